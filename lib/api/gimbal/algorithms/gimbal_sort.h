@@ -1,8 +1,15 @@
 /*! \file
  *  \brief Generialized array sorting algorithms
  *  \ingroup sorting
- *  \todo
- *      - gblSortRadix()
+ *
+ *  gblSortPdq() and gblSortTim() are the general-purpose sorts, for
+ *  elements of any size, with fast paths for 4, 8, and 16-byte elements.
+ *  Neither allocates for small arrays, nor uses stack space proportional
+ *  to the array's size. gblSortQuick() and gblSortMerge() forward to them.
+ *
+ *  gblSortRadix() and gblSortRadixKey() sort by an integral or
+ *  floating-point key without any comparisons at all, in linear time,
+ *  using O(n) temporary heap memory.
  *
  *  \author Falco Girgis
  */
@@ -10,12 +17,30 @@
 #ifndef GIMBAL_SORT_H
 #define GIMBAL_SORT_H
 
-#include "../core/gimbal_decls.h"
+#include "../core/gimbal_result.h"
 
 GBL_DECLS_BEGIN
 
-typedef int  (*GblSortComparatorFn) (const void*, const void*);
-typedef void (*GblSortFn)           (void*, size_t, size_t, GblSortComparatorFn);
+typedef int      (*GblSortComparatorFn) (const void*, const void*);
+typedef void     (*GblSortFn)           (void*, size_t, size_t, GblSortComparatorFn);
+typedef uint64_t (*GblSortKeyFn)        (const void*);
+
+/*! Types of keys which gblSortRadix() can sort elements by
+ *  \ingroup sorting
+ *
+ *  Floating-point keys are ordered from -inf to +inf, with -0.0
+ *  before +0.0, negative NaNs before everything, and positive NaNs
+ *  after everything.
+ */
+GBL_DECLARE_ENUM(GBL_SORT_KEY) {
+    GBL_SORT_KEY_UINT32,    //!< uint32_t key
+    GBL_SORT_KEY_INT32,     //!< int32_t key
+    GBL_SORT_KEY_FLOAT,     //!< float key
+    GBL_SORT_KEY_UINT64,    //!< uint64_t key
+    GBL_SORT_KEY_INT64,     //!< int64_t key
+    GBL_SORT_KEY_DOUBLE,    //!< double key
+    GBL_SORT_KEY_COUNT      //!< Number of key types
+};
 
 /*! \defgroup sorting Sorting
  *  \ingroup algorithms
@@ -28,6 +53,22 @@ GBL_EXPORT void gblSortInsertion (void* pArray, size_t  count, size_t  elemSize,
 GBL_EXPORT void gblSortShell     (void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
 GBL_EXPORT void gblSortMerge     (void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
 GBL_EXPORT void gblSortBubble    (void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
+//! Unstable pattern-defeating quicksort: O(n log n) worst case, O(n) for sorted input, and fast on inputs with many duplicates
+GBL_EXPORT void gblSortPdq       (void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
+//! Stable natural merge sort (timsort): O(n log n) worst case, O(n) for input made of a few sorted runs
+GBL_EXPORT void gblSortTim       (void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
+
+//! Stable radix sort by the key of type \p keyType found \p keyOffset bytes into each element
+GBL_EXPORT GBL_RESULT gblSortRadix    (void*        pArray,
+                                       size_t       count,
+                                       size_t       elemSize,
+                                       size_t       keyOffset,
+                                       GBL_SORT_KEY keyType) GBL_NOEXCEPT;
+//! Stable radix sort by the unsigned key which \p pFnKey returns for each element, called once per element
+GBL_EXPORT GBL_RESULT gblSortRadixKey (void*        pArray,
+                                       size_t       count,
+                                       size_t       elemSize,
+                                       GblSortKeyFn pFnKey) GBL_NOEXCEPT;
 //! @}
 
 GBL_EXPORT size_t gblSearchBinary (void* pSrc, size_t  elemSize, int l, int r, void* pDst, GblSortComparatorFn pFnCmp) GBL_NOEXCEPT;
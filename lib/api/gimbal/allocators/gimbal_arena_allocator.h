@@ -29,6 +29,13 @@ GBL_DECLS_BEGIN
 
 GBL_FORWARD_DECLARE_STRUCT(GblContext);
 
+//! Policies for sizing each new page allocated by a GblArenaAllocator
+GBL_DECLARE_ENUM(GBL_ARENA_GROWTH) {
+    GBL_ARENA_GROWTH_FIXED,         //!< Every new page is GblArenaAllocator::pageSize bytes
+    GBL_ARENA_GROWTH_GEOMETRIC,     //!< Each new page is twice the size of the previous one
+    GBL_ARENA_GROWTH_CAPPED         //!< Geometric growth, until reaching GblArenaAllocator::maxPageSize
+};
+
 /*! \brief Represents a single arena allocation page
  *
  *  GblArenaAllocatorPage is the meta data header and
@@ -80,6 +87,18 @@ GBL_CLASS_DERIVE_EMPTY(GblArenaAllocator, GblObject, GblIAllocator);
  *  new for backing data structures with such allocation
  *  patterns.
  *
+ *  New pages are sized according to the arena's GBL_ARENA_GROWTH
+ *  policy. Any request which wouldn't fit within a fresh page
+ *  is given its own dedicated "large block" page instead, which
+ *  is reclaimed by GblArenaAllocator_freeAll() and
+ *  GblArenaAllocator_loadState() along with regular pages.
+ *
+ *  All statistics are maintained as running totals, so
+ *  querying them is O(1), and GblArenaAllocator_alloc()
+ *  is inlined for the common case where the request fits
+ *  within the active page, only calling out of line when
+ *  a new page is required.
+ *
  *  \note
  *  It's often useful to create the first allocation page
  *  as a static buffer somewhere in a source file, so that
@@ -94,10 +113,20 @@ GBL_INSTANCE_DERIVE(GblArenaAllocator, GblObject)
         GblArenaAllocatorPage* pActivePage; ///< Active (unfilled) page at list head
         GblLinkedListNode      listNode;    ///< Linked list node base
     };
-    GblContext* pCtx;                       ///< Custom context associated with allocator
-    size_t      pageSize;                   ///< Default page size for all new pages
-    size_t      pageAlign;                  ///< Alignment of each page, also maximum requestable alignment
-    size_t      allocCount;                 ///< Total # of allocations across all pages
+    union {
+        GblArenaAllocatorPage* pLargeBlock; ///< Most recent dedicated page for an oversized allocation
+        GblLinkedListNode      largeList;   ///< Linked list of large block pages
+    };
+    GblContext*      pCtx;                  ///< Custom context associated with allocator
+    size_t           pageSize;              ///< Size of the first page allocated
+    size_t           pageAlign;             ///< Alignment of each page
+    GBL_ARENA_GROWTH growth;                ///< Policy for sizing subsequent pages
+    size_t           maxPageSize;           ///< Largest page size for GBL_ARENA_GROWTH_CAPPED
+    size_t           nextPageSize;          ///< Size of the next page to be allocated
+    size_t           allocCount;            ///< Total # of allocations across all pages
+    size_t           pageCount;             ///< Total # of pages, including the active page and large blocks
+    size_t           capacity;              ///< Combined capacity of every page
+    size_t           retiredBytes;          ///< Combined bytes used by every page other than the active page
 GBL_INSTANCE_END
 
 /*! \brief Represents the current state of a GblArenaAllocator
@@ -116,6 +145,7 @@ GBL_INSTANCE_END
  */
 typedef struct GblArenaAllocatorState {
     GblArenaAllocatorPage* pActivePage;
+    GblArenaAllocatorPage* pLargeBlock;
     size_t                 bytesUsed;
 } GblArenaAllocatorState;
 
@@ -126,7 +156,9 @@ GBL_EXPORT GBL_RESULT GblArenaAllocator_construct       (GBL_SELF,
                                                          size_t                 pageSize,
                                                          size_t                 pageAlign,
                                                          GblArenaAllocatorPage* pInitialPage,
-                                                         GblContext*            pCtx)                    GBL_NOEXCEPT;
+                                                         GblContext*            pCtx,
+                                                         GBL_ARENA_GROWTH       growth,
+                                                         size_t                 maxPageSize)             GBL_NOEXCEPT;
 
 GBL_EXPORT GBL_RESULT GblArenaAllocator_destruct        (GBL_SELF)                                       GBL_NOEXCEPT;
 
@@ -145,20 +177,62 @@ GBL_EXPORT void*      GblArenaAllocator_alloc           (GBL_SELF, size_t size,
 GBL_EXPORT GBL_RESULT GblArenaAllocator_freeAll         (GBL_SELF)                                       GBL_NOEXCEPT;
 
 // ===== Macro overloads =====
-#define GblArenaAllocator_construct(...)    GblArenaAllocator_constructDefault_(__VA_ARGS__)
+#define GblArenaAllocator_construct(...)    GBL_VA_OVERLOAD_CALL_ARGC(GblArenaAllocator_construct, __VA_ARGS__)
 #define GblArenaAllocator_alloc(...)        GblArenaAllocator_allocDefault_(__VA_ARGS__)
 
 // ===== IMPL =====
 ///\cond
-#define GblArenaAllocator_constructDefault_(...) \
-    GblArenaAllocator_constructDefault__(__VA_ARGS__, 16, GBL_NULL, GBL_NULL)
-#define GblArenaAllocator_constructDefault__(self, size, align, initial, ctx, ...) \
-    (GblArenaAllocator_construct)(self, size, align, initial, ctx)
+#define GblArenaAllocator_construct_7(self, size, align, initial, ctx, growth, maxSize) \
+    (GblArenaAllocator_construct)(self, size, align, initial, ctx, growth, maxSize)
+#define GblArenaAllocator_construct_6(self, size, align, initial, ctx, growth) \
+    GblArenaAllocator_construct_7(self, size, align, initial, ctx, growth, 0)
+#define GblArenaAllocator_construct_5(self, size, align, initial, ctx) \
+    GblArenaAllocator_construct_6(self, size, align, initial, ctx, GBL_ARENA_GROWTH_FIXED)
+#define GblArenaAllocator_construct_4(self, size, align, initial) \
+    GblArenaAllocator_construct_5(self, size, align, initial, GBL_NULL)
+#define GblArenaAllocator_construct_3(self, size, align) \
+    GblArenaAllocator_construct_4(self, size, align, GBL_NULL)
+#define GblArenaAllocator_construct_2(self, size) \
+    GblArenaAllocator_construct_3(self, size, 16)
 
 #define GblArenaAllocator_allocDefault_(...) \
     GblArenaAllocator_allocDefault__(__VA_ARGS__, 0)
 #define GblArenaAllocator_allocDefault__(self, size, align, ...) \
-    (GblArenaAllocator_alloc)(self, size, align)
+    GblArenaAllocator_allocInline_(self, size, align)
+
+// Bumps the given page for an allocation, returning NULL if it doesn't fit
+GBL_INLINE void* GblArenaAllocator_place_(GblArenaAllocatorPage* pPage,
+                                          size_t                 size,
+                                          size_t                 alignment) GBL_NOEXCEPT
+{
+    const uintptr_t base    = (uintptr_t)pPage->bytes;
+    const uintptr_t aligned = (base + pPage->used + alignment - 1) & ~(uintptr_t)(alignment - 1);
+    const size_t    offset  = (size_t)(aligned - base);
+
+    if(offset > pPage->capacity || size > pPage->capacity - offset)
+        return GBL_NULL;
+
+    pPage->used = offset + size;
+    return (void*)aligned;
+}
+
+// Fast path for allocating from the active page, falling back to GblArenaAllocator_alloc()
+GBL_INLINE void* GblArenaAllocator_allocInline_(GBL_SELF, size_t size, size_t alignment) GBL_NOEXCEPT {
+    GblArenaAllocatorPage* pPage = pSelf->pActivePage;
+
+    if(!alignment) alignment = GBL_ALIGNOF(GBL_MAX_ALIGN_T);
+
+    if(size && pPage != (GblArenaAllocatorPage*)&pSelf->listNode) GBL_LIKELY {
+        void* pData = GblArenaAllocator_place_(pPage, size, alignment);
+
+        if(pData) GBL_LIKELY {
+            ++pSelf->allocCount;
+            return pData;
+        }
+    }
+
+    return (GblArenaAllocator_alloc)(pSelf, size, alignment);
+}
 ///\endcond
 GBL_DECLS_END
 
@@ -0,0 +1,91 @@
+/*! \file
+ *  \brief GblConcurrentPoolAllocator thread-caching pool allocator + API
+ *  \ingroup allocators
+ *  \copydoc GblConcurrentPoolAllocator
+ *
+ *  \author Falco Girgis
+ */
+
+#ifndef GIMBAL_CONCURRENT_POOL_ALLOCATOR_H
+#define GIMBAL_CONCURRENT_POOL_ALLOCATOR_H
+
+#include "gimbal_pool_allocator.h"
+
+#define GBL_SELF_TYPE GblConcurrentPoolAllocator
+
+GBL_DECLS_BEGIN
+
+GBL_FORWARD_DECLARE_STRUCT(GblConcurrentPoolDepot_);
+
+/*! \brief Thread-safe pool allocator with per-thread caches
+ *
+ *  GblConcurrentPoolAllocator is a variant of GblPoolAllocator
+ *  which may be shared between any number of threads without
+ *  any external locking.
+ *
+ *  Each thread allocates from and frees to its own cache of
+ *  free entries, consisting of two "magazines" of up to
+ *  GblConcurrentPoolAllocator::magazineSize entries each, so
+ *  the common case touches no shared state at all. When both
+ *  of a thread's magazines run empty or full, an entire
+ *  magazine is exchanged with a shared depot of full magazines
+ *  using lock-free transfers. Only when the depot itself runs
+ *  dry or overflows is the backing GblPoolAllocator locked.
+ *
+ *  Entries are interchangeable, so an entry allocated on one
+ *  thread may be freed on any other. When a thread exits, its
+ *  cached entries are returned to the depot for use by the
+ *  remaining threads.
+ *
+ *  \note
+ *  Only the allocator itself is thread-safe. Construction and
+ *  destruction must not race with any other operation.
+ *
+ *  \ingroup allocators
+ *  \sa GblPoolAllocator
+ */
+typedef struct GblConcurrentPoolAllocator {
+    GBL_PRIVATE_BEGIN
+        GblConcurrentPoolDepot_* pDepot;    ///< Shared depot and backing pool
+    GBL_PRIVATE_END
+    size_t      entrySize;                  ///< Base struct size of each entry
+    size_t      entryAlign;                 ///< Alignment requirement for each entry
+    size_t      magazineSize;               ///< Number of entries moved per depot transfer
+    size_t      magazineCount;              ///< Number of magazines the depot can hold
+    GblContext* pCtx;                       ///< Custom context associated with the allocator
+} GblConcurrentPoolAllocator;
+
+// ===== Public methods =====
+GBL_EXPORT GBL_RESULT GblConcurrentPoolAllocator_construct     (GBL_SELF,
+                                                                size_t      entrySize,
+                                                                size_t      entriesPerPage,
+                                                                size_t      entryAlign/*=0*/,
+                                                                size_t      magazineSize/*=0*/,
+                                                                size_t      magazineCount/*=0*/,
+                                                                GblContext* pCtx/*=NULL*/)  GBL_NOEXCEPT;
+
+GBL_EXPORT GBL_RESULT GblConcurrentPoolAllocator_destruct      (GBL_SELF)                   GBL_NOEXCEPT;
+
+GBL_EXPORT void*      GblConcurrentPoolAllocator_new           (GBL_SELF)                   GBL_NOEXCEPT;
+GBL_EXPORT GBL_RESULT GblConcurrentPoolAllocator_delete        (GBL_SELF, void* pEntry)     GBL_NOEXCEPT;
+
+GBL_EXPORT size_t     GblConcurrentPoolAllocator_activeEntries (GBL_CSELF)                  GBL_NOEXCEPT;
+GBL_EXPORT size_t     GblConcurrentPoolAllocator_depotSize     (GBL_CSELF)                  GBL_NOEXCEPT;
+
+// ===== Macro Overloads =====
+#define GblConcurrentPoolAllocator_construct(...) \
+    GblConcurrentPoolAllocator_constructDefault_(__VA_ARGS__)
+
+// ===== IMPL =====
+
+///\cond
+#define GblConcurrentPoolAllocator_constructDefault_(...) \
+    GblConcurrentPoolAllocator_constructDefault__(__VA_ARGS__, 0, 0, 0, GBL_NULL)
+#define GblConcurrentPoolAllocator_constructDefault__(self, size, perPage, align, magSize, magCount, ctx, ...) \
+    (GblConcurrentPoolAllocator_construct)(self, size, perPage, align, magSize, magCount, ctx)
+///\endcond
+GBL_DECLS_END
+
+#undef GBL_SELF_TYPE
+
+#endif // GIMBAL_CONCURRENT_POOL_ALLOCATOR_H
@@ -0,0 +1,125 @@
+/*! \file
+ *  \brief GblConcurrentRingBuffer lock-free bounded queue and related functions
+ *  \ingroup containers
+ *  \copydoc GblConcurrentRingBuffer
+ *
+ *  \author Falco Girgis
+ */
+
+#ifndef GIMBAL_CONCURRENT_RING_BUFFER_H
+#define GIMBAL_CONCURRENT_RING_BUFFER_H
+
+#include "../core/gimbal_typedefs.h"
+#include "../core/gimbal_ctx.h"
+
+#define GBL_SELF_TYPE GblConcurrentRingBuffer
+
+GBL_DECLS_BEGIN
+
+GBL_FORWARD_DECLARE_STRUCT(GblConcurrentRingBufferState_);
+
+//! Thread-safety guarantees provided by a GblConcurrentRingBuffer
+GBL_DECLARE_ENUM(GBL_CONCURRENT_RING_BUFFER_MODE) {
+    GBL_CONCURRENT_RING_BUFFER_MPMC,    //!< Any number of producer threads and consumer threads
+    GBL_CONCURRENT_RING_BUFFER_SPSC     //!< Exactly one producer thread and one consumer thread
+};
+
+/*! \brief Lock-free, fixed-capacity queue for passing elements between threads
+ *
+ *  GblConcurrentRingBuffer is the thread-safe counterpart to
+ *  GblRingBuffer: a bounded FIFO of untyped, fixed-size elements
+ *  which may be pushed and popped concurrently without any
+ *  external locking.
+ *
+ *  Unlike GblRingBuffer, a full buffer never overwrites its
+ *  oldest values. Instead, pushing to a full buffer or popping
+ *  from an empty one fails immediately, returning GBL_FALSE,
+ *  so that the caller may decide whether to spin, yield, or
+ *  back off.
+ *
+ *  Two modes are supported:
+ *  - GBL_CONCURRENT_RING_BUFFER_MPMC: each slot carries a
+ *    sequence number, so that producers and consumers claim
+ *    slots with a single compare-and-swap on a shared index,
+ *    then publish them independently of one another.
+ *  - GBL_CONCURRENT_RING_BUFFER_SPSC: the single producer and
+ *    single consumer each own one index, so no read-modify-write
+ *    operations are required at all.
+ *
+ *  The batch operations, GblConcurrentRingBuffer_pushBackMany()
+ *  and GblConcurrentRingBuffer_popFrontMany(), transfer as many
+ *  elements as are available with a single claim, amortizing
+ *  the cost of synchronization across the entire batch.
+ *
+ *  \note
+ *  The capacity is rounded up to the next power of two. Only the
+ *  queue operations are thread-safe: construction and destruction
+ *  must not race with any other operation.
+ *
+ *  \ingroup containers
+ *  \sa GblRingBuffer
+ */
+typedef struct GblConcurrentRingBuffer {
+    GBL_PRIVATE_BEGIN
+        GblConcurrentRingBufferState_*  pState;
+        GblContext*                     pCtx;
+        uint8_t*                        pData;
+        size_t                          capacity;
+        size_t                          elementSize;
+        GBL_CONCURRENT_RING_BUFFER_MODE mode;
+    GBL_PRIVATE_END
+} GblConcurrentRingBuffer;
+
+GBL_EXPORT GBL_RESULT  GblConcurrentRingBuffer_construct_5 (GBL_SELF,
+                                                            size_t                          elementSize,
+                                                            size_t                          capacity,
+                                                            GBL_CONCURRENT_RING_BUFFER_MODE mode,
+                                                            GblContext*                     pCtx)           GBL_NOEXCEPT;
+
+GBL_EXPORT GBL_RESULT  GblConcurrentRingBuffer_construct_4 (GBL_SELF,
+                                                            size_t                          elementSize,
+                                                            size_t                          capacity,
+                                                            GBL_CONCURRENT_RING_BUFFER_MODE mode)           GBL_NOEXCEPT;
+
+GBL_EXPORT GBL_RESULT  GblConcurrentRingBuffer_construct_3 (GBL_SELF,
+                                                            size_t                          elementSize,
+                                                            size_t                          capacity)       GBL_NOEXCEPT;
+
+#define                GblConcurrentRingBuffer_construct(...)  GBL_VA_OVERLOAD_CALL(GblConcurrentRingBuffer_construct, \
+                                                                                    GBL_VA_OVERLOAD_SUFFIXER_ARGC,     \
+                                                                                    __VA_ARGS__)
+
+GBL_EXPORT GBL_RESULT  GblConcurrentRingBuffer_destruct     (GBL_SELF)                                      GBL_NOEXCEPT;
+
+GBL_EXPORT GblContext* GblConcurrentRingBuffer_context      (GBL_CSELF)                                     GBL_NOEXCEPT;
+GBL_EXPORT size_t      GblConcurrentRingBuffer_capacity     (GBL_CSELF)                                     GBL_NOEXCEPT;
+GBL_EXPORT size_t      GblConcurrentRingBuffer_elementSize  (GBL_CSELF)                                     GBL_NOEXCEPT;
+GBL_EXPORT GBL_CONCURRENT_RING_BUFFER_MODE
+                       GblConcurrentRingBuffer_mode         (GBL_CSELF)                                     GBL_NOEXCEPT;
+
+//! Returns a snapshot of the number of elements, which may already be stale while other threads are active
+GBL_EXPORT size_t      GblConcurrentRingBuffer_size         (GBL_CSELF)                                     GBL_NOEXCEPT;
+GBL_EXPORT GblBool     GblConcurrentRingBuffer_empty        (GBL_CSELF)                                     GBL_NOEXCEPT;
+GBL_EXPORT GblBool     GblConcurrentRingBuffer_full         (GBL_CSELF)                                     GBL_NOEXCEPT;
+
+//! Copies a single element into the back of the buffer, returning GBL_FALSE if it was full
+GBL_EXPORT GblBool     GblConcurrentRingBuffer_pushBack     (GBL_SELF, const void* pData)                   GBL_NOEXCEPT;
+//! Claims the next slot at the back of the buffer to be filled in-place, returning NULL if it was full
+GBL_EXPORT void*       GblConcurrentRingBuffer_emplaceBack  (GBL_SELF)                                      GBL_NOEXCEPT;
+/*! Publishes a slot returned by GblConcurrentRingBuffer_emplaceBack() to consumers once it has been filled
+ *  \note In SPSC mode, each emplaced slot must be committed before another element may be pushed.
+ */
+GBL_EXPORT void        GblConcurrentRingBuffer_commitBack   (GBL_SELF, void* pSlot)                         GBL_NOEXCEPT;
+//! Copies the front element into \p pData and removes it, returning GBL_FALSE if the buffer was empty
+GBL_EXPORT GblBool     GblConcurrentRingBuffer_popFront     (GBL_SELF, void* pData)                         GBL_NOEXCEPT;
+
+//! Pushes up to \p count contiguous elements from \p pData with a single claim, returning how many were pushed
+GBL_EXPORT size_t      GblConcurrentRingBuffer_pushBackMany (GBL_SELF, const void* pData, size_t count)     GBL_NOEXCEPT;
+//! Pops up to \p count elements into the contiguous array, \p pData, with a single claim, returning how many were popped
+GBL_EXPORT size_t      GblConcurrentRingBuffer_popFrontMany (GBL_SELF, void* pData, size_t count)           GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#undef GBL_SELF_TYPE
+
+#endif // GIMBAL_CONCURRENT_RING_BUFFER_H
@@ -25,9 +25,23 @@ typedef GblBool (*GblHashSetIterFn)(GBL_CSELF, void*, void*);             ///< U
 
 /*! \brief Hash-table based abstract associative container with C++-style STL std::unoredered_set API
  *  \details
- *  GblHashSet uses open-addressing ans is implemented using a Robin Hood hashing algorithm.
- *  Using it requires providing a custom hasher function (which typically uses one of
- *  the libGimbal hashing algorithms such as gblHashMurmur()) as well as a custom comparator function.
+ *  GblHashSet uses open-addressing and is implemented as a "Swiss table." Using it requires
+ *  providing a custom hasher function (which typically uses one of the libGimbal hashing
+ *  algorithms such as gblHashMurmur()) as well as a custom comparator function.
+ *
+ *  Entries are stored inline within a flat array of buckets, alongside a separate array of
+ *  one-byte control words: one per bucket, holding a 7-bit fingerprint of its entry's hash
+ *  or marking it as empty or deleted. Lookups scan the control words of 16 buckets at a
+ *  time (with SSE2, when available) and only visit the buckets whose fingerprints match,
+ *  so the entries themselves are rarely touched other than to compare the one being
+ *  searched for. Entries never move, except when the table is resized.
+ *
+ *  When the number of entries is known up-front, GblHashSet_reserve() sizes the table for
+ *  them with a single allocation, and GblHashSet_insertMany() does the same for an array
+ *  of entries before hashing and placing them in batches. GblHashSet_rehash() rebuilds the
+ *  table with a given number of buckets, which lets the caller pick a lower load factor
+ *  (bucketCount = size / loadFactor) than the maximum of 7/8, trading memory for shorter
+ *  probe sequences.
  *
  *  \note
  *  Performance is pretty darn good. Read speed is faster than both C++'s std::unordered_pSelf and
@@ -49,6 +63,8 @@ typedef struct GblHashSet {
         size_t             count;
         size_t             mask;
         void*              pBuckets;
+        int8_t*            pCtrl;
+        size_t             growthLeft;
         void*              pSpare;
         void*              pUserdata;
     GBL_PRIVATE_END
@@ -124,6 +140,9 @@ GBL_EXPORT GblHashSetIter    GblHashSet_find          (GBL_CSELF, const void* pK
 
 GBL_EXPORT void*             GblHashSet_set           (GBL_SELF, const void* pEntry)    GBL_NOEXCEPT; //raw set, returns existing item w/o deleting
 GBL_EXPORT GblBool           GblHashSet_insert        (GBL_SELF, const void* pEntry)    GBL_NOEXCEPT; //throws duplicate error
+GBL_EXPORT size_t            GblHashSet_insertMany    (GBL_SELF,
+                                                       const void* pEntries,
+                                                       size_t      count)               GBL_NOEXCEPT; //inserts array, returns # of new entries
 GBL_EXPORT void              GblHashSet_insertOrAssign(GBL_SELF, const void* pEntry)    GBL_NOEXCEPT; //deletes any overwritten value
 GBL_EXPORT void*             GblHashSet_emplace       (GBL_SELF, const void* pKey)      GBL_NOEXCEPT; //throws duplicate error
 GBL_EXPORT void*             GblHashSet_tryEmplace    (GBL_SELF, const void* pKey)      GBL_NOEXCEPT; //gracefully returns NULL if already exists
@@ -132,6 +151,8 @@ GBL_EXPORT GblBool           GblHashSet_erase         (GBL_SELF, const void* pKe
 GBL_EXPORT void*             GblHashSet_extract       (GBL_SELF, const void* pKey)      GBL_NOEXCEPT; //removes entry, no deletion, not found is fine
 GBL_EXPORT void              GblHashSet_clear         (GBL_SELF)                        GBL_NOEXCEPT; //deletes entries
 
+GBL_EXPORT GBL_RESULT        GblHashSet_reserve       (GBL_SELF, size_t count)          GBL_NOEXCEPT; //room for count entries without growing
+GBL_EXPORT GBL_RESULT        GblHashSet_rehash        (GBL_SELF, size_t bucketCount)    GBL_NOEXCEPT; //rebuilds with at least bucketCount buckets
 GBL_EXPORT GBL_RESULT        GblHashSet_shrinkToFit   (GBL_SELF)                        GBL_NOEXCEPT;
 
 GBL_EXPORT void*             GblHashSet_probe         (GBL_CSELF, size_t  position)     GBL_NOEXCEPT; //returns entry at slot or NULL, sparse
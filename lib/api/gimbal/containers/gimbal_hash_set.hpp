@@ -212,6 +212,9 @@ public:
     pointer     extract         (const key_type& key) noexcept;
     void        clear           (void) noexcept;
 
+    void        reserve         (size_type count);
+    void        rehash          (size_type bucketCount);
+
     template<typename... Args>
     bool        emplace         (const key_type& key, Args&&... args);   //needs to throw exception
     template<typename... Args>
@@ -600,6 +603,16 @@ inline void HashSet<K, H, P>::clear(void) noexcept {
     GblHashSet_clear(this);
 }
 
+template<typename K, typename H, typename P>
+inline void HashSet<K, H, P>::reserve(size_type count) {
+    Exception::checkThrow(GblHashSet_reserve(this, count));
+}
+
+template<typename K, typename H, typename P>
+inline void HashSet<K, H, P>::rehash(size_type bucketCount) {
+    Exception::checkThrow(GblHashSet_rehash(this, bucketCount));
+}
+
 template<typename K, typename H, typename P>
 inline auto HashSet<K, H, P>::probe(size_type position) noexcept -> pointer {
     return reinterpret_cast<pointer>(GblHashSet_probe(this, position));
@@ -45,4 +45,13 @@
 #endif
 #endif
 
+// Declares a value of the given type which is shared between threads and only accessed atomically
+#ifdef __cplusplus
+#   include <atomic>
+#   define GBL_ATOMIC(type)                    std::atomic<type>
+#else
+#   include <stdatomic.h>
+#   define GBL_ATOMIC(type)                    _Atomic(type)
+#endif
+
 #endif // GIMBAL_ATOMICS_H
@@ -592,6 +592,80 @@ GBL_MAYBE_UNUSED GBL_CTX_INLINE(LOG, GBL_RESULT, GblFlags level, const char* pFm
 #define GBL_CTX_BLOCK(...) \
     GBL_VA_OVERLOAD_SELECT(GBL_CTX_BLOCK, GBL_VA_OVERLOAD_SUFFIXER_ARGC, GBL_SRC_FILE, GBL_SRC_FN, GBL_SRC_LN, __VA_ARGS__)(GBL_SRC_FILE, GBL_SRC_FN, GBL_SRC_LN, __VA_ARGS__)
 
+// ================= LIGHTWEIGHT LEAF FRAMES ==============
+/* Opt-in alternative to GBL_CTX_BEGIN()/GBL_CTX_END() for small functions
+ * which call nothing else that records errors. A leaf frame is a local
+ * GblLeafFrame holding only a result and source location: it is never pushed
+ * onto the GblThd, and a message is only formatted into the thread's last
+ * record (then logged and reported to the context) once a check fails.
+ * Unlike a regular frame, returning successfully leaves a previous error in
+ * the thread's last record untouched.
+ */
+
+#define GBL_CTX_LEAF_RESULT()   (GBL_CTX_LEAF_FRAME_NAME).result
+#define GBL_CTX_LEAF_SOURCE()   (GBL_CTX_LEAF_FRAME_NAME).srcLocation
+
+#define GBL_CTX_LEAF_BEGIN()                                    \
+    GblLeafFrame GBL_CTX_LEAF_FRAME_NAME = {                    \
+        { GBL_NULL, GBL_NULL, 0 }, GBL_RESULT_SUCCESS           \
+    }
+
+#define GBL_CTX_LEAF_VERIFY_(expr, result, srcLoc, ...)                         \
+    GBL_STMT_START {                                                            \
+        if(!(expr)) GBL_UNLIKELY {                                              \
+            GblContext_leafRecordSet_(&GBL_CTX_LEAF_FRAME_NAME,                 \
+                                      srcLoc, result, __VA_ARGS__);             \
+            goto GBL_CTX_LEAF_END_LABEL;                                        \
+        }                                                                       \
+    } GBL_STMT_END
+
+#define GBL_CTX_LEAF_VERIFY_N(srcLoc, expr, result, ...) \
+    GBL_CTX_LEAF_VERIFY_(expr, result, srcLoc, __VA_ARGS__)
+
+#define GBL_CTX_LEAF_VERIFY_3(srcLoc, expr, result) \
+    GBL_CTX_LEAF_VERIFY_N(srcLoc, expr, result, "%s", gblResultString(result))
+
+#define GBL_CTX_LEAF_VERIFY(...)                                                                                        \
+    GBL_STMT_START {                                                                                                    \
+        const GblSrcLoc src_ = GBL_SRC_LOC(GBL_SRC_FILE, GBL_SRC_FN, GBL_SRC_LN);                                       \
+        GBL_VA_OVERLOAD_SELECT(GBL_CTX_LEAF_VERIFY, GBL_VA_OVERLOAD_SUFFIXER_3_N, src_, __VA_ARGS__)(src_, __VA_ARGS__);\
+    } GBL_STMT_END
+
+#define GBL_CTX_LEAF_VERIFY_ARG_N(srcLoc, expr, ...) \
+    GBL_CTX_LEAF_VERIFY_(expr, GBL_RESULT_ERROR_INVALID_ARG, srcLoc, __VA_ARGS__)
+
+#define GBL_CTX_LEAF_VERIFY_ARG_2(src, expr) \
+    GBL_CTX_LEAF_VERIFY_ARG_N(src, expr, "Invalid Arg: "#expr)
+
+#define GBL_CTX_LEAF_VERIFY_ARG(...)                                                                                        \
+    GBL_STMT_START {                                                                                                        \
+        const GblSrcLoc src_ = GBL_SRC_LOC(GBL_SRC_FILE, GBL_SRC_FN, GBL_SRC_LN);                                           \
+        GBL_VA_OVERLOAD_SELECT(GBL_CTX_LEAF_VERIFY_ARG, GBL_VA_OVERLOAD_SUFFIXER_2_N, src_, __VA_ARGS__)(src_, __VA_ARGS__);\
+    } GBL_STMT_END
+
+#define GBL_CTX_LEAF_VERIFY_POINTER_N(srcLoc, expr, ...) \
+    GBL_CTX_LEAF_VERIFY_(expr, GBL_RESULT_ERROR_INVALID_POINTER, srcLoc, __VA_ARGS__)
+
+#define GBL_CTX_LEAF_VERIFY_POINTER_2(src, expr) \
+    GBL_CTX_LEAF_VERIFY_POINTER_N(src, expr, "Invalid Pointer")
+
+#define GBL_CTX_LEAF_VERIFY_POINTER(...)                                                                                        \
+    GBL_STMT_START {                                                                                                            \
+        const GblSrcLoc src_ = GBL_SRC_LOC(GBL_SRC_FILE, GBL_SRC_FN, GBL_SRC_LN);                                               \
+        GBL_VA_OVERLOAD_SELECT(GBL_CTX_LEAF_VERIFY_POINTER, GBL_VA_OVERLOAD_SUFFIXER_2_N, src_, __VA_ARGS__)(src_, __VA_ARGS__);\
+    } GBL_STMT_END
+
+#define GBL_CTX_LEAF_DONE() \
+    goto GBL_CTX_LEAF_END_LABEL
+
+#define GBL_CTX_LEAF_END_BLOCK()                \
+    goto GBL_CTX_LEAF_END_LABEL;                \
+    GBL_LABEL_EMPTY(GBL_CTX_LEAF_END_LABEL)
+
+#define GBL_CTX_LEAF_END()                      \
+    GBL_CTX_LEAF_END_BLOCK();                   \
+    return GBL_CTX_LEAF_RESULT()
+
 GBL_DECLS_END
 
 #endif // GIMBAL_API_H
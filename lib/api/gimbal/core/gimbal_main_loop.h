@@ -1,8 +1,25 @@
 /*! \file
  *  \brief GblMainLoop task scheduler priority queue
  *  \ingroup core
+ *
+ *  GblMainLoop is a task scheduler with two execution
+ *  domains:
+ *      - a set of per-priority FIFO queues, which are drained
+ *        sequentially by the thread calling GblMainLoop_exec()
+ *        or GblMainLoop_iteration(), highest priority first
+ *      - an optional pool of GblThread workers which execute
+ *        dispatched tasks concurrently
+ *
+ *  Each worker owns a lock-free work-stealing deque. Tasks
+ *  dispatched from a worker go onto its own deque, while tasks
+ *  dispatched from any other thread are pushed onto a worker's
+ *  lock-free submission stack in round-robin order. Idle
+ *  workers steal from the others, so no global lock is taken
+ *  when dispatching or executing tasks.
+ *
  *  \todo
- *   - implement me
+ *   - task timeouts
+ *   - priorities within the worker pool
  *
  *   \author    2023 Falco Girgis
  *   \copyright MIT License
@@ -13,7 +30,17 @@
 
 #include "../meta/instances/gimbal_object.h"
 #include "../meta/signals/gimbal_signal.h"
-#include "../containers/gimbal_linked_list.h"
+#include "../containers/gimbal_doubly_linked_list.h"
+
+/*! \name Type System
+ *  \brief Type UUID and cast operators
+ *  @{
+ */
+#define GBL_MAIN_LOOP_TYPE              (GBL_TYPEID(GblMainLoop))            //!< Type UUID for GblMainLoop
+#define GBL_MAIN_LOOP(self)             (GBL_CAST(GblMainLoop, self))        //!< Function-style GblInstance cast
+#define GBL_MAIN_LOOP_CLASS(klass)      (GBL_CLASS_CAST(GblMainLoop, klass)) //!< Function-style GblClass cast
+#define GBL_MAIN_LOOP_GET_CLASS(self)   (GBL_CLASSOF(GblMainLoop, self))     //!< Get GblMainLoopClass from GblInstance
+//! @}
 
 #define GBL_SELF_TYPE GblMainLoop
 
@@ -22,7 +49,7 @@ GBL_DECLS_BEGIN
 GBL_FORWARD_DECLARE_STRUCT(GblTask);
 GBL_FORWARD_DECLARE_STRUCT(GblMainLoop);
 
-//! Enumeration for
+//! Enumeration for the priority levels of the queues of a GblMainLoop
 typedef enum GBL_PRIORITY_LEVEL {
     GBL_PRIORITY_IDLE,
     GBL_PRIORITY_HIGH_IDLE,
@@ -36,7 +63,8 @@ typedef enum GBL_PRIORITY_LEVEL {
  *  \extends GblObjectClass
  *  \brief   GblClass VTable structure for GblMainLoop
  *
- *  WIP
+ *  Provides overridable hooks for each of the
+ *  scheduling events of the loop's priority queues.
  *
  *  \sa GblMainLoop
  */
@@ -47,42 +75,70 @@ GBL_CLASS_DERIVE(GblMainLoop, GblObject)
     GBL_RESULT (*pFnExecIdle)   (GBL_SELF);
 GBL_CLASS_END
 
-// Needs a context with queue
 /*! \struct  GblMainLoop
  *  \extends GblObject
- *  \brief   Sequentially executing priority queue of GblTask objects
- *
- *  WIP
+ *  \brief   Priority queue of GblTask objects with a work-stealing worker pool
  *
  *  \sa GblMainLoopClass
  */
 GBL_INSTANCE_DERIVE(GblMainLoop, GblObject)
-    union {
-        GblTask*           pHead;
-        GblLinkedListNode  listNode;
-    }                  taskQueue[GBL_PRIORITY_COUNT];
-    size_t             taskCount;
-    uint32_t           taskBitMap;
-    GblTask*           pActiveTask;
-    GBL_PRIORITY_LEVEL prevTaskPriority;
+    GblDoublyLinkedListNode taskQueue[GBL_PRIORITY_COUNT]; //!< FIFO queue of pending tasks per priority
+    size_t                  taskCount;                     //!< Total number of tasks within taskQueue
+    uint32_t                taskBitMap;                    //!< Bit N is set when taskQueue[N] is non-empty
+    GblTask*                pActiveTask;                   //!< Task currently executing from taskQueue
+    GBL_PRIORITY_LEVEL      prevTaskPriority;              //!< Priority of the last executed task
 GBL_INSTANCE_END
 
 GBL_SIGNALS(GblMainLoop,
-    (execIdle,     GBL_INSTANCE_TYPE),
-    (taskEnqueued, GBL_INSTANCE_TYPE, GBL_INSTANCE_TYPE)
+    (execIdle,     (GBL_INSTANCE_TYPE, pReceiver)),
+    (taskEnqueued, (GBL_INSTANCE_TYPE, pReceiver), (GBL_TASK_TYPE, pTask))
 )
 
-GBL_EXPORT GblType    GblMainLoop_type    (void) GBL_NOEXCEPT;
+//! Returns the GblType UUID associated with GblMainLoop
+GBL_EXPORT GblType    GblMainLoop_type      (void)                      GBL_NOEXCEPT;
+
+/*! \name  Priority Queues
+ *  \brief Methods for sequential execution on the loop's thread
+ *  \relatesalso GblMainLoop
+ *  @{
+ */
+//! Appends \p pTask to the queue matching its GblTask_priority()
+GBL_EXPORT GBL_RESULT GblMainLoop_enqueue   (GBL_SELF, GblTask* pTask)  GBL_NOEXCEPT;
+//! Removes a queued \p pTask from the loop without executing it
+GBL_EXPORT GBL_RESULT GblMainLoop_cancel    (GBL_SELF, GblTask* pTask)  GBL_NOEXCEPT;
+//! Returns the next task to be executed, or NULL if the queues are empty
+GBL_EXPORT GblTask*   GblMainLoop_top       (GBL_CSELF)                 GBL_NOEXCEPT;
+//! Returns the total number of tasks pending within the queues
+GBL_EXPORT size_t     GblMainLoop_depth     (GBL_CSELF)                 GBL_NOEXCEPT;
 
-GBL_EXPORT GBL_RESULT GblMainLoop_enqueue (GBL_SELF, GblTask* pTask) GBL_NOEXCEPT;
-GBL_EXPORT GBL_RESULT GblMainLoop_cancel  (GBL_SELF, GblTask* pTask) GBL_NOEXCEPT;
-GBL_EXPORT GblTask*   GblMainLoop_top     (GBL_CSELF)                GBL_NOEXCEPT;
-GBL_EXPORT size_t     GblMainLoop_depth   (GBL_CSELF)                GBL_NOEXCEPT;
+//! Executes the highest priority pending task, or the idle handler when there are none
+GBL_EXPORT GBL_RESULT GblMainLoop_iteration (GBL_SELF)                  GBL_NOEXCEPT;
+//! Runs GblMainLoop_iteration() repeatedly until GblMainLoop_stop() is called
+GBL_EXPORT GBL_RESULT GblMainLoop_exec      (GBL_SELF)                  GBL_NOEXCEPT;
+//! Requests that a running GblMainLoop_exec() return after its current iteration
+GBL_EXPORT GBL_RESULT GblMainLoop_stop      (GBL_SELF)                  GBL_NOEXCEPT;
+//! Returns GBL_TRUE while GblMainLoop_exec() is running
+GBL_EXPORT GblBool    GblMainLoop_isRunning (GBL_CSELF)                 GBL_NOEXCEPT;
+//! @}
 
-GBL_EXPORT GBL_RESULT GblMainLoop_iteration (GBL_SELF)  GBL_NOEXCEPT;
-GBL_EXPORT GBL_RESULT GblMainLoop_exec      (GBL_SELF)  GBL_NOEXCEPT;
-GBL_EXPORT GBL_RESULT GblMainLoop_stop      (GBL_SELF)  GBL_NOEXCEPT;
-GBL_EXPORT GblBool    GblMainLoop_isRunning (GBL_CSELF) GBL_NOEXCEPT;
+/*! \name  Worker Pool
+ *  \brief Methods for concurrent execution on worker threads
+ *  \relatesalso GblMainLoop
+ *  @{
+ */
+//! Spawns \p count GblThread workers, each with its own work-stealing deque
+GBL_EXPORT GBL_RESULT GblMainLoop_startWorkers (GBL_SELF, size_t count) GBL_NOEXCEPT;
+//! Waits for all dispatched tasks to complete, then joins and destroys the workers
+GBL_EXPORT GBL_RESULT GblMainLoop_stopWorkers  (GBL_SELF)               GBL_NOEXCEPT;
+//! Returns the number of worker threads currently owned by the loop
+GBL_EXPORT size_t     GblMainLoop_workerCount  (GBL_CSELF)              GBL_NOEXCEPT;
+//! Returns the number of dispatched tasks which have not yet finished executing
+GBL_EXPORT size_t     GblMainLoop_pending      (GBL_CSELF)              GBL_NOEXCEPT;
+//! Schedules \p pTask on the worker pool, or onto the priority queues if there are no workers
+GBL_EXPORT GBL_RESULT GblMainLoop_dispatch     (GBL_SELF, GblTask* pTask) GBL_NOEXCEPT;
+//! Blocks until every dispatched task has completed, helping execute them while waiting
+GBL_EXPORT GBL_RESULT GblMainLoop_wait         (GBL_SELF)               GBL_NOEXCEPT;
+//! @}
 
 GBL_DECLS_END
 
@@ -43,6 +43,12 @@ typedef struct GblStackFrame {
     struct GblStackFrame*   pPrevFrame;
 } GblStackFrame;
 
+//! Lightweight frame of a leaf function, from GBL_CTX_LEAF_BEGIN() to GBL_CTX_LEAF_END(), which is never pushed
+typedef struct GblLeafFrame {
+    GblSourceLocation   srcLocation;
+    GBL_RESULT          result;
+} GblLeafFrame;
+
 // ===== Public API =====
 GBL_INLINE void       GblCallRecord_construct (GblCallRecord*    pRecord,
                                                GBL_RESULT        resultCode,
@@ -97,6 +103,11 @@ GBL_EXPORT GBL_RESULT     GblContext_callRecordSet_ (GblContext* pSelf,
                                                      const GblStackFrame* pFrame,
                                                      const GblCallRecord* pRecord)    GBL_NOEXCEPT;
 
+GBL_EXPORT GBL_RESULT     GblContext_leafRecordSet_ (GblLeafFrame*        pFrame,
+                                                     GblSourceLocation    source,
+                                                     GBL_RESULT           result,
+                                                     const char*          pFmt, ...)  GBL_NOEXCEPT;
+
 ///\endcond
 
 GBL_INLINE void GblCallRecord_construct(GblCallRecord* pRecord, GBL_RESULT resultCode, GblSourceLocation source, const char* pFmt, ...) GBL_NOEXCEPT {
@@ -2,16 +2,38 @@
  *  \brief GblTask high-level concurrent runnable object
  *  \ingroup core
  *
+ *  GblTask is the unit of work which is scheduled by a
+ *  GblMainLoop, either sequentially on the loop's own
+ *  priority queues or concurrently on its worker pool.
+ *
+ *  \note
+ *  A GblMainLoop does NOT take ownership of a task while
+ *  it's queued. The caller is responsible for keeping the
+ *  task alive until it has finished or been canceled.
+ *
  *  \todo
- *   - implement me (designing API currently, unimplemented)
+ *   - timeouts
  *
- *   \author Falco Girgis
+ *   \author 2023 Falco Girgis
+ *   \copyright MIT License
  */
 
 #ifndef GIMBAL_TASK_H
 #define GIMBAL_TASK_H
 
 #include "../meta/instances/gimbal_object.h"
+#include "../containers/gimbal_doubly_linked_list.h"
+#include "gimbal_atomics.h"
+
+/*! \name Type System
+ *  \brief Type UUID and cast operators
+ *  @{
+ */
+#define GBL_TASK_TYPE               (GBL_TYPEID(GblTask))            //!< Type UUID for GblTask
+#define GBL_TASK(self)              (GBL_CAST(GblTask, self))        //!< Function-style GblInstance cast
+#define GBL_TASK_CLASS(klass)       (GBL_CLASS_CAST(GblTask, klass)) //!< Function-style GblClass cast
+#define GBL_TASK_GET_CLASS(self)    (GBL_CLASSOF(GblTask, self))     //!< Get GblTaskClass from GblInstance
+//! @}
 
 #define GBL_SELF_TYPE GblTask
 
@@ -22,6 +44,15 @@ GBL_FORWARD_DECLARE_STRUCT(GblTask);
 
 typedef int8_t GblPriority;
 
+//! Lifetime states for a GblTask
+GBL_DECLARE_ENUM(GBL_TASK_STATE) {
+    GBL_TASK_STATE_READY,       //!< Idle, not scheduled
+    GBL_TASK_STATE_QUEUED,      //!< Scheduled, waiting to execute
+    GBL_TASK_STATE_RUNNING,     //!< Currently executing
+    GBL_TASK_STATE_FINISHED,    //!< Finished executing
+    GBL_TASK_STATE_CANCELED     //!< Removed from the queue before executing
+};
+
 /*! \struct  GblTaskClass
  *  \extends GblObjectClass
  *  \brief   GblClass structure for GblTask
@@ -45,14 +76,39 @@ GBL_CLASS_END
  *  \extends GblObject
  *  \brief   High-level schedulable concurrently-executing operation
  *
- *  No public members.
- *
  *  \sa GblTaskClass
  */
-GBL_INSTANCE_DERIVE_EMPTY(GblTask, GblObject);
+GBL_INSTANCE_DERIVE(GblTask, GblObject)
+    GBL_PRIVATE_BEGIN
+        union {
+            GblDoublyLinkedListNode listNode; //!< Intrusive node for GblMainLoop priority queues
+            GblTask*                pNext;    //!< Intrusive link for worker submission stacks
+        };
+        GblMainLoop*                pLoop;    //!< Loop the task is currently queued on
+        GblPriority                 priority; //!< Priority the task was queued with
+    GBL_PRIVATE_END
+    GBL_ATOMIC(GBL_TASK_STATE) state;         //!< Current scheduling state, read through GblTask_state()
+    GBL_RESULT                 result;        //!< Result of the last execution, valid once GblTask_isDone()
+GBL_INSTANCE_END
+
+//! Returns the GblType UUID associated with GblTask
+GBL_EXPORT GblType        GblTask_type     (void)      GBL_NOEXCEPT;
 
-GBL_EXPORT GblPriority GblTask_priority(GBL_CSELF) GBL_NOEXCEPT;
+//! Returns the priority of the given task, as reported by GblTaskClass::pFnPriority
+GBL_EXPORT GblPriority    GblTask_priority (GBL_CSELF) GBL_NOEXCEPT;
+//! Returns the current scheduling state of the given task
+GBL_EXPORT GBL_TASK_STATE GblTask_state    (GBL_CSELF) GBL_NOEXCEPT;
+//! Returns the result of the given task's last execution
+GBL_EXPORT GBL_RESULT     GblTask_result   (GBL_CSELF) GBL_NOEXCEPT;
+//! Returns GBL_TRUE if the given task has finished executing or was canceled
+GBL_EXPORT GblBool        GblTask_isDone   (GBL_CSELF) GBL_NOEXCEPT;
 
+//! Synchronously executes the given task on the calling thread, storing its result
+GBL_EXPORT GBL_RESULT     GblTask_exec     (GBL_SELF)  GBL_NOEXCEPT;
+//! Marks the given task as canceled, invoking GblTaskClass::pFnCancel
+GBL_EXPORT GBL_RESULT     GblTask_cancel   (GBL_SELF)  GBL_NOEXCEPT;
+//! Returns a finished or canceled task to GBL_TASK_STATE_READY, so that it may be scheduled again
+GBL_EXPORT GBL_RESULT     GblTask_reset    (GBL_SELF)  GBL_NOEXCEPT;
 
 GBL_DECLS_END
 
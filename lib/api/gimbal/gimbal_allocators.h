@@ -10,6 +10,7 @@
 #include "allocators/gimbal_allocation_tracker.h"
 #include "allocators/gimbal_arena_allocator.h"
 #include "allocators/gimbal_pool_allocator.h"
+#include "allocators/gimbal_concurrent_pool_allocator.h"
 #include "allocators/gimbal_scope_allocator.h"
 
 /*! \defgroup allocators Allocators
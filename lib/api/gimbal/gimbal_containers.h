@@ -13,6 +13,7 @@
 #include "containers/gimbal_array_heap.h"
 #include "containers/gimbal_array_list.h"
 #include "containers/gimbal_array_map.h"
+#include "containers/gimbal_concurrent_ring_buffer.h"
 #include "containers/gimbal_doubly_linked_list.h"
 #include "containers/gimbal_hash_set.h"
 #include "containers/gimbal_linked_list.h"
@@ -49,6 +50,7 @@
         GblArrayMap		       |Resizable array-based, [K,V] container with optional binary searchability         | gimbal_array_map.h
         GblArrayHeap           |Dynamic array-based, binary heap structure providing a priority queue API         | gimbal_array_heap.h
         GblRingBuffer          |Fixed-capacity circular buffer backed by a contiguous array with queue semantics  | gimbal_ring_buffer.h
+        GblConcurrentRingBuffer|Lock-free, fixed-capacity SPSC or MPMC queue for passing elements between threads | gimbal_concurrent_ring_buffer.h
 */
 
 #endif // GIMBAL_CONTAINERS_H
@@ -8,6 +8,7 @@
 #define GIMBAL_STRINGS_H
 
 #include "strings/gimbal_pattern.h"
+#include "strings/gimbal_pattern_set.h"
 #include "strings/gimbal_quark.h"
 #include "strings/gimbal_string.h"
 #include "strings/gimbal_string_buffer.h"
@@ -441,6 +441,8 @@ GBL_DECLS_END
  * \fn GblClass* GblClass_cast(GblClass* pSelf, GblType toType)
  * Casts the given class to a class of the given type, raising errors and
  * returning NULL upon failure.
+ * \note Resolved casts to interface types are cached globally by concrete
+ * type, so repeating a cast costs a single lock-free cache probe.
  * \param pSelf source class pointer
  * \param toType desired destination type
  * \returns pointer to GblClass upon success, NULL upon failure
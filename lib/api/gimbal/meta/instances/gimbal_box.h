@@ -77,13 +77,14 @@ GBL_CLASS_END
  *      - arbitrary flag bits
  *
  *  \note
- *  A GblBox is 12 or 20 bytes total (32 or 64 bit respectively).
+ *  A GblBox is 16 or 28 bytes total (32 or 64 bit respectively).
  *
  *  \sa GblBoxClass
  */
 GBL_INSTANCE_BASE(GblBox)                       // Size (32/64 bit)
-    GBL_PRIVATE_BEGIN                           // 12/20 Bytes Total
+    GBL_PRIVATE_BEGIN                           // 16/28 Bytes Total
         GblArrayMap* pFields;                   //!< PRIVATE: Storage for extended userdata fields
+        void*        pConnectionTable;          //!< PRIVATE: Lazily allocated table of signal connections
         GblRefCount  refCounter;                //!< PRIVATE: Atomic reference counter
         uint16_t     contextType         : 1;   //!< PRIVATE: GblContext type flag \deprecated
         uint16_t     constructedInPlace  : 1;   //!< PRIVATE: Flag for whether memory is deallocated upon destruction
@@ -208,6 +208,10 @@ GBL_EXPORT GBL_RESULT GblObject_propertyVariant     (GBL_CSELF, const char* pNam
 //! Variant of GblObject_propertyVariant(), with the property name specified as a quark (faster lookups)
 GBL_EXPORT GBL_RESULT GblObject_propertyVariantByQuark
                                                     (GBL_CSELF, GblQuark name, GblVariant* pValue)     GBL_NOEXCEPT;
+//! Looks up the property by its index within the object type's property table (no hashing), storing its value in the pointer passed as a variadic argument
+GBL_EXPORT GBL_RESULT GblObject_propertyById        (GBL_CSELF, size_t id, ...)                        GBL_NOEXCEPT;
+//! Variant of GblObject_propertyVariant(), with the property specified by its index, as returned by GblProperty_index()
+GBL_EXPORT GBL_RESULT GblObject_propertyVariantById (GBL_CSELF, size_t id, GblVariant* pValue)         GBL_NOEXCEPT;
 //! Takes a NULL-terminated K,V pair list of string property names and pointers to store their values within
 GBL_EXPORT GBL_RESULT GblObject_properties          (GBL_CSELF, ...)                                   GBL_NOEXCEPT;
 //! Variant of GblObject_properties() with the NULL-terminated K,V pair list being specified as a pointer to a va_list
@@ -232,6 +236,11 @@ GBL_EXPORT GBL_RESULT GblObject_setPropertyVariant  (GBL_SELF, const char* pName
 //! Variant of GblObject_setPropertyVariant() where the property name is provided as a quark (for faster lookups)
 GBL_EXPORT GBL_RESULT GblObject_setPropertyVariantByQuark
                                                     (GBL_SELF, GblQuark name, GblVariant* pValue)      GBL_NOEXCEPT;
+//! Variant of GblObject_setProperty() with the property specified by its index, as returned by GblProperty_index() (no hashing)
+GBL_EXPORT GBL_RESULT GblObject_setPropertyById     (GBL_SELF, size_t id, ...)                         GBL_NOEXCEPT;
+//! Variant of GblObject_setPropertyVariant() with the property specified by its index, as returned by GblProperty_index()
+GBL_EXPORT GBL_RESULT GblObject_setPropertyVariantById
+                                                    (GBL_SELF, size_t id, GblVariant* pValue)          GBL_NOEXCEPT;
 //! Sets multiple properties by taking a NULL-terminated K,V pairs list of string names and pointers to store the values within
 GBL_EXPORT GBL_RESULT GblObject_setProperties       (GBL_SELF, ...)                                    GBL_NOEXCEPT;
 //! Variant of Gblobject_setProperties() where the NULL-termianted K,V pairs list is specified as apointer to a va_list
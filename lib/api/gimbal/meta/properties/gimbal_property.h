@@ -65,12 +65,21 @@ GBL_CLASS_END
  *  dynamically looked-up by a string key, passed to the Gblobject
  *  constructor, or which can be programmatically iterated over.
  *
- *  \sa GblPropertyClass
+ *  Every property visible from an object type also occupies an index
+ *  within that type's flattened property table, shared by all of its
+ *  derived types, which can be used for lookups without hashing. Indices
+ *  are only stable while the properties of a type and its bases are
+ *  unchanged: installing a property on a base type shifts up the indices
+ *  of its derived types' own properties, and uninstalling one shifts down
+ *  the index of every property after it.
+ *
+ *  \sa GblPropertyClass, GblProperty_index(), GblProperty_at()
  */
 GBL_INSTANCE_DERIVE(GblProperty, GblBox)
     GBL_PRIVATE_BEGIN
         GblProperty* pNext;
-        GblType      objectType;
+        size_t       index;
+        GblType      objectType;    // hashed together with name, so keep them adjacent
     GBL_PRIVATE_END
     GblQuark    name;
     size_t      id;
@@ -100,6 +109,8 @@ GBL_EXPORT const GblProperty*
                         GblProperty_find           (GblType objectType, const char* pName) GBL_NOEXCEPT;
 GBL_EXPORT const GblProperty*
                         GblProperty_findQuark      (GblType objectType, GblQuark name)     GBL_NOEXCEPT;
+GBL_EXPORT const GblProperty*
+                        GblProperty_at             (GblType objectType, size_t index)      GBL_NOEXCEPT;
 GBL_EXPORT const GblProperty*
                         GblProperty_next           (GblType            objectType,
                                                     const GblProperty* pPrev,
@@ -151,6 +162,7 @@ GBL_EXPORT GBL_RESULT GblProperty_createOrConstruct(GblProperty** ppSelf,
 
 GBL_EXPORT GblType      GblProperty_objectType     (GBL_CSELF)                             GBL_NOEXCEPT;
 GBL_EXPORT const char*  GblProperty_nameString     (GBL_CSELF)                             GBL_NOEXCEPT;
+GBL_EXPORT size_t       GblProperty_index          (GBL_CSELF)                             GBL_NOEXCEPT;
 
 GBL_EXPORT GBL_RESULT   GblProperty_defaultValue   (GBL_CSELF, GblVariant* pValue)         GBL_NOEXCEPT;
 GBL_EXPORT GblBool      GblProperty_checkValue     (GBL_CSELF, const GblVariant* pValue)   GBL_NOEXCEPT;
@@ -110,6 +110,7 @@ GBL_DECL_CCLOSURE_MARSHAL_VOID__(INSTANCE_ENUM);
 GBL_DECL_CCLOSURE_MARSHAL_VOID__(INSTANCE_FLAGS);
 GBL_DECL_CCLOSURE_MARSHAL_VOID__(INSTANCE_POINTER);
 GBL_DECL_CCLOSURE_MARSHAL_VOID__(INSTANCE_BOXED);
+GBL_DECL_CCLOSURE_MARSHAL_VOID__(INSTANCE_INSTANCE);
 //! @}
 
 GBL_DECLS_END
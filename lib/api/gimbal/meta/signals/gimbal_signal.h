@@ -1,6 +1,14 @@
 /*! \file
  *  \brief Signals, connections, and related API
  *  \ingroup signals
+ *
+ *  Connecting, disconnecting, blocking, and emitting are all
+ *  safe to call concurrently from any thread. Emission doesn't
+ *  take a global lock: it iterates over an immutable snapshot of
+ *  an emitter's connections, so a connection which is removed
+ *  during an emission on another thread may still be invoked
+ *  by that emission, if it had already begun.
+ *
  *  \todo
  *      - GblSignal_next() for iteration
  *
@@ -19,9 +27,27 @@
 #define GBL_SIGNALS_REGISTER(instanceStruct, /* marshals */...)
 #define GBL_EMIT(emitter, ...)                                      (GblSignal_emit(GBL_INSTANCE(emitter), __VA_ARGS__))
 #define GBL_CONNECT(...)                                            (GBL_VA_OVERLOAD_CALL_ARGC(GBL_CONNECT, __VA_ARGS__))
+#define GBL_EMIT_ID(emitter, ...)                                   (GblSignal_emitById(GBL_INSTANCE(emitter), __VA_ARGS__))
+
+#define GBL_SIGNAL_ID_INVALID                                       0   //!< Value of a GblSignalId which doesn't refer to any signal
 
 GBL_DECLS_BEGIN
 
+GBL_FORWARD_DECLARE_STRUCT(GblMainLoop);
+
+/*! Pre-resolved handle to an installed signal
+ *  \ingroup signals
+ *
+ *  Emitting a signal by name requires converting the name into
+ *  a GblQuark first, which means a lookup within the global quark
+ *  registry on every emission. A GblSignalId is resolved once up-front
+ *  with GblSignal_id(), then passed to GblSignal_emitById() for every
+ *  subsequent emission, skipping the name lookup entirely.
+ *
+ *  \note A GblSignalId remains valid until its signal is uninstalled.
+ */
+typedef uintptr_t GblSignalId;
+
 GBL_EXPORT GBL_RESULT   GblSignal_install         (GblType        ownerType,
                                                    const char*    pName,
                                                    GblMarshalFn   pFnCMarshal,
@@ -31,6 +57,9 @@ GBL_EXPORT GBL_RESULT   GblSignal_install         (GblType        ownerType,
 GBL_EXPORT GBL_RESULT   GblSignal_uninstall       (GblType        ownerType,
                                                    const char*    pName)          GBL_NOEXCEPT;
 
+GBL_EXPORT GblSignalId  GblSignal_id              (GblType        ownerType,
+                                                   const char*    pName)          GBL_NOEXCEPT;
+
 GBL_EXPORT GBL_RESULT   GblSignal_connect         (GblInstance*   pEmitter,
                                                    const char*    pSignalName,
                                                    GblInstance*   pReceiver,
@@ -53,6 +82,32 @@ GBL_EXPORT GBL_RESULT   GblSignal_connectClosure  (GblInstance*   pEmitter,
                                                    GblInstance*   pReceiver,
                                                    GblClosure*    pClosure)       GBL_NOEXCEPT;
 
+/*! Connects a C callback which is queued onto \p pLoop rather than being called by the emitter
+ *  \ingroup signals
+ *
+ *  Every emission of the signal boxes its arguments once and enqueues
+ *  a GblTask onto \p pLoop, which invokes the callback from whichever
+ *  thread runs the loop. Pending deliveries for a connection which is
+ *  disconnected before the loop gets to them are dropped.
+ *
+ *  \note The connection keeps a reference to \p pLoop until it has
+ *  been disconnected and all of its pending deliveries have completed.
+ */
+GBL_EXPORT GBL_RESULT   GblSignal_connectQueued   (GblInstance*   pEmitter,
+                                                   const char*    pSignalName,
+                                                   GblInstance*   pReceiver,
+                                                   GblMainLoop*   pLoop,
+                                                   GblFnPtr       pFnCCallback,
+                                                   void*          pUserdata)      GBL_NOEXCEPT;
+
+//! Equivalent to GblSignal_connectQueued(), except for connecting an arbitrary GblClosure
+GBL_EXPORT GBL_RESULT   GblSignal_connectClosureQueued
+                                                  (GblInstance*   pEmitter,
+                                                   const char*    pSignalName,
+                                                   GblInstance*   pReceiver,
+                                                   GblMainLoop*   pLoop,
+                                                   GblClosure*    pClosure)       GBL_NOEXCEPT;
+
 GBL_EXPORT size_t       GblSignal_disconnect      (GblInstance*   pEmitter,
                                                    const char*    pSignalName,
                                                    GblInstance*   pReceiver,
@@ -80,6 +135,18 @@ GBL_EXPORT GBL_RESULT   GblSignal_emitVariants    (GblInstance*   pEmitter,
                                                    const char*    pSignalName,
                                                    GblVariant*    pArgs)          GBL_NOEXCEPT;
 
+GBL_EXPORT GBL_RESULT   GblSignal_emitById        (GblInstance*   pEmitter,
+                                                   GblSignalId    signalId,
+                                                   ...)                           GBL_NOEXCEPT;
+
+GBL_EXPORT GBL_RESULT   GblSignal_emitByIdVaList  (GblInstance*   pEmitter,
+                                                   GblSignalId    signalId,
+                                                   va_list*       pVarArgs)       GBL_NOEXCEPT;
+
+GBL_EXPORT GBL_RESULT   GblSignal_emitVariantsById(GblInstance*   pEmitter,
+                                                   GblSignalId    signalId,
+                                                   GblVariant*    pArgs)          GBL_NOEXCEPT;
+
 GBL_EXPORT GblInstance* GblSignal_emitter         (void)                          GBL_NOEXCEPT;
 
 GBL_EXPORT GblInstance* GblSignal_receiver        (void)                          GBL_NOEXCEPT;
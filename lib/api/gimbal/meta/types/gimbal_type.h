@@ -64,6 +64,7 @@ typedef enum GblTypeFlags {
     GBL_TYPE_FLAG_INCOMPLETE      = (1 << 11), //!< Incomplete/partial type missing some type dependency
     GBL_TYPE_FLAG_ABSTRACT        = (1 << 12), //!< Type cannot be instantiated without being derived
     GBL_TYPE_FLAG_FINAL           = (1 << 13), //!< Type cannot be derived from
+    GBL_TYPE_FLAG_INSTANCE_POOLED = (1 << 14), //!< Type's instances are allocated from its own thread-caching pool rather than individually. Not inherited, and incompatible with custom allocation sizes.
     GBL_TYPE_FLAGS_MASK           = 0xffffffc0 //!< Mask of all user type flags
 } GblTypeFlags;
 
@@ -108,6 +109,10 @@ GBL_EXPORT GblType    GblType_next       (GblType previousType)     GBL_NOEXCEPT
 
 /*! \name  Querying
  *  \brief Methods for looking up or querying types
+ *
+ *  Lookups are lock-free and may be performed concurrently
+ *  from any number of threads. Only registering or
+ *  unregistering a type takes the registry lock.
  *  @{
  */
 //! Queries the internal type registry for a GblType by its type name
@@ -158,6 +163,12 @@ GBL_EXPORT size_t  GblType_depth    (GBL_VSELF)               GBL_NOEXCEPT;
 
 /*! \name  Type Checking
  *  \brief Methods performing type system queries on a type
+ *
+ *  Each type stores a table of its ancestors indexed by depth
+ *  and a sorted set of every interface it maps to, both built
+ *  at registration, so checking derivation is constant-time
+ *  and checking interfaces is a binary search, regardless of
+ *  how deep the hierarchy is.
  *  @{
  */
 //! Returns GBL_TRUE if the given type is a valid, registred type
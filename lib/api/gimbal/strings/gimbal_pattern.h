@@ -2,6 +2,27 @@
  *  \brief   GblPattern RegExp-style pattern matching
  *  \ingroup strings
  *
+ *  GblPattern is an immutable, reference-counted, compiled regular
+ *  expression, which can be shared and matched from multiple threads
+ *  at once. The "Str" variants of the matching functions look their
+ *  expressions up in a small, thread-safe LRU cache of compiled
+ *  patterns, so that calling them repeatedly with the same expression
+ *  doesn't recompile it every time.
+ *
+ *  Supported syntax:
+ *
+ *      .        any character other than '\n' and '\r'
+ *      ^        start of the string, when leading the expression
+ *      $        end of the string, when ending the expression
+ *      *, +     greedily match 0 or more, 1 or more
+ *      ?        match 0 or 1 (preferring 0)
+ *      {n}      greedily match exactly n, {n,} at least n, {n,m} n through m
+ *      [abc]    character class, with ranges like [a-z]
+ *      [^abc]   inverted character class
+ *      \s, \S  whitespace, non-whitespace
+ *      \w, \W  alphanumeric or '_', anything else
+ *      \d, \D  digit, non-digit
+ *
  *  \todo
  *      - Refactor GblPattern_matchNot() to be less disgusting
  *      - GblPattern_matchNot() incorrect when more than one match in a row
@@ -28,6 +49,26 @@ GBL_FORWARD_DECLARE_STRUCT(GblStringView);
 typedef struct GblPattern GblPattern;
 
 // ===== Public API =====
+//! Compiles \p pRegExp into a new pattern with a reference count of 1, or returns NULL if it's invalid
+GBL_EXPORT GblPattern*
+                   GblPattern_create        (const char* pRegExp)            GBL_NOEXCEPT;
+//! Returns a new reference to the given pattern, incrementing its reference count
+GBL_EXPORT GblPattern*
+                   GblPattern_ref           (GBL_CSELF)                      GBL_NOEXCEPT;
+//! Releases a reference to the given pattern, destroying it when the count hits 0
+GBL_EXPORT GblRefCount
+                   GblPattern_unref         (GBL_CSELF)                      GBL_NOEXCEPT;
+//! Returns the number of active references held to the given pattern
+GBL_EXPORT GblRefCount
+                   GblPattern_refCount      (GBL_CSELF)                      GBL_NOEXCEPT;
+//! Returns the regular expression the given pattern was compiled from
+GBL_EXPORT const char*
+                   GblPattern_string        (GBL_CSELF)                      GBL_NOEXCEPT;
+
+/*! \deprecated Use GblPattern_create(). The returned pattern is borrowed,
+ *  not owned by the caller, and is only valid until the calling thread's
+ *  next call to GblPattern_compile().
+ */
 GBL_EXPORT const GblPattern*
                    GblPattern_compile       (const char* pRegExp)            GBL_NOEXCEPT;
 
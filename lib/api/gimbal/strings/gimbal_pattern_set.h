@@ -0,0 +1,89 @@
+/*! \file
+ *  \brief   GblPatternSet DFA-based multi-pattern matching
+ *  \ingroup strings
+ *
+ *  GblPatternSet compiles one or more GblPattern regular expressions
+ *  into a single deterministic finite automaton, which finds every
+ *  match of every pattern within a string in one left-to-right pass,
+ *  in time linear to the string's length, no matter how many patterns
+ *  the set holds or how many near-misses the string contains.
+ *
+ *  Patterns use the same syntax as GblPattern, but since a DFA can't
+ *  backtrack, matches are found in the order that they end, then each
+ *  is widened to the leftmost start and longest end its pattern allows,
+ *  so '?' is greedy rather than lazy. Matches never overlap, and
+ *  patterns which can match an empty string are rejected.
+ *
+ *  A GblPatternSet is immutable and reference-counted, so it can be
+ *  shared and matched from multiple threads at once.
+ */
+
+#ifndef GIMBAL_PATTERN_SET_H
+#define GIMBAL_PATTERN_SET_H
+
+#include "gimbal_pattern.h"
+#include "gimbal_string_view.h"
+
+#define GBL_SELF_TYPE GblPatternSet
+
+GBL_DECLS_BEGIN
+
+/*! Opaque structure representing a set of patterns compiled into a DFA
+ *  \ingroup strings
+ */
+typedef struct GblPatternSet GblPatternSet;
+
+//! Callback invoked for each match found by GblPatternSet_scan(), returning GBL_TRUE to stop scanning
+typedef GblBool (*GblPatternSetIterFn)(GBL_CSELF, size_t pattern, GblStringView match, void* pClosure);
+
+// ===== Public API =====
+//! Compiles the \p count regular expressions from \p ppRegExps into a new set, or returns NULL if any are invalid
+GBL_EXPORT GblPatternSet*
+                   GblPatternSet_create       (const char* const* ppRegExps,
+                                               size_t             count)   GBL_NOEXCEPT;
+//! Returns a new reference to the given set, incrementing its reference count
+GBL_EXPORT GblPatternSet*
+                   GblPatternSet_ref          (GBL_CSELF)                  GBL_NOEXCEPT;
+//! Releases a reference to the given set, destroying it when the count hits 0
+GBL_EXPORT GblRefCount
+                   GblPatternSet_unref        (GBL_CSELF)                  GBL_NOEXCEPT;
+//! Returns the number of active references held to the given set
+GBL_EXPORT GblRefCount
+                   GblPatternSet_refCount     (GBL_CSELF)                  GBL_NOEXCEPT;
+//! Returns the number of patterns within the given set
+GBL_EXPORT size_t  GblPatternSet_patternCount (GBL_CSELF)                  GBL_NOEXCEPT;
+//! Returns the compiled pattern at \p index within the given set
+GBL_EXPORT const GblPattern*
+                   GblPatternSet_pattern      (GBL_CSELF, size_t index)    GBL_NOEXCEPT;
+//! Returns the number of states within the automaton used to scan for matches
+GBL_EXPORT size_t  GblPatternSet_stateCount   (GBL_CSELF)                  GBL_NOEXCEPT;
+
+//! Finds the first match within \p string, optionally returning it and the index of its pattern
+GBL_EXPORT GblBool GblPatternSet_find         (GBL_CSELF,
+                                               GblStringView  string,
+                                               GblStringView* pMatch/*=NULL*/,
+                                               size_t*        pPattern/*=NULL*/) GBL_NOEXCEPT;
+//! Calls \p pFnIter for each match within \p string, in order, returning the number of matches visited
+GBL_EXPORT size_t  GblPatternSet_scan         (GBL_CSELF,
+                                               GblStringView       string,
+                                               GblPatternSetIterFn pFnIter,
+                                               void*               pClosure) GBL_NOEXCEPT;
+//! Returns the total number of matches of every pattern within \p string
+GBL_EXPORT size_t  GblPatternSet_matchCount   (GBL_CSELF, GblStringView string) GBL_NOEXCEPT;
+
+// ===== Default Argument Wrapper Macros ====-
+#define GblPatternSet_find(...)             (GblPatternSet_findDefault_(__VA_ARGS__))
+
+// ===== Implementation =====
+///\cond
+#define GblPatternSet_findDefault_(...) \
+    (GblPatternSet_findDefault__(__VA_ARGS__, GBL_NULL, GBL_NULL))
+#define GblPatternSet_findDefault__(set, str, match, pattern, ...) \
+    ((GblPatternSet_find)(set, str, match, pattern))
+///\endcond
+
+GBL_DECLS_END
+
+#undef GBL_SELF_TYPE
+
+#endif // GIMBAL_PATTERN_SET_H
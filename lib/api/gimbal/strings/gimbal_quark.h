@@ -22,7 +22,8 @@
  *  since a string literal's lifetime is global.
  *
  *  \note
- *  All functions in this API are thread-safe.
+ *  All functions in this API are thread-safe. Looking up a string which
+ *  has already been interned never locks; only interning a new one does.
  *
  *  ### Example Usage
  *
@@ -185,7 +186,8 @@ GBL_DECLS_END
     \details
         Equivalent to GblQuark_fromString(), except for only the specified
         length of the string. This is useful for either substrings, or
-        for non NULL-teriminated strings.
+        for non NULL-teriminated strings. The string is looked up in place,
+        and is only copied if it hasn't been interned before.
     \param pString array of characters
     \param length of array
     \returns quark value or #GBL_QUARK_INVALID if the string is NULL or length is 0
@@ -216,7 +218,8 @@ GBL_DECLS_END
 /*!
     \fn GblQuark_tryStringSized(const char* pString, size_t  length)
     \details
-        Equivalent to GblQuark_tryString() with a substring.
+        Equivalent to GblQuark_tryString() with a substring, which is
+        looked up in place without being copied.
     \param pString array of characters
     \param length length of array
     \returns quark value or #GBL_QUARK_INVALID
@@ -1,54 +1,343 @@
 #include <gimbal/algorithms/gimbal_sort.h>
+#include <gimbal/core/gimbal_ctx.h>
+#include <string.h>
 
-GBL_EXPORT void gblSortMerge(void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) {
-    uint8_t* pFirstHalf;
-    uint8_t* pEofFirstHalf;
-    uint8_t* pSecondHalf;
-    uint8_t* pEofSecondHalf;
-    uint8_t* pResultBuffer, *pResult;
-    size_t  halfSize;
+#define GBL_SORT_INSERTION_THRESHOLD_       24      // ranges shorter than this are insertion sorted
+#define GBL_SORT_NINTHER_THRESHOLD_         128     // ranges longer than this take the pseudomedian of 9 as the pivot
+#define GBL_SORT_PARTIAL_INSERTION_LIMIT_   8       // elements moved before giving up on a range being nearly sorted
+#define GBL_SORT_RUNS_MAX_                  96      // pending runs, way more than the merge invariants ever allow
+#define GBL_SORT_SCRATCH_STACK_SIZE_        1024    // bytes of merge scratch taken from the stack before the heap
 
-    if(count <= 1) return;
+/* Merge scratch memory, which starts out on the stack then moves onto
+   the heap once a merge outgrows it, never asking for more than the
+   half of the array that the largest possible merge needs. */
+typedef struct GblSortScratch_ {
+    char*         pHeap;
+    size_t        heapSize;
+    size_t        limit;
+    unsigned char stack[GBL_SORT_SCRATCH_STACK_SIZE_];
+} GblSortScratch_;
 
-    halfSize = count / 2;
-    pFirstHalf = (uint8_t*)pArray;
-    pSecondHalf = (uint8_t*)pArray + (halfSize * elemSize);
+// Returns scratch memory for at least the given number of bytes, or NULL if it can't be allocated
+static char* gblSortScratch_(GblSortScratch_* pSelf, size_t bytes) {
+    if(bytes <= sizeof(pSelf->stack))
+        return (char*)pSelf->stack;
 
-    gblSortMerge(pFirstHalf, halfSize, elemSize, pFnCmp);
-    gblSortMerge(pSecondHalf, count-halfSize, elemSize, pFnCmp);
+    if(bytes > pSelf->heapSize) {
+        size_t size = pSelf->heapSize * 2;
 
-    pEofFirstHalf = pSecondHalf;
-    pEofSecondHalf = (uint8_t*)pArray + (count * elemSize);
-    pResultBuffer = (uint8_t*)GBL_ALLOCA(count * elemSize);
-    pResult = pResultBuffer;
+        if(size < bytes)       size = bytes;
+        if(size > pSelf->limit) size = pSelf->limit;
 
-    while(pFirstHalf < pEofFirstHalf && pSecondHalf < pEofSecondHalf) {
-        if((*pFnCmp)(pFirstHalf, pSecondHalf) < 0) {
-            memcpy(pResult, pFirstHalf, elemSize);
-            pFirstHalf += elemSize;
-        } else {
-            memcpy(pResult, pSecondHalf, elemSize);
-            pSecondHalf += elemSize;
-        }
-        pResult += elemSize;
+        GBL_CTX_BEGIN(NULL);
+
+        if(pSelf->pHeap)
+            GBL_CTX_FREE(pSelf->pHeap);
+
+        pSelf->pHeap    = GBL_CTX_MALLOC(size);
+        pSelf->heapSize = pSelf->pHeap? size : 0;
+
+        GBL_CTX_END_BLOCK();
     }
 
-    while(pFirstHalf < pEofFirstHalf) {
-        memcpy(pResult, pFirstHalf, elemSize);
-        pFirstHalf += elemSize;
-        pResult += elemSize;
+    return pSelf->pHeap;
+}
+
+static void gblSortScratchRelease_(GblSortScratch_* pSelf) {
+    if(!pSelf->pHeap) return;
+
+    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_FREE(pSelf->pHeap);
+    GBL_CTX_END_BLOCK();
+}
+
+// Timsort's minimum run length: between 32 and 64, such that count / minRun is at or just under a power of 2
+static size_t gblSortMinRun_(size_t count) {
+    size_t odd = 0;
+
+    while(count >= 64) {
+        odd   |= count & 1;
+        count >>= 1;
     }
 
-    while(pSecondHalf < pEofSecondHalf) {
-        memcpy(pResult, pSecondHalf, elemSize);
-        pSecondHalf += elemSize;
-        pResult += elemSize;
+    return count + odd;
+}
+
+#define GBL_SORT_SUFFIX_    4
+#define GBL_SORT_WIDTH_     4
+#include "gimbal_sort_.h"
+
+#define GBL_SORT_SUFFIX_    8
+#define GBL_SORT_WIDTH_     8
+#include "gimbal_sort_.h"
+
+#define GBL_SORT_SUFFIX_    16
+#define GBL_SORT_WIDTH_     16
+#include "gimbal_sort_.h"
+
+#define GBL_SORT_SUFFIX_    Any
+#define GBL_SORT_WIDTH_     elemSize
+#define GBL_SORT_GENERIC_
+#include "gimbal_sort_.h"
+
+// Calls the instantiation of the given kernel which matches elemSize
+#define GBL_SORT_DISPATCH_(name, ...)                                       \
+    GBL_STMT_START {                                                        \
+        switch(elemSize) {                                                  \
+        case 4:  gblSort_##name##4_(__VA_ARGS__);   break;                  \
+        case 8:  gblSort_##name##8_(__VA_ARGS__);   break;                  \
+        case 16: gblSort_##name##16_(__VA_ARGS__);  break;                  \
+        default: gblSort_##name##Any_(__VA_ARGS__); break;                  \
+        }                                                                   \
+    } GBL_STMT_END
+
+GBL_EXPORT void gblSortPdq(void* pArray, size_t count, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    char* const pBegin     = pArray;
+    unsigned    badAllowed = 0;
+
+    if(count < 2) return;
+
+    void* pTemp = GBL_ALLOCA(elemSize);
+
+    // after log2(count) badly unbalanced partitions, fall back to heapsort
+    for(size_t n = count; n; n >>= 1)
+        ++badAllowed;
+
+    GBL_SORT_DISPATCH_(pdq, pBegin, pBegin + count * elemSize, elemSize, pFnCmp, pTemp, badAllowed, GBL_TRUE);
+}
+
+GBL_EXPORT void gblSortTim(void* pArray, size_t count, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    char* const     pBegin = pArray;
+    GblSortScratch_ scratch;
+
+    if(count < 2) return;
+
+    void* pTemp = GBL_ALLOCA(elemSize);
+
+    scratch.pHeap    = NULL;
+    scratch.heapSize = 0;
+    scratch.limit    = count / 2 * elemSize;
+
+    GBL_SORT_DISPATCH_(tim, pBegin, pBegin + count * elemSize, elemSize, pFnCmp, &scratch, pTemp);
+
+    gblSortScratchRelease_(&scratch);
+}
+
+GBL_EXPORT void gblSortQuick(void* pArray, size_t count, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    gblSortPdq(pArray, count, elemSize, pFnCmp);
+}
+
+GBL_EXPORT void gblSortMerge(void* pArray, size_t count, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    gblSortTim(pArray, count, elemSize, pFnCmp);
+}
+
+/* Radix sorting maps every key onto a uint64_t whose unsigned order
+   matches the key's own: signed integers have their sign bit flipped,
+   and floats have their sign bit flipped when positive, or every bit
+   flipped when negative. Elements are then moved along with their keys
+   through a stable LSD pass per byte, except for bytes which are the
+   same across every key, which are skipped, so 32-bit and narrow-ranged
+   keys take fewer passes. When the elements are nothing but the keys
+   themselves, only the keys are moved, then mapped back at the end. */
+#define GBL_SORT_RADIX_MAP_(type, expr)                                     \
+    for(size_t i = 0; i < count; ++i) {                                     \
+        type k;                                                             \
+        memcpy(&k, pArray + i * elemSize + keyOffset, sizeof(type));        \
+        pKeys[i] = (expr);                                                  \
     }
 
-    memcpy(pArray, pResultBuffer, count * elemSize);
+static void gblSortRadixMap_(const char*  pArray,
+                             size_t       count,
+                             size_t       elemSize,
+                             size_t       keyOffset,
+                             GBL_SORT_KEY keyType,
+                             uint64_t*    pKeys)
+{
+    switch(keyType) {
+    case GBL_SORT_KEY_UINT32:
+        GBL_SORT_RADIX_MAP_(uint32_t, k); break;
+    case GBL_SORT_KEY_INT32:
+        GBL_SORT_RADIX_MAP_(uint32_t, k ^ 0x80000000u); break;
+    case GBL_SORT_KEY_FLOAT:
+        GBL_SORT_RADIX_MAP_(uint32_t, k ^ ((uint32_t)-(int32_t)(k >> 31) | 0x80000000u)); break;
+    case GBL_SORT_KEY_UINT64:
+        GBL_SORT_RADIX_MAP_(uint64_t, k); break;
+    case GBL_SORT_KEY_INT64:
+        GBL_SORT_RADIX_MAP_(uint64_t, k ^ 0x8000000000000000ull); break;
+    case GBL_SORT_KEY_DOUBLE:
+        GBL_SORT_RADIX_MAP_(uint64_t, k ^ ((uint64_t)-(int64_t)(k >> 63) | 0x8000000000000000ull)); break;
+    default: break;
+    }
 }
 
+#define GBL_SORT_RADIX_UNMAP_(type, expr)                                   \
+    for(size_t i = 0; i < count; ++i) {                                     \
+        const type k = (type)pKeys[i];                                      \
+        const type v = (expr);                                              \
+        memcpy(pArray + i * sizeof(type), &v, sizeof(type));                \
+    }
 
+static void gblSortRadixUnmap_(char* pArray, size_t count, GBL_SORT_KEY keyType, const uint64_t* pKeys) {
+    switch(keyType) {
+    case GBL_SORT_KEY_UINT32:
+        GBL_SORT_RADIX_UNMAP_(uint32_t, k); break;
+    case GBL_SORT_KEY_INT32:
+        GBL_SORT_RADIX_UNMAP_(uint32_t, k ^ 0x80000000u); break;
+    case GBL_SORT_KEY_FLOAT:
+        GBL_SORT_RADIX_UNMAP_(uint32_t, k ^ (((k >> 31) - 1u) | 0x80000000u)); break;
+    case GBL_SORT_KEY_UINT64:
+        GBL_SORT_RADIX_UNMAP_(uint64_t, k); break;
+    case GBL_SORT_KEY_INT64:
+        GBL_SORT_RADIX_UNMAP_(uint64_t, k ^ 0x8000000000000000ull); break;
+    case GBL_SORT_KEY_DOUBLE:
+        GBL_SORT_RADIX_UNMAP_(uint64_t, k ^ (((k >> 63) - 1u) | 0x8000000000000000ull)); break;
+    default: break;
+    }
+}
+
+#define GBL_SORT_RADIX_SCATTER_(width)                                      \
+    for(size_t i = 0; i < count; ++i) {                                     \
+        const size_t dst = pOffsets[(pKeys[i] >> shift) & 0xff]++;          \
+        pKeysDst[dst] = pKeys[i];                                           \
+        memcpy(pDst + dst * (width), pSrc + i * (width), (width));          \
+    }
+
+/* Sorts pKeys, along with the elements of pArray unless elemSize is 0,
+   using pKeysTemp and pTemp as the other halves of the double buffers,
+   then returns whether the sorted keys and elements ended up within
+   those temporary buffers rather than the originals. */
+static GblBool gblSortRadixPasses_(char*     pArray,
+                                   char*     pTemp,
+                                   uint64_t* pKeys,
+                                   uint64_t* pKeysTemp,
+                                   size_t    count,
+                                   size_t    elemSize)
+{
+    size_t  histograms[sizeof(uint64_t)][256] = { { 0 } };
+    GblBool swapped = GBL_FALSE;
+
+    for(size_t i = 0; i < count; ++i)
+        for(size_t d = 0; d < sizeof(uint64_t); ++d)
+            ++histograms[d][(pKeys[i] >> (d * 8)) & 0xff];
+
+    for(size_t d = 0; d < sizeof(uint64_t); ++d) {
+        const unsigned shift    = (unsigned)(d * 8);
+        size_t* const  pOffsets = histograms[d];
+        uint64_t*      pKeysDst = pKeysTemp;
+        char*          pSrc     = pArray;
+        char*          pDst     = pTemp;
+        size_t         offset   = 0;
+
+        // this byte is the same for every key, so the pass would change nothing
+        if(pOffsets[(pKeys[0] >> shift) & 0xff] == count)
+            continue;
+
+        for(size_t b = 0; b < 256; ++b) {
+            const size_t bucket = pOffsets[b];
+            pOffsets[b] = offset;
+            offset     += bucket;
+        }
+
+        switch(elemSize) {
+        case 0:
+            for(size_t i = 0; i < count; ++i)
+                pKeysDst[pOffsets[(pKeys[i] >> shift) & 0xff]++] = pKeys[i];
+            break;
+        case 4:  GBL_SORT_RADIX_SCATTER_(4);        break;
+        case 8:  GBL_SORT_RADIX_SCATTER_(8);        break;
+        case 16: GBL_SORT_RADIX_SCATTER_(16);       break;
+        default: GBL_SORT_RADIX_SCATTER_(elemSize); break;
+        }
+
+        pKeysTemp = pKeys;
+        pKeys     = pKeysDst;
+        pTemp     = pArray;
+        pArray    = pDst;
+        swapped   = !swapped;
+    }
+
+    return swapped;
+}
+
+/* Allocates the double buffers, sorts, then copies the elements back
+   into place, or maps the keys back into them. pFnKey is used to get
+   each key if it's given, otherwise keyType is. */
+static GBL_RESULT gblSortRadix_(char*        pArray,
+                                size_t       count,
+                                size_t       elemSize,
+                                size_t       keyOffset,
+                                GBL_SORT_KEY keyType,
+                                GblSortKeyFn pFnKey)
+{
+    char* pTemp = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    const size_t  keySize  = keyType < GBL_SORT_KEY_UINT64? sizeof(uint32_t) : sizeof(uint64_t);
+    const GblBool keysOnly = !pFnKey && elemSize == keySize;
+    uint64_t*     pKeys    = GBL_CTX_MALLOC(sizeof(uint64_t) * count * 2);
+
+    if(pKeys && !keysOnly)
+        pTemp = GBL_CTX_MALLOC(elemSize * count);
+
+    if(pKeys && (pTemp || keysOnly)) {
+        if(pFnKey) {
+            for(size_t i = 0; i < count; ++i)
+                pKeys[i] = pFnKey(pArray + i * elemSize);
+        } else {
+            gblSortRadixMap_(pArray, count, elemSize, keyOffset, keyType, pKeys);
+        }
+
+        const GblBool swapped = gblSortRadixPasses_(pArray, pTemp, pKeys, pKeys + count,
+                                                    count, keysOnly? 0 : elemSize);
+
+        if(keysOnly)
+            gblSortRadixUnmap_(pArray, count, keyType, swapped? pKeys + count : pKeys);
+        else if(swapped)
+            memcpy(pArray, pTemp, elemSize * count);
+    }
+
+    if(pTemp) GBL_CTX_FREE(pTemp);
+    if(pKeys) GBL_CTX_FREE(pKeys);
+
+    GBL_CTX_VERIFY(pKeys && (pTemp || keysOnly), GBL_RESULT_ERROR_MEM_ALLOC);
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT gblSortRadix(void*        pArray,
+                                   size_t       count,
+                                   size_t       elemSize,
+                                   size_t       keyOffset,
+                                   GBL_SORT_KEY keyType)
+{
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_ARG(keyType < GBL_SORT_KEY_COUNT);
+    GBL_CTX_VERIFY_ARG(keyOffset + (keyType < GBL_SORT_KEY_UINT64? sizeof(uint32_t) : sizeof(uint64_t))
+                       <= elemSize);
+
+    if(count < 2) GBL_CTX_DONE();
+
+    GBL_CTX_VERIFY_POINTER(pArray);
+    GBL_CTX_VERIFY_CALL(gblSortRadix_(pArray, count, elemSize, keyOffset, keyType, NULL));
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT gblSortRadixKey(void* pArray, size_t count, size_t elemSize, GblSortKeyFn pFnKey) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pFnKey);
+    GBL_CTX_VERIFY_ARG(elemSize);
+
+    if(count < 2) GBL_CTX_DONE();
+
+    GBL_CTX_VERIFY_POINTER(pArray);
+    GBL_CTX_VERIFY_CALL(gblSortRadix_(pArray, count, elemSize, 0, GBL_SORT_KEY_UINT64, pFnKey));
+
+    GBL_CTX_END();
+}
 
 GBL_EXPORT void gblSortSelection(void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) {
     void* pTemp = GBL_ALLOCA(elemSize);
@@ -64,10 +353,6 @@ GBL_EXPORT void gblSortSelection(void* pArray, size_t  count, size_t  elemSize,
     }
 }
 
-GBL_EXPORT void gblSortQuick(void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) {
-    qsort(pArray, count, elemSize, pFnCmp);
-}
-
 GBL_EXPORT void gblSortInsertion(void* pArray, size_t  count, size_t  elemSize, GblSortComparatorFn pFnCmp) {
     void* pTemp = GBL_ALLOCA(elemSize);
     for(size_t  i = 2; i < count; ++i) {
@@ -0,0 +1,555 @@
+/* Element-width specialized sorting kernels, instantiated by gimbal_sort.c.
+
+   This file is deliberately not include-guarded: it's included once per
+   instantiation, with GBL_SORT_SUFFIX_ naming it and GBL_SORT_WIDTH_ set
+   either to a constant element size, so every copy and swap compiles down
+   to plain moves, or to elemSize, for elements of any size. Each kernel
+   takes a pTemp buffer of at least one element, so nothing is allocated
+   per call or per level of recursion. */
+
+#ifndef GBL_SORT_SUFFIX_
+#   error "GBL_SORT_SUFFIX_ must be defined before including gimbal_sort_.h"
+#endif
+
+#define GBL_SORT_FN_(name)          GBL_SORT_FN__(name, GBL_SORT_SUFFIX_)
+#define GBL_SORT_FN__(name, sfx)    GBL_SORT_FN___(name, sfx)
+#define GBL_SORT_FN___(name, sfx)   gblSort_##name##sfx##_
+#define GBL_SORT_AT_(p, i)          ((p) + (size_t)(i) * GBL_SORT_WIDTH_)
+
+GBL_INLINE void GBL_SORT_FN_(copy)(void* pDst, const void* pSrc, size_t elemSize) {
+    GBL_UNUSED(elemSize);
+    memcpy(pDst, pSrc, GBL_SORT_WIDTH_);
+}
+
+GBL_INLINE void GBL_SORT_FN_(swap)(void* pA, void* pB, size_t elemSize) {
+    GBL_UNUSED(elemSize);
+#ifdef GBL_SORT_GENERIC_
+    unsigned char  temp[64];
+    unsigned char* pBytesA = pA;
+    unsigned char* pBytesB = pB;
+
+    for(size_t remaining = elemSize; remaining; ) {
+        const size_t chunk = remaining < sizeof(temp)? remaining : sizeof(temp);
+
+        memcpy(temp,    pBytesA, chunk);
+        memcpy(pBytesA, pBytesB, chunk);
+        memcpy(pBytesB, temp,    chunk);
+
+        pBytesA   += chunk;
+        pBytesB   += chunk;
+        remaining -= chunk;
+    }
+#else
+    unsigned char temp[GBL_SORT_WIDTH_];
+
+    memcpy(temp, pA,   GBL_SORT_WIDTH_);
+    memcpy(pA,   pB,   GBL_SORT_WIDTH_);
+    memcpy(pB,   temp, GBL_SORT_WIDTH_);
+#endif
+}
+
+GBL_INLINE void GBL_SORT_FN_(sort2)(char* pA, char* pB, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    if(pFnCmp(pB, pA) < 0)
+        GBL_SORT_FN_(swap)(pA, pB, elemSize);
+}
+
+GBL_INLINE void GBL_SORT_FN_(sort3)(char* pA, char* pB, char* pC, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    GBL_SORT_FN_(sort2)(pA, pB, elemSize, pFnCmp);
+    GBL_SORT_FN_(sort2)(pB, pC, elemSize, pFnCmp);
+    GBL_SORT_FN_(sort2)(pA, pB, elemSize, pFnCmp);
+}
+
+// Stable insertion sort of [pBegin, pEnd); unguarded if the element before pBegin is no greater than any within it
+static void GBL_SORT_FN_(insertion)(char*               pBegin,
+                                    char*               pEnd,
+                                    size_t              elemSize,
+                                    GblSortComparatorFn pFnCmp,
+                                    void*               pTemp,
+                                    GblBool             guarded)
+{
+    if(pBegin == pEnd) return;
+
+    for(char* pCur = GBL_SORT_AT_(pBegin, 1); pCur < pEnd; pCur += GBL_SORT_WIDTH_) {
+        char* pSift = pCur;
+
+        if(pFnCmp(pSift, pSift - GBL_SORT_WIDTH_) < 0) {
+            GBL_SORT_FN_(copy)(pTemp, pSift, elemSize);
+
+            do {
+                GBL_SORT_FN_(copy)(pSift, pSift - GBL_SORT_WIDTH_, elemSize);
+                pSift -= GBL_SORT_WIDTH_;
+            } while((!guarded || pSift != pBegin) && pFnCmp(pTemp, pSift - GBL_SORT_WIDTH_) < 0);
+
+            GBL_SORT_FN_(copy)(pSift, pTemp, elemSize);
+        }
+    }
+}
+
+// Insertion sort which gives up, returning GBL_FALSE, once it has moved more than a handful of elements
+static GblBool GBL_SORT_FN_(insertionPartial)(char*               pBegin,
+                                              char*               pEnd,
+                                              size_t              elemSize,
+                                              GblSortComparatorFn pFnCmp,
+                                              void*               pTemp)
+{
+    size_t moves = 0;
+
+    if(pBegin == pEnd) return GBL_TRUE;
+
+    for(char* pCur = GBL_SORT_AT_(pBegin, 1); pCur < pEnd; pCur += GBL_SORT_WIDTH_) {
+        char* pSift = pCur;
+
+        if(pFnCmp(pSift, pSift - GBL_SORT_WIDTH_) < 0) {
+            GBL_SORT_FN_(copy)(pTemp, pSift, elemSize);
+
+            do {
+                GBL_SORT_FN_(copy)(pSift, pSift - GBL_SORT_WIDTH_, elemSize);
+                pSift -= GBL_SORT_WIDTH_;
+            } while(pSift != pBegin && pFnCmp(pTemp, pSift - GBL_SORT_WIDTH_) < 0);
+
+            GBL_SORT_FN_(copy)(pSift, pTemp, elemSize);
+            moves += (size_t)(pCur - pSift) / GBL_SORT_WIDTH_;
+        }
+
+        if(moves > GBL_SORT_PARTIAL_INSERTION_LIMIT_)
+            return GBL_FALSE;
+    }
+
+    return GBL_TRUE;
+}
+
+static void GBL_SORT_FN_(siftDown)(char*               pBegin,
+                                   size_t              root,
+                                   size_t              count,
+                                   size_t              elemSize,
+                                   GblSortComparatorFn pFnCmp)
+{
+    for(size_t child; (child = root * 2 + 1) < count; root = child) {
+        if(child + 1 < count && pFnCmp(GBL_SORT_AT_(pBegin, child), GBL_SORT_AT_(pBegin, child + 1)) < 0)
+            ++child;
+
+        if(!(pFnCmp(GBL_SORT_AT_(pBegin, root), GBL_SORT_AT_(pBegin, child)) < 0))
+            break;
+
+        GBL_SORT_FN_(swap)(GBL_SORT_AT_(pBegin, root), GBL_SORT_AT_(pBegin, child), elemSize);
+    }
+}
+
+// Fallback which bounds the worst case to O(n log n) once partitioning keeps going badly
+static void GBL_SORT_FN_(heap)(char* pBegin, char* pEnd, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    size_t count = (size_t)(pEnd - pBegin) / GBL_SORT_WIDTH_;
+
+    for(size_t root = count / 2; root--; )
+        GBL_SORT_FN_(siftDown)(pBegin, root, count, elemSize, pFnCmp);
+
+    while(count > 1) {
+        GBL_SORT_FN_(swap)(pBegin, GBL_SORT_AT_(pBegin, --count), elemSize);
+        GBL_SORT_FN_(siftDown)(pBegin, 0, count, elemSize, pFnCmp);
+    }
+}
+
+/* Partitions [pBegin, pEnd) around the pivot at pBegin, with elements
+   equal to it on the right, returning where the pivot ends up and
+   whether no elements had to be swapped. Requires the median-of-3 to
+   have left an element no less than the pivot at the end. */
+static char* GBL_SORT_FN_(partitionRight)(char*               pBegin,
+                                          char*               pEnd,
+                                          size_t              elemSize,
+                                          GblSortComparatorFn pFnCmp,
+                                          GblBool*            pPartitioned)
+{
+    char* pFirst = pBegin;
+    char* pLast  = pEnd;
+
+    while(pFnCmp(pFirst += GBL_SORT_WIDTH_, pBegin) < 0);
+
+    if(pFirst - GBL_SORT_WIDTH_ == pBegin)
+        while(pFirst < pLast && !(pFnCmp(pLast -= GBL_SORT_WIDTH_, pBegin) < 0));
+    else
+        while(!(pFnCmp(pLast -= GBL_SORT_WIDTH_, pBegin) < 0));
+
+    *pPartitioned = pFirst >= pLast;
+
+    while(pFirst < pLast) {
+        GBL_SORT_FN_(swap)(pFirst, pLast, elemSize);
+        while(pFnCmp(pFirst += GBL_SORT_WIDTH_, pBegin) < 0);
+        while(!(pFnCmp(pLast -= GBL_SORT_WIDTH_, pBegin) < 0));
+    }
+
+    pFirst -= GBL_SORT_WIDTH_;
+    GBL_SORT_FN_(swap)(pBegin, pFirst, elemSize);
+
+    return pFirst;
+}
+
+/* Partitions [pBegin, pEnd) around the pivot at pBegin, with elements
+   equal to it on the left, returning where the pivot ends up. Used when
+   the pivot equals the element before the range, which means everything
+   equal to it is already in its final place, so runs of duplicates are
+   skipped over in linear time. */
+static char* GBL_SORT_FN_(partitionLeft)(char*               pBegin,
+                                         char*               pEnd,
+                                         size_t              elemSize,
+                                         GblSortComparatorFn pFnCmp)
+{
+    char* pFirst = pBegin;
+    char* pLast  = pEnd;
+
+    while(pFnCmp(pBegin, pLast -= GBL_SORT_WIDTH_) < 0);
+
+    if(pLast + GBL_SORT_WIDTH_ == pEnd)
+        while(pFirst < pLast && !(pFnCmp(pBegin, pFirst += GBL_SORT_WIDTH_) < 0));
+    else
+        while(!(pFnCmp(pBegin, pFirst += GBL_SORT_WIDTH_) < 0));
+
+    while(pFirst < pLast) {
+        GBL_SORT_FN_(swap)(pFirst, pLast, elemSize);
+        while(pFnCmp(pBegin, pLast -= GBL_SORT_WIDTH_) < 0);
+        while(!(pFnCmp(pBegin, pFirst += GBL_SORT_WIDTH_) < 0));
+    }
+
+    GBL_SORT_FN_(swap)(pBegin, pLast, elemSize);
+
+    return pLast;
+}
+
+// Pattern-defeating quicksort, recursing into the smaller partition so the stack stays O(log n)
+static void GBL_SORT_FN_(pdq)(char*               pBegin,
+                              char*               pEnd,
+                              size_t              elemSize,
+                              GblSortComparatorFn pFnCmp,
+                              void*               pTemp,
+                              unsigned            badAllowed,
+                              GblBool             leftmost)
+{
+    for(;;) {
+        const size_t count = (size_t)(pEnd - pBegin) / GBL_SORT_WIDTH_;
+
+        if(count < GBL_SORT_INSERTION_THRESHOLD_) {
+            GBL_SORT_FN_(insertion)(pBegin, pEnd, elemSize, pFnCmp, pTemp, leftmost);
+            return;
+        }
+
+        // choose the pivot as the median of 3, or the pseudomedian of 9 for larger ranges
+        const size_t half = count / 2;
+        char* const  pMid = GBL_SORT_AT_(pBegin, half);
+        char* const  pTop = pEnd - GBL_SORT_WIDTH_;
+
+        if(count > GBL_SORT_NINTHER_THRESHOLD_) {
+            GBL_SORT_FN_(sort3)(pBegin, pMid, pTop, elemSize, pFnCmp);
+            GBL_SORT_FN_(sort3)(GBL_SORT_AT_(pBegin, 1), pMid - GBL_SORT_WIDTH_, pTop - GBL_SORT_WIDTH_,
+                                elemSize, pFnCmp);
+            GBL_SORT_FN_(sort3)(GBL_SORT_AT_(pBegin, 2), pMid + GBL_SORT_WIDTH_, GBL_SORT_AT_(pTop, -2),
+                                elemSize, pFnCmp);
+            GBL_SORT_FN_(sort3)(pMid - GBL_SORT_WIDTH_, pMid, pMid + GBL_SORT_WIDTH_, elemSize, pFnCmp);
+            GBL_SORT_FN_(swap)(pBegin, pMid, elemSize);
+        } else {
+            GBL_SORT_FN_(sort3)(pMid, pBegin, pTop, elemSize, pFnCmp);
+        }
+
+        // an equal element before the range means the pivot is a duplicate of a previous one
+        if(!leftmost && !(pFnCmp(pBegin - GBL_SORT_WIDTH_, pBegin) < 0)) {
+            pBegin = GBL_SORT_FN_(partitionLeft)(pBegin, pEnd, elemSize, pFnCmp) + GBL_SORT_WIDTH_;
+            continue;
+        }
+
+        GblBool      partitioned;
+        char* const  pPivot = GBL_SORT_FN_(partitionRight)(pBegin, pEnd, elemSize, pFnCmp, &partitioned);
+        const size_t left   = (size_t)(pPivot - pBegin) / GBL_SORT_WIDTH_;
+        const size_t right  = (size_t)(pEnd - pPivot) / GBL_SORT_WIDTH_ - 1;
+
+        if(left < count / 8 || right < count / 8) {
+            if(!--badAllowed) {
+                GBL_SORT_FN_(heap)(pBegin, pEnd, elemSize, pFnCmp);
+                return;
+            }
+
+            // break up whatever pattern produced the bad pivot
+            if(left >= GBL_SORT_INSERTION_THRESHOLD_) {
+                GBL_SORT_FN_(swap)(pBegin, GBL_SORT_AT_(pBegin, left / 4), elemSize);
+                GBL_SORT_FN_(swap)(pPivot - GBL_SORT_WIDTH_, GBL_SORT_AT_(pPivot, -(ptrdiff_t)(left / 4)), elemSize);
+            }
+
+            if(right >= GBL_SORT_INSERTION_THRESHOLD_) {
+                GBL_SORT_FN_(swap)(pPivot + GBL_SORT_WIDTH_, GBL_SORT_AT_(pPivot, 1 + right / 4), elemSize);
+                GBL_SORT_FN_(swap)(pEnd - GBL_SORT_WIDTH_, GBL_SORT_AT_(pEnd, -(ptrdiff_t)(right / 4)), elemSize);
+            }
+        } else if(partitioned &&
+                  GBL_SORT_FN_(insertionPartial)(pBegin, pPivot, elemSize, pFnCmp, pTemp) &&
+                  GBL_SORT_FN_(insertionPartial)(pPivot + GBL_SORT_WIDTH_, pEnd, elemSize, pFnCmp, pTemp)) {
+            // already sorted, or very nearly
+            return;
+        }
+
+        if(left < right) {
+            GBL_SORT_FN_(pdq)(pBegin, pPivot, elemSize, pFnCmp, pTemp, badAllowed, leftmost);
+            pBegin   = pPivot + GBL_SORT_WIDTH_;
+            leftmost = GBL_FALSE;
+        } else {
+            GBL_SORT_FN_(pdq)(pPivot + GBL_SORT_WIDTH_, pEnd, elemSize, pFnCmp, pTemp, badAllowed, GBL_FALSE);
+            pEnd = pPivot;
+        }
+    }
+}
+
+// Stable binary insertion sort of [pBegin, pEnd), whose first presorted elements end at pSorted
+static void GBL_SORT_FN_(insertionBinary)(char*               pBegin,
+                                          char*               pSorted,
+                                          char*               pEnd,
+                                          size_t              elemSize,
+                                          GblSortComparatorFn pFnCmp,
+                                          void*               pTemp)
+{
+    for(char* pCur = pSorted; pCur < pEnd; pCur += GBL_SORT_WIDTH_) {
+        size_t lo = 0;
+        size_t hi = (size_t)(pCur - pBegin) / GBL_SORT_WIDTH_;
+
+        // after any equal elements, to stay stable
+        while(lo < hi) {
+            const size_t mid = lo + (hi - lo) / 2;
+
+            if(pFnCmp(pCur, GBL_SORT_AT_(pBegin, mid)) < 0) hi = mid;
+            else lo = mid + 1;
+        }
+
+        char* const pDst = GBL_SORT_AT_(pBegin, lo);
+
+        if(pDst != pCur) {
+            GBL_SORT_FN_(copy)(pTemp, pCur, elemSize);
+            memmove(pDst + GBL_SORT_WIDTH_, pDst, (size_t)(pCur - pDst));
+            GBL_SORT_FN_(copy)(pDst, pTemp, elemSize);
+        }
+    }
+}
+
+// Returns the end of the run starting at pBegin, reversing it first if it's strictly descending
+static char* GBL_SORT_FN_(run)(char* pBegin, char* pEnd, size_t elemSize, GblSortComparatorFn pFnCmp) {
+    char* pRun = GBL_SORT_AT_(pBegin, 1);
+
+    if(pRun == pEnd) return pRun;
+
+    if(pFnCmp(pRun, pBegin) < 0) {
+        while((pRun += GBL_SORT_WIDTH_) < pEnd && pFnCmp(pRun, pRun - GBL_SORT_WIDTH_) < 0);
+
+        for(char* pLo = pBegin, *pHi = pRun - GBL_SORT_WIDTH_; pLo < pHi;
+            pLo += GBL_SORT_WIDTH_, pHi -= GBL_SORT_WIDTH_)
+            GBL_SORT_FN_(swap)(pLo, pHi, elemSize);
+    } else {
+        while((pRun += GBL_SORT_WIDTH_) < pEnd && !(pFnCmp(pRun, pRun - GBL_SORT_WIDTH_) < 0));
+    }
+
+    return pRun;
+}
+
+// Returns how many elements of [pBegin, pBegin + count) are less than pKey, or also equal to it if upper is set
+static size_t GBL_SORT_FN_(bound)(const char*         pBegin,
+                                  size_t              count,
+                                  const void*         pKey,
+                                  size_t              elemSize,
+                                  GblSortComparatorFn pFnCmp,
+                                  GblBool             upper)
+{
+    size_t lo = 0;
+
+    GBL_UNUSED(elemSize);
+
+    while(count) {
+        const size_t half = count / 2;
+        const int    cmp  = pFnCmp(GBL_SORT_AT_(pBegin, lo + half), pKey);
+
+        if(cmp < 0 || (upper && cmp == 0)) {
+            lo    += half + 1;
+            count -= half + 1;
+        } else {
+            count  = half;
+        }
+    }
+
+    return lo;
+}
+
+static void GBL_SORT_FN_(reverse)(char* pBegin, char* pEnd, size_t elemSize) {
+    while(pBegin < (pEnd -= GBL_SORT_WIDTH_)) {
+        GBL_SORT_FN_(swap)(pBegin, pEnd, elemSize);
+        pBegin += GBL_SORT_WIDTH_;
+    }
+}
+
+/* Merges without any scratch memory, by rotating each block of the second
+   run into place within the first. Quadratic in the worst case, it's only
+   the fallback for when scratch memory can't be allocated. */
+static void GBL_SORT_FN_(mergeInPlace)(char*               pBegin,
+                                       char*               pMid,
+                                       char*               pEnd,
+                                       size_t              elemSize,
+                                       GblSortComparatorFn pFnCmp)
+{
+    while(pBegin < pMid && pMid < pEnd) {
+        pBegin = GBL_SORT_AT_(pBegin, GBL_SORT_FN_(bound)(pBegin, (size_t)(pMid - pBegin) / GBL_SORT_WIDTH_,
+                                                          pMid, elemSize, pFnCmp, GBL_TRUE));
+        if(pBegin == pMid) return;
+
+        char* const pCut = GBL_SORT_AT_(pMid, GBL_SORT_FN_(bound)(pMid, (size_t)(pEnd - pMid) / GBL_SORT_WIDTH_,
+                                                                  pBegin, elemSize, pFnCmp, GBL_FALSE));
+
+        GBL_SORT_FN_(reverse)(pBegin, pMid, elemSize);
+        GBL_SORT_FN_(reverse)(pMid,   pCut, elemSize);
+        GBL_SORT_FN_(reverse)(pBegin, pCut, elemSize);
+
+        pBegin += pCut - pMid;
+        pMid    = pCut;
+    }
+}
+
+/* Stably merges the adjacent sorted runs [pBegin, pMid) and [pMid, pEnd),
+   through a scratch buffer holding the smaller of the two. Elements of
+   the first run which are already no greater than the second's first,
+   and of the second which are already greater than the first's last,
+   are trimmed off before anything is copied. */
+static void GBL_SORT_FN_(merge)(char*               pBegin,
+                                char*               pMid,
+                                char*               pEnd,
+                                size_t              elemSize,
+                                GblSortComparatorFn pFnCmp,
+                                GblSortScratch_*    pScratch)
+{
+    pBegin = GBL_SORT_AT_(pBegin, GBL_SORT_FN_(bound)(pBegin, (size_t)(pMid - pBegin) / GBL_SORT_WIDTH_,
+                                                      pMid, elemSize, pFnCmp, GBL_TRUE));
+    if(pBegin == pMid) return;
+
+    pEnd = GBL_SORT_AT_(pMid, GBL_SORT_FN_(bound)(pMid, (size_t)(pEnd - pMid) / GBL_SORT_WIDTH_,
+                                                  pMid - GBL_SORT_WIDTH_, elemSize, pFnCmp, GBL_FALSE));
+
+    const size_t leftBytes  = (size_t)(pMid - pBegin);
+    const size_t rightBytes = (size_t)(pEnd - pMid);
+
+    char* const pBuffer    = gblSortScratch_(pScratch, leftBytes < rightBytes? leftBytes : rightBytes);
+
+    if(!pBuffer) {
+        GBL_SORT_FN_(mergeInPlace)(pBegin, pMid, pEnd, elemSize, pFnCmp);
+    } else if(leftBytes <= rightBytes) {
+        char*       pLeft    = pBuffer;
+        const char* pLeftEnd = pLeft + leftBytes;
+        char*       pRight   = pMid;
+        char*       pOut     = pBegin;
+
+        memcpy(pLeft, pBegin, leftBytes);
+
+        // the first element of the right run is known to come first
+        GBL_SORT_FN_(copy)(pOut, pRight, elemSize);
+        pOut   += GBL_SORT_WIDTH_;
+        pRight += GBL_SORT_WIDTH_;
+
+        while(pLeft < pLeftEnd && pRight < pEnd) {
+            if(pFnCmp(pRight, pLeft) < 0) {
+                GBL_SORT_FN_(copy)(pOut, pRight, elemSize);
+                pRight += GBL_SORT_WIDTH_;
+            } else {
+                GBL_SORT_FN_(copy)(pOut, pLeft, elemSize);
+                pLeft  += GBL_SORT_WIDTH_;
+            }
+
+            pOut += GBL_SORT_WIDTH_;
+        }
+
+        memcpy(pOut, pLeft, (size_t)(pLeftEnd - pLeft));
+    } else {
+        char* const pRightBegin = pBuffer;
+        char*       pRight      = pRightBegin + rightBytes;
+        char*       pLeft       = pMid;
+        char*       pOut        = pEnd;
+
+        memcpy(pRightBegin, pMid, rightBytes);
+
+        // the last element of the left run is known to come last
+        pOut  -= GBL_SORT_WIDTH_;
+        pLeft -= GBL_SORT_WIDTH_;
+        GBL_SORT_FN_(copy)(pOut, pLeft, elemSize);
+
+        while(pLeft > pBegin && pRight > pRightBegin) {
+            pOut -= GBL_SORT_WIDTH_;
+
+            if(pFnCmp(pRight - GBL_SORT_WIDTH_, pLeft - GBL_SORT_WIDTH_) < 0) {
+                pLeft  -= GBL_SORT_WIDTH_;
+                GBL_SORT_FN_(copy)(pOut, pLeft, elemSize);
+            } else {
+                pRight -= GBL_SORT_WIDTH_;
+                GBL_SORT_FN_(copy)(pOut, pRight, elemSize);
+            }
+        }
+
+        memcpy(pBegin, pRightBegin, (size_t)(pRight - pRightBegin));
+    }
+}
+
+/* Stable natural merge sort in the style of timsort: ascending and
+   strictly descending runs are found and extended to a minimum length
+   with binary insertion sort, then merged while keeping the pending runs'
+   lengths growing like the Fibonacci sequence, so merges stay balanced
+   and the run stack stays logarithmic. */
+static void GBL_SORT_FN_(tim)(char*               pBegin,
+                              char*               pEnd,
+                              size_t              elemSize,
+                              GblSortComparatorFn pFnCmp,
+                              GblSortScratch_*    pScratch,
+                              void*               pTemp)
+{
+    const size_t count  = (size_t)(pEnd - pBegin) / GBL_SORT_WIDTH_;
+    const size_t minRun = gblSortMinRun_(count);
+    char*        runs[GBL_SORT_RUNS_MAX_ + 1];
+    size_t       pending = 0;
+
+    for(char* pRun = pBegin; pRun < pEnd; ) {
+        char* pRunEnd = GBL_SORT_FN_(run)(pRun, pEnd, elemSize, pFnCmp);
+
+        if((size_t)(pRunEnd - pRun) / GBL_SORT_WIDTH_ < minRun) {
+            char* const pForced = (size_t)(pEnd - pRun) / GBL_SORT_WIDTH_ < minRun?
+                                      pEnd : GBL_SORT_AT_(pRun, minRun);
+
+            GBL_SORT_FN_(insertionBinary)(pRun, pRunEnd, pForced, elemSize, pFnCmp, pTemp);
+            pRunEnd = pForced;
+        }
+
+        runs[pending++] = pRun;
+        runs[pending]   = pRunEnd;
+        pRun            = pRunEnd;
+
+        // runs[i] begins the ith pending run, which ends where the next begins
+        for(;;) {
+            size_t n = pending - 1;
+
+#define GBL_SORT_RUN_LENGTH_(i) ((size_t)(runs[(i) + 1] - runs[(i)]))
+            if((n >= 1 && GBL_SORT_RUN_LENGTH_(n - 1) <= GBL_SORT_RUN_LENGTH_(n)) ||
+               (n >= 2 && GBL_SORT_RUN_LENGTH_(n - 2) <= GBL_SORT_RUN_LENGTH_(n - 1) + GBL_SORT_RUN_LENGTH_(n)) ||
+               (n >= 3 && GBL_SORT_RUN_LENGTH_(n - 3) <= GBL_SORT_RUN_LENGTH_(n - 2) + GBL_SORT_RUN_LENGTH_(n - 1))) {
+                if(n >= 2 && GBL_SORT_RUN_LENGTH_(n - 2) < GBL_SORT_RUN_LENGTH_(n))
+                    --n;
+            } else {
+                break;
+            }
+#undef GBL_SORT_RUN_LENGTH_
+
+            // merge runs n - 1 and n
+            GBL_SORT_FN_(merge)(runs[n - 1], runs[n], runs[n + 1], elemSize, pFnCmp, pScratch);
+
+            for(size_t r = n; r < pending; ++r)
+                runs[r] = runs[r + 1];
+
+            --pending;
+        }
+    }
+
+    while(pending > 1) {
+        GBL_SORT_FN_(merge)(runs[pending - 2], runs[pending - 1], runs[pending], elemSize, pFnCmp, pScratch);
+        runs[pending - 1] = runs[pending];
+        --pending;
+    }
+}
+
+#undef GBL_SORT_AT_
+#undef GBL_SORT_FN___
+#undef GBL_SORT_FN__
+#undef GBL_SORT_FN_
+#undef GBL_SORT_WIDTH_
+#undef GBL_SORT_SUFFIX_
+#undef GBL_SORT_GENERIC_
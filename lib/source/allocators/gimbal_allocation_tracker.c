@@ -83,8 +83,10 @@ GBL_EXPORT GBL_RESULT GblAllocationTracker_allocEvent(GblAllocationTracker* pSel
 
     GblAllocationTracker_* pSelf_ = (GblAllocationTracker_*)pSelf;
 
+    // Ignore nested events from our own hash set, without clearing the flag for the outer event
+    if(pSelf_->recursing) return GBL_RESULT_SUCCESS;
+
     GBL_CTX_BEGIN(GblHashSet_context(&pSelf_->activeSet));
-    if(pSelf_->recursing) GBL_CTX_DONE();
 
     pSelf_->recursing = GBL_TRUE;
     GBL_CTX_VERIFY(GblHashSet_insert(&pSelf_->activeSet, &entry),
@@ -128,8 +130,10 @@ GBL_EXPORT GBL_RESULT GblAllocationTracker_reallocEvent(GblAllocationTracker*
     };
 
     GblAllocationTracker_* pSelf_ = (GblAllocationTracker_*)pSelf;
+    // Ignore nested events from our own hash set, without clearing the flag for the outer event
+    if(pSelf_->recursing) return GBL_RESULT_SUCCESS;
+
     GBL_CTX_BEGIN(GblHashSet_context(&pSelf_->activeSet));
-    if(pSelf_->recursing) GBL_CTX_DONE();
 
     pSelf_->recursing = GBL_TRUE;
     GblAllocationEntry_* pExistingEntry = GblHashSet_extract(&pSelf_->activeSet, &entry);
@@ -164,8 +168,10 @@ GBL_EXPORT GBL_RESULT GblAllocationTracker_reallocEvent(GblAllocationTracker*
 
 GBL_EXPORT GBL_RESULT GblAllocationTracker_freeEvent(GblAllocationTracker* pSelf, const void* pPtr, GblSourceLocation srcLoc) {
     GblAllocationTracker_* pSelf_ = (GblAllocationTracker_*)pSelf;
+    // Ignore nested events from our own hash set, without clearing the flag for the outer event
+    if(pSelf_->recursing) return GBL_RESULT_SUCCESS;
+
     GBL_CTX_BEGIN(GblHashSet_context(&pSelf_->activeSet));
-    if(pSelf_->recursing) GBL_CTX_DONE();
 
     const GblAllocationEntry_ entry = {
         .pPointer   = pPtr
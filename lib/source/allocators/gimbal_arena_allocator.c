@@ -4,19 +4,37 @@
 
 #define GBL_ARENA_PAGE_(node)  GBL_LINKED_LIST_ENTRY(node, GblArenaAllocatorPage, listNode)
 
+#define GBL_ARENA_PAGE_EMPTY_(self)  ((self)->pActivePage == GBL_ARENA_PAGE_(&(self)->listNode))
+#define GBL_ARENA_LARGE_EMPTY_(self) ((self)->pLargeBlock == GBL_ARENA_PAGE_(&(self)->largeList))
+
 GBL_EXPORT GBL_RESULT (GblArenaAllocator_construct)(GblArenaAllocator*     pSelf,
                                                     size_t                 pageSize,
                                                     size_t                 pageAlign,
                                                     GblArenaAllocatorPage* pInitialPage,
-                                                    GblContext*            pCtx)
+                                                    GblContext*            pCtx,
+                                                    GBL_ARENA_GROWTH       growth,
+                                                    size_t                 maxPageSize)
 {
     GBL_CTX_BEGIN(pCtx);
+    GBL_CTX_VERIFY(growth <= GBL_ARENA_GROWTH_CAPPED,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Invalid arena growth policy: %d", growth);
+    GBL_CTX_VERIFY(growth != GBL_ARENA_GROWTH_CAPPED || maxPageSize >= pageSize,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Capped arena growth requires maxPageSize >= pageSize");
     memset(pSelf, 0, sizeof(GblArenaAllocator));
     pSelf->pCtx = pCtx;
     GblLinkedList_init(&pSelf->listNode);
-    if(pInitialPage)
+    GblLinkedList_init(&pSelf->largeList);
+    if(pInitialPage) {
         GblLinkedList_pushFront(&pSelf->listNode, &pInitialPage->listNode);
-    pSelf->pageSize = pageSize;
+        pSelf->pageCount = 1;
+        pSelf->capacity  = pInitialPage->capacity;
+    }
+    pSelf->pageSize     = pageSize;
+    pSelf->nextPageSize = pageSize;
+    pSelf->growth       = growth;
+    pSelf->maxPageSize  = maxPageSize;
     pSelf->pageAlign = pageAlign < GBL_ALIGNOF(GBL_MAX_ALIGN_T)? GBL_ALIGNOF(GBL_MAX_ALIGN_T) : pageAlign;
     GBL_CTX_END();
 }
@@ -38,43 +56,124 @@ static GblArenaAllocatorPage* GblArenaAllocator_allocPage_(GblContext* pCtx, siz
     return pPage;
 }
 
-GBL_EXPORT void* GblArenaAllocator_alloc(GblArenaAllocator* pSelf, size_t  size, size_t alignment) {
+static void GblArenaAllocator_pushPage_(GblArenaAllocator* pSelf, GblArenaAllocatorPage* pPage) {
+    if(!GBL_ARENA_PAGE_EMPTY_(pSelf))
+        pSelf->retiredBytes += pSelf->pActivePage->used;
+
+    GblLinkedList_pushFront(&pSelf->listNode, &pPage->listNode);
+
+    ++pSelf->pageCount;
+    pSelf->capacity += pPage->capacity;
+}
+
+static void GblArenaAllocator_popPage_(GblArenaAllocator* pSelf) {
+    GblArenaAllocatorPage* pPage = GBL_ARENA_PAGE_(GblLinkedList_popFront(&pSelf->listNode));
+
+    --pSelf->pageCount;
+    pSelf->capacity -= pPage->capacity;
+
+    if(!GBL_ARENA_PAGE_EMPTY_(pSelf))
+        pSelf->retiredBytes -= pSelf->pActivePage->used;
+
+    if(!pPage->staticAlloc) {
+        // resume growing from the reclaimed page's size rather than from where we left off
+        pSelf->nextPageSize = pPage->capacity;
+
+        GBL_CTX_BEGIN(pSelf->pCtx);
+        GBL_CTX_FREE(pPage);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
+static void GblArenaAllocator_popLargeBlock_(GblArenaAllocator* pSelf) {
+    GblArenaAllocatorPage* pPage = GBL_ARENA_PAGE_(GblLinkedList_popFront(&pSelf->largeList));
+
+    --pSelf->pageCount;
+    pSelf->capacity     -= pPage->capacity;
+    pSelf->retiredBytes -= pPage->used;
+
+    GBL_CTX_BEGIN(pSelf->pCtx);
+    GBL_CTX_FREE(pPage);
+    GBL_CTX_END_BLOCK();
+}
+
+// Gives a request which can't fit within a fresh page its own dedicated page, leaving the active page alone
+static void* GblArenaAllocator_allocLarge_(GblArenaAllocator* pSelf, size_t size, size_t alignment, size_t headerAlign) {
     void* pData = NULL;
-    if(size) {
 
-        GblArenaAllocatorPage* pPage = GBL_ARENA_PAGE_(GblLinkedList_front(&pSelf->listNode));
+    GBL_CTX_BEGIN(pSelf->pCtx);
+    const size_t blockAlign   = alignment > pSelf->pageAlign? alignment : pSelf->pageAlign;
+    const size_t payloadAlign = blockAlign < headerAlign? blockAlign : headerAlign;
+    const size_t padding      = alignment > payloadAlign? alignment - payloadAlign : 0;
+
+    GBL_CTX_VERIFY(size <= SIZE_MAX - padding - sizeof(GblArenaAllocatorPage) - blockAlign,
+                   GBL_RESULT_ERROR_OVERFLOW,
+                   "Cannot allocate large block of size %zu",
+                   size);
+
+    GblArenaAllocatorPage* pBlock = GblArenaAllocator_allocPage_(pSelf->pCtx,
+                                                                 size + padding,
+                                                                 blockAlign);
+    GBL_CTX_VERIFY_POINTER(pBlock);
+    GblLinkedList_pushFront(&pSelf->largeList, &pBlock->listNode);
+
+    pData = GblArenaAllocator_place_(pBlock, size, alignment);
+
+    ++pSelf->pageCount;
+    pSelf->capacity     += pBlock->capacity;
+    pSelf->retiredBytes += pBlock->used;
+    GBL_CTX_END_BLOCK();
+
+    return pData;
+}
+
+static void GblArenaAllocator_grow_(GblArenaAllocator* pSelf) {
+    if(pSelf->growth == GBL_ARENA_GROWTH_FIXED)
+        return;
+
+    size_t nextSize = pSelf->nextPageSize <= SIZE_MAX / 2?
+                          pSelf->nextPageSize * 2 : SIZE_MAX;
+
+    if(pSelf->growth == GBL_ARENA_GROWTH_CAPPED && nextSize > pSelf->maxPageSize)
+        nextSize = pSelf->maxPageSize;
+
+    pSelf->nextPageSize = nextSize;
+}
+
+// Slow path, only called by GblArenaAllocator_allocInline_() when the request doesn't fit the active page
+GBL_EXPORT void* (GblArenaAllocator_alloc)(GblArenaAllocator* pSelf, size_t  size, size_t alignment) {
+    void* pData = NULL;
+    if(size) {
 
         if(alignment == 0) alignment = GBL_ALIGNOF(GBL_MAX_ALIGN_T);
-        const size_t  actualSize = gblAlignedAllocSize(size, alignment);
 
-        if(!pPage || (pPage->capacity - pPage->used) < actualSize) {
-            if(actualSize <= pSelf->pageSize) {
-                GblArenaAllocatorPage* pNewPage = GblArenaAllocator_allocPage_(pSelf->pCtx,
-                                                                               pSelf->pageSize,
-                                                                               pSelf->pageAlign);
-                GblLinkedList_pushFront(&pSelf->listNode, &pNewPage->listNode);
+        if(!GBL_ARENA_PAGE_EMPTY_(pSelf))
+            pData = GblArenaAllocator_place_(pSelf->pActivePage, size, alignment);
+
+        if(!pData) {
+            // a fresh page's payload is aligned to both the page and its header, anything more may need padding
+            const size_t headerAlign  = offsetof(GblArenaAllocatorPage, bytes) & -offsetof(GblArenaAllocatorPage, bytes);
+            const size_t payloadAlign = pSelf->pageAlign < headerAlign? pSelf->pageAlign : headerAlign;
+            const size_t padding      = alignment > payloadAlign? alignment - payloadAlign : 0;
+
+            if(size > pSelf->nextPageSize || padding > pSelf->nextPageSize - size) {
+                pData = GblArenaAllocator_allocLarge_(pSelf, size, alignment, headerAlign);
             } else {
                 GBL_CTX_BEGIN(pSelf->pCtx);
-                GBL_CTX_VERIFY(actualSize <= pSelf->pageSize,
-                               GBL_RESULT_ERROR_OVERFLOW,
-                               "Cannot allocate chunk of size %u from pages of size %u",
-                               actualSize, pSelf->pageSize);
+                GblArenaAllocatorPage* pNewPage = GblArenaAllocator_allocPage_(pSelf->pCtx,
+                                                                               pSelf->nextPageSize,
+                                                                               pSelf->pageAlign);
+                GBL_CTX_VERIFY_POINTER(pNewPage);
+                GblArenaAllocator_pushPage_(pSelf, pNewPage);
+                GblArenaAllocator_grow_(pSelf);
+
+                pData = GblArenaAllocator_place_(pSelf->pActivePage, size, alignment);
                 GBL_CTX_END_BLOCK();
-                goto end;
             }
         }
 
-        pData = &pSelf->pActivePage->bytes[pSelf->pActivePage->used];
-        pSelf->pActivePage->used += actualSize;
-        ++pSelf->allocCount;
-
-        const uintptr_t rem = (uintptr_t)pData % alignment;
-        if(rem) {
-            uintptr_t advancePointer = (alignment - rem);
-            pData = (void*)(((uintptr_t)pData) + advancePointer);
-        }
+        if(pData) ++pSelf->allocCount;
     }
-end:
     return pData;
 }
 
@@ -84,6 +183,9 @@ GBL_EXPORT GBL_RESULT GblArenaAllocator_freeAll(GblArenaAllocator* pSelf) {
     GblLinkedListNode staticList;
     GblLinkedList_init(&staticList);
 
+    pSelf->pageCount = 0;
+    pSelf->capacity  = 0;
+
     GblLinkedListNode tempNode;
     // iterate over all pages, freeing the heap ones, accumulating + clearing the static ones
     for(GblLinkedListNode* pNode = pSelf->listNode.pNext;
@@ -97,6 +199,8 @@ GBL_EXPORT GBL_RESULT GblArenaAllocator_freeAll(GblArenaAllocator* pSelf) {
             pNode = &tempNode;
         } else {
             pPage->used = 0;
+            ++pSelf->pageCount;
+            pSelf->capacity += pPage->capacity;
             tempNode = *pNode;
             GblLinkedList_pushBack(&staticList, pNode);
             pNode = &tempNode;
@@ -105,65 +209,48 @@ GBL_EXPORT GBL_RESULT GblArenaAllocator_freeAll(GblArenaAllocator* pSelf) {
 
     GblLinkedList_init(&pSelf->listNode);
     GblLinkedList_joinFront(&pSelf->listNode, &staticList);
+
+    // large blocks are always heap-allocated
+    while(!GBL_ARENA_LARGE_EMPTY_(pSelf)) {
+        GblArenaAllocatorPage* pBlock = GBL_ARENA_PAGE_(GblLinkedList_popFront(&pSelf->largeList));
+        GBL_CTX_FREE(pBlock);
+    }
+
     pSelf->allocCount   = 0;
+    pSelf->retiredBytes = 0;
+    pSelf->nextPageSize = pSelf->pageSize;
 
     GBL_CTX_END();
 }
 
 GBL_EXPORT size_t  GblArenaAllocator_pageCount(const GblArenaAllocator* pSelf) {
-    return GblLinkedList_count(&pSelf->listNode);
+    return pSelf->pageCount;
 }
 
 GBL_EXPORT size_t  GblArenaAllocator_bytesUsed(const GblArenaAllocator* pSelf) {
-    size_t  bytes = 0;
-    for(GblLinkedListNode* pIt = pSelf->listNode.pNext;
-        pIt != &pSelf->listNode;
-        pIt = pIt->pNext)
-    {
-        bytes += GBL_ARENA_PAGE_(pIt)->used;
-    }
-    return bytes;
+    return pSelf->retiredBytes +
+           (GBL_ARENA_PAGE_EMPTY_(pSelf)? 0 : pSelf->pActivePage->used);
 }
 
 GBL_EXPORT size_t  GblArenaAllocator_totalCapacity(const GblArenaAllocator* pSelf) {
-    size_t  bytes = 0;
-    for(GblLinkedListNode* pIt = pSelf->listNode.pNext;
-        pIt != &pSelf->listNode;
-        pIt = pIt->pNext)
-    {
-        bytes += GBL_ARENA_PAGE_(pIt)->capacity;
-    }
-    return bytes;
+    return pSelf->capacity;
 }
 
 GBL_EXPORT float GblArenaAllocator_utilization(const GblArenaAllocator* pSelf) {
-    size_t  capacity = 0;
-    size_t  used = 0;
-    for(GblLinkedListNode* pIt = pSelf->listNode.pNext;
-        pIt != &pSelf->listNode;
-        pIt = pIt->pNext)
-    {
-        capacity += GBL_ARENA_PAGE_(pIt)->capacity;
-        used += GBL_ARENA_PAGE_(pIt)->used;
-    }
-    return (capacity != 0)? (float)used/(float)capacity : 0.0f;
+    return (pSelf->capacity != 0)?
+                (float)GblArenaAllocator_bytesUsed(pSelf)/(float)pSelf->capacity : 0.0f;
 }
 
 GBL_EXPORT size_t  GblArenaAllocator_fragmentedBytes(const GblArenaAllocator* pSelf) {
-    size_t  bytes = 0;
-    for(GblLinkedListNode* pIt = pSelf->listNode.pNext;
-        pIt != &pSelf->listNode;
-        pIt = pIt->pNext)
-    {
-        if(GBL_ARENA_PAGE_(pIt) == pSelf->pActivePage) continue;
-        bytes += GBL_ARENA_PAGE_(pIt)->capacity - GBL_ARENA_PAGE_(pIt)->used;
-    }
-    return bytes;
+    const size_t activeCapacity = GBL_ARENA_PAGE_EMPTY_(pSelf)?
+                                      0 : pSelf->pActivePage->capacity;
+
+    return (pSelf->capacity - activeCapacity) - pSelf->retiredBytes;
 }
 
 GBL_EXPORT size_t  GblArenaAllocator_bytesAvailable(const GblArenaAllocator* pSelf) {
     size_t  bytes = 0;
-    if(pSelf->pActivePage) {
+    if(!GBL_ARENA_PAGE_EMPTY_(pSelf)) {
         bytes = pSelf->pActivePage->capacity - pSelf->pActivePage->used;
     }
     return bytes;
@@ -171,16 +258,26 @@ GBL_EXPORT size_t  GblArenaAllocator_bytesAvailable(const GblArenaAllocator* pSe
 
 GBL_EXPORT void GblArenaAllocator_saveState(const GblArenaAllocator* pSelf, GblArenaAllocatorState* pState) {
     pState->pActivePage = pSelf->pActivePage;
-    pState->bytesUsed   = pSelf->pActivePage->used;
+    pState->pLargeBlock = pSelf->pLargeBlock;
+    pState->bytesUsed   = GBL_ARENA_PAGE_EMPTY_(pSelf)? 0 : pSelf->pActivePage->used;
 }
 
 GBL_EXPORT GBL_RESULT GblArenaAllocator_loadState(GblArenaAllocator* pSelf, const GblArenaAllocatorState* pState) {
     GBL_CTX_BEGIN(pSelf->pCtx);
+    while(pSelf->pLargeBlock != pState->pLargeBlock) {
+        GBL_CTX_VERIFY(!GBL_ARENA_LARGE_EMPTY_(pSelf),
+                       GBL_RESULT_ERROR_INVALID_ARG,
+                       "Cannot load state from a large block not owned by the arena!");
+        GblArenaAllocator_popLargeBlock_(pSelf);
+    }
     while(pSelf->pActivePage != pState->pActivePage) {
-        GblArenaAllocatorPage* pPage = GBL_ARENA_PAGE_(GblLinkedList_popFront(&pSelf->listNode));
-        GBL_CTX_FREE(pPage);
+        GBL_CTX_VERIFY(!GBL_ARENA_PAGE_EMPTY_(pSelf),
+                       GBL_RESULT_ERROR_INVALID_ARG,
+                       "Cannot load state from a page not owned by the arena!");
+        GblArenaAllocator_popPage_(pSelf);
     }
-    pSelf->pActivePage->used = pState->bytesUsed;
+    if(!GBL_ARENA_PAGE_EMPTY_(pSelf))
+        pSelf->pActivePage->used = pState->bytesUsed;
     GBL_CTX_END();
 }
 
@@ -0,0 +1,412 @@
+#include <gimbal/allocators/gimbal_concurrent_pool_allocator.h>
+#include <gimbal/core/gimbal_ctx.h>
+#include <gimbal/algorithms/gimbal_numeric.h>
+#include <tinycthread.h>
+#include <stdatomic.h>
+
+#define GBL_CONCURRENT_POOL_MAGAZINE_SIZE_DEFAULT_  32  // Entries per magazine when none is given
+#define GBL_CONCURRENT_POOL_MAGAZINE_COUNT_DEFAULT_ 64  // Depot magazines when none is given
+#define GBL_CONCURRENT_POOL_STACK_INDEX_(head)      ((uint32_t)((head) & 0xffffffff))
+#define GBL_CONCURRENT_POOL_STACK_TAG_(head)        ((head) >> 32)
+
+// Free entries are threaded into singly-linked lists through their first word
+typedef struct GblConcurrentPoolEntry_ {
+    struct GblConcurrentPoolEntry_* pNext;
+} GblConcurrentPoolEntry_;
+
+/* A magazine is just the header for a detached list of free entries
+   while it's sitting within the depot, so handing one off moves a whole
+   batch of entries at once. */
+typedef struct GblConcurrentPoolMagazine_ {
+    _Atomic(uint32_t)        next;      // 1-based index of the next magazine within its stack
+    size_t                   count;
+    GblConcurrentPoolEntry_* pEntries;
+} GblConcurrentPoolMagazine_;
+
+typedef struct GblConcurrentPoolList_ {
+    GblConcurrentPoolEntry_* pHead;
+    size_t                   count;
+} GblConcurrentPoolList_;
+
+/* Per-thread cache: the "loaded" magazine is allocated from and freed to,
+   while the "previous" one lets a thread bounce back and forth across a
+   magazine boundary without hitting the depot every time. Caches are never
+   freed before the allocator, and are recycled when their thread exits. */
+typedef struct GblConcurrentPoolCache_ {
+    GBL_ALIGNAS(64)
+    GblConcurrentPoolList_          loaded;
+    GblConcurrentPoolList_          previous;
+    _Atomic(intptr_t)               liveEntries;    // Only written by the owning thread, may go negative
+    GblConcurrentPoolDepot_*        pDepot;
+    struct GblConcurrentPoolCache_* pNext;
+    atomic_bool                     claimed;
+} GblConcurrentPoolCache_;
+
+/* Shared state: two ABA-tagged Treiber stacks of magazine indices, one
+   holding magazines full of entries and one holding unused headers, plus
+   the backing pool, which is only locked when the depot runs dry or when
+   it has no room left for another full magazine. */
+struct GblConcurrentPoolDepot_ {
+    GBL_ALIGNAS(64)
+    _Atomic(uint64_t)                 fullStack;
+    GBL_ALIGNAS(64)
+    _Atomic(uint64_t)                 emptyStack;
+    atomic_size_t                     fullCount;
+    GBL_ALIGNAS(64)
+    _Atomic(GblConcurrentPoolCache_*) pCaches;
+    tss_t                             cacheKey;
+    mtx_t                             poolMtx;
+    GblPoolAllocator                  pool;
+    size_t                            magazineSize;
+    size_t                            magazineCount;
+    GblContext*                       pCtx;
+    GblConcurrentPoolMagazine_        magazines[];
+};
+
+static void GblConcurrentPool_stackPush_(GblConcurrentPoolDepot_*    pDepot,
+                                         _Atomic(uint64_t)*          pStack,
+                                         GblConcurrentPoolMagazine_* pMagazine)
+{
+    const uint64_t index = (uint64_t)(pMagazine - pDepot->magazines) + 1;
+    uint64_t       head  = atomic_load_explicit(pStack, memory_order_relaxed);
+    uint64_t       newHead;
+
+    do {
+        atomic_store_explicit(&pMagazine->next,
+                              GBL_CONCURRENT_POOL_STACK_INDEX_(head),
+                              memory_order_relaxed);
+        newHead = ((GBL_CONCURRENT_POOL_STACK_TAG_(head) + 1) << 32) | index;
+    } while(!atomic_compare_exchange_weak_explicit(pStack, &head, newHead,
+                                                   memory_order_release,
+                                                   memory_order_relaxed));
+}
+
+static GblConcurrentPoolMagazine_* GblConcurrentPool_stackPop_(GblConcurrentPoolDepot_* pDepot,
+                                                              _Atomic(uint64_t)*       pStack)
+{
+    uint64_t head = atomic_load_explicit(pStack, memory_order_acquire);
+    uint64_t newHead;
+    uint32_t index;
+
+    do {
+        index = GBL_CONCURRENT_POOL_STACK_INDEX_(head);
+
+        if(!index)
+            return NULL;
+
+        // headers are never freed while the allocator lives, and the tag catches a stale read
+        newHead = ((GBL_CONCURRENT_POOL_STACK_TAG_(head) + 1) << 32) |
+                  atomic_load_explicit(&pDepot->magazines[index-1].next, memory_order_relaxed);
+    } while(!atomic_compare_exchange_weak_explicit(pStack, &head, newHead,
+                                                   memory_order_acquire,
+                                                   memory_order_acquire));
+
+    return &pDepot->magazines[index-1];
+}
+
+// Carves a full magazine's worth of entries out of the backing pool
+static GblConcurrentPoolList_ GblConcurrentPool_poolTake_(GblConcurrentPoolDepot_* pDepot) {
+    GblConcurrentPoolList_ list = { NULL, 0 };
+
+    mtx_lock(&pDepot->poolMtx);
+    while(list.count < pDepot->magazineSize) {
+        GblConcurrentPoolEntry_* pEntry = GblPoolAllocator_new(&pDepot->pool);
+
+        if(!pEntry) break;
+
+        pEntry->pNext = list.pHead;
+        list.pHead    = pEntry;
+        ++list.count;
+    }
+    mtx_unlock(&pDepot->poolMtx);
+
+    return list;
+}
+
+static void GblConcurrentPool_poolGive_(GblConcurrentPoolDepot_* pDepot, GblConcurrentPoolList_* pList) {
+    mtx_lock(&pDepot->poolMtx);
+    while(pList->pHead) {
+        GblConcurrentPoolEntry_* pEntry = pList->pHead;
+        pList->pHead = pEntry->pNext;
+        GblPoolAllocator_delete(&pDepot->pool, pEntry);
+    }
+    mtx_unlock(&pDepot->poolMtx);
+
+    pList->count = 0;
+}
+
+static GblConcurrentPoolList_ GblConcurrentPool_depotTake_(GblConcurrentPoolDepot_* pDepot) {
+    GblConcurrentPoolMagazine_* pMagazine = GblConcurrentPool_stackPop_(pDepot, &pDepot->fullStack);
+
+    if(!pMagazine)
+        return GblConcurrentPool_poolTake_(pDepot);
+
+    const GblConcurrentPoolList_ list = { pMagazine->pEntries, pMagazine->count };
+
+    atomic_fetch_sub_explicit(&pDepot->fullCount, 1, memory_order_relaxed);
+    GblConcurrentPool_stackPush_(pDepot, &pDepot->emptyStack, pMagazine);
+
+    return list;
+}
+
+static void GblConcurrentPool_depotGive_(GblConcurrentPoolDepot_* pDepot, GblConcurrentPoolList_* pList) {
+    if(!pList->count)
+        return;
+
+    GblConcurrentPoolMagazine_* pMagazine = GblConcurrentPool_stackPop_(pDepot, &pDepot->emptyStack);
+
+    if(!pMagazine) {
+        GblConcurrentPool_poolGive_(pDepot, pList);
+        return;
+    }
+
+    pMagazine->pEntries = pList->pHead;
+    pMagazine->count    = pList->count;
+    pList->pHead        = NULL;
+    pList->count        = 0;
+
+    GblConcurrentPool_stackPush_(pDepot, &pDepot->fullStack, pMagazine);
+    atomic_fetch_add_explicit(&pDepot->fullCount, 1, memory_order_relaxed);
+}
+
+// Called on thread exit, hands the thread's entries back to everyone else
+static void GblConcurrentPool_cacheRelease_(void* pData) {
+    GblConcurrentPoolCache_* pCache = pData;
+
+    GblConcurrentPool_depotGive_(pCache->pDepot, &pCache->loaded);
+    GblConcurrentPool_depotGive_(pCache->pDepot, &pCache->previous);
+
+    atomic_store_explicit(&pCache->claimed, GBL_FALSE, memory_order_release);
+}
+
+static GblConcurrentPoolCache_* GblConcurrentPool_cacheCreate_(GblConcurrentPoolDepot_* pDepot) {
+    GblConcurrentPoolCache_* pCache = NULL;
+
+    // recycle a cache left behind by an exited thread before creating another
+    for(pCache = atomic_load_explicit(&pDepot->pCaches, memory_order_acquire);
+        pCache;
+        pCache = pCache->pNext)
+    {
+        if(!atomic_load_explicit(&pCache->claimed, memory_order_relaxed) &&
+           !atomic_exchange_explicit(&pCache->claimed, GBL_TRUE, memory_order_acquire))
+            break;
+    }
+
+    if(!pCache) {
+        GBL_CTX_BEGIN(pDepot->pCtx);
+        pCache = GBL_CTX_MALLOC(gblAlignedAllocSize(sizeof(GblConcurrentPoolCache_),
+                                                    GBL_ALIGNOF(GblConcurrentPoolCache_)),
+                                GBL_ALIGNOF(GblConcurrentPoolCache_));
+        memset(pCache, 0, sizeof(GblConcurrentPoolCache_));
+        pCache->pDepot = pDepot;
+        atomic_init(&pCache->liveEntries, 0);
+        atomic_init(&pCache->claimed, GBL_TRUE);
+
+        pCache->pNext = atomic_load_explicit(&pDepot->pCaches, memory_order_relaxed);
+        while(!atomic_compare_exchange_weak_explicit(&pDepot->pCaches, &pCache->pNext, pCache,
+                                                     memory_order_release,
+                                                     memory_order_relaxed));
+        GBL_CTX_END_BLOCK();
+
+        if(!pCache) return NULL;
+    }
+
+    tss_set(pDepot->cacheKey, pCache);
+    return pCache;
+}
+
+GBL_INLINE GblConcurrentPoolCache_* GblConcurrentPool_cache_(GblConcurrentPoolDepot_* pDepot) {
+    GblConcurrentPoolCache_* pCache = tss_get(pDepot->cacheKey);
+
+    if(!pCache) GBL_UNLIKELY
+        pCache = GblConcurrentPool_cacheCreate_(pDepot);
+
+    return pCache;
+}
+
+GBL_EXPORT GBL_RESULT (GblConcurrentPoolAllocator_construct)(GblConcurrentPoolAllocator* pSelf,
+                                                             size_t                      entrySize,
+                                                             size_t                      entriesPerPage,
+                                                             size_t                      entryAlign,
+                                                             size_t                      magazineSize,
+                                                             size_t                      magazineCount,
+                                                             GblContext*                 pCtx)
+{
+    GBL_CTX_BEGIN(pCtx);
+    GBL_CTX_VERIFY_POINTER(pSelf);
+    GBL_CTX_VERIFY(entrySize >= sizeof(GblConcurrentPoolEntry_),
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Entry size must be able to hold a pointer: %zu",
+                   entrySize);
+
+    if(!entryAlign)    entryAlign    = GBL_ALIGNOF(GBL_MAX_ALIGN_T);
+    if(!magazineSize)  magazineSize  = GBL_CONCURRENT_POOL_MAGAZINE_SIZE_DEFAULT_;
+    if(!magazineCount) magazineCount = GBL_CONCURRENT_POOL_MAGAZINE_COUNT_DEFAULT_;
+
+    GBL_CTX_VERIFY(magazineCount < UINT32_MAX,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Too many depot magazines: %zu",
+                   magazineCount);
+
+    memset(pSelf, 0, sizeof(GblConcurrentPoolAllocator));
+
+    GblConcurrentPoolDepot_* pDepot =
+            GBL_CTX_MALLOC(gblAlignedAllocSize(sizeof(GblConcurrentPoolDepot_) +
+                                               sizeof(GblConcurrentPoolMagazine_) * magazineCount,
+                                               GBL_ALIGNOF(GblConcurrentPoolDepot_)),
+                           GBL_ALIGNOF(GblConcurrentPoolDepot_));
+
+    memset(pDepot, 0, sizeof(GblConcurrentPoolDepot_));
+    atomic_init(&pDepot->fullStack,  0);
+    atomic_init(&pDepot->emptyStack, 0);
+    atomic_init(&pDepot->fullCount,  0);
+    atomic_init(&pDepot->pCaches,    NULL);
+    pDepot->magazineSize  = magazineSize;
+    pDepot->magazineCount = magazineCount;
+    pDepot->pCtx          = pCtx;
+
+    for(size_t m = 0; m < magazineCount; ++m) {
+        atomic_init(&pDepot->magazines[m].next, 0);
+        pDepot->magazines[m].count    = 0;
+        pDepot->magazines[m].pEntries = NULL;
+        GblConcurrentPool_stackPush_(pDepot, &pDepot->emptyStack, &pDepot->magazines[m]);
+    }
+
+    if(tss_create(&pDepot->cacheKey, GblConcurrentPool_cacheRelease_) != thrd_success) {
+        GBL_CTX_FREE(pDepot);
+        GBL_CTX_VERIFY(GBL_FALSE,
+                       GBL_RESULT_ERROR_INTERNAL,
+                       "Failed to create thread-local cache key!");
+    }
+
+    if(!GBL_RESULT_SUCCESS(GblPoolAllocator_construct(&pDepot->pool,
+                                                      entrySize,
+                                                      entriesPerPage,
+                                                      entryAlign,
+                                                      GBL_NULL,
+                                                      pCtx)))
+    {
+        tss_delete(pDepot->cacheKey);
+        GBL_CTX_FREE(pDepot);
+        GBL_CTX_VERIFY(GBL_FALSE,
+                       GBL_RESULT_ERROR_INTERNAL,
+                       "Failed to construct backing pool!");
+    }
+
+    mtx_init(&pDepot->poolMtx, mtx_plain);
+
+    GBL_PRIV_REF(pSelf).pDepot = pDepot;
+    pSelf->entrySize           = entrySize;
+    pSelf->entryAlign          = entryAlign;
+    pSelf->magazineSize        = magazineSize;
+    pSelf->magazineCount       = magazineCount;
+    pSelf->pCtx                = pCtx;
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentPoolAllocator_destruct(GblConcurrentPoolAllocator* pSelf) {
+    GblConcurrentPoolDepot_* pDepot = GBL_PRIV_REF(pSelf).pDepot;
+
+    GBL_CTX_BEGIN(pSelf->pCtx);
+    GBL_CTX_VERIFY_POINTER(pDepot);
+
+    // no cache destructors may run once the key is gone, so every cache can go
+    tss_delete(pDepot->cacheKey);
+
+    GblConcurrentPoolCache_* pCache = atomic_load_explicit(&pDepot->pCaches, memory_order_acquire);
+    while(pCache) {
+        GblConcurrentPoolCache_* pNext = pCache->pNext;
+        GBL_CTX_FREE(pCache);
+        pCache = pNext;
+    }
+
+    // all entries, wherever they are cached, live within the backing pool's pages
+    GBL_CTX_VERIFY_CALL(GblPoolAllocator_destruct(&pDepot->pool));
+    mtx_destroy(&pDepot->poolMtx);
+
+    GBL_CTX_FREE(pDepot);
+    GBL_PRIV_REF(pSelf).pDepot = NULL;
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT void* GblConcurrentPoolAllocator_new(GblConcurrentPoolAllocator* pSelf) {
+    GblConcurrentPoolCache_* pCache = GblConcurrentPool_cache_(GBL_PRIV_REF(pSelf).pDepot);
+
+    if(!pCache)
+        return NULL;
+
+    if(!pCache->loaded.count) GBL_UNLIKELY {
+        if(pCache->previous.count) {
+            const GblConcurrentPoolList_ temp = pCache->loaded;
+            pCache->loaded   = pCache->previous;
+            pCache->previous = temp;
+        } else {
+            pCache->loaded = GblConcurrentPool_depotTake_(pCache->pDepot);
+
+            if(!pCache->loaded.count)
+                return NULL;
+        }
+    }
+
+    GblConcurrentPoolEntry_* pEntry = pCache->loaded.pHead;
+    pCache->loaded.pHead = pEntry->pNext;
+    --pCache->loaded.count;
+
+    atomic_store_explicit(&pCache->liveEntries,
+                          atomic_load_explicit(&pCache->liveEntries, memory_order_relaxed) + 1,
+                          memory_order_relaxed);
+
+    return pEntry;
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentPoolAllocator_delete(GblConcurrentPoolAllocator* pSelf, void* pEntry) {
+    GblConcurrentPoolDepot_* pDepot = GBL_PRIV_REF(pSelf).pDepot;
+    GblConcurrentPoolCache_* pCache = GblConcurrentPool_cache_(pDepot);
+
+    if(!pCache) GBL_UNLIKELY {
+        GblConcurrentPoolList_ list = { pEntry, 1 };
+        ((GblConcurrentPoolEntry_*)pEntry)->pNext = NULL;
+        GblConcurrentPool_poolGive_(pDepot, &list);
+        return GBL_RESULT_SUCCESS;
+    }
+
+    if(pCache->loaded.count == pDepot->magazineSize) GBL_UNLIKELY {
+        if(pCache->previous.count)
+            GblConcurrentPool_depotGive_(pDepot, &pCache->previous);
+
+        pCache->previous = pCache->loaded;
+        pCache->loaded.pHead = NULL;
+        pCache->loaded.count = 0;
+    }
+
+    GblConcurrentPoolEntry_* pNode = pEntry;
+    pNode->pNext = pCache->loaded.pHead;
+    pCache->loaded.pHead = pNode;
+    ++pCache->loaded.count;
+
+    atomic_store_explicit(&pCache->liveEntries,
+                          atomic_load_explicit(&pCache->liveEntries, memory_order_relaxed) - 1,
+                          memory_order_relaxed);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+GBL_EXPORT size_t GblConcurrentPoolAllocator_activeEntries(const GblConcurrentPoolAllocator* pSelf) {
+    GblConcurrentPoolDepot_* pDepot = GBL_PRIV_REF(pSelf).pDepot;
+    intptr_t                 total  = 0;
+
+    for(GblConcurrentPoolCache_* pCache = atomic_load_explicit(&pDepot->pCaches, memory_order_acquire);
+        pCache;
+        pCache = pCache->pNext)
+    {
+        total += atomic_load_explicit(&pCache->liveEntries, memory_order_relaxed);
+    }
+
+    return total > 0? (size_t)total : 0;
+}
+
+GBL_EXPORT size_t GblConcurrentPoolAllocator_depotSize(const GblConcurrentPoolAllocator* pSelf) {
+    return atomic_load_explicit(&GBL_PRIV_REF(pSelf).pDepot->fullCount, memory_order_relaxed);
+}
@@ -0,0 +1,372 @@
+#include <gimbal/containers/gimbal_concurrent_ring_buffer.h>
+#include <gimbal/algorithms/gimbal_numeric.h>
+#include <stdatomic.h>
+
+#define GBL_CONCURRENT_RING_BUFFER_MASK_(self)  (GBL_PRIV_REF(self).capacity - 1)
+
+/* Producer and consumer indices live on separate cache lines so that each
+   side only ever writes to its own. They increase monotonically and are only
+   masked when indexing, so their difference is always the current size.
+   The cached indices are only used by SPSC buffers, where each one is a
+   private, possibly stale copy of the other side's index, which spares the
+   owner from touching the other side's cache line until it appears to be
+   full or empty.
+
+   MPMC buffers follow the state with one sequence number per slot: a slot
+   at position "pos" may be written once its sequence reaches "pos," may be
+   read once it reaches "pos + 1," and is handed back to producers by
+   advancing it to "pos + capacity." */
+struct GblConcurrentRingBufferState_ {
+    GBL_ALIGNAS(64)
+    atomic_size_t tail;
+    size_t        cachedHead;
+    GBL_ALIGNAS(64)
+    atomic_size_t head;
+    size_t        cachedTail;
+    GBL_ALIGNAS(64)
+    atomic_size_t sequences[];
+};
+
+GBL_INLINE uint8_t* GblConcurrentRingBuffer_slot_(const GblConcurrentRingBuffer* pSelf, size_t pos) GBL_NOEXCEPT {
+    return &GBL_PRIV_REF(pSelf).pData[(pos & GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf)) *
+                                      GBL_PRIV_REF(pSelf).elementSize];
+}
+
+// Copies "count" elements between the buffer, starting at "pos," and a flat array, splitting it at the wrap-around point
+GBL_INLINE void GblConcurrentRingBuffer_copyIn_(GblConcurrentRingBuffer* pSelf, size_t pos, const void* pData, size_t count) GBL_NOEXCEPT {
+    const size_t elementSize = GBL_PRIV_REF(pSelf).elementSize;
+    const size_t index       = pos & GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+    const size_t first       = GBL_MIN(count, GBL_PRIV_REF(pSelf).capacity - index);
+
+    memcpy(&GBL_PRIV_REF(pSelf).pData[index * elementSize], pData, first * elementSize);
+    memcpy(GBL_PRIV_REF(pSelf).pData, (const uint8_t*)pData + first * elementSize, (count - first) * elementSize);
+}
+
+GBL_INLINE void GblConcurrentRingBuffer_copyOut_(const GblConcurrentRingBuffer* pSelf, size_t pos, void* pData, size_t count) GBL_NOEXCEPT {
+    const size_t elementSize = GBL_PRIV_REF(pSelf).elementSize;
+    const size_t index       = pos & GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+    const size_t first       = GBL_MIN(count, GBL_PRIV_REF(pSelf).capacity - index);
+
+    memcpy(pData, &GBL_PRIV_REF(pSelf).pData[index * elementSize], first * elementSize);
+    memcpy((uint8_t*)pData + first * elementSize, GBL_PRIV_REF(pSelf).pData, (count - first) * elementSize);
+}
+
+/* Claims up to "count" consecutive slots for writing with a single CAS on
+   the tail. Every slot within the run is checked to be writable first,
+   since consumers may release slots out of order; once the CAS succeeds,
+   nobody else can claim them. Returns the number claimed, with their
+   first position stored in "pPos." */
+static size_t GblConcurrentRingBuffer_claimBackMpmc_(GblConcurrentRingBuffer* pSelf, size_t count, size_t* pPos) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+    const size_t                   mask   = GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+    size_t                         pos    = atomic_load_explicit(&pState->tail, memory_order_relaxed);
+
+    for(;;) {
+        size_t n = 0;
+
+        while(n < count) {
+            const size_t   seq  = atomic_load_explicit(&pState->sequences[(pos + n) & mask],
+                                                       memory_order_acquire);
+            const intptr_t diff = (intptr_t)(seq - (pos + n));
+
+            if(diff == 0) {
+                ++n;
+            } else if(diff < 0 || n) {
+                // Either the buffer is full, or we've claimed as much of it as we can
+                break;
+            } else {
+                // Another producer got here first, so start over from the new tail
+                n = SIZE_MAX;
+                break;
+            }
+        }
+
+        if(n == SIZE_MAX) {
+            pos = atomic_load_explicit(&pState->tail, memory_order_relaxed);
+        } else if(!n) {
+            return 0;
+        } else if(atomic_compare_exchange_weak_explicit(&pState->tail, &pos, pos + n,
+                                                        memory_order_relaxed,
+                                                        memory_order_relaxed)) {
+            *pPos = pos;
+            return n;
+        }
+    }
+}
+
+// Consumer-side mirror of GblConcurrentRingBuffer_claimBackMpmc_()
+static size_t GblConcurrentRingBuffer_claimFrontMpmc_(GblConcurrentRingBuffer* pSelf, size_t count, size_t* pPos) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+    const size_t                   mask   = GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+    size_t                         pos    = atomic_load_explicit(&pState->head, memory_order_relaxed);
+
+    for(;;) {
+        size_t n = 0;
+
+        while(n < count) {
+            const size_t   seq  = atomic_load_explicit(&pState->sequences[(pos + n) & mask],
+                                                       memory_order_acquire);
+            const intptr_t diff = (intptr_t)(seq - (pos + n + 1));
+
+            if(diff == 0) {
+                ++n;
+            } else if(diff < 0 || n) {
+                break;
+            } else {
+                n = SIZE_MAX;
+                break;
+            }
+        }
+
+        if(n == SIZE_MAX) {
+            pos = atomic_load_explicit(&pState->head, memory_order_relaxed);
+        } else if(!n) {
+            return 0;
+        } else if(atomic_compare_exchange_weak_explicit(&pState->head, &pos, pos + n,
+                                                        memory_order_relaxed,
+                                                        memory_order_relaxed)) {
+            *pPos = pos;
+            return n;
+        }
+    }
+}
+
+// Returns how many slots the SPSC producer may write, refreshing its view of the head only when it appears full
+GBL_INLINE size_t GblConcurrentRingBuffer_availableBackSpsc_(GblConcurrentRingBuffer* pSelf, size_t tail, size_t count) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState    = GBL_PRIV_REF(pSelf).pState;
+    size_t                         available = GBL_PRIV_REF(pSelf).capacity - (tail - pState->cachedHead);
+
+    if(available < count) {
+        pState->cachedHead = atomic_load_explicit(&pState->head, memory_order_acquire);
+        available = GBL_PRIV_REF(pSelf).capacity - (tail - pState->cachedHead);
+    }
+
+    return GBL_MIN(available, count);
+}
+
+GBL_INLINE size_t GblConcurrentRingBuffer_availableFrontSpsc_(GblConcurrentRingBuffer* pSelf, size_t head, size_t count) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState    = GBL_PRIV_REF(pSelf).pState;
+    size_t                         available = pState->cachedTail - head;
+
+    if(available < count) {
+        pState->cachedTail = atomic_load_explicit(&pState->tail, memory_order_acquire);
+        available = pState->cachedTail - head;
+    }
+
+    return GBL_MIN(available, count);
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentRingBuffer_construct_5(GblConcurrentRingBuffer*        pSelf,
+                                                          size_t                          elementSize,
+                                                          size_t                          capacity,
+                                                          GBL_CONCURRENT_RING_BUFFER_MODE mode,
+                                                          GblContext*                     pCtx) GBL_NOEXCEPT
+{
+    GBL_CTX_BEGIN(pCtx);
+    GBL_CTX_VERIFY_POINTER(pSelf);
+    GBL_CTX_VERIFY_ARG(elementSize > 0);
+    GBL_CTX_VERIFY_ARG(capacity > 0);
+    GBL_CTX_VERIFY(mode == GBL_CONCURRENT_RING_BUFFER_MPMC ||
+                   mode == GBL_CONCURRENT_RING_BUFFER_SPSC,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Invalid GblConcurrentRingBuffer mode: %d", mode);
+
+    memset(pSelf, 0, sizeof(GblConcurrentRingBuffer));
+
+    // Sequence numbers can't tell a full slot from an empty one with only a single slot
+    capacity = gblPow2Next_u64(GBL_MAX(capacity, 2));
+
+    const size_t align       = GBL_ALIGNOF(GBL_MAX_ALIGN_T);
+    const size_t stateSize   = sizeof(GblConcurrentRingBufferState_) +
+                               (mode == GBL_CONCURRENT_RING_BUFFER_MPMC?
+                                    capacity * sizeof(atomic_size_t) : 0);
+    const size_t dataOffset  = ((stateSize + align - 1) / align) * align;
+    const size_t allocSize   = gblAlignedAllocSize(dataOffset + capacity * elementSize,
+                                                   GBL_ALIGNOF(GblConcurrentRingBufferState_));
+
+    GblConcurrentRingBufferState_* pState = GBL_CTX_MALLOC(allocSize,
+                                                           GBL_ALIGNOF(GblConcurrentRingBufferState_),
+                                                           "GblConcurrentRingBuffer");
+    memset(pState, 0, sizeof(GblConcurrentRingBufferState_));
+
+    if(mode == GBL_CONCURRENT_RING_BUFFER_MPMC)
+        for(size_t s = 0; s < capacity; ++s)
+            atomic_init(&pState->sequences[s], s);
+
+    GBL_PRIV_REF(pSelf).pState      = pState;
+    GBL_PRIV_REF(pSelf).pCtx        = pCtx;
+    GBL_PRIV_REF(pSelf).pData       = (uint8_t*)pState + dataOffset;
+    GBL_PRIV_REF(pSelf).capacity    = capacity;
+    GBL_PRIV_REF(pSelf).elementSize = elementSize;
+    GBL_PRIV_REF(pSelf).mode        = mode;
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentRingBuffer_construct_4(GblConcurrentRingBuffer*        pSelf,
+                                                          size_t                          elementSize,
+                                                          size_t                          capacity,
+                                                          GBL_CONCURRENT_RING_BUFFER_MODE mode) GBL_NOEXCEPT
+{
+    return GblConcurrentRingBuffer_construct_5(pSelf, elementSize, capacity, mode, GBL_NULL);
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentRingBuffer_construct_3(GblConcurrentRingBuffer* pSelf,
+                                                          size_t                   elementSize,
+                                                          size_t                   capacity) GBL_NOEXCEPT
+{
+    return GblConcurrentRingBuffer_construct_4(pSelf, elementSize, capacity, GBL_CONCURRENT_RING_BUFFER_MPMC);
+}
+
+GBL_EXPORT GBL_RESULT GblConcurrentRingBuffer_destruct(GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    GBL_CTX_BEGIN(GBL_PRIV_REF(pSelf).pCtx);
+    GBL_CTX_FREE(GBL_PRIV_REF(pSelf).pState);
+    GBL_PRIV_REF(pSelf).pState   = GBL_NULL;
+    GBL_PRIV_REF(pSelf).pData    = GBL_NULL;
+    GBL_PRIV_REF(pSelf).capacity = 0;
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblContext* GblConcurrentRingBuffer_context(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GBL_PRIV_REF(pSelf).pCtx;
+}
+
+GBL_EXPORT size_t GblConcurrentRingBuffer_capacity(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GBL_PRIV_REF(pSelf).capacity;
+}
+
+GBL_EXPORT size_t GblConcurrentRingBuffer_elementSize(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GBL_PRIV_REF(pSelf).elementSize;
+}
+
+GBL_EXPORT GBL_CONCURRENT_RING_BUFFER_MODE GblConcurrentRingBuffer_mode(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GBL_PRIV_REF(pSelf).mode;
+}
+
+GBL_EXPORT size_t GblConcurrentRingBuffer_size(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+
+    if(!pState) GBL_UNLIKELY
+        return 0;
+
+    // Reading the head first means the tail can only have moved further ahead of it, so just clamp the result
+    const size_t head = atomic_load_explicit(&pState->head, memory_order_acquire);
+    const size_t tail = atomic_load_explicit(&pState->tail, memory_order_acquire);
+
+    return GBL_MIN(tail - head, GBL_PRIV_REF(pSelf).capacity);
+}
+
+GBL_EXPORT GblBool GblConcurrentRingBuffer_empty(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GblConcurrentRingBuffer_size(pSelf) == 0;
+}
+
+GBL_EXPORT GblBool GblConcurrentRingBuffer_full(const GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    return GblConcurrentRingBuffer_size(pSelf) == GBL_PRIV_REF(pSelf).capacity;
+}
+
+GBL_EXPORT void* GblConcurrentRingBuffer_emplaceBack(GblConcurrentRingBuffer* pSelf) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+    size_t                         pos;
+
+    if(GBL_PRIV_REF(pSelf).mode == GBL_CONCURRENT_RING_BUFFER_SPSC) {
+        pos = atomic_load_explicit(&pState->tail, memory_order_relaxed);
+        if(!GblConcurrentRingBuffer_availableBackSpsc_(pSelf, pos, 1)) GBL_UNLIKELY
+            return GBL_NULL;
+    } else if(!GblConcurrentRingBuffer_claimBackMpmc_(pSelf, 1, &pos)) GBL_UNLIKELY {
+        return GBL_NULL;
+    }
+
+    return GblConcurrentRingBuffer_slot_(pSelf, pos);
+}
+
+GBL_EXPORT void GblConcurrentRingBuffer_commitBack(GblConcurrentRingBuffer* pSelf, void* pSlot) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+
+    if(GBL_PRIV_REF(pSelf).mode == GBL_CONCURRENT_RING_BUFFER_SPSC) {
+        GBL_UNUSED(pSlot);
+        atomic_store_explicit(&pState->tail,
+                              atomic_load_explicit(&pState->tail, memory_order_relaxed) + 1,
+                              memory_order_release);
+    } else {
+        /* A claimed slot's sequence still equals its position, and nobody
+           else may modify it until we publish it, so it can simply be bumped. */
+        const size_t index = ((uint8_t*)pSlot - GBL_PRIV_REF(pSelf).pData) / GBL_PRIV_REF(pSelf).elementSize;
+
+        atomic_store_explicit(&pState->sequences[index],
+                              atomic_load_explicit(&pState->sequences[index], memory_order_relaxed) + 1,
+                              memory_order_release);
+    }
+}
+
+GBL_EXPORT GblBool GblConcurrentRingBuffer_pushBack(GblConcurrentRingBuffer* pSelf, const void* pData) GBL_NOEXCEPT {
+    void* pSlot = GblConcurrentRingBuffer_emplaceBack(pSelf);
+
+    if(!pSlot) GBL_UNLIKELY
+        return GBL_FALSE;
+
+    memcpy(pSlot, pData, GBL_PRIV_REF(pSelf).elementSize);
+    GblConcurrentRingBuffer_commitBack(pSelf, pSlot);
+
+    return GBL_TRUE;
+}
+
+GBL_EXPORT GblBool GblConcurrentRingBuffer_popFront(GblConcurrentRingBuffer* pSelf, void* pData) GBL_NOEXCEPT {
+    return GblConcurrentRingBuffer_popFrontMany(pSelf, pData, 1) == 1;
+}
+
+GBL_EXPORT size_t GblConcurrentRingBuffer_pushBackMany(GblConcurrentRingBuffer* pSelf, const void* pData, size_t count) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+    size_t                         pos;
+
+    if(GBL_PRIV_REF(pSelf).mode == GBL_CONCURRENT_RING_BUFFER_SPSC) {
+        pos   = atomic_load_explicit(&pState->tail, memory_order_relaxed);
+        count = GblConcurrentRingBuffer_availableBackSpsc_(pSelf, pos, count);
+
+        if(count) GBL_LIKELY {
+            GblConcurrentRingBuffer_copyIn_(pSelf, pos, pData, count);
+            atomic_store_explicit(&pState->tail, pos + count, memory_order_release);
+        }
+    } else {
+        count = GblConcurrentRingBuffer_claimBackMpmc_(pSelf, count, &pos);
+
+        if(count) GBL_LIKELY {
+            const size_t mask = GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+
+            GblConcurrentRingBuffer_copyIn_(pSelf, pos, pData, count);
+
+            for(size_t e = 0; e < count; ++e)
+                atomic_store_explicit(&pState->sequences[(pos + e) & mask], pos + e + 1, memory_order_release);
+        }
+    }
+
+    return count;
+}
+
+GBL_EXPORT size_t GblConcurrentRingBuffer_popFrontMany(GblConcurrentRingBuffer* pSelf, void* pData, size_t count) GBL_NOEXCEPT {
+    GblConcurrentRingBufferState_* pState = GBL_PRIV_REF(pSelf).pState;
+    size_t                         pos;
+
+    if(GBL_PRIV_REF(pSelf).mode == GBL_CONCURRENT_RING_BUFFER_SPSC) {
+        pos   = atomic_load_explicit(&pState->head, memory_order_relaxed);
+        count = GblConcurrentRingBuffer_availableFrontSpsc_(pSelf, pos, count);
+
+        if(count) GBL_LIKELY {
+            GblConcurrentRingBuffer_copyOut_(pSelf, pos, pData, count);
+            atomic_store_explicit(&pState->head, pos + count, memory_order_release);
+        }
+    } else {
+        count = GblConcurrentRingBuffer_claimFrontMpmc_(pSelf, count, &pos);
+
+        if(count) GBL_LIKELY {
+            const size_t mask     = GBL_CONCURRENT_RING_BUFFER_MASK_(pSelf);
+            const size_t capacity = GBL_PRIV_REF(pSelf).capacity;
+
+            GblConcurrentRingBuffer_copyOut_(pSelf, pos, pData, count);
+
+            for(size_t e = 0; e < count; ++e)
+                atomic_store_explicit(&pState->sequences[(pos + e) & mask], pos + e + capacity, memory_order_release);
+        }
+    }
+
+    return count;
+}
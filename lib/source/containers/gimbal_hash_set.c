@@ -1,22 +1,146 @@
 #include <gimbal/containers/gimbal_hash_set.h>
 #include <gimbal/algorithms/gimbal_hash.h>
 #include <gimbal/algorithms/gimbal_numeric.h>
+#include <limits.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define GBL_HASH_SET_SSE2_
+#   include <emmintrin.h>
+#endif
+
+#define GBL_HASH_SET_GROUP_WIDTH_       16          // # of control words scanned at once
+#define GBL_HASH_SET_CTRL_EMPTY_        (-128)      // control word for a bucket that has never been used
+#define GBL_HASH_SET_CTRL_DELETED_      (-2)        // control word for a bucket whose entry was erased
+#define GBL_HASH_SET_FINGERPRINT_(hash) ((int8_t)(((uint32_t)(hash) * 0x9e3779b1u) >> 25))
+#define GBL_HASH_SET_MAX_LOAD_(buckets) ((buckets) - (buckets) / 8)
+#define GBL_HASH_SET_BATCH_SIZE_        32          // # of entries hashed at once by GblHashSet_insertMany()
+
+/* Control words are stored separately from the buckets, with non-negative
+   values holding a 7-bit fingerprint of a full bucket's hash, mixed from
+   all of its bits, while negative values mark empty and deleted buckets.
+   The first GBL_HASH_SET_GROUP_WIDTH_ - 1 control words are mirrored after
+   the last, so that a group starting anywhere can be loaded without
+   wrapping around. Each function below returns a bitmask of the matching
+   control words within the group starting at "pCtrl." */
+GBL_INLINE uint32_t GblHashSet_groupMatch_(const int8_t* pCtrl, int8_t ctrl) {
+#ifdef GBL_HASH_SET_SSE2_
+    const __m128i group = _mm_loadu_si128((const __m128i*)pCtrl);
+    return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(ctrl), group));
+#else
+    uint32_t mask = 0;
+    for(unsigned c = 0; c < GBL_HASH_SET_GROUP_WIDTH_; ++c)
+        mask |= (uint32_t)(pCtrl[c] == ctrl) << c;
+    return mask;
+#endif
+}
+
+GBL_INLINE uint32_t GblHashSet_groupMatchEmpty_(const int8_t* pCtrl) {
+    return GblHashSet_groupMatch_(pCtrl, GBL_HASH_SET_CTRL_EMPTY_);
+}
+
+GBL_INLINE uint32_t GblHashSet_groupMatchEmptyOrDeleted_(const int8_t* pCtrl) {
+#ifdef GBL_HASH_SET_SSE2_
+    return (uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)pCtrl));
+#else
+    uint32_t mask = 0;
+    for(unsigned c = 0; c < GBL_HASH_SET_GROUP_WIDTH_; ++c)
+        mask |= (uint32_t)(pCtrl[c] < 0) << c;
+    return mask;
+#endif
+}
+
+GBL_INLINE void* GblHashSet_bucketAt_(const struct GblHashSet *map, size_t index) {
+    return ((char*)GBL_PRIV_REF(map).pBuckets)+(GBL_PRIV_REF(map).bucketSize*index);
+}
 
-struct GblHashSetBucket_ {
-    uint32_t hash;
-    uint16_t dib;
-};
+GBL_INLINE uint32_t GblHashSet_getHash_(const struct GblHashSet *map, const void *key) {
+    return GBL_PRIV_REF(map).pFnHash(map, key);
+}
 
-GBL_INLINE struct GblHashSetBucket_* GblHashSet_bucketAt_(const struct GblHashSet *map, size_t index) {
-    return (struct GblHashSetBucket_*)(((char*)GBL_PRIV_REF(map).pBuckets)+(GBL_PRIV_REF(map).bucketSize*index));
+GBL_INLINE void GblHashSet_setCtrl_(struct GblHashSet* map, size_t index, int8_t ctrl) {
+    GBL_PRIV_REF(map).pCtrl[index] = ctrl;
+    if(index < GBL_HASH_SET_GROUP_WIDTH_ - 1)
+        GBL_PRIV_REF(map).pCtrl[GBL_PRIV_REF(map).bucketCount + index] = ctrl;
 }
 
-GBL_INLINE void *GblHashSet_bucketItem_(struct GblHashSetBucket_ *entry) {
-    return ((char*)entry) + sizeof(struct GblHashSetBucket_);
+/* Groups are probed quadratically, advancing by one more group each time,
+   which visits every group exactly once for power-of-two bucket counts. */
+static size_t GblHashSet_findIndex_(const struct GblHashSet* map, const void* key, uint32_t hash) {
+    const int8_t fingerprint = GBL_HASH_SET_FINGERPRINT_(hash);
+    size_t       pos         = hash & GBL_PRIV_REF(map).mask;
+    size_t       step        = 0;
+
+    // The entry is most likely in the very first bucket, so start fetching it alongside its control word
+    GBL_PREFETCH(GblHashSet_bucketAt_(map, pos));
+
+    for(;;) {
+        const int8_t* pGroup = &GBL_PRIV_REF(map).pCtrl[pos];
+
+        for(uint32_t m = GblHashSet_groupMatch_(pGroup, fingerprint); m; m &= m - 1) {
+            const size_t index = (pos + GBL_BITMASK_CTZ(m)) & GBL_PRIV_REF(map).mask;
+            if(GBL_PRIV_REF(map).pFnCompare(map, key, GblHashSet_bucketAt_(map, index)))
+                return index;
+        }
+
+        if(GblHashSet_groupMatchEmpty_(pGroup)) GBL_LIKELY
+            return SIZE_MAX;
+
+        step += GBL_HASH_SET_GROUP_WIDTH_;
+        pos   = (pos + step) & GBL_PRIV_REF(map).mask;
+    }
 }
 
-GBL_INLINE uint32_t GblHashSet_getHash_(const struct GblHashSet *map, const void *key) {
-    return GBL_PRIV_REF(map).pFnHash(map, key);
+// Returns the first empty or deleted bucket along the probe sequence for "hash"
+static size_t GblHashSet_findInsertIndex_(const struct GblHashSet* map, uint32_t hash) {
+    size_t pos  = hash & GBL_PRIV_REF(map).mask;
+    size_t step = 0;
+
+    for(;;) {
+        const uint32_t m = GblHashSet_groupMatchEmptyOrDeleted_(&GBL_PRIV_REF(map).pCtrl[pos]);
+
+        if(m) GBL_LIKELY
+            return (pos + GBL_BITMASK_CTZ(m)) & GBL_PRIV_REF(map).mask;
+
+        step += GBL_HASH_SET_GROUP_WIDTH_;
+        pos   = (pos + step) & GBL_PRIV_REF(map).mask;
+    }
+}
+
+// Fills in the empty or deleted bucket at "index" with a copy of "item"
+GBL_INLINE void* GblHashSet_place_(struct GblHashSet* map, size_t index, uint32_t hash, const void* item) {
+    void* pBucket = GblHashSet_bucketAt_(map, index);
+
+    if (GBL_PRIV_REF(map).pCtrl[index] == GBL_HASH_SET_CTRL_EMPTY_) {
+        --GBL_PRIV_REF(map).growthLeft;
+    }
+
+    GblHashSet_setCtrl_(map, index, GBL_HASH_SET_FINGERPRINT_(hash));
+    memcpy(pBucket, item, GBL_PRIV_REF(map).entrySize);
+    GBL_PRIV_REF(map).count++;
+    return pBucket;
+}
+
+// Returns the smallest bucket count whose maximum load can hold "count" entries
+static size_t GblHashSet_bucketsFor_(size_t count) {
+    size_t bucketCount = 16;
+    while (GBL_HASH_SET_MAX_LOAD_(bucketCount) < count) {
+        bucketCount *= 2;
+    }
+    return bucketCount;
+}
+
+/* Allocates the control words and the buckets they describe as a single
+   block, with every control word marked as empty. */
+static int8_t* GblHashSet_allocBuckets_(struct GblHashSet* map, size_t bucketCount, void** ppBuckets) {
+    int8_t* pCtrl = NULL;
+    const size_t ctrlSize = gblAlignedAllocSize(bucketCount + GBL_HASH_SET_GROUP_WIDTH_,
+                                                GBL_ALIGNOF(GBL_MAX_ALIGN_T));
+    GBL_CTX_BEGIN(GBL_PRIV_REF(map).pCtx);
+    pCtrl = GBL_CTX_MALLOC(ctrlSize + GBL_PRIV_REF(map).bucketSize * bucketCount);
+    memset(pCtrl, GBL_HASH_SET_CTRL_EMPTY_, bucketCount + GBL_HASH_SET_GROUP_WIDTH_);
+    *ppBuckets = pCtrl + ctrlSize;
+    GBL_CTX_END_BLOCK();
+    return pCtrl;
 }
 /// \endcond
 
@@ -43,7 +167,7 @@ GBL_EXPORT GBL_RESULT GblHashSet_construct_8(GblHashSet*      pSet,
             }
             capacity = ncap;
         }
-        size_t bucketsz = sizeof(struct GblHashSetBucket_) + elsize;
+        size_t bucketsz = elsize;
         while (bucketsz & (sizeof(uintptr_t)-1)) {
             bucketsz++;
         }
@@ -60,8 +184,10 @@ GBL_EXPORT GBL_RESULT GblHashSet_construct_8(GblHashSet*      pSet,
         GBL_PRIV_REF(pSet).capacity       = capacity;
         GBL_PRIV_REF(pSet).bucketCount    = capacity;
         GBL_PRIV_REF(pSet).mask           = GBL_PRIV_REF(pSet).bucketCount-1;
-        GBL_PRIV_REF(pSet).pBuckets       = GBL_CTX_MALLOC(GBL_PRIV_REF(pSet).bucketSize*GBL_PRIV_REF(pSet).bucketCount);
-        memset(GBL_PRIV_REF(pSet).pBuckets, 0, GBL_PRIV_REF(pSet).bucketSize*GBL_PRIV_REF(pSet).bucketCount);
+        GBL_PRIV_REF(pSet).growthLeft     = GBL_HASH_SET_MAX_LOAD_(GBL_PRIV_REF(pSet).bucketCount);
+        GBL_PRIV_REF(pSet).pCtrl          = GblHashSet_allocBuckets_(pSet,
+                                                                     GBL_PRIV_REF(pSet).bucketCount,
+                                                                     &GBL_PRIV_REF(pSet).pBuckets);
     }
     GBL_CTX_END();
 
@@ -114,6 +240,7 @@ GBL_EXPORT GBL_RESULT  GblHashSet_clone(GblHashSet* pSelf, const GblHashSet* pRh
                                        GBL_PRIV_REF(pRhs).capacity,
                                        pCtx,
                                        GBL_PRIV_REF(pRhs).pUserdata));
+    GBL_CTX_VERIFY_CALL(GblHashSet_reserve(pSelf, GBL_PRIV_REF(pRhs).count));
 
     for(size_t  s = 0; s < GBL_PRIV_REF(pRhs).bucketCount; ++s) {
         void* pEntry = GblHashSet_probe(pRhs, s);
@@ -150,8 +277,7 @@ GBL_EXPORT GBL_RESULT GblHashSet_assignMove(GblHashSet* pLhs, GblHashSet* pRhs)
 static void free_elements(GblHashSet *map) {
     if (GBL_PRIV_REF(map).pFnDestruct) {
         for (size_t i = 0; i < GBL_PRIV_REF(map).bucketCount; i++) {
-            struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-            if (bucket->dib) GBL_PRIV_REF(map).pFnDestruct(map, GblHashSet_bucketItem_(bucket));
+            if (GBL_PRIV_REF(map).pCtrl[i] >= 0) GBL_PRIV_REF(map).pFnDestruct(map, GblHashSet_bucketAt_(map, i));
         }
     }
 }
@@ -171,126 +297,139 @@ GBL_EXPORT void GblHashSet_clear(GblHashSet *map)  {
     if (update_cap) {
         GBL_PRIV_REF(map).capacity = GBL_PRIV_REF(map).bucketCount;
     } else if (GBL_PRIV_REF(map).bucketCount != GBL_PRIV_REF(map).capacity) {
-        void *new_buckets = GBL_CTX_MALLOC(GBL_PRIV_REF(map).bucketSize*GBL_PRIV_REF(map).capacity);
-        if (new_buckets) {
-            GBL_CTX_FREE(GBL_PRIV_REF(map).pBuckets);
+        void* new_buckets;
+        int8_t* new_ctrl = GblHashSet_allocBuckets_(map, GBL_PRIV_REF(map).capacity, &new_buckets);
+        if (new_ctrl) {
+            GBL_CTX_FREE(GBL_PRIV_REF(map).pCtrl);
+            GBL_PRIV_REF(map).pCtrl = new_ctrl;
             GBL_PRIV_REF(map).pBuckets = new_buckets;
         }
         GBL_PRIV_REF(map).bucketCount = GBL_PRIV_REF(map).capacity;
     }
-    memset(GBL_PRIV_REF(map).pBuckets, 0, GBL_PRIV_REF(map).bucketSize*GBL_PRIV_REF(map).bucketCount);
+    memset(GBL_PRIV_REF(map).pCtrl, GBL_HASH_SET_CTRL_EMPTY_, GBL_PRIV_REF(map).bucketCount + GBL_HASH_SET_GROUP_WIDTH_);
     GBL_PRIV_REF(map).mask = GBL_PRIV_REF(map).bucketCount-1;
+    GBL_PRIV_REF(map).growthLeft = GBL_HASH_SET_MAX_LOAD_(GBL_PRIV_REF(map).bucketCount);
     GBL_CTX_END_BLOCK();
 }
 
+// Rebuilds the table with at least "new_cap" buckets, which also discards any deleted buckets
 static GblBool resize(struct GblHashSet *map, size_t new_cap) {
+    GblBool success = GBL_FALSE;
     GBL_CTX_BEGIN(GBL_PRIV_REF(map).pCtx); {
+        size_t bucketCount = 16;
+        while (bucketCount < new_cap || GBL_HASH_SET_MAX_LOAD_(bucketCount) <= GBL_PRIV_REF(map).count) {
+            bucketCount *= 2;
+        }
+
+        void*   pBuckets;
+        int8_t* pCtrl = GblHashSet_allocBuckets_(map, bucketCount, &pBuckets);
+        GBL_CTX_VERIFY_LAST_RECORD();
+
         GblHashSet _map2;
         GblHashSet* map2 = &_map2;
-        GBL_CTX_CALL(GblHashSet_construct(map2,
-                                          GBL_PRIV_REF(map).entrySize,
-                                          GBL_PRIV_REF(map).pFnHash,
-                                          GBL_PRIV_REF(map).pFnCompare,
-                                          GBL_PRIV_REF(map).pFnDestruct,
-                                          new_cap,
-                                          GBL_PRIV_REF(map).pCtx,
-                                          GBL_PRIV_REF(map).pUserdata));
+        memcpy(map2, map, sizeof(GblHashSet));
+        GBL_PRIV_REF(map2).pCtrl       = pCtrl;
+        GBL_PRIV_REF(map2).pBuckets    = pBuckets;
+        GBL_PRIV_REF(map2).bucketCount = bucketCount;
+        GBL_PRIV_REF(map2).mask        = bucketCount-1;
 
         for (size_t i = 0; i < GBL_PRIV_REF(map).bucketCount; i++) {
-            struct GblHashSetBucket_ *entry = GblHashSet_bucketAt_(map, i);
-            if (!entry->dib) {
+            if (GBL_PRIV_REF(map).pCtrl[i] < 0) {
                 continue;
             }
-            entry->dib = 1;
-            size_t j = entry->hash & GBL_PRIV_REF(map2).mask;
-            for (;;) {
-                struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map2, j);
-                if (bucket->dib == 0) {
-                    memcpy(bucket, entry, GBL_PRIV_REF(map).bucketSize);
-                    break;
-                }
-                if (bucket->dib < entry->dib) {
-                    memcpy(GBL_PRIV_REF(map2).pSpare, bucket, GBL_PRIV_REF(map).bucketSize);
-                    memcpy(bucket, entry, GBL_PRIV_REF(map).bucketSize);
-                    memcpy(entry, GBL_PRIV_REF(map2).pSpare, GBL_PRIV_REF(map).bucketSize);
-                }
-                j = (j + 1) & GBL_PRIV_REF(map2).mask;
-                entry->dib += 1;
-            }
+            void* entry = GblHashSet_bucketAt_(map, i);
+            const uint32_t hash = GblHashSet_getHash_(map, entry);
+            const size_t j = GblHashSet_findInsertIndex_(map2, hash);
+            GblHashSet_setCtrl_(map2, j, GBL_PRIV_REF(map).pCtrl[i]);
+            memcpy(GblHashSet_bucketAt_(map2, j), entry, GBL_PRIV_REF(map).bucketSize);
         }
-        GBL_CTX_FREE(GBL_PRIV_REF(map).pBuckets);
-        GBL_PRIV_REF(map).pBuckets = GBL_PRIV_REF(map2).pBuckets;
-        GBL_PRIV_REF(map).bucketCount = GBL_PRIV_REF(map2).bucketCount;
-        GBL_PRIV_REF(map).mask = GBL_PRIV_REF(map2).mask;
-        GBL_CTX_FREE(GBL_PRIV_REF(map2).pSpare);
+        GBL_CTX_FREE(GBL_PRIV_REF(map).pCtrl);
+        GBL_PRIV_REF(map).pCtrl = pCtrl;
+        GBL_PRIV_REF(map).pBuckets = pBuckets;
+        GBL_PRIV_REF(map).bucketCount = bucketCount;
+        GBL_PRIV_REF(map).mask = bucketCount-1;
+        GBL_PRIV_REF(map).growthLeft = GBL_HASH_SET_MAX_LOAD_(bucketCount) - GBL_PRIV_REF(map).count;
+        success = GBL_TRUE;
     }
     GBL_CTX_END_BLOCK();
-    return GBL_TRUE;
+    return success;
 }
 
 GBL_EXPORT GBL_RESULT GblHashSet_shrinkToFit(GblHashSet* pSelf)  {
     GBL_CTX_BEGIN(GBL_PRIV_REF(pSelf).pCtx);
     if(GBL_PRIV_REF(pSelf).count < GBL_PRIV_REF(pSelf).bucketCount * 0.75) {
-        GBL_CTX_VERIFY_EXPRESSION(resize(pSelf, GBL_PRIV_REF(pSelf).bucketCount*0.75));
+        GBL_CTX_VERIFY_EXPRESSION(resize(pSelf, 0));
+    }
+    GBL_CTX_END();
+}
+
+/* Makes room for "additional" more entries without any further growth,
+   either by growing straight to the final size or, when deleted buckets
+   are what's in the way, by rebuilding in place. */
+static GblBool GblHashSet_reserveGrowth_(GblHashSet* pSelf, size_t additional) {
+    if(GBL_PRIV_REF(pSelf).growthLeft >= additional)
+        return GBL_TRUE;
+
+    return resize(pSelf, GblHashSet_bucketsFor_(GBL_PRIV_REF(pSelf).count + additional));
+}
+
+GBL_EXPORT GBL_RESULT GblHashSet_reserve(GblHashSet* pSelf, size_t count) {
+    GBL_CTX_BEGIN(GBL_PRIV_REF(pSelf).pCtx);
+    if(count > GBL_PRIV_REF(pSelf).count) {
+        GBL_CTX_VERIFY(GblHashSet_reserveGrowth_(pSelf, count - GBL_PRIV_REF(pSelf).count),
+                       GBL_RESULT_ERROR_MEM_REALLOC);
+        // Keep erasing from shrinking the table back down below what was reserved
+        GBL_PRIV_REF(pSelf).capacity = GBL_MAX(GBL_PRIV_REF(pSelf).capacity,
+                                               GBL_PRIV_REF(pSelf).bucketCount);
     }
     GBL_CTX_END();
 }
 
+GBL_EXPORT GBL_RESULT GblHashSet_rehash(GblHashSet* pSelf, size_t bucketCount) {
+    GBL_CTX_BEGIN(GBL_PRIV_REF(pSelf).pCtx);
+    GBL_CTX_VERIFY(resize(pSelf, bucketCount),
+                   GBL_RESULT_ERROR_MEM_REALLOC);
+    GBL_PRIV_REF(pSelf).capacity = GBL_PRIV_REF(pSelf).bucketCount;
+    GBL_CTX_END();
+}
+
 
 static void* GblHashSet_rawSet_(GblHashSet* map, const void* item, void** ppNewEntry)  {
     void* pPrevItem = NULL;
 
-    void* edata = GBL_ALLOCA(GBL_PRIV_REF(map).bucketSize);
-
     GBL_ASSERT(item);
 
-    if (GBL_PRIV_REF(map).count == GBL_PRIV_REF(map).bucketCount*0.75) {
-        GblBool result = resize(map, GBL_PRIV_REF(map).bucketCount*2);
+    const uint32_t hash = GblHashSet_getHash_(map, item);
+    size_t i = GblHashSet_findIndex_(map, item, hash);
+
+    if (i != SIZE_MAX) {
+        void* bucket = GblHashSet_bucketAt_(map, i);
+        memcpy(GBL_PRIV_REF(map).pSpare, bucket, GBL_PRIV_REF(map).entrySize);
+        memcpy(bucket, item, GBL_PRIV_REF(map).entrySize);
+        if(ppNewEntry) *ppNewEntry = bucket;
+        pPrevItem = GBL_PRIV_REF(map).pSpare;
+        goto done;
+    }
+
+    i = GblHashSet_findInsertIndex_(map, hash);
+
+    // Reusing a deleted bucket is always fine, but an empty one has to fit within the load factor
+    if (!GBL_PRIV_REF(map).growthLeft && GBL_PRIV_REF(map).pCtrl[i] == GBL_HASH_SET_CTRL_EMPTY_) {
+        // Rebuild at the same size when deleted buckets account for most of the load
+        const size_t new_cap = GBL_PRIV_REF(map).count < GBL_PRIV_REF(map).bucketCount*7/16?
+                                   GBL_PRIV_REF(map).bucketCount : GBL_PRIV_REF(map).bucketCount*2;
+        GblBool result = resize(map, new_cap);
         if(!result) {
             GBL_CTX_BEGIN(GBL_PRIV_REF(map).pCtx);
             GBL_CTX_VERIFY(result, GBL_RESULT_ERROR_MEM_REALLOC);
             GBL_CTX_END_BLOCK();
             goto done;
         }
+        i = GblHashSet_findInsertIndex_(map, hash);
     }
 
-    struct GblHashSetBucket_ *entry = edata;
-    entry->hash = GblHashSet_getHash_(map, item);
-    entry->dib = 1;
-    memcpy(GblHashSet_bucketItem_(entry), item, GBL_PRIV_REF(map).entrySize);
-
-    unsigned swaps = 0;
-    size_t i = entry->hash & GBL_PRIV_REF(map).mask;
-    for (;;) {
-        struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-        if (bucket->dib == 0) {
-            memcpy(bucket, entry, GBL_PRIV_REF(map).bucketSize);
-            if(ppNewEntry && !swaps) {
-                *ppNewEntry = GblHashSet_bucketItem_(bucket);
-            }
-            GBL_PRIV_REF(map).count++;
-            break;
-        }
-        if (entry->hash == bucket->hash && GBL_PRIV_REF(map).pFnCompare(map, GblHashSet_bucketItem_(entry), GblHashSet_bucketItem_(bucket)))
-        {
-            memcpy(GBL_PRIV_REF(map).pSpare, GblHashSet_bucketItem_(bucket), GBL_PRIV_REF(map).entrySize);
-            memcpy(GblHashSet_bucketItem_(bucket), GblHashSet_bucketItem_(entry), GBL_PRIV_REF(map).entrySize);
-            if(ppNewEntry) *ppNewEntry = GblHashSet_bucketItem_(bucket);
-            pPrevItem = GBL_PRIV_REF(map).pSpare;
-            break;
-        }
-        if (bucket->dib < entry->dib) {
-            memcpy(GBL_PRIV_REF(map).pSpare, bucket, GBL_PRIV_REF(map).bucketSize);
-            memcpy(bucket, entry, GBL_PRIV_REF(map).bucketSize);
-            memcpy(entry, GBL_PRIV_REF(map).pSpare, GBL_PRIV_REF(map).bucketSize);
-            if(!swaps && ppNewEntry) {
-                *ppNewEntry = GblHashSet_bucketItem_(bucket);
-                ++swaps;
-            }
-        }
-        i = (i + 1) & GBL_PRIV_REF(map).mask;
-        entry->dib += 1;
-    }
+    void* pBucket = GblHashSet_place_(map, i, hash, item);
+    if(ppNewEntry) *ppNewEntry = pBucket;
 done:
     return pPrevItem;
 }
@@ -321,11 +460,10 @@ GBL_EXPORT void* GblHashSet_set(GblHashSet *map, const void *item)  {
 // buckets in the hashmap.
 GBL_EXPORT void* GblHashSet_probe(const GblHashSet *map, size_t  position)  {
     size_t i = position & GBL_PRIV_REF(map).mask;
-    struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-    if (!bucket->dib) {
+    if (GBL_PRIV_REF(map).pCtrl[i] < 0) {
         return NULL;
     }
-    return GblHashSet_bucketItem_(bucket);
+    return GblHashSet_bucketAt_(map, i);
 }
 
 
@@ -347,39 +485,32 @@ GBL_EXPORT void* GblHashSet_extract(GblHashSet *map, const void* pKey)  {
 
     GBL_ASSERT(pKey);
 
-    uint32_t hash = GblHashSet_getHash_(map, pKey);
-    size_t i = hash & GBL_PRIV_REF(map).mask;
-    for (;;) {
-        struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-        if (!bucket->dib) {
-            break;
+    const size_t i = GblHashSet_findIndex_(map, pKey, GblHashSet_getHash_(map, pKey));
+    if (i != SIZE_MAX) {
+        memcpy(GBL_PRIV_REF(map).pSpare, GblHashSet_bucketAt_(map, i), GBL_PRIV_REF(map).entrySize);
+
+        /* The bucket can only be marked empty again if no probe sequence could
+           have ever found every bucket around it full and continued on past it,
+           which is true if there are empty buckets within the same group-width
+           window on both sides of it. */
+        const uint32_t emptyBefore = GblHashSet_groupMatchEmpty_(&GBL_PRIV_REF(map).pCtrl[(i - GBL_HASH_SET_GROUP_WIDTH_) & GBL_PRIV_REF(map).mask]);
+        const uint32_t emptyAfter  = GblHashSet_groupMatchEmpty_(&GBL_PRIV_REF(map).pCtrl[i]);
+        const GblBool  neverFull   = emptyBefore && emptyAfter &&
+                                     (GBL_BITMASK_CTZ(emptyAfter) +
+                                      GBL_BITMASK_CLZ(emptyBefore) - (sizeof(unsigned) * CHAR_BIT - GBL_HASH_SET_GROUP_WIDTH_))
+                                     < GBL_HASH_SET_GROUP_WIDTH_;
+
+        GblHashSet_setCtrl_(map, i, neverFull? GBL_HASH_SET_CTRL_EMPTY_ : GBL_HASH_SET_CTRL_DELETED_);
+        if (neverFull) ++GBL_PRIV_REF(map).growthLeft;
+
+        GBL_PRIV_REF(map).count--;
+        if (GBL_PRIV_REF(map).bucketCount > GBL_PRIV_REF(map).capacity && GBL_PRIV_REF(map).count <= GBL_PRIV_REF(map).bucketCount*0.1) {
+            // Ignore the return value. It's ok for the resize operation to
+            // fail to allocate enough memory because a shrink operation
+            // does not change the integrity of the data.
+            resize(map, GBL_PRIV_REF(map).bucketCount/2);
         }
-        if (bucket->hash == hash && GBL_PRIV_REF(map).pFnCompare(map, pKey, GblHashSet_bucketItem_(bucket)))
-        {
-            memcpy(GBL_PRIV_REF(map).pSpare, GblHashSet_bucketItem_(bucket), GBL_PRIV_REF(map).entrySize);
-            bucket->dib = 0;
-            for (;;) {
-                struct GblHashSetBucket_ *prev = bucket;
-                i = (i + 1) & GBL_PRIV_REF(map).mask;
-                bucket = GblHashSet_bucketAt_(map, i);
-                if (bucket->dib <= 1) {
-                    prev->dib = 0;
-                    break;
-                }
-                memcpy(prev, bucket, GBL_PRIV_REF(map).bucketSize);
-                prev->dib--;
-            }
-            GBL_PRIV_REF(map).count--;
-            if (GBL_PRIV_REF(map).bucketCount > GBL_PRIV_REF(map).capacity && GBL_PRIV_REF(map).count <= GBL_PRIV_REF(map).bucketCount*0.1) {
-                // Ignore the return value. It's ok for the resize operation to
-                // fail to allocate enough memory because a shrink operation
-                // does not change the integrity of the data.
-                resize(map, GBL_PRIV_REF(map).bucketCount/2);
-            }
-            pEntry = GBL_PRIV_REF(map).pSpare;
-            break;
-        }
-        i = (i + 1) & GBL_PRIV_REF(map).mask;
+        pEntry = GBL_PRIV_REF(map).pSpare;
     }
     return pEntry;
 }
@@ -391,7 +522,7 @@ GBL_EXPORT GBL_RESULT GblHashSet_destruct(GblHashSet *map)  {
     //if (!map) return
     GBL_CTX_BEGIN(GBL_PRIV_REF(map).pCtx);
     free_elements(map);
-    GBL_CTX_FREE(GBL_PRIV_REF(map).pBuckets);
+    GBL_CTX_FREE(GBL_PRIV_REF(map).pCtrl);
     GBL_CTX_FREE(GBL_PRIV_REF(map).pSpare);
     GBL_CTX_END();
 }
@@ -403,9 +534,8 @@ GBL_EXPORT GblBool GblHashSet_foreach(const GblHashSet *map,
                   GblHashSetIterFn iter, void* udata)
 {
     for (size_t i = 0; i < GBL_PRIV_REF(map).bucketCount; i++) {
-        struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-        if (bucket->dib) {
-            if (!iter(map, GblHashSet_bucketItem_(bucket), udata)) {
+        if (GBL_PRIV_REF(map).pCtrl[i] >= 0) {
+            if (!iter(map, GblHashSet_bucketAt_(map, i), udata)) {
                 return GBL_FALSE;
             }
         }
@@ -483,20 +613,9 @@ GBL_EXPORT void* GblHashSet_get(const GblHashSet* pSelf, const void *pKey) {
         GBL_CTX_VERIFY_POINTER(pKey);
         GBL_CTX_END_BLOCK();
     } else {
-        const uint32_t hash = GblHashSet_getHash_(pSelf, pKey);
-        size_t i = hash & GBL_PRIV_REF(pSelf).mask;
-        for (;;) {
-            struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(pSelf, i);
-            if (!bucket->dib) {
-                break;
-            }
-            if (bucket->hash == hash &&
-                GBL_PRIV_REF(pSelf).pFnCompare(pSelf, pKey, GblHashSet_bucketItem_(bucket)))
-            {
-                pEntry = GblHashSet_bucketItem_(bucket);
-                break;
-            }
-            i = (i + 1) & GBL_PRIV_REF(pSelf).mask;
+        const size_t i = GblHashSet_findIndex_(pSelf, pKey, GblHashSet_getHash_(pSelf, pKey));
+        if (i != SIZE_MAX) {
+            pEntry = GblHashSet_bucketAt_(pSelf, i);
         }
     }
     return pEntry;
@@ -509,20 +628,9 @@ GBL_EXPORT GblHashSetIter GblHashSet_find(const GblHashSet* map, const void* key
     };
 
     GBL_ASSERT(key);
-    uint32_t hash = GblHashSet_getHash_(map, key);
-    size_t i = hash & GBL_PRIV_REF(map).mask;
-    for (;;) {
-        struct GblHashSetBucket_ *bucket = GblHashSet_bucketAt_(map, i);
-        if (!bucket->dib) {
-            break;
-        }
-        if (bucket->hash == hash &&
-            GBL_PRIV_REF(map).pFnCompare(map, key, GblHashSet_bucketItem_(bucket)))
-        {
-            GBL_PRIV(it).bucketIdx = i;
-            break;
-        }
-        i = (i + 1) & GBL_PRIV_REF(map).mask;
+    const size_t i = GblHashSet_findIndex_(map, key, GblHashSet_getHash_(map, key));
+    if (i != SIZE_MAX) {
+        GBL_PRIV(it).bucketIdx = i;
     }
     return it;
 
@@ -569,6 +677,42 @@ GBL_EXPORT GblBool GblHashSet_insert(GblHashSet* pSet, const void* pItem) {
     return inserted;
 }
 
+/* Every entry is assumed to be new, so that the table grows at most once,
+   up-front. Entries are then hashed a batch at a time, which lets fetching
+   each one's control words overlap with hashing the rest of the batch. */
+GBL_EXPORT size_t GblHashSet_insertMany(GblHashSet* pSet, const void* pEntries, size_t count) {
+    size_t inserted = 0;
+    GBL_CTX_BEGIN(GBL_PRIV_REF(pSet).pCtx);
+    if(!count) GBL_CTX_DONE();
+    GBL_CTX_VERIFY_POINTER(pEntries);
+    GBL_CTX_VERIFY(GblHashSet_reserveGrowth_(pSet, count),
+                   GBL_RESULT_ERROR_MEM_REALLOC);
+
+    const size_t   entrySize = GBL_PRIV_REF(pSet).entrySize;
+    const uint8_t* pEntry    = pEntries;
+    uint32_t       hashes[GBL_HASH_SET_BATCH_SIZE_];
+
+    for(size_t b = 0; b < count; b += GBL_HASH_SET_BATCH_SIZE_) {
+        const size_t batchSize = GBL_MIN(GBL_HASH_SET_BATCH_SIZE_, count - b);
+
+        for(size_t e = 0; e < batchSize; ++e) {
+            hashes[e] = GblHashSet_getHash_(pSet, pEntry + e * entrySize);
+            GBL_PREFETCH((const char*)&GBL_PRIV_REF(pSet).pCtrl[hashes[e] & GBL_PRIV_REF(pSet).mask]);
+        }
+
+        for(size_t e = 0; e < batchSize; ++e, pEntry += entrySize) {
+            if(GblHashSet_findIndex_(pSet, pEntry, hashes[e]) != SIZE_MAX)
+                continue;
+
+            GblHashSet_place_(pSet, GblHashSet_findInsertIndex_(pSet, hashes[e]), hashes[e], pEntry);
+            ++inserted;
+        }
+    }
+
+    GBL_CTX_END_BLOCK();
+    return inserted;
+}
+
 GBL_EXPORT void GblHashSet_insertOrAssign(GblHashSet* pSet, const void* pEntry) {
     if(!pEntry) {
         GBL_CTX_BEGIN(GBL_PRIV_REF(pSet).pCtx);
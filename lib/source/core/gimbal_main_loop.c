@@ -1,2 +1,777 @@
 #include <gimbal/core/gimbal_main_loop.h>
+#include <gimbal/core/gimbal_task.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/meta/signals/gimbal_marshal.h>
+#include <tinycthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
 
+#define GBL_MAIN_LOOP_(self)            (GBL_PRIVATE(GblMainLoop, self))
+#define GBL_MAIN_LOOP_TASK_(node)       (GBL_DOUBLY_LINKED_LIST_ENTRY(node, GblTask, private_.listNode))
+#define GBL_MAIN_LOOP_DEQUE_CAPACITY_   1024    // Initial capacity of each worker's deque (power of 2)
+#define GBL_MAIN_LOOP_SPIN_COUNT_       64      // Fruitless search rounds before a worker goes to sleep
+#define GBL_MAIN_LOOP_WORKER_NAME_SIZE_ 64      // Worker thread name buffer, including the " worker N" suffix
+#define GBL_MAIN_LOOP_WORKER_SUFFIX_    " worker 18446744073709551615"  // Widest possible suffix
+
+/* Circular array backing a worker's deque. Grown by its owner
+   only, with the previous array being retired rather than freed,
+   since a thief may still be reading from it. */
+typedef struct GblMainLoopRing_ {
+    struct GblMainLoopRing_* pRetired;
+    size_t                   mask;
+    _Atomic(GblTask*)        tasks[];
+} GblMainLoopRing_;
+
+/* Per-worker state: a Chase-Lev work-stealing deque, which only
+   the owner pushes to and pops from the bottom of, while every other
+   thread steals from the top, plus a lock-free stack for submissions
+   coming from non-worker threads. Hot fields sit on their own cache lines. */
+typedef struct GblMainLoopWorker_ {
+    GBL_ALIGNAS(64)
+    _Atomic(int64_t)           top;
+    GBL_ALIGNAS(64)
+    _Atomic(int64_t)           bottom;
+    _Atomic(GblMainLoopRing_*) pRing;
+    GBL_ALIGNAS(64)
+    _Atomic(GblTask*)          pInbox;
+    GblMainLoop*               pLoop;
+    GblThread*                 pThread;
+    uint32_t                   seed;
+} GblMainLoopWorker_;
+
+GBL_DECLARE_STRUCT(GblMainLoop_) {
+    mtx_t               queueMtx;
+    mtx_t               sleepMtx;
+    cnd_t               sleepCnd;
+    atomic_bool         running;
+    atomic_bool         shutdown;
+    atomic_size_t       pending;    // Dispatched tasks which have not finished
+    atomic_size_t       queued;     // Dispatched tasks which no worker has claimed
+    atomic_size_t       sleepers;
+    atomic_size_t       nextWorker;
+    size_t              workerCount;
+    GblMainLoopWorker_* pWorkers;
+};
+
+static GBL_THREAD_LOCAL GblMainLoopWorker_* pCurWorker_ = NULL;
+
+static GblMainLoopRing_* GblMainLoop_ringCreate_(size_t capacity) {
+    GblMainLoopRing_* pRing = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    pRing = GBL_CTX_MALLOC(sizeof(GblMainLoopRing_) + sizeof(GblTask*) * capacity);
+
+    GBL_CTX_VERIFY(pRing,
+                   GBL_RESULT_ERROR_MEM_ALLOC,
+                   "Failed to allocate deque ring of capacity %zu!",
+                   capacity);
+
+    pRing->pRetired = NULL;
+    pRing->mask     = capacity - 1;
+
+    GBL_CTX_END_BLOCK();
+
+    return pRing;
+}
+
+static void GblMainLoop_ringDestroy_(GblMainLoopRing_* pRing) {
+    GBL_CTX_BEGIN(NULL);
+
+    while(pRing) {
+        GblMainLoopRing_* pRetired = pRing->pRetired;
+        GBL_CTX_FREE(pRing);
+        pRing = pRetired;
+    }
+
+    GBL_CTX_END_BLOCK();
+}
+
+// Owner only: push onto the bottom of the deque, doubling its array when full
+static GBL_RESULT GblMainLoop_dequePush_(GblMainLoopWorker_* pWorker, GblTask* pTask) {
+    const int64_t     b     = atomic_load_explicit(&pWorker->bottom, memory_order_relaxed);
+    const int64_t     t     = atomic_load_explicit(&pWorker->top,    memory_order_acquire);
+    GblMainLoopRing_* pRing = atomic_load_explicit(&pWorker->pRing,  memory_order_relaxed);
+
+    if(b - t > (int64_t)pRing->mask) GBL_UNLIKELY {
+        GblMainLoopRing_* pGrown = GblMainLoop_ringCreate_((pRing->mask + 1) << 1);
+
+        // the full ring is left untouched, so the caller still owns pTask
+        if(!pGrown) GBL_UNLIKELY
+            return GBL_RESULT_ERROR_MEM_ALLOC;
+
+        for(int64_t i = t; i < b; ++i)
+            atomic_store_explicit(&pGrown->tasks[i & pGrown->mask],
+                                  atomic_load_explicit(&pRing->tasks[i & pRing->mask],
+                                                       memory_order_relaxed),
+                                  memory_order_relaxed);
+
+        pGrown->pRetired = pRing;
+        atomic_store_explicit(&pWorker->pRing, pGrown, memory_order_release);
+        pRing = pGrown;
+    }
+
+    atomic_store_explicit(&pRing->tasks[b & pRing->mask], pTask, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+// Owner only: pop from the bottom of the deque, racing thieves for the last entry
+static GblTask* GblMainLoop_dequePop_(GblMainLoopWorker_* pWorker) {
+    const int64_t     b     = atomic_load_explicit(&pWorker->bottom, memory_order_relaxed) - 1;
+    GblMainLoopRing_* pRing = atomic_load_explicit(&pWorker->pRing,  memory_order_relaxed);
+    GblTask*          pTask = NULL;
+
+    atomic_store_explicit(&pWorker->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    int64_t t = atomic_load_explicit(&pWorker->top, memory_order_relaxed);
+
+    if(t <= b) {
+        pTask = atomic_load_explicit(&pRing->tasks[b & pRing->mask], memory_order_relaxed);
+
+        if(t == b) {
+            if(!atomic_compare_exchange_strong_explicit(&pWorker->top, &t, t + 1,
+                                                        memory_order_seq_cst,
+                                                        memory_order_relaxed))
+                pTask = NULL;
+
+            atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_store_explicit(&pWorker->bottom, b + 1, memory_order_relaxed);
+    }
+
+    return pTask;
+}
+
+// Any thread: take the oldest entry from the top of the deque
+static GblTask* GblMainLoop_dequeSteal_(GblMainLoopWorker_* pWorker) {
+    int64_t t = atomic_load_explicit(&pWorker->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    const int64_t b = atomic_load_explicit(&pWorker->bottom, memory_order_acquire);
+
+    if(t < b) {
+        GblMainLoopRing_* pRing = atomic_load_explicit(&pWorker->pRing, memory_order_acquire);
+        GblTask*          pTask = atomic_load_explicit(&pRing->tasks[t & pRing->mask],
+                                                       memory_order_relaxed);
+
+        if(atomic_compare_exchange_strong_explicit(&pWorker->top, &t, t + 1,
+                                                   memory_order_seq_cst,
+                                                   memory_order_relaxed))
+            return pTask;
+    }
+
+    return NULL;
+}
+
+// Any thread: push onto a worker's submission stack
+static void GblMainLoop_inboxPush_(GblMainLoopWorker_* pWorker, GblTask* pTask) {
+    GblTask* pHead = atomic_load_explicit(&pWorker->pInbox, memory_order_relaxed);
+
+    do {
+        GBL_PRIV_REF(pTask).pNext = pHead;
+    } while(!atomic_compare_exchange_weak_explicit(&pWorker->pInbox, &pHead, pTask,
+                                                   memory_order_release,
+                                                   memory_order_relaxed));
+}
+
+/* Worker only: claims an entire submission stack, moving all but its
+   oldest entry onto the caller's own deque, where they become stealable. */
+static GblTask* GblMainLoop_inboxTake_(GblMainLoopWorker_* pWorker, GblMainLoopWorker_* pVictim) {
+    if(!atomic_load_explicit(&pVictim->pInbox, memory_order_relaxed))
+        return NULL;
+
+    GblTask* pTask = atomic_exchange_explicit(&pVictim->pInbox, NULL, memory_order_acquire);
+    GblTask* pPrev = NULL;
+
+    // Reverse LIFO submission order into FIFO order
+    while(pTask) {
+        GblTask* pNext = GBL_PRIV_REF(pTask).pNext;
+        GBL_PRIV_REF(pTask).pNext = pPrev;
+        pPrev = pTask;
+        pTask = pNext;
+    }
+
+    if((pTask = pPrev)) {
+        for(GblTask* pIt = GBL_PRIV_REF(pTask).pNext; pIt; pIt = GBL_PRIV_REF(pIt).pNext) {
+            if(!GBL_RESULT_SUCCESS(GblMainLoop_dequePush_(pWorker, pIt))) GBL_UNLIKELY {
+                // hand whatever didn't fit back to our own inbox, oldest first, to retry later
+                while(pIt) {
+                    GblTask* pNext = GBL_PRIV_REF(pIt).pNext;
+                    GblMainLoop_inboxPush_(pWorker, pIt);
+                    pIt = pNext;
+                }
+                break;
+            }
+        }
+    }
+
+    return pTask;
+}
+
+static GblTask* GblMainLoop_workerNext_(GblMainLoop_* pSelf_, GblMainLoopWorker_* pWorker) {
+    GblTask* pTask = GblMainLoop_dequePop_(pWorker);
+
+    if(!pTask)
+        pTask = GblMainLoop_inboxTake_(pWorker, pWorker);
+
+    if(!pTask && pSelf_->workerCount > 1) {
+        // xorshift to pick the first victim, so thieves don't all dogpile the same worker
+        pWorker->seed ^= pWorker->seed << 13;
+        pWorker->seed ^= pWorker->seed >> 17;
+        pWorker->seed ^= pWorker->seed << 5;
+
+        const size_t start = pWorker->seed % pSelf_->workerCount;
+
+        for(size_t w = 0; w < pSelf_->workerCount && !pTask; ++w) {
+            GblMainLoopWorker_* pVictim = &pSelf_->pWorkers[(start + w) % pSelf_->workerCount];
+
+            if(pVictim == pWorker) continue;
+
+            if(!(pTask = GblMainLoop_dequeSteal_(pVictim)))
+                pTask = GblMainLoop_inboxTake_(pWorker, pVictim);
+        }
+    }
+
+    return pTask;
+}
+
+static GblTask* GblMainLoop_helperNext_(GblMainLoop_* pSelf_) {
+    GblTask* pTask = NULL;
+
+    for(size_t w = 0; w < pSelf_->workerCount && !pTask; ++w)
+        pTask = GblMainLoop_dequeSteal_(&pSelf_->pWorkers[w]);
+
+    return pTask;
+}
+
+static GblBool GblMainLoop_isSchedulable_(const GblTask* pTask) {
+    const GBL_TASK_STATE state = GblTask_state(pTask);
+
+    return state != GBL_TASK_STATE_QUEUED && state != GBL_TASK_STATE_RUNNING;
+}
+
+static void GblMainLoop_run_(GblMainLoop_* pSelf_, GblTask* pTask) {
+    atomic_fetch_sub_explicit(&pSelf_->queued, 1, memory_order_relaxed);
+
+    GblTask_exec(pTask);
+
+    // The task may be destroyed by its owner as soon as this lands
+    atomic_fetch_sub_explicit(&pSelf_->pending, 1, memory_order_release);
+}
+
+static void GblMainLoop_sleep_(GblMainLoop_* pSelf_) {
+    mtx_lock(&pSelf_->sleepMtx);
+
+    atomic_fetch_add(&pSelf_->sleepers, 1);
+
+    while(!atomic_load(&pSelf_->queued) && !atomic_load(&pSelf_->shutdown))
+        cnd_wait(&pSelf_->sleepCnd, &pSelf_->sleepMtx);
+
+    atomic_fetch_sub(&pSelf_->sleepers, 1);
+
+    mtx_unlock(&pSelf_->sleepMtx);
+}
+
+static GBL_RESULT GblMainLoop_workerRun_(GblThread* pThread) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoopWorker_* pWorker = GblBox_userdata(GBL_BOX(pThread));
+    GblMainLoop_*       pSelf_  = GBL_MAIN_LOOP_(pWorker->pLoop);
+    size_t              idle    = 0;
+
+    pCurWorker_ = pWorker;
+
+    while(!atomic_load_explicit(&pSelf_->shutdown, memory_order_acquire)) {
+        GblTask* pTask = GblMainLoop_workerNext_(pSelf_, pWorker);
+
+        if(pTask) {
+            GblMainLoop_run_(pSelf_, pTask);
+            idle = 0;
+        } else if(++idle < GBL_MAIN_LOOP_SPIN_COUNT_) {
+            thrd_yield();
+        } else {
+            GblMainLoop_sleep_(pSelf_);
+            idle = 0;
+        }
+    }
+
+    pCurWorker_ = NULL;
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_startWorkers(GblMainLoop* pSelf, size_t count) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    GBL_CTX_VERIFY_ARG(count);
+    GBL_CTX_VERIFY(!pSelf_->workerCount,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to start workers on loop which already has %zu!",
+                   pSelf_->workerCount);
+
+    pSelf_->pWorkers = GBL_CTX_MALLOC(gblAlignedAllocSize(sizeof(GblMainLoopWorker_) * count,
+                                                          GBL_ALIGNOF(GblMainLoopWorker_)),
+                                      GBL_ALIGNOF(GblMainLoopWorker_));
+
+    GBL_CTX_VERIFY(pSelf_->pWorkers,
+                   GBL_RESULT_ERROR_MEM_ALLOC,
+                   "Failed to allocate %zu workers!",
+                   count);
+
+    memset(pSelf_->pWorkers, 0, sizeof(GblMainLoopWorker_) * count);
+
+    // Every worker must be fully initialized before any can start stealing
+    for(size_t w = 0; w < count; ++w) {
+        GblMainLoopWorker_* pWorker = &pSelf_->pWorkers[w];
+        GblMainLoopRing_*   pRing   = GblMainLoop_ringCreate_(GBL_MAIN_LOOP_DEQUE_CAPACITY_);
+
+        if(!pRing) GBL_UNLIKELY {
+            for(size_t r = 0; r < w; ++r)
+                GblMainLoop_ringDestroy_(atomic_load(&pSelf_->pWorkers[r].pRing));
+
+            GBL_CTX_FREE(pSelf_->pWorkers);
+            pSelf_->pWorkers = NULL;
+        }
+
+        GBL_CTX_VERIFY(pRing,
+                       GBL_RESULT_ERROR_MEM_ALLOC,
+                       "Failed to allocate deque for worker %zu!",
+                       w);
+
+        atomic_init(&pWorker->top,    0);
+        atomic_init(&pWorker->bottom, 0);
+        atomic_init(&pWorker->pRing,  pRing);
+        atomic_init(&pWorker->pInbox, NULL);
+        pWorker->pLoop = pSelf;
+        pWorker->seed  = (uint32_t)w * 2654435761u + 1;
+    }
+
+    atomic_store(&pSelf_->shutdown, GBL_FALSE);
+    pSelf_->workerCount = count;
+
+    for(size_t w = 0; w < count; ++w) {
+        GblMainLoopWorker_* pWorker = &pSelf_->pWorkers[w];
+        char                name[GBL_MAIN_LOOP_WORKER_NAME_SIZE_];
+
+        // only the loop's own name is ever cut short, never the worker's index
+        snprintf(name, sizeof(name), "%.*s worker %zu",
+                 (int)(sizeof(name) - sizeof(GBL_MAIN_LOOP_WORKER_SUFFIX_)),
+                 GblObject_name(GBL_OBJECT(pSelf))? GblObject_name(GBL_OBJECT(pSelf)) : "GblMainLoop",
+                 w);
+
+        pWorker->pThread = GblThread_create(GblMainLoop_workerRun_, pWorker, GBL_FALSE);
+        GblThread_setName(pWorker->pThread, name);
+        GBL_CTX_VERIFY_CALL(GblThread_start(pWorker->pThread));
+    }
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_stopWorkers(GblMainLoop* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    if(!pSelf_->workerCount)
+        GBL_CTX_DONE();
+
+    GBL_CTX_VERIFY(!pCurWorker_ || pCurWorker_->pLoop != pSelf,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to stop workers from one of the loop's own workers!");
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_wait(pSelf));
+
+    mtx_lock(&pSelf_->sleepMtx);
+    atomic_store(&pSelf_->shutdown, GBL_TRUE);
+    cnd_broadcast(&pSelf_->sleepCnd);
+    mtx_unlock(&pSelf_->sleepMtx);
+
+    for(size_t w = 0; w < pSelf_->workerCount; ++w) {
+        GblMainLoopWorker_* pWorker = &pSelf_->pWorkers[w];
+
+        // Join status is the worker's last call record, not a failure to join
+        GblThread_join(pWorker->pThread);
+        GblThread_unref(pWorker->pThread);
+        GblMainLoop_ringDestroy_(atomic_load(&pWorker->pRing));
+    }
+
+    GBL_CTX_FREE(pSelf_->pWorkers);
+    pSelf_->pWorkers    = NULL;
+    pSelf_->workerCount = 0;
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT size_t GblMainLoop_workerCount(const GblMainLoop* pSelf) {
+    return GBL_MAIN_LOOP_(pSelf)->workerCount;
+}
+
+GBL_EXPORT size_t GblMainLoop_pending(const GblMainLoop* pSelf) {
+    return atomic_load_explicit(&GBL_MAIN_LOOP_(pSelf)->pending, memory_order_acquire);
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_dispatch(GblMainLoop* pSelf, GblTask* pTask) {
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    if(!pSelf_->workerCount)
+        return GblMainLoop_enqueue(pSelf, pTask);
+
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pTask);
+    GBL_CTX_VERIFY(GblMainLoop_isSchedulable_(pTask),
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to dispatch task which is already scheduled!");
+
+    const GBL_TASK_STATE prevState = GblTask_state(pTask);
+
+    // released by pushing it onto a deque or inbox, which the worker acquires it from
+    atomic_store_explicit(&pTask->state, GBL_TASK_STATE_QUEUED, memory_order_relaxed);
+
+    atomic_fetch_add(&pSelf_->pending, 1);
+    atomic_fetch_add(&pSelf_->queued,  1);
+
+    if(pCurWorker_ && pCurWorker_->pLoop == pSelf) {
+        const GBL_RESULT result = GblMainLoop_dequePush_(pCurWorker_, pTask);
+
+        // never published, so nobody else can have seen the task yet
+        if(!GBL_RESULT_SUCCESS(result)) GBL_UNLIKELY {
+            atomic_fetch_sub(&pSelf_->queued,  1);
+            atomic_fetch_sub(&pSelf_->pending, 1);
+            atomic_store_explicit(&pTask->state, prevState, memory_order_relaxed);
+        }
+
+        GBL_CTX_VERIFY_CALL(result);
+    } else {
+        const size_t w = atomic_fetch_add_explicit(&pSelf_->nextWorker, 1, memory_order_relaxed);
+        GblMainLoop_inboxPush_(&pSelf_->pWorkers[w % pSelf_->workerCount], pTask);
+    }
+
+    // Only pay for the lock when somebody actually needs waking
+    if(atomic_load(&pSelf_->sleepers)) {
+        mtx_lock(&pSelf_->sleepMtx);
+        cnd_signal(&pSelf_->sleepCnd);
+        mtx_unlock(&pSelf_->sleepMtx);
+    }
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_wait(GblMainLoop* pSelf) {
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+    GblMainLoopWorker_* pWorker = (pCurWorker_ && pCurWorker_->pLoop == pSelf)?
+                                      pCurWorker_ : NULL;
+
+    while(atomic_load_explicit(&pSelf_->pending, memory_order_acquire)) {
+        GblTask* pTask = pWorker? GblMainLoop_workerNext_(pSelf_, pWorker) :
+                                  GblMainLoop_helperNext_(pSelf_);
+
+        if(pTask) GblMainLoop_run_(pSelf_, pTask);
+        else      thrd_yield();
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblMainLoop_enqueueTask_(GblMainLoop* pSelf, GblTask* pTask) {
+    GblMainLoop_* pSelf_   = GBL_MAIN_LOOP_(pSelf);
+    GblPriority   priority = GblTask_priority(pTask);
+
+    if(priority < GBL_PRIORITY_IDLE)
+        priority = GBL_PRIORITY_IDLE;
+    else if(priority >= GBL_PRIORITY_COUNT)
+        priority = GBL_PRIORITY_COUNT - 1;
+
+    mtx_lock(&pSelf_->queueMtx);
+
+    GblDoublyLinkedList_pushBack(&pSelf->taskQueue[priority],
+                                 &GBL_PRIV_REF(pTask).listNode);
+    GBL_PRIV_REF(pTask).pLoop    = pSelf;
+    GBL_PRIV_REF(pTask).priority = priority;
+    atomic_store_explicit(&pTask->state, GBL_TASK_STATE_QUEUED, memory_order_relaxed);
+    pSelf->taskBitMap           |= (1u << priority);
+    ++pSelf->taskCount;
+
+    mtx_unlock(&pSelf_->queueMtx);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblMainLoop_cancelTask_(GblMainLoop* pSelf, GblTask* pTask) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    mtx_lock(&pSelf_->queueMtx);
+
+    const GblBool queued = GBL_PRIV_REF(pTask).pLoop == pSelf &&
+                           GblTask_state(pTask) == GBL_TASK_STATE_QUEUED;
+
+    if(queued) {
+        const GblPriority priority = GBL_PRIV_REF(pTask).priority;
+
+        GblDoublyLinkedList_remove(&GBL_PRIV_REF(pTask).listNode);
+        GBL_PRIV_REF(pTask).pLoop = NULL;
+
+        if(GblDoublyLinkedList_empty(&pSelf->taskQueue[priority]))
+            pSelf->taskBitMap &= ~(1u << priority);
+
+        --pSelf->taskCount;
+    }
+
+    mtx_unlock(&pSelf_->queueMtx);
+
+    GBL_CTX_VERIFY(queued,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to cancel task which isn't queued on the loop!");
+
+    GBL_CTX_VERIFY_CALL(GblTask_cancel(pTask));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblMainLoop_execTask_(GblMainLoop* pSelf, GblTask* pTask) {
+    GBL_UNUSED(pSelf);
+
+    // A failing task reports through its own result, not the loop's
+    GblTask_exec(pTask);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblMainLoop_execIdle_(GblMainLoop* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_EMIT(pSelf, "execIdle");
+    thrd_yield();
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_enqueue(GblMainLoop* pSelf, GblTask* pTask) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pTask);
+    GBL_CTX_VERIFY(GblMainLoop_isSchedulable_(pTask),
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to enqueue task which is already scheduled!");
+
+    GBL_VCALL(GblMainLoop, pFnEnqueueTask, pSelf, pTask);
+
+    GBL_EMIT(pSelf, "taskEnqueued", pTask);
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_cancel(GblMainLoop* pSelf, GblTask* pTask) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pTask);
+    GBL_VCALL(GblMainLoop, pFnCancelTask, pSelf, pTask);
+
+    GBL_CTX_END();
+}
+
+// Caller must hold queueMtx
+static GBL_PRIORITY_LEVEL GblMainLoop_topPriority_(const GblMainLoop* pSelf) {
+    GBL_PRIORITY_LEVEL priority = GBL_PRIORITY_COUNT - 1;
+
+    while(priority > GBL_PRIORITY_IDLE && !(pSelf->taskBitMap & (1u << priority)))
+        --priority;
+
+    return priority;
+}
+
+GBL_EXPORT GblTask* GblMainLoop_top(const GblMainLoop* pSelf) {
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+    GblTask*      pTask  = NULL;
+
+    mtx_lock(&pSelf_->queueMtx);
+
+    if(pSelf->taskBitMap)
+        pTask = GBL_MAIN_LOOP_TASK_(
+                    GblDoublyLinkedList_front(&pSelf->taskQueue[GblMainLoop_topPriority_(pSelf)]));
+
+    mtx_unlock(&pSelf_->queueMtx);
+
+    return pTask;
+}
+
+GBL_EXPORT size_t GblMainLoop_depth(const GblMainLoop* pSelf) {
+    return pSelf->taskCount;
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_iteration(GblMainLoop* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+    GblTask*      pTask  = NULL;
+
+    mtx_lock(&pSelf_->queueMtx);
+
+    if(pSelf->taskBitMap) {
+        const GBL_PRIORITY_LEVEL priority = GblMainLoop_topPriority_(pSelf);
+
+        pTask = GBL_MAIN_LOOP_TASK_(GblDoublyLinkedList_popFront(&pSelf->taskQueue[priority]));
+        GBL_PRIV_REF(pTask).pLoop = NULL;
+
+        if(GblDoublyLinkedList_empty(&pSelf->taskQueue[priority]))
+            pSelf->taskBitMap &= ~(1u << priority);
+
+        --pSelf->taskCount;
+        pSelf->prevTaskPriority = priority;
+    }
+
+    mtx_unlock(&pSelf_->queueMtx);
+
+    if(pTask) {
+        pSelf->pActiveTask = pTask;
+        GBL_VCALL(GblMainLoop, pFnExecTask, pSelf, pTask);
+        pSelf->pActiveTask = NULL;
+    } else {
+        GBL_VCALL(GblMainLoop, pFnExecIdle, pSelf);
+    }
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_exec(GblMainLoop* pSelf) {
+    GblBool started = GBL_FALSE;
+
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    GBL_CTX_VERIFY(!atomic_exchange(&pSelf_->running, GBL_TRUE),
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to execute loop which is already running!");
+
+    started = GBL_TRUE;
+
+    while(atomic_load_explicit(&pSelf_->running, memory_order_acquire))
+        GBL_CTX_VERIFY_CALL(GblMainLoop_iteration(pSelf));
+
+    GBL_CTX_END_BLOCK();
+
+    // a rejected nested exec() must not stop the loop that is already running
+    if(started)
+        atomic_store(&GBL_MAIN_LOOP_(pSelf)->running, GBL_FALSE);
+
+    return GBL_CTX_RESULT();
+}
+
+GBL_EXPORT GBL_RESULT GblMainLoop_stop(GblMainLoop* pSelf) {
+    atomic_store_explicit(&GBL_MAIN_LOOP_(pSelf)->running, GBL_FALSE, memory_order_release);
+    return GBL_RESULT_SUCCESS;
+}
+
+GBL_EXPORT GblBool GblMainLoop_isRunning(const GblMainLoop* pSelf) {
+    return atomic_load_explicit(&GBL_MAIN_LOOP_(pSelf)->running, memory_order_acquire);
+}
+
+static GBL_RESULT GblMainLoop_GblBox_destructor_(GblBox* pBox) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblMainLoop*  pSelf  = GBL_MAIN_LOOP(pBox);
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    GBL_CTX_CALL(GblMainLoop_stopWorkers(pSelf));
+
+    mtx_destroy(&pSelf_->queueMtx);
+    mtx_destroy(&pSelf_->sleepMtx);
+    cnd_destroy(&pSelf_->sleepCnd);
+
+    GBL_VCALL_DEFAULT(GblObject, base.pFnDestructor, pBox);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblMainLoop_init_(GblInstance* pInstance) {
+    GblMainLoop*  pSelf  = GBL_MAIN_LOOP(pInstance);
+    GblMainLoop_* pSelf_ = GBL_MAIN_LOOP_(pSelf);
+
+    for(size_t p = 0; p < GBL_PRIORITY_COUNT; ++p)
+        GblDoublyLinkedList_init(&pSelf->taskQueue[p]);
+
+    pSelf->prevTaskPriority = GBL_PRIORITY_DEFAULT;
+
+    mtx_init(&pSelf_->queueMtx, mtx_plain);
+    mtx_init(&pSelf_->sleepMtx, mtx_plain);
+    cnd_init(&pSelf_->sleepCnd);
+
+    atomic_init(&pSelf_->running,    GBL_FALSE);
+    atomic_init(&pSelf_->shutdown,   GBL_FALSE);
+    atomic_init(&pSelf_->pending,    0);
+    atomic_init(&pSelf_->queued,     0);
+    atomic_init(&pSelf_->sleepers,   0);
+    atomic_init(&pSelf_->nextWorker, 0);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblMainLoopClass_init_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pUd);
+    GBL_CTX_BEGIN(NULL);
+
+    if(!GblType_classRefCount(GBL_MAIN_LOOP_TYPE)) {
+        GblSignal_install(GBL_MAIN_LOOP_TYPE,
+                          "execIdle",
+                          GblMarshal_CClosure_VOID__INSTANCE,
+                          0);
+
+        GblSignal_install(GBL_MAIN_LOOP_TYPE,
+                          "taskEnqueued",
+                          GblMarshal_CClosure_VOID__INSTANCE_INSTANCE,
+                          1,
+                          GBL_TASK_TYPE);
+    }
+
+    GBL_BOX_CLASS(pClass)      ->pFnDestructor  = GblMainLoop_GblBox_destructor_;
+    GBL_MAIN_LOOP_CLASS(pClass)->pFnEnqueueTask = GblMainLoop_enqueueTask_;
+    GBL_MAIN_LOOP_CLASS(pClass)->pFnExecTask    = GblMainLoop_execTask_;
+    GBL_MAIN_LOOP_CLASS(pClass)->pFnCancelTask  = GblMainLoop_cancelTask_;
+    GBL_MAIN_LOOP_CLASS(pClass)->pFnExecIdle    = GblMainLoop_execIdle_;
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblMainLoopClass_final_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pClass, pUd);
+    GBL_CTX_BEGIN(NULL);
+
+    if(!GblType_classRefCount(GBL_MAIN_LOOP_TYPE)) {
+        GblSignal_uninstall(GBL_MAIN_LOOP_TYPE, "execIdle");
+        GblSignal_uninstall(GBL_MAIN_LOOP_TYPE, "taskEnqueued");
+    }
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblType GblMainLoop_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+
+    static const GblTypeInfo info = {
+        .classSize           = sizeof(GblMainLoopClass),
+        .pFnClassInit        = GblMainLoopClass_init_,
+        .pFnClassFinal       = GblMainLoopClass_final_,
+        .instanceSize        = sizeof(GblMainLoop),
+        .instancePrivateSize = sizeof(GblMainLoop_),
+        .pFnInstanceInit     = GblMainLoop_init_
+    };
+
+    if(type == GBL_INVALID_TYPE) GBL_UNLIKELY {
+        type = GblType_register(GblQuark_internStringStatic("GblMainLoop"),
+                                GBL_OBJECT_TYPE,
+                                &info,
+                                GBL_TYPE_FLAG_TYPEINFO_STATIC);
+    }
+
+    return type;
+}
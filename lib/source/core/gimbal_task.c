@@ -0,0 +1,147 @@
+#include <gimbal/core/gimbal_task.h>
+#include <gimbal/core/gimbal_main_loop.h>
+
+GBL_EXPORT GblPriority GblTask_priority(const GblTask* pSelf) {
+    GblPriority priority = GBL_PRIORITY_DEFAULT;
+
+    GBL_CTX_BEGIN(NULL);
+    GBL_VCALL(GblTask, pFnPriority, pSelf, &priority);
+    GBL_CTX_END_BLOCK();
+
+    return priority;
+}
+
+/* A task's state is published with release stores and read with acquire
+   loads, so whichever thread sees a task as finished also sees its result.
+   Storing the final state is the last access GblTask_exec() and
+   GblTask_cancel() make to a task, so once it's done, it may be reused or
+   destroyed by any thread. */
+GBL_EXPORT GBL_TASK_STATE GblTask_state(const GblTask* pSelf) {
+    return atomic_load_explicit(&((GblTask*)pSelf)->state, memory_order_acquire);
+}
+
+GBL_EXPORT GBL_RESULT GblTask_result(const GblTask* pSelf) {
+    return pSelf->result;
+}
+
+GBL_EXPORT GblBool GblTask_isDone(const GblTask* pSelf) {
+    const GBL_TASK_STATE state = GblTask_state(pSelf);
+
+    return state == GBL_TASK_STATE_FINISHED ||
+           state == GBL_TASK_STATE_CANCELED;
+}
+
+GBL_EXPORT GBL_RESULT GblTask_exec(GblTask* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY(GblTask_state(pSelf) != GBL_TASK_STATE_RUNNING,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to execute task which is already running!");
+
+    atomic_store_explicit(&pSelf->state, GBL_TASK_STATE_RUNNING, memory_order_relaxed);
+    GBL_VCALL(GblTask, pFnExec, pSelf);
+
+    pSelf->result = GBL_CTX_RESULT();
+    atomic_store_explicit(&pSelf->state, GBL_TASK_STATE_FINISHED, memory_order_release);
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblTask_cancel(GblTask* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY(GblTask_state(pSelf) != GBL_TASK_STATE_RUNNING,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Attempt to cancel task which is already running!");
+
+    GBL_VCALL(GblTask, pFnCancel, pSelf);
+
+    atomic_store_explicit(&pSelf->state, GBL_TASK_STATE_CANCELED, memory_order_release);
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblTask_reset(GblTask* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_TASK_STATE state = GblTask_state(pSelf);
+
+    // only one caller may take a done task back, and it must see everything its last run wrote
+    while(state != GBL_TASK_STATE_READY) {
+        GBL_CTX_VERIFY(state == GBL_TASK_STATE_FINISHED || state == GBL_TASK_STATE_CANCELED,
+                       GBL_RESULT_ERROR_INVALID_OPERATION,
+                       "Attempt to reset task which is still scheduled!");
+
+        if(atomic_compare_exchange_weak_explicit(&pSelf->state,
+                                                 &state,
+                                                 GBL_TASK_STATE_READY,
+                                                 memory_order_acq_rel,
+                                                 memory_order_acquire))
+            break;
+    }
+
+    pSelf->result = GBL_RESULT_UNKNOWN;
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblTask_exec_(GblTask* pSelf) {
+    GBL_UNUSED(pSelf);
+    return GBL_RESULT_UNIMPLEMENTED;
+}
+
+static GBL_RESULT GblTask_cancel_(GblTask* pSelf) {
+    GBL_UNUSED(pSelf);
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTask_timeout_(GblTask* pSelf) {
+    GBL_UNUSED(pSelf);
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTask_priority_(const GblTask* pSelf, GblPriority* pPriority) {
+    GBL_UNUSED(pSelf);
+    *pPriority = GBL_PRIORITY_DEFAULT;
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTask_init_(GblInstance* pInstance) {
+    GblTask* pSelf = GBL_TASK(pInstance);
+
+    atomic_init(&pSelf->state, GBL_TASK_STATE_READY);
+    pSelf->result = GBL_RESULT_UNKNOWN;
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTaskClass_init_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pUd);
+
+    GBL_TASK_CLASS(pClass)->pFnExec     = GblTask_exec_;
+    GBL_TASK_CLASS(pClass)->pFnCancel   = GblTask_cancel_;
+    GBL_TASK_CLASS(pClass)->pFnTimeout  = GblTask_timeout_;
+    GBL_TASK_CLASS(pClass)->pFnPriority = GblTask_priority_;
+
+    return GBL_RESULT_SUCCESS;
+}
+
+GBL_EXPORT GblType GblTask_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+
+    static const GblTypeInfo info = {
+        .classSize       = sizeof(GblTaskClass),
+        .pFnClassInit    = GblTaskClass_init_,
+        .instanceSize    = sizeof(GblTask),
+        .pFnInstanceInit = GblTask_init_
+    };
+
+    if(type == GBL_INVALID_TYPE) GBL_UNLIKELY {
+        type = GblType_register(GblQuark_internStringStatic("GblTask"),
+                                GBL_OBJECT_TYPE,
+                                &info,
+                                GBL_TYPE_FLAG_TYPEINFO_STATIC);
+    }
+
+    return type;
+}
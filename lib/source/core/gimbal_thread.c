@@ -547,6 +547,19 @@ static GBL_RESULT GblThreadClass_initialize_(GblClass* pClass, const void* pUd)
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblThreadClass_finalize_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pClass, pUd);
+    GBL_CTX_BEGIN(NULL);
+
+    if(!GblType_classRefCount(GBL_THREAD_TYPE)) {
+        GblSignal_uninstall(GBL_THREAD_TYPE, "started");
+        GblSignal_uninstall(GBL_THREAD_TYPE, "finished");
+        GblSignal_uninstall(GBL_THREAD_TYPE, "signaled");
+    }
+
+    GBL_CTX_END();
+}
+
 GBL_EXPORT GBL_RESULT GblThread_setPriority(GblThread* pSelf,
                                             GBL_THREAD_PRIORITY priority) {
     GBL_UNUSED(pSelf, priority);
@@ -574,6 +587,7 @@ GBL_EXPORT GblType GblThread_type(void) {
     static const GblTypeInfo info = {
         .classSize           = sizeof(GblThreadClass),
         .pFnClassInit        = GblThreadClass_initialize_,
+        .pFnClassFinal       = GblThreadClass_finalize_,
         .instanceSize        = sizeof(GblThread),
         .instancePrivateSize = sizeof(GblThread_),
         .pFnInstanceInit     = GblThread_initialize_
@@ -3,6 +3,7 @@
 #include <gimbal/meta/ifaces/gimbal_interface.h>
 #include "gimbal/core/gimbal_ctx.h"
 #include "../types/gimbal_type_.h"
+#include <stdatomic.h>
 
 GBL_INLINE void* GblClass_basePtr_(const GblClass* pClass) {
     GblMetaClass* pMeta = GBL_META_CLASS_(GBL_CLASS_TYPEOF(pClass));
@@ -474,86 +475,206 @@ GBL_EXPORT GblRefCount GblClass_unrefDefault(GblClass* pSelf) GBL_NOEXCEPT {
     return refCount;
 }
 
-// Cast a class to the given type, with optional error checking and validation (recurses for interfaces)
-static GblClass* GblClass_cast_(GblClass* pClass, GblType toType, GblBool check, GblBool recursing) {
-    GblClass* pClassStart = pClass;
-    GblClass* pToClass    = NULL;
+#define GBL_CLASS_CAST_CACHE_SIZE_  512
 
-    // Casting a NULL pointer or to an invalid type returns NULL
-    if(pClass && toType != GBL_INVALID_TYPE) GBL_LIKELY {
-        //early exit when class is already of desired type
-        if(GBL_CLASS_META_CLASS_(pClass) == GBL_META_CLASS_(toType)) GBL_LIKELY {
-            pToClass = pClass;
-        } else {
-            GblBool toInterface = GBL_FALSE;
-            if(GBL_TYPE_INTERFACED_CHECK(toType)) toInterface = GBL_TRUE;
-
-            // If current node is an interface class, attempt to "back out" to root class node
-            // BUT ONLY IF WE AREN'T TRYING TO CHECK AN INTERFACE RECURSIVELY
-            if(!recursing) {
-                while(GBL_TYPE_INTERFACED_CHECK(GBL_CLASS_TYPEOF(pClass))) {
-                    // Move class pointer to interface's concrete class
-                    pClass = GblInterface_outerClass((GblInterface*)pClass);
-                    GBL_ASSERT(pClass);
-                }
+/* Entry within the global cast cache, mapping a concrete class's
+ * metaclass and an interface type to the offset of the interface
+ * from the concrete class. Each entry is guarded by a sequence
+ * counter, which is odd while it's being written, so lookups
+ * never take a lock.
+ */
+typedef struct GblClassCastEntry_ {
+    atomic_uint         seq;
+    _Atomic(uintptr_t)  pMeta;
+    _Atomic(uintptr_t)  toType;
+    atomic_ptrdiff_t    offset;
+} GblClassCastEntry_;
+
+static GblClassCastEntry_ castCache_[GBL_CLASS_CAST_CACHE_SIZE_];
+
+static GblClassCastEntry_* GblClass_castCacheEntry_(const GblMetaClass* pMeta, GblType toType) {
+    const uint64_t hash = ((uint64_t)(uintptr_t)pMeta ^ ((uint64_t)toType >> GBL_CLASS_FLAGS_BIT_COUNT_))
+                        * 0x9e3779b97f4a7c15ull;
+    return &castCache_[(hash >> 32) & (GBL_CLASS_CAST_CACHE_SIZE_ - 1)];
+}
+
+static GblBool GblClass_castCacheFind_(const GblMetaClass* pMeta, GblType toType, ptrdiff_t* pOffset) {
+    GblClassCastEntry_* pEntry = GblClass_castCacheEntry_(pMeta, toType);
+    const unsigned      seq    = atomic_load_explicit(&pEntry->seq, memory_order_acquire);
+
+    if(seq & 1)
+        return GBL_FALSE;
+
+    const uintptr_t meta   = atomic_load_explicit(&pEntry->pMeta,  memory_order_relaxed);
+    const uintptr_t type   = atomic_load_explicit(&pEntry->toType, memory_order_relaxed);
+    const ptrdiff_t offset = atomic_load_explicit(&pEntry->offset, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    if(atomic_load_explicit(&pEntry->seq, memory_order_relaxed) != seq ||
+       meta != (uintptr_t)pMeta || type != (uintptr_t)toType)
+        return GBL_FALSE;
+
+    *pOffset = offset;
+    return GBL_TRUE;
+}
+
+static void GblClass_castCacheInsert_(const GblMetaClass* pMeta, GblType toType, ptrdiff_t offset) {
+    GblClassCastEntry_* pEntry = GblClass_castCacheEntry_(pMeta, toType);
+    unsigned            seq    = atomic_load_explicit(&pEntry->seq, memory_order_relaxed);
+
+    // Someone else is already writing this entry, so just don't bother
+    if((seq & 1) || !atomic_compare_exchange_strong_explicit(&pEntry->seq, &seq, seq + 1,
+                                                             memory_order_acquire,
+                                                             memory_order_relaxed))
+        return;
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&pEntry->pMeta,  (uintptr_t)pMeta,  memory_order_relaxed);
+    atomic_store_explicit(&pEntry->toType, (uintptr_t)toType, memory_order_relaxed);
+    atomic_store_explicit(&pEntry->offset, offset,            memory_order_relaxed);
+    atomic_store_explicit(&pEntry->seq,    seq + 2,           memory_order_release);
+}
+
+// Invalidates every cached cast, called when a type is unregistered and its metaclass freed
+void GblClass_castCacheClear_(void) {
+    for(size_t e = 0; e < GBL_CLASS_CAST_CACHE_SIZE_; ++e) {
+        GblClassCastEntry_* pEntry = &castCache_[e];
+        unsigned            seq;
+
+        do {
+            seq = atomic_load_explicit(&pEntry->seq, memory_order_relaxed) & ~1u;
+        } while(!atomic_compare_exchange_weak_explicit(&pEntry->seq, &seq, seq + 1,
+                                                       memory_order_acquire,
+                                                       memory_order_relaxed));
+
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&pEntry->pMeta,  0, memory_order_relaxed);
+        atomic_store_explicit(&pEntry->toType, 0, memory_order_relaxed);
+        atomic_store_explicit(&pEntry->seq,    seq + 2, memory_order_release);
+    }
+}
+
+/* Searches a class and its interfaces for the given type, breadth-first,
+ * recursing for interfaces. pIncomplete is set if any interface had yet to
+ * be constructed, since the result is then not safe to cache.
+ */
+static GblClass* GblClass_castSearch_(GblClass* pClass, GblType toType, GblBool recursing, GblBool* pIncomplete) {
+    GblClass* pToClass = NULL;
+
+    //early exit when class is already of desired type
+    if(GBL_CLASS_META_CLASS_(pClass) == GBL_META_CLASS_(toType)) GBL_LIKELY {
+        pToClass = pClass;
+    } else {
+        GblBool toInterface = GBL_FALSE;
+        if(GBL_TYPE_INTERFACED_CHECK(toType)) toInterface = GBL_TRUE;
+
+        // If current node is an interface class, attempt to "back out" to root class node
+        // BUT ONLY IF WE AREN'T TRYING TO CHECK AN INTERFACE RECURSIVELY
+        if(!recursing) {
+            while(GBL_TYPE_INTERFACED_CHECK(GBL_CLASS_TYPEOF(pClass))) {
+                // Move class pointer to interface's concrete class
+                pClass = GblInterface_outerClass((GblInterface*)pClass);
+                GBL_ASSERT(pClass);
             }
+        }
+
+        GblMetaClass* pMeta   = GBL_CLASS_META_CLASS_(pClass);
+        GblMetaClass* pToMeta = GBL_META_CLASS_(toType);
+        GBL_ASSERT(pMeta);
+
+        // Casting to a class type only has to check the ancestor table
+        if(!toInterface) {
+            if(pMeta == pToMeta ||
+               (pToMeta->depth < pMeta->depth && pMeta->pBases[pToMeta->depth] == pToMeta))
+                pToClass = pClass;
 
-            GblMetaClass* pMeta = GBL_CLASS_META_CLASS_(pClass);
-            GBL_ASSERT(pMeta);
-
-            // iterate from derived to base class, breadth-first searching
-            do {
-                //check current class
-                if(pMeta == GBL_META_CLASS_(toType)) {
-                    pToClass = pClass;
-                    break;
-                } else if(toInterface) {
-                    for(unsigned i = 0; i < pMeta->pInfo->interfaceCount; ++i) {
-
-                        GblMetaClass* pIFaceMeta = GBL_META_CLASS_(toType);
-                        GblInterface* pCurIClass = GBL_PTR_OFFSET(GblInterface*,
-                                                                  pClass,
-                                                                  pMeta->pInfo->pInterfaceImpls[i].classOffset);
-
-                        /* Assume an interface is invalid, because it has yet to be constructed,
-                           so skip using it for further consideration. */
-                        if(GBL_CLASS_TYPEOF(pCurIClass) == GBL_INVALID_TYPE)
-                            continue;
-
-                        GBL_ASSERT(GBL_CLASS_FLAG_TEST_(GBL_CLASS(pCurIClass), GBL_CLASS_FLAG_IFACE_IMPL_));
-                        GBL_ASSERT(GBL_META_CLASS_(pMeta->pInfo->pInterfaceImpls[i].interfaceType)
-                                                    == GBL_META_CLASS_(GBL_CLASS_TYPEOF(pCurIClass)));
-                        GBL_ASSERT(GBL_CLASS_TYPEOF(pCurIClass) != GBL_INVALID_TYPE);
-
-                        if(GBL_META_CLASS_(GBL_CLASS_TYPEOF(pCurIClass)) == pIFaceMeta) {
+            return pToClass;
+        }
+
+        // Repeated casts from the same concrete type to an interface hit the cache
+        ptrdiff_t offset;
+        if(!recursing && GblClass_castCacheFind_(pMeta, toType, &offset)) {
+            GblClass* pIClass = GBL_PTR_OFFSET(GblClass*, pClass, offset);
+
+            // Only trust it if the interface has actually been constructed
+            if(GBL_CLASS_META_CLASS_(pIClass) == pToMeta) GBL_LIKELY
+                return pIClass;
+        }
+
+        GblClass* pOuterClass = pClass;
+
+        // iterate from derived to base class, breadth-first searching
+        do {
+            //check current class
+            if(pMeta == pToMeta) {
+                pToClass = pClass;
+                break;
+            } else {
+                for(unsigned i = 0; i < pMeta->pInfo->interfaceCount; ++i) {
+
+                    GblInterface* pCurIClass = GBL_PTR_OFFSET(GblInterface*,
+                                                              pClass,
+                                                              pMeta->pInfo->pInterfaceImpls[i].classOffset);
+
+                    /* Assume an interface is invalid, because it has yet to be constructed,
+                       so skip using it for further consideration. */
+                    if(GBL_CLASS_TYPEOF(pCurIClass) == GBL_INVALID_TYPE) {
+                        *pIncomplete = GBL_TRUE;
+                        continue;
+                    }
+
+                    GBL_ASSERT(GBL_CLASS_FLAG_TEST_(GBL_CLASS(pCurIClass), GBL_CLASS_FLAG_IFACE_IMPL_));
+                    GBL_ASSERT(GBL_META_CLASS_(pMeta->pInfo->pInterfaceImpls[i].interfaceType)
+                                                == GBL_META_CLASS_(GBL_CLASS_TYPEOF(pCurIClass)));
+                    GBL_ASSERT(GBL_CLASS_TYPEOF(pCurIClass) != GBL_INVALID_TYPE);
+
+                    if(GBL_META_CLASS_(GBL_CLASS_TYPEOF(pCurIClass)) == pToMeta) {
+                        pToClass = GBL_CLASS(pCurIClass);
+                        break;
+                    } else {
+                        pCurIClass = (GblInterface*)GblClass_castSearch_(GBL_CLASS(pCurIClass), toType, GBL_TRUE, pIncomplete);
+                        if(pCurIClass) {
+                            GBL_ASSERT(GblType_check(GBL_CLASS_TYPEOF(pCurIClass), toType));
                             pToClass = GBL_CLASS(pCurIClass);
                             break;
-                        } else {
-                            pCurIClass = (GblInterface*)GblClass_cast_(GBL_CLASS(pCurIClass), toType, GBL_FALSE, GBL_TRUE);
-                            if(pCurIClass) {
-                                GBL_ASSERT(GblType_check(GBL_CLASS_TYPEOF(pCurIClass), toType)); //SLOOOW, but good check for Debug
-                                pToClass = GBL_CLASS(pCurIClass);
-                                break;
-                            }
                         }
                     }
                 }
-                pMeta = pMeta->pParent;
-            } while(!pToClass && pMeta);
-        }
+            }
+            pMeta = pMeta->pParent;
+        } while(!pToClass && pMeta);
+
+        if(!recursing && pToClass && !*pIncomplete)
+            GblClass_castCacheInsert_(GBL_CLASS_META_CLASS_(pOuterClass),
+                                      toType,
+                                      (uint8_t*)pToClass - (uint8_t*)pOuterClass);
     }
+
+    return pToClass;
+}
+
+// Cast a class to the given type, with optional error checking and validation
+static GblClass* GblClass_cast_(GblClass* pClass, GblType toType, GblBool check) {
+    GblClass* pToClass   = NULL;
+    GblBool   incomplete = GBL_FALSE;
+
+    // Casting a NULL pointer or to an invalid type returns NULL
+    if(pClass && toType != GBL_INVALID_TYPE) GBL_LIKELY
+        pToClass = GblClass_castSearch_(pClass, toType, GBL_FALSE, &incomplete);
+
     if(check && !pToClass) {
         GBL_CTX_BEGIN(pCtx_);
         if(toType == GBL_INVALID_TYPE) {
             if(pClass) {
                 GBL_CTX_RECORD_SET(GBL_RESULT_ERROR_TYPE_MISMATCH,
                                    "Attempted to cast from type %s to GBL_INVALID_TYPE!",
-                                   GblType_name(GblClass_typeOf(pClassStart)));
+                                   GblType_name(GblClass_typeOf(pClass)));
             }
         } else {
             GBL_CTX_RECORD_SET(GBL_RESULT_ERROR_TYPE_MISMATCH,
                                "Failed to cast from type %s to %s!",
-                               GblType_name(GblClass_typeOf(pClassStart)), GblType_name(toType));
+                               GblType_name(GblClass_typeOf(pClass)), GblType_name(toType));
         }
         GBL_CTX_END_BLOCK();
     }
@@ -576,10 +697,10 @@ GBL_EXPORT GblBool GblClass_check(const GblClass* pSelf, GblType toType) {
 }
 
 GBL_EXPORT GblClass* GblClass_cast(GblClass* pSelf, GblType toType) GBL_NOEXCEPT {
-    return GblClass_cast_(pSelf, toType, GBL_TRUE, GBL_FALSE);
+    return GblClass_cast_(pSelf, toType, GBL_TRUE);
 }
 GBL_EXPORT GblClass* GblClass_as(GblClass* pSelf, GblType toType) GBL_NOEXCEPT {
-    return GblClass_cast_(pSelf, toType, GBL_FALSE, GBL_FALSE);
+    return GblClass_cast_(pSelf, toType, GBL_FALSE);
 }
 
 
@@ -324,6 +324,30 @@ GBL_EXPORT GBL_RESULT GblContext_callRecordSet_(GblContext* pSelf,
     return GblContext_setLastIssue(pSelf, pRecord);
 }
 
+// Only reached once a leaf frame's check fails, so a regular frame is only paid for on the error path
+GBL_EXPORT GBL_RESULT GblContext_leafRecordSet_(GblLeafFrame*     pFrame,
+                                                GblSourceLocation source,
+                                                GBL_RESULT        result,
+                                                const char*       pFmt, ...) GBL_NOEXCEPT
+{
+    va_list varArgs;
+
+    pFrame->srcLocation = source;
+    pFrame->result      = result;
+
+    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_SOURCE_LOC_PUSH(source);
+
+    va_start(varArgs, pFmt);
+    vsnprintf(GBL_CTX_RECORD().message, sizeof(GBL_CTX_RECORD().message), pFmt, varArgs);
+    va_end(varArgs);
+
+    GBL_CTX_RESULT() = result;
+    GBL_CTX_RECORD_HANDLER(&GBL_CTX_RECORD());
+    GBL_CTX_SOURCE_POP();
+    GBL_CTX_END();
+}
+
 GBL_EXPORT void GblContext_setLogFilter(GblContext* pSelf, GblFlags mask) {
     pSelf->logFilter = mask;
 }
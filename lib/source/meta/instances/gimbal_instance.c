@@ -1,6 +1,51 @@
 #include <gimbal/meta/instances/gimbal_instance.h>
+#include <gimbal/allocators/gimbal_concurrent_pool_allocator.h>
 #include "../types/gimbal_type_.h"
 
+#define GBL_INSTANCE_POOL_PAGE_SIZE_    32
+
+// Size of each allocation backing an instance of the given type, including its private data
+GBL_INLINE size_t GblInstance_allocSize_(const GblMetaClass* pMeta, size_t size) {
+    return gblAlignedAllocSizeDefault(size + (-pMeta->instancePrivateOffset));
+}
+
+// Returns the pool backing a GBL_TYPE_FLAG_INSTANCE_POOLED type's instances, creating it upon first use
+static GblConcurrentPoolAllocator* GblInstance_pool_(GblMetaClass* pMeta) {
+    GblConcurrentPoolAllocator* pPool = atomic_load_explicit(&pMeta->pInstancePool, memory_order_acquire);
+    if(pPool) GBL_LIKELY return pPool;
+
+    GBL_CTX_BEGIN(pCtx_);
+    mtx_lock(&typeRegMtx_);
+
+    pPool = atomic_load_explicit(&pMeta->pInstancePool, memory_order_relaxed);
+    if(!pPool) {
+        pPool = GBL_CTX_NEW(GblConcurrentPoolAllocator);
+        GBL_CTX_CALL(GblConcurrentPoolAllocator_construct(pPool,
+                                                          GblInstance_allocSize_(pMeta, pMeta->pInfo->instanceSize),
+                                                          GBL_INSTANCE_POOL_PAGE_SIZE_,
+                                                          GBL_ALIGNOF(GBL_MAX_ALIGN_T)));
+        if(GBL_RESULT_ERROR(GBL_CTX_RESULT())) {
+            GBL_CTX_FREE(pPool);
+            pPool = NULL;
+        } else atomic_store_explicit(&pMeta->pInstancePool, pPool, memory_order_release);
+    }
+
+    mtx_unlock(&typeRegMtx_);
+    GBL_CTX_END_BLOCK();
+    return pPool;
+}
+
+extern void GblInstance_poolFree_(GblMetaClass* pMeta) {
+    GblConcurrentPoolAllocator* pPool = atomic_exchange_explicit(&pMeta->pInstancePool, NULL, memory_order_acq_rel);
+
+    if(pPool) {
+        GBL_CTX_BEGIN(pCtx_);
+        GBL_CTX_CALL(GblConcurrentPoolAllocator_destruct(pPool));
+        GBL_CTX_FREE(pPool);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
 GBL_EXPORT void* GblInstance_basePtr_(const GblInstance* pInstance) {
     GblMetaClass* pMeta = GBL_META_CLASS_(GBL_TYPEOF(pInstance));
     return pMeta? (void*)((uint8_t*)pInstance + pMeta->instancePrivateOffset) : NULL;
@@ -44,46 +89,31 @@ GBL_RESULT typeInstanceConstructValidate_(GblType type, GblClass* pClass, GblBoo
     GBL_CTX_END();
 }
 
+// Takes the instance's reference to its default class, skipping GblClass_refDefault() once it exists
+GBL_INLINE GblClass* GblInstance_classRef_(GblMetaClass* pMeta) {
+    if(GBL_ATOMIC_INT16_LOAD(pMeta->refCount) && pMeta->pClass) {
+        GBL_ATOMIC_INT16_INC(pMeta->refCount);
+        return pMeta->pClass;
+    }
+
+    return GblClass_refDefault(GBL_TYPE_(pMeta));
+}
+
+// Expects the public and private portions of the instance to have been zeroed already
 GBL_EXPORT GBL_RESULT GblInstance_init_(GblType type, GblInstance* pInstance, GblClass* pClass) {
     GblMetaClass*   pMeta = GBL_META_CLASS_(type);
     GBL_CTX_BEGIN(pCtx_);
-    GBL_CTX_PUSH_VERBOSE("[GblType] Instance Init: type %s", GblType_name(type));
-
-    // Zero Initialize
-    memset(pInstance, 0, pMeta->pInfo->instanceSize);
-    if(pMeta->pInfo->instancePrivateSize) {
-        memset((void*)(((uintptr_t)pInstance) + pMeta->instancePrivateOffset),
-               0,
-               pMeta->pInfo->instancePrivateSize);
-    }
 
     // Set Class
-    if(!pClass) pClass = GblClass_refDefault(type);
-    else GblClass_refDefault(type);
-    GBL_CTX_VERIFY_EXPRESSION(pClass, "Failed to retrieve class reference!");
-    pInstance->pClass = pClass;
-
-    GBL_CTX_VERBOSE("Calling initializer chain.");
-    GBL_CTX_PUSH();
-
-    for(uint8_t idx = 0; idx <= pMeta->depth; ++idx) {
-        GblMetaClass* pIter = GBL_META_CLASS_(GblType_base((GblType)pMeta, idx));
-        if(pIter->pInfo->pFnInstanceInit) {
-            GBL_CTX_VERBOSE("Calling instance initializers: [%s]", GblType_name(GBL_TYPE_(pIter)));
-            GBL_CTX_CALL(pIter->pInfo->pFnInstanceInit(pInstance));
-        } else {
-            GBL_CTX_VERBOSE("No instance initializer: [%s]", GblType_name(GBL_TYPE_(pIter)));
-        }
-    }
+    GblClass* pDefaultClass = GblInstance_classRef_(pMeta);
+    GBL_CTX_VERIFY_EXPRESSION(pDefaultClass, "Failed to retrieve class reference!");
+    pInstance->pClass = pClass? pClass : pDefaultClass;
 
-    GBL_CTX_POP(1);
+    // Call flattened initializer chain, from the root type down
+    for(uint8_t i = 0; i < pMeta->instanceInitCount; ++i)
+        GBL_CTX_CALL(pMeta->pInstanceInits[i](pInstance));
 
-//#ifdef GBL_TYPE_DEBUG
-    {
-        int16_t count = GBL_ATOMIC_INT16_INC(pMeta->instanceRefCount);
-        GBL_CTX_DEBUG("Instance RefCount: %u", count+1);
-    }
-//#endif
+    GBL_ATOMIC_INT16_INC(pMeta->instanceRefCount);
 
     GBL_CTX_END();
 }
@@ -92,7 +122,7 @@ GBL_EXPORT GBL_RESULT (GblInstance_construct)(GblInstance* pSelf, GblType type,
     GBL_CTX_BEGIN(pCtx_);
     GBL_CTX_VERIFY_CALL(typeInstanceConstructValidate_(type, pClass, GBL_TRUE));
     GBL_CTX_VERIFY_POINTER(pSelf);
-    GBL_CTX_PUSH_VERBOSE("[GblType] Instance Construct: type %s", GblType_name(type));
+    memset(pSelf, 0, GBL_META_CLASS_(type)->pInfo->instanceSize);
     GBL_CTX_VERIFY_CALL(GblInstance_init_(type, pSelf, pClass));
     GBL_CTX_END();
 }
@@ -103,7 +133,6 @@ GBL_EXPORT GblInstance* (GblInstance_create)(GblType type, size_t size, GblClass
 
     GBL_CTX_BEGIN(pCtx_);
 
-    GBL_CTX_PUSH_VERBOSE("[GblType] Instance Create: type %s", GblType_name(type));
     GBL_CTX_VERIFY_CALL(typeInstanceConstructValidate_(type, pClass, GBL_FALSE));
 
     if(!size) size = pMeta->pInfo->instanceSize;
@@ -114,23 +143,34 @@ GBL_EXPORT GblInstance* (GblInstance_create)(GblType type, size_t size, GblClass
                    size,
                    pMeta->pInfo->instanceSize);
 
-    GBL_CTX_DEBUG("Allocating %zu bytes.", size + (-pMeta->instancePrivateOffset));
-
-    uint8_t* pBase =
-        GBL_CTX_MALLOC(gblAlignedAllocSizeDefault(size + (-pMeta->instancePrivateOffset)),
-                       GBL_ALIGNOF(GBL_MAX_ALIGN_T),
-                       GblType_name(type));
+    uint8_t* pBase = NULL;
+
+    if(pMeta->flags & GBL_TYPE_FLAG_INSTANCE_POOLED) {
+        GBL_CTX_VERIFY(size == pMeta->pInfo->instanceSize,
+                       GBL_RESULT_ERROR_INVALID_ARG,
+                       "Cannot allocate pooled type [%s] with a custom size [given: %zu, pooled: %zu]",
+                       GblType_name(type),
+                       size,
+                       pMeta->pInfo->instanceSize);
+
+        GblConcurrentPoolAllocator* pPool = GblInstance_pool_(pMeta);
+        GBL_CTX_VERIFY_LAST_RECORD();
+        pBase = GblConcurrentPoolAllocator_new(pPool);
+        GBL_CTX_VERIFY(pBase, GBL_RESULT_ERROR_MEM_ALLOC);
+    } else {
+        pBase = GBL_CTX_MALLOC(GblInstance_allocSize_(pMeta, size),
+                               GBL_ALIGNOF(GBL_MAX_ALIGN_T),
+                               GblType_name(type));
+    }
 
-    // initialize just the private portion here, as the public will be initialized later
-    if(pMeta->instancePrivateOffset != 0)
-        memset(pBase, 0, -pMeta->instancePrivateOffset);
+    // zero the private and public portions, which are contiguous, in one go
+    memset(pBase, 0, -pMeta->instancePrivateOffset + pMeta->pInfo->instanceSize);
 
     pBase -= pMeta->instancePrivateOffset;
 
     pInstance = GBL_INSTANCE(pBase);
     GBL_CTX_VERIFY_CALL(GblInstance_init_(type, pInstance, pClass));
 
-    GBL_CTX_POP(1);
     GBL_CTX_END_BLOCK();
     return pInstance;
 }
@@ -172,13 +212,17 @@ GBL_EXPORT GblRefCount GblInstance_destroy(GblInstance* pSelf) {
     GblRefCount refCount = 0;
     GBL_CTX_BEGIN(pCtx_); {
        if(pSelf) {
-            GBL_CTX_PUSH_VERBOSE("[GblType] Instance Destroy: %s",
-                                 GblType_name(GblInstance_typeOf(pSelf)));
-            void* pBase = GblInstance_basePtr_(pSelf);
+            // the class may not outlive destruction, so look up the metaclass first
+            GblMetaClass* pMeta = GBL_META_CLASS_(GBL_TYPEOF(pSelf));
+            void*         pBase = (uint8_t*)pSelf + pMeta->instancePrivateOffset;
             refCount = GblInstance_destruct(pSelf);
             GBL_CTX_VERIFY_LAST_RECORD();
-            GBL_CTX_FREE(pBase);
-            GBL_CTX_POP(1);
+            if(pMeta->flags & GBL_TYPE_FLAG_INSTANCE_POOLED)
+                GBL_CTX_CALL(GblConcurrentPoolAllocator_delete(atomic_load_explicit(&pMeta->pInstancePool,
+                                                                                    memory_order_relaxed),
+                                                               pBase));
+            else
+                GBL_CTX_FREE(pBase);
         }
     }
     GBL_CTX_END_BLOCK();
@@ -186,6 +186,24 @@ GBL_EXPORT GBL_RESULT GblObject_propertyVariantByQuark(const GblObject* pSelf,
     return GblObject_propertyVCall_(pSelf, pProp, pValue);
 }
 
+GBL_EXPORT GBL_RESULT GblObject_propertyVariantById(const GblObject* pSelf,
+                                                    size_t           id,
+                                                    GblVariant*      pValue)
+{
+    const GblProperty* pProp = GblProperty_at(GBL_TYPEOF(pSelf), id);
+
+    if(!pProp) GBL_UNLIKELY {
+        GBL_CTX_BEGIN(NULL);
+        GBL_CTX_VERIFY(GBL_FALSE,
+                       GBL_RESULT_ERROR_INVALID_PROPERTY,
+                       "[GblObject] Attempt to get unknown property #%zu on object type %s",
+                       id, GblType_name(GBL_TYPEOF(pSelf)));
+        GBL_CTX_END();
+    }
+
+    return GblObject_propertyVCall_(pSelf, pProp, pValue);
+}
+
 GBL_EXPORT GBL_RESULT GblObject_propertyVariant(const GblObject* pSelf,
                                                 const char* pName,
                                                 GblVariant* pValue)
@@ -261,6 +279,24 @@ GBL_EXPORT GBL_RESULT GblObject_setPropertyVariantByQuark(GblObject*  pSelf,
     return GblObject_setPropertyVCall_(pSelf, pProp, pValue, GBL_PROPERTY_FLAG_WRITE);
 }
 
+GBL_EXPORT GBL_RESULT GblObject_setPropertyVariantById(GblObject*  pSelf,
+                                                       size_t      id,
+                                                       GblVariant* pValue)
+{
+    const GblProperty* pProp = GblProperty_at(GBL_TYPEOF(pSelf), id);
+
+    if(!pProp) GBL_UNLIKELY {
+        GBL_CTX_BEGIN(NULL);
+        GBL_CTX_VERIFY(GBL_FALSE,
+                       GBL_RESULT_ERROR_INVALID_PROPERTY,
+                       "[GblObject] Attempt to set unknown property #%zu on object type %s",
+                       id, GblType_name(GBL_TYPEOF(pSelf)));
+        GBL_CTX_END();
+    }
+
+    return GblObject_setPropertyVCall_(pSelf, pProp, pValue, GBL_PROPERTY_FLAG_WRITE);
+}
+
 GBL_EXPORT GBL_RESULT GblObject_setPropertyVariant(GblObject* pSelf,
                                                    const char* pName,
                                                    GblVariant* pValue)
@@ -350,6 +386,26 @@ GBL_EXPORT GBL_RESULT GblObject_propertyVaListByQuark(const GblObject* pSelf, Gb
     GBL_CTX_END();
 }
 
+GBL_EXPORT GBL_RESULT GblObject_propertyById(const GblObject* pSelf, size_t id, ...) {
+    va_list varArgs;
+    va_start(varArgs, id);
+
+    GBL_CTX_BEGIN(NULL);
+
+    const GblProperty* pProp = GblProperty_at(GBL_TYPEOF(pSelf), id);
+    GBL_CTX_VERIFY(pProp,
+                   GBL_RESULT_ERROR_INVALID_PROPERTY,
+                   "[GblObject] Tried to get unknown property: %s[#%zu]",
+                   GblType_name(GBL_TYPEOF(pSelf)),
+                   id);
+
+    GBL_CTX_CALL(GblObject_propertyVaList_(pSelf, pProp, &varArgs));
+
+    GBL_CTX_END_BLOCK();
+    va_end(varArgs);
+    return GBL_CTX_RESULT();
+}
+
 GBL_EXPORT GBL_RESULT GblObject_property(const GblObject* pSelf, const char* pName, ...) {
     va_list varArgs;
 
@@ -414,6 +470,26 @@ GBL_EXPORT GBL_RESULT GblObject_setPropertyVaListByQuark(GblObject* pSelf, GblQu
 }
 
 
+GBL_EXPORT GBL_RESULT GblObject_setPropertyById(GblObject* pSelf, size_t id, ...) {
+    va_list varArgs;
+    va_start(varArgs, id);
+
+    GBL_CTX_BEGIN(NULL);
+
+    const GblProperty* pProp = GblProperty_at(GBL_TYPEOF(pSelf), id);
+    GBL_CTX_VERIFY(pProp,
+                   GBL_RESULT_ERROR_INVALID_PROPERTY,
+                   "[GblObject] Tried to set unknown property: %s[#%zu]",
+                   GblType_name(GBL_TYPEOF(pSelf)),
+                   id);
+
+    GBL_CTX_CALL(GblObject_setPropertyVaList_(pSelf, pProp, &varArgs));
+
+    GBL_CTX_END_BLOCK();
+    va_end(varArgs);
+    return GBL_CTX_RESULT();
+}
+
 GBL_EXPORT GBL_RESULT GblObject_setProperty(GblObject* pSelf, const char* pName, ...) {
     va_list varArgs;
     va_start(varArgs, pName);
@@ -12,7 +12,34 @@ typedef struct GblPropertyRoot_ {
     GblProperty*    pLast;
 } GblPropertyRoot_;
 
-static GblHashSet propertyRegistry_;
+typedef struct GblPropertyEntry_ {
+    GblQuark            name;
+    const GblProperty*  pProperty;      // what lookups resolve to, including any override
+    const GblProperty*  pDeclaration;   // original declaration, which is what iteration yields
+} GblPropertyEntry_;
+
+/* Contiguous table of every property visible from a type, indexed by
+   GblProperty_index(). It begins with a copy of its parent's table, so a
+   property keeps the same index within every derived type, followed by
+   the type's own properties in installation order. An OVERRIDE property
+   takes over the entry of the property it overrides rather than adding
+   one. Tables are built lazily, with typeRegMtx_ held, and are replaced
+   for a type and all of its descendants whenever one of its properties
+   is installed or removed, which renumbers every property after it.
+   Readers load tables without the lock, so replaced tables are retired
+   rather than freed, and are only reclaimed when the property system is
+   finalized. */
+typedef struct GblPropertyTable_ {
+    struct GblPropertyTable_* pRetired;
+    size_t              count;
+    size_t              baseCount;      // entries inherited from the parent's table
+    GblFlags            flags;          // combined flags of every declaration
+    GblPropertyEntry_   entries[];
+} GblPropertyTable_;
+
+static GblHashSet           propertyRegistry_;
+static GblPropertyTable_    propertyTableEmpty_ = { 0 };
+static GblPropertyTable_*   pPropertyTablesRetired_ = NULL;   // guarded by typeRegMtx_
 
 // ========== PROPERTY SYSTEM PRIVATE ==========
 
@@ -59,6 +86,103 @@ GBL_INLINE  GblProperty* propertyFirst_(GblType objectType) {
     return pProperty;
 }
 
+static GblPropertyTable_* propertyTableBuild_(GblMetaClass* pMeta) {
+    GblPropertyTable_* pTable = atomic_load_explicit(&pMeta->pProperties, memory_order_acquire);
+
+    if(pTable) return pTable;
+
+    const GblPropertyTable_* pBase = pMeta->pParent?
+                                        propertyTableBuild_(pMeta->pParent) : &propertyTableEmpty_;
+    const GblPropertyRoot_*  pRoot = propertyRoot_(GBL_TYPE_(pMeta));
+
+    // Types without any properties all share the same empty table
+    if(!pRoot && !pBase->count) {
+        pTable = &propertyTableEmpty_;
+        atomic_store_explicit(&pMeta->pProperties, pTable, memory_order_release);
+        return pTable;
+    }
+
+    GBL_CTX_BEGIN(pCtx_);
+    const size_t capacity = pBase->count + (pRoot? pRoot->count : 0);
+
+    pTable = GBL_CTX_MALLOC(sizeof(GblPropertyTable_) + sizeof(GblPropertyEntry_) * capacity);
+    memcpy(pTable->entries, pBase->entries, sizeof(GblPropertyEntry_) * pBase->count);
+    pTable->pRetired  = NULL;
+    pTable->count     = pBase->count;
+    pTable->baseCount = pBase->count;
+    pTable->flags     = pBase->flags;
+
+    for(GblProperty* pIt = pRoot? GBL_PRIV(pRoot->base).pNext : NULL;
+        pIt;
+        pIt = GBL_PRIV_REF(pIt).pNext)
+    {
+        if(pIt->flags & GBL_PROPERTY_FLAG_OVERRIDE) {
+            size_t o = pTable->count;
+            while(o-- && pTable->entries[o].name != pIt->name);
+
+            if(o != GBL_NPOS) {
+                pTable->entries[o].pProperty = pIt;
+                GBL_PRIV_REF(pIt).index      = o;
+                continue;
+            }
+        }
+
+        pTable->entries[pTable->count] = (GblPropertyEntry_){ pIt->name, pIt, pIt };
+        GBL_PRIV_REF(pIt).index = pTable->count++;
+        pTable->flags |= pIt->flags;
+    }
+
+    atomic_store_explicit(&pMeta->pProperties, pTable, memory_order_release);
+
+    GBL_CTX_END_BLOCK();
+    return pTable;
+}
+
+static const GblPropertyTable_* propertyTable_(GblType objectType) {
+    if(objectType == GBL_INVALID_TYPE)
+        return &propertyTableEmpty_;
+
+    GblMetaClass*      pMeta  = GBL_META_CLASS_(objectType);
+    GblPropertyTable_* pTable = atomic_load_explicit(&pMeta->pProperties, memory_order_acquire);
+
+    if(!pTable) GBL_UNLIKELY {
+        mtx_lock(&typeRegMtx_);
+        pTable = propertyTableBuild_(pMeta);
+        mtx_unlock(&typeRegMtx_);
+    }
+
+    return pTable;
+}
+
+// Only for a metaclass which is being destroyed, when nothing can still be reading its table
+extern void GblProperty_tableFree_(GblMetaClass* pMeta) {
+    GblPropertyTable_* pTable = atomic_exchange_explicit(&pMeta->pProperties, NULL, memory_order_acq_rel);
+
+    if(pTable && pTable != &propertyTableEmpty_) {
+        GBL_CTX_BEGIN(pCtx_);
+        GBL_CTX_FREE(pTable);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
+// Caller must hold typeRegMtx_
+static void propertyTableInvalidate_(GblMetaClass* pMeta) {
+    GblPropertyTable_* pTable = atomic_exchange_explicit(&pMeta->pProperties, NULL, memory_order_acq_rel);
+
+    if(pTable && pTable != &propertyTableEmpty_) {
+        pTable->pRetired        = pPropertyTablesRetired_;
+        pPropertyTablesRetired_ = pTable;
+    }
+
+    for(GblNaryTreeNode* pIt = pMeta->treeNode.pChildFirst; pIt; pIt = pIt->pSiblingNext)
+        propertyTableInvalidate_((GblMetaClass*)pIt);
+}
+
+static void propertyTablesInvalidate_(GblType objectType) {
+    mtx_lock(&typeRegMtx_);
+    propertyTableInvalidate_(GBL_META_CLASS_(objectType));
+    mtx_unlock(&typeRegMtx_);
+}
 
 extern GBL_RESULT GblProperty_init_(GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
@@ -84,6 +208,13 @@ static GblBool GblProperty_final_iterator_(const GblHashSet* pHash, void* pEntry
 
 extern GBL_RESULT GblProperty_final_(GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
+
+    while(pPropertyTablesRetired_) {
+        GblPropertyTable_* pRetired = pPropertyTablesRetired_->pRetired;
+        GBL_CTX_FREE(pPropertyTablesRetired_);
+        pPropertyTablesRetired_ = pRetired;
+    }
+
     size_t  count = GblHashSet_size(&propertyRegistry_);
     if(count) {
         GBL_CTX_RECORD_SET(GBL_RESULT_ERROR_MEM_FREE,
@@ -134,6 +265,15 @@ GBL_EXPORT GblType GblProperty_objectType(const GblProperty* pSelf) {
     return pSelf? GBL_PRIV_REF(pSelf).objectType : GBL_INVALID_TYPE;
 }
 
+GBL_EXPORT size_t GblProperty_index(const GblProperty* pSelf) {
+    if(!pSelf) return GBL_NPOS;
+
+    // Indices are only assigned once the owning type's table has been built
+    propertyTable_(GBL_PRIV_REF(pSelf).objectType);
+
+    return GBL_PRIV_REF(pSelf).index;
+}
+
 GBL_EXPORT GBL_RESULT GblProperty_createOrConstruct(GblProperty** ppSelf,
                                                     GblType       derivedType,
                                                     const char*   pName,
@@ -165,25 +305,27 @@ GBL_EXPORT GBL_RESULT GblProperty_createOrConstruct(GblProperty** ppSelf,
 }
 
 GBL_EXPORT const GblProperty* GblProperty_findQuark(GblType objectType, GblQuark name) {
-    const GblProperty* pProperty = NULL;
-    GBL_CTX_BEGIN(GblHashSet_context(&propertyRegistry_)); {
-        GBL_CTX_VERIFY(name != GBL_QUARK_INVALID,
-                       GBL_RESULT_ERROR_INVALID_PROPERTY);
-        GblProperty* pKey             = GBL_ALLOCA(sizeof(GblProperty));
-        pKey->name                    = name;
-        GBL_PRIV_REF(pKey).objectType = objectType;
-
-        while(GBL_PRIV_REF(pKey).objectType != GBL_INVALID_TYPE) {
-            const GblProperty** ppRet = (const GblProperty**)GblHashSet_get(&propertyRegistry_, &pKey);
-            if(ppRet) {
-                pProperty = *ppRet;
-                break;
-            }
-            GBL_PRIV_REF(pKey).objectType = GblType_parent(GBL_PRIV_REF(pKey).objectType);
-        }
+    if(name == GBL_QUARK_INVALID) GBL_UNLIKELY {
+        GBL_CTX_BEGIN(NULL);
+        GBL_CTX_VERIFY(GBL_FALSE, GBL_RESULT_ERROR_INVALID_PROPERTY);
+        GBL_CTX_END_BLOCK();
+        return NULL;
+    }
 
-    } GBL_CTX_END_BLOCK();
-    return pProperty;
+    const GblPropertyTable_* pTable = propertyTable_(objectType);
+
+    // Search backwards, so a shadowing property in a derived type wins
+    for(size_t e = pTable->count; e--; )
+        if(pTable->entries[e].name == name)
+            return pTable->entries[e].pProperty;
+
+    return NULL;
+}
+
+GBL_EXPORT const GblProperty* GblProperty_at(GblType objectType, size_t index) {
+    const GblPropertyTable_* pTable = propertyTable_(objectType);
+
+    return index < pTable->count? pTable->entries[index].pProperty : NULL;
 }
 
 GBL_EXPORT const GblProperty* GblProperty_find(GblType objectType, const char* pName) {
@@ -200,11 +342,15 @@ GBL_EXPORT GblBool GblProperty_foreach(GblType           objectType,
     GBL_CTX_VERIFY_TYPE(objectType);
     GBL_CTX_VERIFY_POINTER(pFnIt);
 
-    const size_t  depth = GblType_depth(objectType);
-    for(size_t  d = 0; d <= depth; ++d) {
-        const GblType curType = GblType_base(objectType, d);
-        const GblProperty* pProp = NULL;
-        while((pProp = GblProperty_next(curType, pProp, flags))) {
+    const GblPropertyTable_* pTable = propertyTable_(objectType);
+
+    if(!(pTable->flags & flags))
+        GBL_CTX_DONE();
+
+    for(size_t e = 0; e < pTable->count; ++e) {
+        const GblProperty* pProp = pTable->entries[e].pDeclaration;
+
+        if((pProp->flags & flags) && !(pProp->flags & GBL_PROPERTY_FLAG_OVERRIDE)) {
             if(pFnIt(pProp, pClosure)) {
                 result = GBL_TRUE;
                 GBL_CTX_DONE();
@@ -217,41 +363,26 @@ GBL_EXPORT GblBool GblProperty_foreach(GblType           objectType,
 }
 
 GBL_EXPORT const GblProperty* GblProperty_next(GblType objectType, const GblProperty* pPrev, GblFlags mask) {
-    const GblProperty* pNext = NULL;
-    GBL_CTX_BEGIN(GblHashSet_context(&propertyRegistry_));
-    const GblProperty* pIt = NULL;
-
-    // We're first starting, grab the root node of the first type with a property entry
-    if(!pPrev) {
-        pIt = (GblProperty*)propertyRoot_(objectType);
-        // Skip types which don't have the flag we're looking for
-        if(!pIt || !(pIt->flags&mask))
-            GBL_CTX_DONE();
-    // We're continuing from an existing node
-    } else {
-        pIt = pPrev;
-    }
+    const GblPropertyTable_* pTable = propertyTable_(objectType);
 
-    // while on unacceptable node
-    while(pIt) {
+    // Start with the type's own properties, or continue on from the previous one
+    size_t e = pTable->baseCount;
 
-        // regular next node
-        if(GBL_PRIV_REF(pIt).pNext) {
-            pIt = GblProperty_findQuark(objectType, GBL_PRIV_REF(pIt).pNext->name);
-        //beginning of new type
-        } else {
-            break;
-        }
+    if(pPrev) {
+        e = GblProperty_index(pPrev);
+        if(e >= pTable->count) return NULL;
+        ++e;
+    }
+
+    for(; e < pTable->count; ++e) {
+        const GblProperty* pProp = pTable->entries[e].pDeclaration;
 
         // Check if the mask matches and skip overrides!!
-        if((pIt->flags & mask) && !(pIt->flags & GBL_PROPERTY_FLAG_OVERRIDE)) {
-            pNext = pIt;
-            break;
-        }
+        if((pProp->flags & mask) && !(pProp->flags & GBL_PROPERTY_FLAG_OVERRIDE))
+            return pProp;
     }
 
-    GBL_CTX_END_BLOCK();
-    return pNext;
+    return NULL;
 }
 
 GBL_EXPORT GBL_RESULT GblProperty_install(GblType objectType, GblProperty* pProperty) {
@@ -287,6 +418,8 @@ GBL_EXPORT GBL_RESULT GblProperty_install(GblType objectType, GblProperty* pProp
     GblBool isFirst = GblHashSet_insert(&propertyRegistry_, &pProperty);
     if(!isFirst) GBL_CTX_WARN("Overwrote existing property!");
 
+    propertyTablesInvalidate_(objectType);
+
     GBL_CTX_POP(1);
     GBL_CTX_END();
 }
@@ -337,6 +470,8 @@ GBL_EXPORT GblBool GblProperty_uninstallQuark(GblType objectType, GblQuark name)
         if(!pRoot->count) {
             success = GblHashSet_erase(&propertyRegistry_, &pRoot);
         }
+
+        propertyTablesInvalidate_(objectType);
     }
     GBL_CTX_END_BLOCK();
     return success;
@@ -392,15 +527,7 @@ GBL_EXPORT int GblProperty_compareValues(const GblProperty* pSelf, const GblVari
 }
 
 GBL_EXPORT size_t  GblProperty_count(GblType objectType) {
-    size_t  count = 0;
-    while(objectType != GBL_INVALID_TYPE) {
-        const GblPropertyRoot_* pRoot = propertyRoot_(objectType);
-        if(pRoot) {
-            count += pRoot->count;
-        }
-        objectType = GblType_parent(objectType);
-    }
-    return count;
+    return propertyTable_(objectType)->count;
 }
 
 GBL_EXPORT GblFlags GblProperty_combinedFlags(GblType objectType) {
@@ -422,6 +549,7 @@ static GBL_RESULT GblProperty_initVaList_(GblProperty* pSelf,
     pSelf->name                    = GblQuark_fromString(pName);
     pSelf->id                      = id;
     pSelf->flags                   = flags;
+    GBL_PRIV_REF(pSelf).index      = GBL_NPOS;
 
     if(optionalArgCount) {
         GBL_VCALL(GblProperty, pFnInitOptionalArgs, pSelf, optionalArgCount, pList);
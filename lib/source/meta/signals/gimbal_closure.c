@@ -1,6 +1,7 @@
 #include <gimbal/meta/signals/gimbal_closure.h>
 #include <gimbal/core/gimbal_ctx.h>
 #include <gimbal/strings/gimbal_quark.h>
+#include "../types/gimbal_type_.h"
 
 static GBL_THREAD_LOCAL GblClosure* pCurrentClosure_ = NULL;
 
@@ -20,6 +21,13 @@ GBL_EXPORT GblClosure* GblClosure_current(void) {
     return pCurrentClosure_;
 }
 
+// Lets signal emission invoke a GblCClosure's callback directly while still looking like a GblClosure_invoke()
+GBL_EXPORT GblClosure* GblClosure_setCurrent_(GblClosure* pClosure) {
+    GblClosure* pPrevClosure = pCurrentClosure_;
+    pCurrentClosure_ = pClosure;
+    return pPrevClosure;
+}
+
 GBL_EXPORT void* GblClosure_currentUserdata(void) {
     return GblBox_userdata(GBL_BOX(GblClosure_current()));
 }
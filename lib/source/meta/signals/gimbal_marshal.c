@@ -110,6 +110,11 @@ GBL_DEFINE_CCLOSURE_MARSHAL_VOID__(INSTANCE_BOXED,
                                    (GblInstance*, void*),
                                    (GblVariant_toPointer(&pArgs[0]), GblVariant_toPointer(&pArgs[1])))
 
+GBL_DEFINE_CCLOSURE_MARSHAL_VOID__(INSTANCE_INSTANCE,
+                                   2,
+                                   (GblInstance*, GblInstance*),
+                                   (GblVariant_toPointer(&pArgs[0]), GblVariant_getInstance(&pArgs[1])))
+
 
 GBL_EXPORT GBL_RESULT GblMarshal_ClassClosureMeta(GblClosure*        pClosure,
                                                   GblVariant*        pRetValue,
@@ -3,32 +3,63 @@
 #include <gimbal/meta/signals/gimbal_class_closure.h>
 #include <gimbal/meta/signals/gimbal_signal_closure.h>
 #include <gimbal/containers/gimbal_hash_set.h>
-#include <gimbal/containers/gimbal_array_map.h>
 #include <gimbal/containers/gimbal_array_list.h>
 #include <gimbal/containers/gimbal_doubly_linked_list.h>
-#include <gimbal/allocators/gimbal_pool_allocator.h>
+#include <gimbal/allocators/gimbal_concurrent_pool_allocator.h>
+#include <gimbal/core/gimbal_main_loop.h>
+#include <gimbal/core/gimbal_task.h>
+#include <tinycthread.h>
+#include <stdatomic.h>
 #include "../types/gimbal_type_.h"
 
 #define GBL_CONNECTION_POOL_ALLOCATOR_
+#define GBL_EMITTER_HANDLER_ARRAY_CAPACITY_DEFAULT_   4
 
 #ifdef GBL_CONNECTION_POOL_ALLOCATOR_
 #   define GBL_CONNECTION_POOL_ALLOCATOR_PAGE_SIZE_  16
-#   define GBL_CONNECTION_NEW_()                     (GblPoolAllocator_new(&connectionAllocator_))
-#   define GBL_CONNECTION_DELETE_(ptr)               (GblPoolAllocator_delete(&connectionAllocator_, ptr))
+#   define GBL_CONNECTION_NEW_()                     (GblConcurrentPoolAllocator_new(&connectionAllocator_))
+#   define GBL_CONNECTION_DELETE_(ptr)               (GblConcurrentPoolAllocator_delete(&connectionAllocator_, ptr))
 #else
 #   define GBL_CONNECTION_NEW_()                     GBL_CTX_NEW(Connection_)
 #   define GBL_CONNECTION_DELETE_(ptr)               GBL_CTX_FREE(ptr)
 #endif
 
+/* Thread safety: every structural change (installing signals, creating
+   connection tables and handlers, connecting, and disconnecting) happens
+   with signalMtx_ held. Emission never takes it for GblBox emitters: each
+   handler publishes an immutable, reference-counted ConnectionArray_
+   snapshot of its connections, which an emitter iterates over after
+   taking a reference to it under the handler's own spinlock. Connections
+   are reference counted as well, so one which gets disconnected during an
+   emission stays alive until every snapshot and queued delivery holding
+   it has been released, and is skipped from then on. */
+
+// Raw, unboxed signal argument, as it was read from a va_list
+typedef union SignalArg_ {
+    int32_t     i32;
+    uint32_t    u32;
+    int64_t     i64;
+    uint64_t    u64;
+    double      f64;
+    void*       pVoid;
+} SignalArg_;
+
+// Calls a GblCClosure's callback with its receiver and raw argument, in place of its marshal
+typedef void (*SignalDirectFn_)(GblFnPtr pFnCallback, GblInstance* pReceiver, const SignalArg_* pArg);
+
 typedef struct Signal_ {
     GblType         ownerType;
     GblQuark        name;
     //GblLinkedListnNode next;
     GblMarshalFn    pFnCMarshal;
+    SignalDirectFn_ pFnDirect;  // NULL if pFnCMarshal isn't a builtin marshal matching argTypes
+    char            directFmt;  // GblIVariant va format of the raw argument, if there is one
     size_t          argCount;
     GblType         argTypes[];
 } Signal_;
 
+struct EmitterHandler_;
+
 typedef struct Connection_ {
     GblDoublyLinkedListNode emitterList;
     GblDoublyLinkedListNode receiverList;
@@ -36,24 +67,70 @@ typedef struct Connection_ {
     GblInstance*            pReceiver;
     const Signal_*          pSignal;
     GblClosure*             pClosure;
+    struct EmitterHandler_* pHandler;
+    GblMainLoop*            pLoop;          // NULL unless the connection is queued
+    atomic_size_t           refCount;       // one for the lists, plus one per snapshot or pending delivery
+    atomic_bool             disconnected;
 } Connection_;
 
+// Immutable snapshot of an emitter handler's connections, which is what emission iterates over
+typedef struct ConnectionArray_ {
+    atomic_size_t refCount;
+    size_t        queuedCount;
+    size_t        count;
+    Connection_*  pConnections[];
+} ConnectionArray_;
+
 typedef struct EmitterHandler_ {
-    GblDoublyLinkedListNode connectionList;
-    GblBool                 blocked;
+    GblDoublyLinkedListNode     connectionList;
+    GblQuark                    name;
+    _Atomic(ConnectionArray_*)  pArray;     // NULL while there are no connections
+    atomic_flag                 arrayLock;  // only held to swap out or take a reference to pArray
+    atomic_bool                 blocked;
 } EmitterHandler_;
 
+/* Append-only array of handlers, which is grown by copying. Handlers are
+   appended in place and published with a release store of the count, so
+   readers never need a lock; outgrown arrays are chained together and
+   only freed with their table, as readers may still be scanning them. */
+typedef struct EmitterHandlerArray_ {
+    struct EmitterHandlerArray_* pRetired;
+    size_t                       capacity;
+    atomic_size_t                count;
+    EmitterHandler_*             pHandlers[];
+} EmitterHandlerArray_;
+
 typedef struct InstanceConnectionTable_ {
-    GblInstance*                pInstance;
-    GblDoublyLinkedListNode     receiverConnections;
-    GblArrayMap*                pEmitterHandlers;
-    GblBool                     signalsBlocked;
+    GblInstance*                    pInstance;
+    GblDoublyLinkedListNode         receiverConnections;
+    _Atomic(EmitterHandlerArray_*)  pHandlers;
+    atomic_bool                     signalsBlocked;
 } InstanceConnectionTable_;
 
+// Arguments boxed once per emission, shared between all of its queued deliveries
+typedef struct QueuedEmission_ {
+    atomic_size_t refCount;
+    size_t        argCount;     // number of constructed arguments, including the receiver
+    GblVariant    args[];
+} QueuedEmission_;
+
+// Task enqueued onto a GblMainLoop to deliver an emission to a queued connection
+typedef struct SignalTask_ {
+    GblTask             base;
+    struct SignalTask_* pNextFree;
+    Connection_*        pConnection;
+    QueuedEmission_*    pEmission;
+} SignalTask_;
+
 static GblHashSet       signalSet_;
 static GblHashSet       instanceConnectionTableSet_;
+static mtx_t            signalMtx_;
+static mtx_t            taskPoolMtx_;
+static SignalTask_*     pTaskPoolHead_  = NULL;
+static SignalTask_*     pTaskPoolTail_  = NULL;
+static GblType          signalTaskType_ = GBL_INVALID_TYPE;
 #ifdef GBL_CONNECTION_POOL_ALLOCATOR_
-static GblPoolAllocator connectionAllocator_;
+static GblConcurrentPoolAllocator connectionAllocator_;
 #endif
 
 static GBL_THREAD_LOCAL Connection_* pActiveConnection_ = NULL;
@@ -78,6 +155,89 @@ static void signalSetDestructor_(const GblHashSet* pSet, void* pEntry) {
     GBL_CTX_END_BLOCK();
 }
 
+/* Builtin GblCClosure marshals which may be bypassed by calling the
+   callback directly: (marshal postfix, argument type, C parameter type,
+   va format, argument expression). */
+#define GBL_SIGNAL_DIRECT_MARSHALS_(X)                                  \
+    X(BOOL,     GBL_BOOL_TYPE,      GblBool,    'i',    i32 != 0)       \
+    X(CHAR,     GBL_CHAR_TYPE,      char,       'i',    i32)            \
+    X(UINT8,    GBL_UINT8_TYPE,     uint8_t,    'i',    i32)            \
+    X(UINT16,   GBL_UINT16_TYPE,    uint16_t,   'i',    i32)            \
+    X(INT16,    GBL_INT16_TYPE,     int16_t,    'i',    i32)            \
+    X(UINT32,   GBL_UINT32_TYPE,    uint32_t,   'l',    u32)            \
+    X(INT32,    GBL_INT32_TYPE,     int32_t,    'i',    i32)            \
+    X(UINT64,   GBL_UINT64_TYPE,    uint64_t,   'z',    u64)            \
+    X(INT64,    GBL_INT64_TYPE,     int64_t,    'q',    i64)            \
+    X(FLOAT,    GBL_FLOAT_TYPE,     float,      'd',    f64)            \
+    X(DOUBLE,   GBL_DOUBLE_TYPE,    double,     'd',    f64)            \
+    X(ENUM,     GBL_ENUM_TYPE,      GblEnum,    'l',    u32)            \
+    X(FLAGS,    GBL_FLAGS_TYPE,     GblFlags,   'l',    u32)            \
+    X(POINTER,  GBL_POINTER_TYPE,   void*,      'p',    pVoid)
+
+#define GBL_SIGNAL_DIRECT_FN_(postfix, type, cType, fmt, arg)                                          \
+    static void SignalDirect_##postfix##_(GblFnPtr pFnCallback, GblInstance* pReceiver, const SignalArg_* pArg) { \
+        ((void (*)(GblInstance*, cType))pFnCallback)(pReceiver, (cType)(pArg->arg));                     \
+    }
+
+GBL_SIGNAL_DIRECT_MARSHALS_(GBL_SIGNAL_DIRECT_FN_)
+
+static void SignalDirect_INSTANCE_(GblFnPtr pFnCallback, GblInstance* pReceiver, const SignalArg_* pArg) {
+    GBL_UNUSED(pArg);
+    ((void (*)(GblInstance*))pFnCallback)(pReceiver);
+}
+
+// Checks whether the signal's marshal is a builtin one whose work can be done inline, for its argument types
+static void Signal_initDirect_(Signal_* pSignal) {
+    pSignal->pFnDirect = NULL;
+    pSignal->directFmt = '\0';
+
+    if(pSignal->pFnCMarshal == GblMarshal_CClosure_VOID__INSTANCE) {
+        if(!pSignal->argCount) pSignal->pFnDirect = SignalDirect_INSTANCE_;
+        return;
+    }
+
+    if(pSignal->argCount != 1) return;
+
+#define GBL_SIGNAL_DIRECT_MATCH_(postfix, type, cType, fmt, arg)                       \
+    if(pSignal->pFnCMarshal == GblMarshal_CClosure_VOID__INSTANCE_##postfix) {        \
+        if(pSignal->argTypes[0] == type ||                                            \
+           GblType_derives(pSignal->argTypes[0], type)) {                             \
+            pSignal->pFnDirect = SignalDirect_##postfix##_;                           \
+            pSignal->directFmt = fmt;                                                 \
+        }                                                                             \
+        return;                                                                       \
+    }
+
+    GBL_SIGNAL_DIRECT_MARSHALS_(GBL_SIGNAL_DIRECT_MATCH_)
+
+#undef GBL_SIGNAL_DIRECT_MATCH_
+}
+
+GBL_INLINE void SignalArg_fromVaList_(SignalArg_* pArg, char fmt, va_list* pVarArgs) {
+    switch(fmt) {
+    case 'i': pArg->i32   = va_arg(*pVarArgs, int32_t);  break;
+    case 'l': pArg->u32   = va_arg(*pVarArgs, uint32_t); break;
+    case 'q': pArg->i64   = va_arg(*pVarArgs, int64_t);  break;
+    case 'z': pArg->u64   = va_arg(*pVarArgs, uint64_t); break;
+    case 'd': pArg->f64   = va_arg(*pVarArgs, double);   break;
+    case 'p': pArg->pVoid = va_arg(*pVarArgs, void*);    break;
+    default: break;
+    }
+}
+
+// Boxes a raw argument back up, for connections which couldn't take the direct path
+static GBL_RESULT SignalArg_toVariant_(const SignalArg_* pArg, char fmt, GblType type, GblVariant* pVariant) {
+    switch(fmt) {
+    case 'i': return GblVariant_constructValueCopy(pVariant, type, pArg->i32);
+    case 'l': return GblVariant_constructValueCopy(pVariant, type, pArg->u32);
+    case 'q': return GblVariant_constructValueCopy(pVariant, type, pArg->i64);
+    case 'z': return GblVariant_constructValueCopy(pVariant, type, pArg->u64);
+    case 'd': return GblVariant_constructValueCopy(pVariant, type, pArg->f64);
+    case 'p': return GblVariant_constructValueCopy(pVariant, type, pArg->pVoid);
+    default:  return GBL_RESULT_ERROR_INVALID_ARG;
+    }
+}
+
 GBL_EXPORT GBL_RESULT GblSignal_install(GblType      ownerType,
                                         const char*  pName,
                                         GblMarshalFn pFnCMarshal,
@@ -112,7 +272,11 @@ GBL_EXPORT GBL_RESULT GblSignal_install(GblType      ownerType,
         GBL_CTX_VERIFY_TYPE(pSignal->argTypes[a]);
     }
 
+    Signal_initDirect_(pSignal);
+
+    mtx_lock(&signalMtx_);
     void* pExisting = GblHashSet_set(&signalSet_, &pSignal);
+    mtx_unlock(&signalMtx_);
 
     if(pExisting) {
         GBL_CTX_WARN("Overwrote existing signal! [%s::%s]",
@@ -143,13 +307,18 @@ GBL_EXPORT GBL_RESULT GblSignal_uninstall(GblType     ownerType,
     pKey->ownerType = ownerType;
     pKey->name      = GblQuark_fromString(pName);
 
-    GBL_CTX_VERIFY(GblHashSet_erase(&signalSet_, &pKey),
+    mtx_lock(&signalMtx_);
+    const GblBool erased = GblHashSet_erase(&signalSet_, &pKey);
+    mtx_unlock(&signalMtx_);
+
+    GBL_CTX_VERIFY(erased,
                    GBL_RESULT_ERROR_INVALID_HANDLE);
 
     GBL_CTX_POP(1);
     GBL_CTX_END();
 }
 
+// Must be called with signalMtx_ held
 static Signal_* Signal_findByQuark_(GblType     ownerType,
                                     GblQuark    name)
 {
@@ -184,6 +353,19 @@ done:
     return pSignal;
 }
 
+GBL_EXPORT GblSignalId GblSignal_id(GblType ownerType, const char* pName) {
+    const GblQuark name = pName? GblQuark_tryString(pName) : GBL_QUARK_INVALID;
+    GblSignalId    id   = GBL_SIGNAL_ID_INVALID;
+
+    if(name != GBL_QUARK_INVALID) {
+        mtx_lock(&signalMtx_);
+        id = (GblSignalId)Signal_findByQuark_(ownerType, name);
+        mtx_unlock(&signalMtx_);
+    }
+
+    return id;
+}
+
 static GblHash instanceConnectionTableHasher_(const GblHashSet* pSet, const void* pEntry) {
     GBL_UNUSED(pSet);
     const InstanceConnectionTable_* pConnections = *(const InstanceConnectionTable_**)pEntry;
@@ -197,32 +379,67 @@ static GblBool instanceConnectionTableComparator_(const GblHashSet* pSet, const
     return (pConnections1->pInstance == pConnections2->pInstance);
 }
 
-static void instanceConnectionTableDestructor_(const GblHashSet* pSet, void* pEntry) {
-    GBL_CTX_BEGIN(GblHashSet_context(pSet));
-    InstanceConnectionTable_* pConnections = *(InstanceConnectionTable_**)pEntry;
+static void InstanceConnectionTable_destroy_(InstanceConnectionTable_* pConnections) {
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
 
+    EmitterHandlerArray_* pHandlers = atomic_load_explicit(&pConnections->pHandlers,
+                                                           memory_order_relaxed);
 #ifndef NDEBUG
     GBL_CTX_VERIFY_EXPRESSION(!GblDoublyLinkedList_count(&pConnections->receiverConnections));
-    for(size_t  s = 0; s < GblArrayMap_size(&pConnections->pEmitterHandlers); ++s) {
-       EmitterHandler_* pHandler = (void*)GblArrayMap_probeValue(&pConnections->pEmitterHandlers,
-                                                                s);
-       GBL_CTX_VERIFY_EXPRESSION(!GblDoublyLinkedList_count(&pHandler->connectionList));
+#endif
+    if(pHandlers) {
+        const size_t count = atomic_load_explicit(&pHandlers->count, memory_order_relaxed);
+        for(size_t  h = 0; h < count; ++h) {
+#ifndef NDEBUG
+            GBL_CTX_VERIFY_EXPRESSION(!GblDoublyLinkedList_count(&pHandlers->pHandlers[h]->connectionList));
+#endif
+            GBL_CTX_FREE(pHandlers->pHandlers[h]);
+        }
+    }
 
+    while(pHandlers) {
+        EmitterHandlerArray_* pRetired = pHandlers->pRetired;
+        GBL_CTX_FREE(pHandlers);
+        pHandlers = pRetired;
     }
-#endif
-    GblArrayMap_destroy(&pConnections->pEmitterHandlers);
+
     GBL_CTX_FREE(pConnections);
     GBL_CTX_END_BLOCK();
 }
 
+static void instanceConnectionTableDestructor_(const GblHashSet* pSet, void* pEntry) {
+    GBL_UNUSED(pSet);
+    InstanceConnectionTable_destroy_(*(InstanceConnectionTable_**)pEntry);
+}
+
+// GblBox instances store their table inline, so only bare GblInstances go through the global set
+GBL_INLINE _Atomic(InstanceConnectionTable_*)* InstanceConnectionTable_slot_(GblInstance* pInstance) {
+    const GblMetaClass* pMeta = pInstance? GBL_META_CLASS_(GBL_CLASS_TYPE_(pInstance->pClass)) : NULL;
+
+    if(pMeta && pMeta->depth && (GblType)(pMeta->depth == 1? pMeta : pMeta->pBases[1]) == GBL_BOX_TYPE)
+        return (_Atomic(InstanceConnectionTable_*)*)&GBL_PRIV_REF((GblBox*)pInstance).pConnectionTable;
+
+    return NULL;
+}
+
 static InstanceConnectionTable_* InstanceConnectionTable_find_(GblInstance* pInstance) {
+    _Atomic(InstanceConnectionTable_*)* pSlot = InstanceConnectionTable_slot_(pInstance);
+    if(pSlot) return atomic_load_explicit(pSlot, memory_order_acquire);
+
     InstanceConnectionTable_* pKey = GBL_ALLOCA(sizeof(InstanceConnectionTable_));
     pKey->pInstance = pInstance;
+
+    // bare instances have to go through the shared set, which is only safe to probe under the lock
+    mtx_lock(&signalMtx_);
     InstanceConnectionTable_** ppTable = GblHashSet_get(&instanceConnectionTableSet_,
                                                        &pKey);
-    return ppTable? *ppTable : NULL;
+    InstanceConnectionTable_*  pTable  = ppTable? *ppTable : NULL;
+    mtx_unlock(&signalMtx_);
+
+    return pTable;
 }
 
+// Must be called with signalMtx_ held
 static InstanceConnectionTable_* InstanceConnectionTable_create_(GblInstance* pInstance) {
     InstanceConnectionTable_* pTable = NULL;
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
@@ -231,13 +448,17 @@ static InstanceConnectionTable_* InstanceConnectionTable_create_(GblInstance* pI
 
     memset(pTable, 0, sizeof(InstanceConnectionTable_));
     pTable->pInstance = pInstance;
+    atomic_init(&pTable->pHandlers, NULL);
+    atomic_init(&pTable->signalsBlocked, GBL_FALSE);
 
     GblDoublyLinkedList_init(&pTable->receiverConnections);
 
-    GBL_CTX_VERIFY(GblHashSet_insert(&instanceConnectionTableSet_, &pTable),
-                   GBL_RESULT_ERROR_INVALID_OPERATION,
-                   "Failed to create an emitter connection table for type [%s]!",
-                   GblType_name(GBL_TYPEOF(pInstance)));
+    _Atomic(InstanceConnectionTable_*)* pSlot = InstanceConnectionTable_slot_(pInstance);
+    if(pSlot) atomic_store_explicit(pSlot, pTable, memory_order_release);
+    else GBL_CTX_VERIFY(GblHashSet_insert(&instanceConnectionTableSet_, &pTable),
+                        GBL_RESULT_ERROR_INVALID_OPERATION,
+                        "Failed to create an emitter connection table for type [%s]!",
+                        GblType_name(GBL_TYPEOF(pInstance)));
     GBL_CTX_END_BLOCK();
     return pTable;
 }
@@ -250,57 +471,81 @@ GBL_INLINE InstanceConnectionTable_* InstanceConnectionTable_findOrCreate_(GblIn
     return pTable;
 }
 
+GBL_INLINE size_t EmitterHandler_count_(const EmitterHandlerArray_* pHandlers) {
+    return pHandlers? atomic_load_explicit(&pHandlers->count, memory_order_acquire) : 0;
+}
 
-static GBL_RESULT emitterSignalHandlerDtor_(const GblArrayMap* pMap, uintptr_t key, void* pEntry) {
-    GBL_UNUSED(key, pMap);
-    EmitterHandler_* pHandlers = pEntry;
-    GBL_CTX_BEGIN(NULL);
-    GBL_CTX_FREE(pHandlers);
-    GBL_CTX_END();
+static EmitterHandler_* EmitterHandler_find_(InstanceConnectionTable_* pTable,
+                                             GblQuark                  name)
+{
+    const EmitterHandlerArray_* pHandlers = atomic_load_explicit(&pTable->pHandlers,
+                                                                 memory_order_acquire);
+    const size_t                count     = EmitterHandler_count_(pHandlers);
+
+    for(size_t  h = 0; h < count; ++h)
+        if(pHandlers->pHandlers[h]->name == name)
+            return pHandlers->pHandlers[h];
+
+    return NULL;
 }
 
-static EmitterHandler_* EmitterHandler_find_(GblInstance*               pInstance,
-                                             const char*                pName,
-                                             GblQuark                   nameQuark,
-                                             InstanceConnectionTable_*  pTable)
+// Must be called with signalMtx_ held
+static EmitterHandler_* EmitterHandler_create_(InstanceConnectionTable_* pTable,
+                                               GblQuark                  name)
 {
     EmitterHandler_* pHandler = NULL;
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
 
-    if(!pTable)
-        pTable = InstanceConnectionTable_find_(pInstance);
+    EmitterHandlerArray_* pHandlers = atomic_load_explicit(&pTable->pHandlers,
+                                                           memory_order_relaxed);
+    const size_t          count     = EmitterHandler_count_(pHandlers);
 
-    if(pTable) {
+    pHandler = GBL_CTX_MALLOC(sizeof(EmitterHandler_));
+    memset(pHandler, 0, sizeof(EmitterHandler_));
+    GblDoublyLinkedList_init(&pHandler->connectionList);
+    pHandler->name = name;
+    atomic_init(&pHandler->pArray, NULL);
+    atomic_flag_clear(&pHandler->arrayLock);
+    atomic_init(&pHandler->blocked, GBL_FALSE);
+
+    if(!pHandlers || count == pHandlers->capacity) {
+        const size_t capacity = pHandlers? pHandlers->capacity * 2 :
+                                           GBL_EMITTER_HANDLER_ARRAY_CAPACITY_DEFAULT_;
 
-        if(nameQuark == GBL_QUARK_INVALID)
-            nameQuark = GblQuark_tryString(pName);
+        EmitterHandlerArray_* pGrown = GBL_CTX_MALLOC(sizeof(EmitterHandlerArray_) +
+                                                      sizeof(EmitterHandler_*) * capacity);
+        pGrown->pRetired = pHandlers;
+        pGrown->capacity = capacity;
 
-        if(nameQuark != GBL_QUARK_INVALID)
-            pHandler = (void*)GblArrayMap_getValue(&pTable->pEmitterHandlers,
-                                                  nameQuark);
+        if(count)
+            memcpy(pGrown->pHandlers, pHandlers->pHandlers, sizeof(EmitterHandler_*) * count);
+
+        pGrown->pHandlers[count] = pHandler;
+        atomic_init(&pGrown->count, count + 1);
+
+        atomic_store_explicit(&pTable->pHandlers, pGrown, memory_order_release);
+    } else {
+        pHandlers->pHandlers[count] = pHandler;
+        atomic_store_explicit(&pHandlers->count, count + 1, memory_order_release);
     }
 
+    GBL_CTX_END_BLOCK();
     return pHandler;
 }
 
-
-
+// Must be called with signalMtx_ held
 static EmitterHandler_* EmitterHandler_findOrCreate_(GblInstance*               pInstance,
                                                      const char*                pName,
-                                                     GblQuark                   nameQuark,
-                                                     InstanceConnectionTable_*  pTable,
-                                                     Signal_*                   pSignal,
                                                      InstanceConnectionTable_** ppTableOut,
                                                      Signal_**                  ppSignalOut)
 {
-    EmitterHandler_* pHandler = NULL;
+    EmitterHandler_*          pHandler = NULL;
+    InstanceConnectionTable_* pTable   = NULL;
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
 
     GBL_CTX_VERIFY_POINTER(pInstance);
 
-    if(nameQuark == GBL_QUARK_INVALID) {
-        if(pSignal) nameQuark = pSignal->name;
-        else nameQuark = GblQuark_tryString(pName);
-    }
+    const GblQuark nameQuark = pName? GblQuark_tryString(pName) : GBL_QUARK_INVALID;
 
     GBL_CTX_VERIFY(nameQuark != GBL_QUARK_INVALID,
                    GBL_RESULT_ERROR_INVALID_HANDLE,
@@ -308,18 +553,13 @@ static EmitterHandler_* EmitterHandler_findOrCreate_(GblInstance*
                    pName);
 
     // first check to see if we have an entry for the signal (fast path)
-    if(!pTable) {
-        pTable = InstanceConnectionTable_find_(pInstance);
-        if(ppTableOut) *ppTableOut = pTable;
-    }
-
-    pHandler = EmitterHandler_find_(pInstance, pName, nameQuark, pTable);
+    pTable = InstanceConnectionTable_find_(pInstance);
+    if(pTable) pHandler = EmitterHandler_find_(pTable, nameQuark);
 
     if(!pHandler || ppSignalOut) {
         //then check to see if signal is even valid
-        const GblType typeId = GBL_TYPEOF(pInstance);
-        if(!pSignal) pSignal = Signal_findByQuark_(typeId,
-                                                   nameQuark);
+        const GblType typeId  = GBL_TYPEOF(pInstance);
+        Signal_*      pSignal = Signal_findByQuark_(typeId, nameQuark);
         GBL_CTX_VERIFY(pSignal,
                        GBL_RESULT_ERROR_INVALID_HANDLE,
                        "[GblType] %s is not a valid signal on type %s",
@@ -328,41 +568,266 @@ static EmitterHandler_* EmitterHandler_findOrCreate_(GblInstance*
         if(ppSignalOut) *ppSignalOut = pSignal;
     }
 
-    if(!pHandler && pSignal) {
-
+    if(!pHandler) {
         //then create table if necessary
         if(!pTable) pTable = InstanceConnectionTable_create_(pInstance);
-
-        if(ppTableOut) *ppTableOut = pTable;
+        GBL_CTX_VERIFY_LAST_RECORD();
 
         //finally add the emitter handler to the table for the given signal
-        pHandler = GBL_CTX_MALLOC(sizeof(EmitterHandler_));
-        memset(pHandler, 0, sizeof(EmitterHandler_));
-        GblDoublyLinkedList_init(&pHandler->connectionList);
-
-        GblArrayMap_setUserdata(&pTable->pEmitterHandlers,
-                                nameQuark,
-                                (uintptr_t)pHandler,
-                                emitterSignalHandlerDtor_);
+        pHandler = EmitterHandler_create_(pTable, nameQuark);
     }
 
     GBL_CTX_END_BLOCK();
+    if(ppTableOut) *ppTableOut = pTable;
     return pHandler;
+}
 
+GBL_INLINE void EmitterHandler_lock_(EmitterHandler_* pHandler) {
+    while(atomic_flag_test_and_set_explicit(&pHandler->arrayLock, memory_order_acquire))
+        thrd_yield();
+}
+
+GBL_INLINE void EmitterHandler_unlock_(EmitterHandler_* pHandler) {
+    atomic_flag_clear_explicit(&pHandler->arrayLock, memory_order_release);
+}
+
+static void Connection_release_(Connection_* pConnection) {
+    if(atomic_fetch_sub_explicit(&pConnection->refCount, 1, memory_order_acq_rel) == 1) {
+        GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+        GBL_UNREF(pConnection->pClosure);
+        if(pConnection->pLoop) GBL_UNREF(pConnection->pLoop);
+        GBL_CONNECTION_DELETE_(pConnection);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
+static void ConnectionArray_release_(ConnectionArray_* pArray) {
+    if(atomic_fetch_sub_explicit(&pArray->refCount, 1, memory_order_acq_rel) == 1) {
+        for(size_t  c = 0; c < pArray->count; ++c)
+            Connection_release_(pArray->pConnections[c]);
+
+        GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+        GBL_CTX_FREE(pArray);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
+// Takes a reference to the handler's current snapshot of connections, returning NULL if it has none
+GBL_INLINE ConnectionArray_* EmitterHandler_acquire_(EmitterHandler_* pHandler) {
+    ConnectionArray_* pArray = NULL;
+
+    // don't bother with the lock if there's nothing to take
+    if(atomic_load_explicit(&pHandler->pArray, memory_order_relaxed)) {
+        EmitterHandler_lock_(pHandler);
+        pArray = atomic_load_explicit(&pHandler->pArray, memory_order_relaxed);
+        if(pArray) atomic_fetch_add_explicit(&pArray->refCount, 1, memory_order_relaxed);
+        EmitterHandler_unlock_(pHandler);
+    }
+
+    return pArray;
+}
+
+// Rebuilds and swaps in the handler's snapshot from its connection list, must be called with signalMtx_ held
+static GBL_RESULT EmitterHandler_publish_(EmitterHandler_* pHandler) {
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+
+    ConnectionArray_* pArray = NULL;
+    const size_t      count  = GblDoublyLinkedList_count(&pHandler->connectionList);
+
+    if(count) {
+        pArray = GBL_CTX_MALLOC(sizeof(ConnectionArray_) + sizeof(Connection_*) * count);
+        atomic_init(&pArray->refCount, 1);
+        pArray->queuedCount = 0;
+        pArray->count       = 0;
+
+        for(GblDoublyLinkedListNode* pNode = pHandler->connectionList.pNext;
+            pNode != &pHandler->connectionList;
+            pNode = pNode->pNext)
+        {
+            Connection_* pConnection = GBL_DOUBLY_LINKED_LIST_ENTRY(pNode, Connection_, emitterList);
+            atomic_fetch_add_explicit(&pConnection->refCount, 1, memory_order_relaxed);
+            pArray->pConnections[pArray->count++] = pConnection;
+            if(pConnection->pLoop) ++pArray->queuedCount;
+        }
+    }
+
+    EmitterHandler_lock_(pHandler);
+    ConnectionArray_* pOld = atomic_load_explicit(&pHandler->pArray, memory_order_relaxed);
+    atomic_store_explicit(&pHandler->pArray, pArray, memory_order_relaxed);
+    EmitterHandler_unlock_(pHandler);
+
+    // emissions which are still iterating over the old snapshot keep it alive
+    if(pOld) ConnectionArray_release_(pOld);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT SignalTask_exec_(GblTask* pTask);
+static GBL_RESULT SignalTask_cancel_(GblTask* pTask);
+
+static GBL_RESULT SignalTaskClass_init_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pUd);
+
+    GBL_TASK_CLASS(pClass)->pFnExec   = SignalTask_exec_;
+    GBL_TASK_CLASS(pClass)->pFnCancel = SignalTask_cancel_;
+
+    return GBL_RESULT_SUCCESS;
+}
+
+// Must be called with signalMtx_ held, which is what keeps registration from racing
+static GblType SignalTask_type_(void) {
+    static const GblTypeInfo info = {
+        .classSize    = sizeof(GblTaskClass),
+        .pFnClassInit = SignalTaskClass_init_,
+        .instanceSize = sizeof(SignalTask_)
+    };
+
+    if(signalTaskType_ == GBL_INVALID_TYPE) GBL_UNLIKELY {
+        signalTaskType_ = GblType_register(GblQuark_internStringStatic("GblSignalTask"),
+                                           GBL_TASK_TYPE,
+                                           &info,
+                                           GBL_TYPE_FLAG_TYPEINFO_STATIC);
+    }
+
+    return signalTaskType_;
+}
+
+static void QueuedEmission_release_(QueuedEmission_* pEmission) {
+    if(atomic_fetch_sub_explicit(&pEmission->refCount, 1, memory_order_acq_rel) == 1) {
+        GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+
+        // args[0] is the emitter's own receiver argument, which it has already destructed
+        for(size_t  a = 1; a < pEmission->argCount; ++a)
+            GBL_CTX_CALL(GblVariant_destruct(&pEmission->args[a]));
+
+        GBL_CTX_FREE(pEmission);
+        GBL_CTX_END_BLOCK();
+    }
+}
+
+/* Drops the task's references and returns it to the pool. The task is
+   still running at this point, so the pool only ever hands out tasks
+   which GblTask has since marked done, which is the very last thing it
+   does with them, and resets them through GblTask_reset(). */
+static void SignalTask_recycle_(SignalTask_* pSelf) {
+    Connection_*     pConnection = pSelf->pConnection;
+    QueuedEmission_* pEmission   = pSelf->pEmission;
+
+    pSelf->pConnection = NULL;
+    pSelf->pEmission   = NULL;
+    pSelf->pNextFree   = NULL;
+
+    mtx_lock(&taskPoolMtx_);
+    if(pTaskPoolTail_) pTaskPoolTail_->pNextFree = pSelf;
+    else pTaskPoolHead_ = pSelf;
+    pTaskPoolTail_ = pSelf;
+    mtx_unlock(&taskPoolMtx_);
+
+    // released last, as they may run arbitrary destructors
+    QueuedEmission_release_(pEmission);
+    Connection_release_(pConnection);
+}
+
+static SignalTask_* SignalTask_acquire_(void) {
+    SignalTask_* pTask = NULL;
+    SignalTask_* pPrev = NULL;
+
+    // the oldest tasks are the most likely to be done, but any which are still finishing up are skipped
+    mtx_lock(&taskPoolMtx_);
+    for(pTask = pTaskPoolHead_; pTask; pPrev = pTask, pTask = pTask->pNextFree) {
+        // a READY task never made it onto a loop in the first place
+        if(GblTask_isDone(GBL_TASK(pTask)) || GblTask_state(GBL_TASK(pTask)) == GBL_TASK_STATE_READY) {
+            if(pPrev) pPrev->pNextFree = pTask->pNextFree;
+            else pTaskPoolHead_ = pTask->pNextFree;
+
+            if(pTaskPoolTail_ == pTask) pTaskPoolTail_ = pPrev;
+
+            pTask->pNextFree = NULL;
+            break;
+        }
+    }
+    mtx_unlock(&taskPoolMtx_);
+
+    // nobody else can reach a task once it's been unlinked, so resetting it can't fail
+    if(pTask) GblTask_reset(GBL_TASK(pTask));
+    else pTask = (SignalTask_*)GblObject_create(signalTaskType_, NULL);
+
+    return pTask;
+}
+
+static GBL_RESULT SignalTask_exec_(GblTask* pTask) {
+    SignalTask_*     pSelf       = (SignalTask_*)pTask;
+    Connection_*     pConnection = pSelf->pConnection;
+    QueuedEmission_* pEmission   = pSelf->pEmission;
+    GBL_RESULT       result      = GBL_RESULT_SUCCESS;
+
+    // drop the delivery if the connection was severed while it was waiting in the queue
+    if(!atomic_load_explicit(&pConnection->disconnected, memory_order_acquire)) {
+        GblVariant* pArgs = GBL_ALLOCA(sizeof(GblVariant) * pEmission->argCount);
+
+        // the emission's arguments are only borrowed, the receiver is the only one which is per-connection
+        memcpy(&pArgs[1], &pEmission->args[1], sizeof(GblVariant) * (pEmission->argCount - 1));
+        GblVariant_constructPointer(&pArgs[0], GBL_POINTER_TYPE, pConnection->pReceiver);
+
+        Connection_* pOldConnection = pActiveConnection_;
+        pActiveConnection_ = pConnection;
+
+        result = GblClosure_invoke(pConnection->pClosure,
+                                   NULL,
+                                   pEmission->argCount,
+                                   pArgs);
+
+        pActiveConnection_ = pOldConnection;
+        GblVariant_destruct(&pArgs[0]);
+    }
+
+    SignalTask_recycle_(pSelf);
+    return result;
+}
+
+static GBL_RESULT SignalTask_cancel_(GblTask* pTask) {
+    SignalTask_recycle_((SignalTask_*)pTask);
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT Connection_enqueue_(Connection_* pConnection, QueuedEmission_* pEmission) {
+    SignalTask_* pTask = NULL;
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+
+    pTask = SignalTask_acquire_();
+    GBL_CTX_VERIFY(pTask,
+                   GBL_RESULT_ERROR_MEM_ALLOC,
+                   "[GblSignal] Failed to create a task for a queued connection!");
+
+    atomic_fetch_add_explicit(&pConnection->refCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&pEmission->refCount, 1, memory_order_relaxed);
+    pTask->pConnection = pConnection;
+    pTask->pEmission   = pEmission;
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_enqueue(pConnection->pLoop, GBL_TASK(pTask)));
+
+    GBL_CTX_END_BLOCK();
+    if(pTask && !GBL_RESULT_SUCCESS(GBL_CTX_RESULT()) && pTask->pConnection)
+        SignalTask_recycle_(pTask);
+    return GBL_CTX_RESULT();
 }
 
 static GBL_RESULT Signal_connect_(GblInstance*   pEmitter,
                                   const char*    pName,
-                                  GblQuark       name,
                                   GblInstance*   pReceiver,
+                                  GblMainLoop*   pLoop,
                                   GblClosure*    pClosure)
 {
+    GblBool hasMutex = GBL_FALSE;
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
     GBL_CTX_VERIFY_POINTER(pEmitter);
     GBL_CTX_VERIFY_POINTER(pName);
     GBL_CTX_VERIFY_POINTER(pReceiver);
     GBL_CTX_VERIFY_POINTER(pClosure);
 
+    mtx_lock(&signalMtx_);
+    hasMutex = GBL_TRUE;
+
     Signal_* pSignal = NULL;
     InstanceConnectionTable_* pEmitterTable = NULL;
 
@@ -370,9 +835,6 @@ static GBL_RESULT Signal_connect_(GblInstance*   pEmitter,
     //   which will also grab the generated emitter table and signal
     EmitterHandler_* pHandler = EmitterHandler_findOrCreate_(pEmitter,
                                                              pName,
-                                                             name,
-                                                             NULL,
-                                                             NULL,
                                                              &pEmitterTable,
                                                              &pSignal);
     GBL_CTX_VERIFY_LAST_RECORD();
@@ -381,6 +843,12 @@ static GBL_RESULT Signal_connect_(GblInstance*   pEmitter,
     InstanceConnectionTable_* pReceiverTable = (pReceiver != pEmitter)?
                                                 InstanceConnectionTable_findOrCreate_(pReceiver) :
                                                 pEmitterTable;
+    GBL_CTX_VERIFY_LAST_RECORD();
+
+    if(pLoop)
+        GBL_CTX_VERIFY(SignalTask_type_() != GBL_INVALID_TYPE,
+                       GBL_RESULT_ERROR_INVALID_TYPE,
+                       "[GblSignal] Failed to register the task type for queued connections!");
 
     // Initialize closure
     if(!GblClosure_hasMarshal(pClosure)) GblClosure_setMarshal(pClosure, pSignal->pFnCMarshal);
@@ -391,6 +859,13 @@ static GBL_RESULT Signal_connect_(GblInstance*   pEmitter,
     pConnection->pReceiver  = pReceiver;
     pConnection->pSignal    = pSignal;
     pConnection->pClosure   = pClosure;
+    pConnection->pHandler   = pHandler;
+    pConnection->pLoop      = pLoop? GBL_MAIN_LOOP(GBL_REF(pLoop)) : NULL;
+    atomic_init(&pConnection->refCount, 1);
+    atomic_init(&pConnection->disconnected, GBL_FALSE);
+
+    // the connection owns the closure from here on out
+    pClosure = NULL;
 
     // Add connection to receiver list
     GblDoublyLinkedList_pushBack(&pReceiverTable->receiverConnections,
@@ -400,8 +875,12 @@ static GBL_RESULT Signal_connect_(GblInstance*   pEmitter,
     GblDoublyLinkedList_pushBack(&pHandler->connectionList,
                                  &pConnection->emitterList);
 
+    // Make it visible to emitters
+    GBL_CTX_VERIFY_CALL(EmitterHandler_publish_(pHandler));
+
     GBL_CTX_END_BLOCK();
-    if(!GBL_RESULT_SUCCESS(GBL_CTX_RESULT())) {
+    if(hasMutex) mtx_unlock(&signalMtx_);
+    if(pClosure && !GBL_RESULT_SUCCESS(GBL_CTX_RESULT())) {
         GBL_UNREF(pClosure);
     }
     return GBL_CTX_RESULT();
@@ -419,7 +898,7 @@ GBL_EXPORT GBL_RESULT (GblSignal_connect)(GblInstance* pEmitter,
         return GBL_RESULT_ERROR_INVALID_POINTER;
     else {
         GblCClosure* pCClosure = GblCClosure_create(pFnCCallback, pUserdata);
-        return Signal_connect_(pEmitter, pSignalName, GBL_QUARK_INVALID, pReceiver, GBL_CLOSURE(pCClosure));
+        return Signal_connect_(pEmitter, pSignalName, pReceiver, NULL, GBL_CLOSURE(pCClosure));
     }
 }
 
@@ -436,7 +915,7 @@ GBL_EXPORT GBL_RESULT GblSignal_connectClass(GblInstance* pEmitter,
     GBL_CTX_VERIFY_ARG(methodOffset >= sizeof(GblClass));
 
     GblClassClosure* pCClosure = GblClassClosure_create(classType, methodOffset, pReceiver, NULL);
-    GBL_CTX_VERIFY_CALL(Signal_connect_(pEmitter, pSignalName, GBL_QUARK_INVALID, pReceiver, GBL_CLOSURE(pCClosure)));
+    GBL_CTX_VERIFY_CALL(Signal_connect_(pEmitter, pSignalName, pReceiver, NULL, GBL_CLOSURE(pCClosure)));
 
     GBL_CTX_END();
 }
@@ -453,11 +932,11 @@ GBL_EXPORT GBL_RESULT GblSignal_connectSignal(GblInstance* pEmitter,
     GBL_CTX_VERIFY(quarkName != GBL_QUARK_INVALID,
                    GBL_RESULT_ERROR_INVALID_HANDLE);
 
-    GBL_CTX_VERIFY(Signal_findByQuark_(GBL_TYPEOF(pDstEmitter), quarkName),
+    GBL_CTX_VERIFY(GblSignal_id(GBL_TYPEOF(pDstEmitter), pDstSignalName) != GBL_SIGNAL_ID_INVALID,
                    GBL_RESULT_ERROR_INVALID_HANDLE);
 
     GblSignalClosure* pSignalClosure = GblSignalClosure_create(pDstSignalName, NULL);
-    GBL_CTX_VERIFY_CALL(Signal_connect_(pEmitter, pSignalName, GBL_QUARK_INVALID, pDstEmitter, GBL_CLOSURE(pSignalClosure)));
+    GBL_CTX_VERIFY_CALL(Signal_connect_(pEmitter, pSignalName, pDstEmitter, NULL, GBL_CLOSURE(pSignalClosure)));
 
     GBL_CTX_END();
 }
@@ -467,19 +946,43 @@ GBL_EXPORT GBL_RESULT GblSignal_connectClosure(GblInstance* pInstance,
                                                GblInstance* pReceiver,
                                                GblClosure*  pClosure)
 {
-    return pClosure? Signal_connect_(pInstance, pName, GBL_QUARK_INVALID, pReceiver, pClosure) :
+    return pClosure? Signal_connect_(pInstance, pName, pReceiver, NULL, pClosure) :
                      GBL_RESULT_ERROR_INVALID_POINTER;
 }
 
-GBL_INLINE GBL_RESULT deleteConnection_(Connection_* pConnection) {
-    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+GBL_EXPORT GBL_RESULT GblSignal_connectQueued(GblInstance* pEmitter,
+                                              const char*  pSignalName,
+                                              GblInstance* pReceiver,
+                                              GblMainLoop* pLoop,
+                                              GblFnPtr     pFnCCallback,
+                                              void*        pUserdata)
+{
+    if(!pFnCCallback || !pLoop)
+        return GBL_RESULT_ERROR_INVALID_POINTER;
+    else {
+        GblCClosure* pCClosure = GblCClosure_create(pFnCCallback, pUserdata);
+        return Signal_connect_(pEmitter, pSignalName, pReceiver, pLoop, GBL_CLOSURE(pCClosure));
+    }
+}
+
+GBL_EXPORT GBL_RESULT GblSignal_connectClosureQueued(GblInstance* pEmitter,
+                                                     const char*  pSignalName,
+                                                     GblInstance* pReceiver,
+                                                     GblMainLoop* pLoop,
+                                                     GblClosure*  pClosure)
+{
+    return pClosure && pLoop? Signal_connect_(pEmitter, pSignalName, pReceiver, pLoop, pClosure) :
+                              GBL_RESULT_ERROR_INVALID_POINTER;
+}
 
+// Unlinks the connection and drops the lists' reference to it, leaving the caller to republish its handler
+GBL_INLINE void deleteConnection_(Connection_* pConnection) {
     GblDoublyLinkedList_remove(&pConnection->emitterList);
     GblDoublyLinkedList_remove(&pConnection->receiverList);
-    GBL_UNREF(pConnection->pClosure);
-    GBL_CONNECTION_DELETE_(pConnection);
 
-    GBL_CTX_END();
+    // the current snapshot still holds a reference, so this is never the last one
+    atomic_store_explicit(&pConnection->disconnected, GBL_TRUE, memory_order_release);
+    Connection_release_(pConnection);
 }
 
 static size_t  disconnectFromHandler_(EmitterHandler_*  pHandler,
@@ -497,10 +1000,14 @@ static size_t  disconnectFromHandler_(EmitterHandler_*  pHandler,
 
         if(!pClosure || pClosure == pConnection->pClosure)
         {
-            GBL_CTX_CALL(deleteConnection_(pConnection));
+            deleteConnection_(pConnection);
             ++disconnectedCount;
         }
     }
+
+    if(disconnectedCount)
+        GBL_CTX_CALL(EmitterHandler_publish_(pHandler));
+
     GBL_CTX_END_BLOCK();
     return disconnectedCount;
 }
@@ -522,6 +1029,8 @@ static size_t  GblSignal_disconnect_(GblInstance*               pEmitter,
 
     const GblQuark signalName = GblQuark_tryString(pSignalName);
 
+    mtx_lock(&signalMtx_);
+
     if(pReceiver) {
         if(!pReceiverTable) {
             pReceiverTable = InstanceConnectionTable_find_(pReceiver);
@@ -540,7 +1049,9 @@ static size_t  GblSignal_disconnect_(GblInstance*               pEmitter,
                    (!pEmitter                       || pEmitter   == pConnection->pEmitter)      &&
                    (!pClosure                       || pClosure   == pConnection->pClosure))
                 {
-                    GBL_CTX_CALL(deleteConnection_(pConnection));
+                    EmitterHandler_* pHandler = pConnection->pHandler;
+                    deleteConnection_(pConnection);
+                    GBL_CTX_CALL(EmitterHandler_publish_(pHandler));
                     ++disconnectedCount;
                 }
             }
@@ -554,22 +1065,23 @@ static size_t  GblSignal_disconnect_(GblInstance*               pEmitter,
         if(pEmitterTable) {
 
             if(signalName != GBL_QUARK_INVALID) {
-                EmitterHandler_* pHandler = (void*)GblArrayMap_getValue(&pEmitterTable->pEmitterHandlers,
-                                                                        signalName);
+                EmitterHandler_* pHandler = EmitterHandler_find_(pEmitterTable, signalName);
                 if(pHandler)
                     disconnectedCount += disconnectFromHandler_(pHandler, pClosure);
 
             } else {
-                const size_t  signalHandlerCount = GblArrayMap_size(&pEmitterTable->pEmitterHandlers);
+                const EmitterHandlerArray_* pHandlers = atomic_load_explicit(&pEmitterTable->pHandlers,
+                                                                             memory_order_relaxed);
+                const size_t  signalHandlerCount = EmitterHandler_count_(pHandlers);
                 for(size_t  s = 0; s < signalHandlerCount; ++s) {
-                    EmitterHandler_* pHandler = (void*)GblArrayMap_probeValue(&pEmitterTable->pEmitterHandlers,
-                                                                              s);
-                    disconnectedCount += disconnectFromHandler_(pHandler, pClosure);
+                    disconnectedCount += disconnectFromHandler_(pHandlers->pHandlers[s], pClosure);
                 }
             }
         }
     }
 
+    mtx_unlock(&signalMtx_);
+
     GBL_CTX_END_BLOCK();
     return disconnectedCount;
 }
@@ -583,21 +1095,34 @@ GBL_EXPORT size_t  GblSignal_disconnect(GblInstance* pEmitter,
 }
 
 GBL_EXPORT GBL_RESULT GblSignal_removeInstance_(GblInstance* pInstance) {
+    _Atomic(InstanceConnectionTable_*)* pSlot  = InstanceConnectionTable_slot_(pInstance);
+
+    // GblBox instances which never had any connections have nothing to clean up
+    if(pSlot && !atomic_load_explicit(pSlot, memory_order_acquire))
+        return GBL_RESULT_SUCCESS;
+
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
 
-    InstanceConnectionTable_* pTable = InstanceConnectionTable_find_(pInstance);
+    mtx_lock(&signalMtx_);
+
+    InstanceConnectionTable_*           pTable = InstanceConnectionTable_find_(pInstance);
     if(pTable) {
 
         GblSignal_disconnect_(NULL, NULL, pInstance, NULL, NULL, pTable);
         GblSignal_disconnect_(pInstance, NULL, NULL, NULL, pTable, NULL);
 
-        GBL_CTX_VERIFY(GblHashSet_erase(&instanceConnectionTableSet_,
-                                        &pTable),
-                       GBL_RESULT_ERROR_MEM_FREE,
-                       "[GblSignal] Failed to erase instance connection table!");
+        if(pSlot) {
+            atomic_store_explicit(pSlot, NULL, memory_order_relaxed);
+            InstanceConnectionTable_destroy_(pTable);
+        } else GBL_CTX_VERIFY(GblHashSet_erase(&instanceConnectionTableSet_,
+                                               &pTable),
+                              GBL_RESULT_ERROR_MEM_FREE,
+                              "[GblSignal] Failed to erase instance connection table!");
     }
 
-    GBL_CTX_END();
+    GBL_CTX_END_BLOCK();
+    mtx_unlock(&signalMtx_);
+    return GBL_CTX_RESULT();
 }
 
 GBL_EXPORT GblBool GblSignal_block(GblInstance* pInstance,
@@ -607,19 +1132,16 @@ GBL_EXPORT GblBool GblSignal_block(GblInstance* pInstance,
     GblBool old = GBL_FALSE;
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
 
+    mtx_lock(&signalMtx_);
     EmitterHandler_* pHandler = EmitterHandler_findOrCreate_(pInstance,
                                                              pSignalName,
-                                                             GBL_QUARK_INVALID,
-                                                             NULL,
-                                                             NULL,
                                                              NULL,
                                                              NULL);
+    mtx_unlock(&signalMtx_);
     GBL_CTX_VERIFY_LAST_RECORD();
 
-    if(pHandler) {
-        old = pHandler->blocked;
-        pHandler->blocked = blocked;
-    }
+    if(pHandler)
+        old = atomic_exchange_explicit(&pHandler->blocked, blocked, memory_order_relaxed);
 
     GBL_CTX_END_BLOCK();
     return old;
@@ -630,10 +1152,11 @@ GBL_EXPORT GblBool GblSignal_blockAll(GblInstance* pInstance,
                                       GblBool      blocked)
 {
     GblBool old = GBL_FALSE;
+    mtx_lock(&signalMtx_);
     InstanceConnectionTable_* pTable = InstanceConnectionTable_findOrCreate_(pInstance);
+    mtx_unlock(&signalMtx_);
     if(pTable) {
-        old = pTable->signalsBlocked;
-        pTable->signalsBlocked = blocked;
+        old = atomic_exchange_explicit(&pTable->signalsBlocked, blocked, memory_order_relaxed);
     }
     return old;
 }
@@ -642,91 +1165,176 @@ GBL_EXPORT size_t  GblSignal_connectionCount(GblInstance* pInstance,
                                              const char*  pSignalName)
 {
     size_t  count = 0;
-    if(pSignalName) {
-        EmitterHandler_* pHandler = EmitterHandler_find_(pInstance, pSignalName, GBL_QUARK_INVALID, NULL);
-        if(pHandler) {
-            count = GblDoublyLinkedList_count(&pHandler->connectionList);
-        }
-    } else {
-        InstanceConnectionTable_* pTable = InstanceConnectionTable_find_(pInstance);
-        if(pTable) {
-            const size_t  size = GblArrayMap_size(&pTable->pEmitterHandlers);
+    mtx_lock(&signalMtx_);
+    InstanceConnectionTable_* pTable = InstanceConnectionTable_find_(pInstance);
+    if(pTable) {
+        if(pSignalName) {
+            const GblQuark   name     = GblQuark_tryString(pSignalName);
+            EmitterHandler_* pHandler = name != GBL_QUARK_INVALID?
+                                            EmitterHandler_find_(pTable, name) : NULL;
+            if(pHandler) {
+                count = GblDoublyLinkedList_count(&pHandler->connectionList);
+            }
+        } else {
+            const EmitterHandlerArray_* pHandlers = atomic_load_explicit(&pTable->pHandlers,
+                                                                         memory_order_relaxed);
+            const size_t  size = EmitterHandler_count_(pHandlers);
             for(size_t  s = 0; s < size; ++s) {
-                EmitterHandler_* pHandler = (EmitterHandler_*)GblArrayMap_probeValue(&pTable->pEmitterHandlers, s);
-                count += GblDoublyLinkedList_count(&pHandler->connectionList);
+                count += GblDoublyLinkedList_count(&pHandlers->pHandlers[s]->connectionList);
             }
         }
     }
+    mtx_unlock(&signalMtx_);
     return count;
 }
 
-static GBL_RESULT GblSignal_emit_(GblInstance* pEmitter,
-                                  const char*  pSignalName,
-                                  va_list*     pVarArgs,
-                                  GblVariant*  pVariantArgs)
+// Returns the C callback of a connection whose GblCClosure would only have its marshal forward arguments to it
+GBL_INLINE GblFnPtr Connection_directCallback_(const Connection_* pConnection) {
+    GblClosure* pClosure = pConnection->pClosure;
+
+    if(!pConnection->pLoop                                                                      &&
+       GBL_PRIV_REF(pClosure).pFnMarshal == pConnection->pSignal->pFnCMarshal                    &&
+       GblInstance_typeOf((GblInstance*)pClosure) == GBL_C_CLOSURE_TYPE                            &&
+       !((GblClosureClass*)GblInstance_class((GblInstance*)pClosure))->pFnMetaMarshal)
+        return GBL_PRIV_REF((GblCClosure*)pClosure).pFnCallback;
+
+    return NULL;
+}
+
+// Calls or enqueues every live connection within a snapshot
+static GBL_RESULT Signal_invoke_(const ConnectionArray_* pArray,
+                                 va_list*                pVarArgs,
+                                 GblVariant*             pVariantArgs)
+{
+    const Signal_*   pSignal     = pArray->pConnections[0]->pSignal;
+    const size_t     argCount    = pSignal->argCount + 1;
+    const GblBool    direct      = pVarArgs && pSignal->pFnDirect;
+    GblVariant*      pArgValues  = NULL;
+    QueuedEmission_* pEmission   = NULL;
+    size_t           constructed = 0;
+    SignalArg_       directArg;
+
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+
+    // read the raw argument once, so it can be forwarded to any number of C callbacks as-is
+    if(direct)
+        SignalArg_fromVaList_(&directArg, pSignal->directFmt, pVarArgs);
+
+    for(size_t  c = 0; c < pArray->count; ++c) {
+        Connection_* pConnection = pArray->pConnections[c];
+
+        // skip connections which have been disconnected since the snapshot was taken
+        if(atomic_load_explicit(&pConnection->disconnected, memory_order_acquire))
+            continue;
+
+        GblFnPtr pFnCallback = direct? Connection_directCallback_(pConnection) : NULL;
+
+        if(pFnCallback) {
+            // call straight into the C callback, without ever boxing its arguments
+            Connection_* pOldConnection = pActiveConnection_;
+            pActiveConnection_ = pConnection;
+
+            GblClosure* pOldClosure = GblClosure_setCurrent_(pConnection->pClosure);
+            pSignal->pFnDirect(pFnCallback, pConnection->pReceiver, &directArg);
+            GblClosure_setCurrent_(pOldClosure);
+
+            pActiveConnection_ = pOldConnection;
+            continue;
+        }
+
+        // initialize argument values upon the first connection which needs them
+        if(!pArgValues) {
+            GBL_CTX_VERIFY(pVarArgs || pVariantArgs,
+                           GBL_RESULT_ERROR_INVALID_OPERATION);
+
+            // queued deliveries share them, so they have to outlive the emission
+            if(pArray->queuedCount) {
+                pEmission = GBL_CTX_MALLOC(sizeof(QueuedEmission_) + sizeof(GblVariant) * argCount);
+                atomic_init(&pEmission->refCount, 1);
+                pEmission->argCount = 0;
+                pArgValues = pEmission->args;
+            } else pArgValues = GBL_ALLOCA(sizeof(GblVariant) * argCount);
+
+            GBL_CTX_VERIFY_CALL(GblVariant_constructPointer(&pArgValues[0], GBL_POINTER_TYPE, pConnection->pReceiver));
+            for(constructed = 1; constructed < argCount; ++constructed) {
+                if(direct)
+                    GBL_CTX_VERIFY_CALL(SignalArg_toVariant_(&directArg,
+                                                             pSignal->directFmt,
+                                                             pSignal->argTypes[constructed-1],
+                                                             &pArgValues[constructed]));
+                else if(pVarArgs)
+                    GBL_CTX_VERIFY_CALL(GblVariant_constructValueCopyVaList(&pArgValues[constructed],
+                                                                            pSignal->argTypes[constructed-1],
+                                                                            pVarArgs));
+                else
+                    GBL_CTX_VERIFY_CALL(GblVariant_constructCopy(&pArgValues[constructed],
+                                                                 &pVariantArgs[constructed-1]));
+
+                if(pEmission) pEmission->argCount = constructed + 1;
+            }
+
+        // update arg[0]: receiver (already set for the first connection, though)
+        } else if(!pConnection->pLoop)
+            GBL_CTX_VERIFY_CALL(GblVariant_setPointer(&pArgValues[0], GBL_POINTER_TYPE, pConnection->pReceiver));
+
+        if(pConnection->pLoop) {
+            GBL_CTX_VERIFY_CALL(Connection_enqueue_(pConnection, pEmission));
+        } else {
+            // save current active connection state
+            Connection_* pOldConnection = pActiveConnection_;
+            pActiveConnection_ = pConnection;
+
+            const GBL_RESULT result = GblClosure_invoke(pConnection->pClosure,
+                                                        NULL,
+                                                        argCount,
+                                                        pArgValues);
+            // restore active connection state
+            pActiveConnection_ = pOldConnection;
+
+            GBL_CTX_VERIFY_CALL(result);
+        }
+    }
+
+    GBL_CTX_END_BLOCK();
+
+    // destruct arguments, leaving any which are shared with queued deliveries to the last of them
+    if(pArgValues) {
+        if(constructed) GblVariant_destruct(&pArgValues[0]);
+
+        if(pEmission) QueuedEmission_release_(pEmission);
+        else for(size_t  a = 1; a < constructed; ++a)
+            GblVariant_destruct(&pArgValues[a]);
+    }
+
+    return GBL_CTX_RESULT();
+}
+
+static GBL_RESULT GblSignal_emit_(GblInstance*   pEmitter,
+                                  const char*    pSignalName,
+                                  const Signal_* pSignal,
+                                  va_list*       pVarArgs,
+                                  GblVariant*    pVariantArgs)
 {
 
     GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
     GBL_CTX_VERIFY_POINTER(pEmitter);
-    GBL_CTX_VERIFY_POINTER(pSignalName);
+    if(!pSignal) GBL_CTX_VERIFY_POINTER(pSignalName);
 
     // if the instance has signal handlers for the specified signal (that aren't blocked)
     InstanceConnectionTable_* pEmitterTable = InstanceConnectionTable_find_(pEmitter);
-    if(pEmitterTable && !pEmitterTable->signalsBlocked) {
-        EmitterHandler_* pHandler = EmitterHandler_find_(pEmitter, pSignalName, GBL_QUARK_INVALID, pEmitterTable);
-        if(pHandler && !pHandler->blocked) {
-            GblDoublyLinkedListNode* pNode = GblDoublyLinkedList_front(&pHandler->connectionList);
+    if(pEmitterTable && !atomic_load_explicit(&pEmitterTable->signalsBlocked, memory_order_relaxed)) {
+        const GblQuark   name     = pSignal? pSignal->name : GblQuark_tryString(pSignalName);
+        EmitterHandler_* pHandler = name != GBL_QUARK_INVALID?
+                                        EmitterHandler_find_(pEmitterTable, name) : NULL;
 
+        if(pHandler && !atomic_load_explicit(&pHandler->blocked, memory_order_relaxed)) {
             // Don't bother setting up stack frame if there's no connections
-            if(pNode) {
-                Connection_*    pConnection = GBL_DOUBLY_LINKED_LIST_ENTRY(pNode, Connection_, emitterList);
-                const size_t    argCount    = pConnection->pSignal->argCount + 1;
-                GblVariant*     pArgValues  = GBL_ALLOCA(sizeof(GblVariant) * argCount);
-
-                // initialize argument values
-                GBL_CTX_VERIFY_CALL(GblVariant_constructPointer(&pArgValues[0], GBL_POINTER_TYPE, pConnection->pReceiver));
-                if(pVarArgs) {
-                    for(size_t  a = 1; a < argCount; ++a) {
-                        GBL_CTX_VERIFY_CALL(GblVariant_constructValueCopyVaList(&pArgValues[a],
-                                                                                pConnection->pSignal->argTypes[a-1],
-                                                                                pVarArgs));
-                    }
-                } else if(pVariantArgs) {
-                    for(size_t  a = 1; a < argCount; ++a) {
-                        GBL_CTX_VERIFY_CALL(GblVariant_constructCopy(&pArgValues[a],
-                                                                     &pVariantArgs[a-1]));
-                    }
-                } else GBL_CTX_RECORD_SET(GBL_RESULT_ERROR_INVALID_OPERATION);
-
-                // call closures
-                GblBool firstConnection = GBL_TRUE;
-                do {
-                    pConnection = GBL_DOUBLY_LINKED_LIST_ENTRY(pNode, Connection_, emitterList);
-
-                    // update arg[0]: receiver (already set for first connection, though)
-                    if(!firstConnection)
-                        GBL_CTX_VERIFY_CALL(GblVariant_setPointer(&pArgValues[0], GBL_POINTER_TYPE, pConnection->pReceiver));
-                    else
-                        firstConnection = GBL_FALSE;
-
-                    // save current active connection state
-                    Connection_* pOldConnection = pActiveConnection_;
-                    pActiveConnection_ = pConnection;
-
-                    // invoke closure
-                    GBL_CTX_VERIFY_CALL(GblClosure_invoke(pConnection->pClosure,
-                                                          NULL,
-                                                          argCount,
-                                                          pArgValues));
-                    // restore active connection state
-                    pActiveConnection_ = pOldConnection;
-
-                } while((pNode = pNode->pNext) != &pHandler->connectionList);
-
-                // destruct arguments
-                for(size_t  a = 0; a < argCount; ++a) {
-                    GBL_CTX_VERIFY_CALL(GblVariant_destruct(&pArgValues[a]));
-                }
+            ConnectionArray_* pArray = EmitterHandler_acquire_(pHandler);
+
+            if(pArray) {
+                const GBL_RESULT result = Signal_invoke_(pArray, pVarArgs, pVariantArgs);
+                ConnectionArray_release_(pArray);
+                GBL_CTX_VERIFY_CALL(result);
             }
         }
     }
@@ -738,7 +1346,7 @@ GBL_EXPORT GBL_RESULT GblSignal_emitVariants(GblInstance* pEmitter,
                                              const char*  pSignalName,
                                              GblVariant*  pVariantArgs)
 {
-    return GblSignal_emit_(pEmitter, pSignalName, NULL, pVariantArgs);
+    return GblSignal_emit_(pEmitter, pSignalName, NULL, NULL, pVariantArgs);
 
 }
 
@@ -746,7 +1354,7 @@ GBL_EXPORT GBL_RESULT GblSignal_emitVaList(GblInstance* pEmitter,
                                            const char*  pSignalName,
                                            va_list*     pVarArgs)
 {
-    return GblSignal_emit_(pEmitter, pSignalName, pVarArgs, NULL);
+    return GblSignal_emit_(pEmitter, pSignalName, NULL, pVarArgs, NULL);
 }
 
 GBL_EXPORT GBL_RESULT GblSignal_emit(GblInstance* pEmitter,
@@ -760,6 +1368,44 @@ GBL_EXPORT GBL_RESULT GblSignal_emit(GblInstance* pEmitter,
     return result;
 }
 
+static GBL_RESULT GblSignal_invalidId_(void) {
+    GBL_CTX_BEGIN(GblHashSet_context(&instanceConnectionTableSet_));
+    GBL_CTX_RECORD_SET(GBL_RESULT_ERROR_INVALID_HANDLE,
+                       "[GblSignal] Cannot emit an invalid signal ID!");
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblSignal_emitVariantsById(GblInstance* pEmitter,
+                                                 GblSignalId  signalId,
+                                                 GblVariant*  pVariantArgs)
+{
+    if(signalId == GBL_SIGNAL_ID_INVALID) GBL_UNLIKELY
+        return GblSignal_invalidId_();
+
+    return GblSignal_emit_(pEmitter, NULL, (const Signal_*)signalId, NULL, pVariantArgs);
+}
+
+GBL_EXPORT GBL_RESULT GblSignal_emitByIdVaList(GblInstance* pEmitter,
+                                               GblSignalId  signalId,
+                                               va_list*     pVarArgs)
+{
+    if(signalId == GBL_SIGNAL_ID_INVALID) GBL_UNLIKELY
+        return GblSignal_invalidId_();
+
+    return GblSignal_emit_(pEmitter, NULL, (const Signal_*)signalId, pVarArgs, NULL);
+}
+
+GBL_EXPORT GBL_RESULT GblSignal_emitById(GblInstance* pEmitter,
+                                         GblSignalId  signalId,
+                                         ...)
+{
+    va_list varArgs;
+    va_start(varArgs, signalId);
+    GBL_RESULT result = GblSignal_emitByIdVaList(pEmitter, signalId, &varArgs);
+    va_end(varArgs);
+    return result;
+}
+
 GBL_EXPORT GblInstance* GblSignal_emitter(void) {
     return pActiveConnection_? pActiveConnection_->pEmitter : NULL;
 }
@@ -770,6 +1416,9 @@ GBL_EXPORT GblInstance* GblSignal_receiver(void) {
 
 GBL_EXPORT GBL_RESULT GblSignal_init_(GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
+    mtx_init(&signalMtx_, mtx_recursive);
+    mtx_init(&taskPoolMtx_, mtx_plain);
+
     GBL_CTX_VERIFY_CALL(GblHashSet_construct(&signalSet_,
                                              sizeof(Signal_*),
                                              signalSetHasher_,
@@ -787,9 +1436,9 @@ GBL_EXPORT GBL_RESULT GblSignal_init_(GblContext* pCtx) {
                                              pCtx));
 
 #ifdef GBL_CONNECTION_POOL_ALLOCATOR_
-        GBL_CTX_VERIFY_CALL(GblPoolAllocator_construct(&connectionAllocator_,
-                                                       sizeof(Connection_),
-                                                       GBL_CONNECTION_POOL_ALLOCATOR_PAGE_SIZE_));
+        GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_construct(&connectionAllocator_,
+                                                                 sizeof(Connection_),
+                                                                 GBL_CONNECTION_POOL_ALLOCATOR_PAGE_SIZE_));
 #endif
 
     GBL_CTX_END();
@@ -797,10 +1446,24 @@ GBL_EXPORT GBL_RESULT GblSignal_init_(GblContext* pCtx) {
 
 GBL_EXPORT GBL_RESULT GblSignal_final_(GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
+
+    // pooled tasks are done, and no longer hold any references
+    for(SignalTask_* pTask = pTaskPoolHead_; pTask; ) {
+        SignalTask_* pNext = pTask->pNextFree;
+        GBL_UNREF(pTask);
+        pTask = pNext;
+    }
+
+    pTaskPoolHead_  = NULL;
+    pTaskPoolTail_  = NULL;
+    signalTaskType_ = GBL_INVALID_TYPE;
+
     GBL_CTX_CALL(GblHashSet_destruct(&signalSet_));
     GBL_CTX_CALL(GblHashSet_destruct(&instanceConnectionTableSet_));
 #ifdef GBL_CONNECTION_POOL_ALLOCATOR_
-    GBL_CTX_CALL(GblPoolAllocator_destruct(&connectionAllocator_));
+    GBL_CTX_CALL(GblConcurrentPoolAllocator_destruct(&connectionAllocator_));
 #endif
+    mtx_destroy(&taskPoolMtx_);
+    mtx_destroy(&signalMtx_);
     GBL_CTX_END();
 }
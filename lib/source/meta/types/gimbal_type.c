@@ -7,6 +7,35 @@
 #include <gimbal/meta/ifaces/gimbal_ivariant.h>
 #include <gimbal/meta/ifaces/gimbal_iplugin.h>
 #include <gimbal/containers/gimbal_array_map.h>
+#include <stdatomic.h>
+
+#define GBL_TYPE_LOOKUP_TOMBSTONE_              ((GblQuark)1)
+#define GBL_TYPE_LOOKUP_CAPACITY_DEFAULT_       128
+
+/* Lock-free read-side index of the type registry.
+
+   Open-addressed table of name -> metaclass entries which is only
+   ever modified while holding typeRegMtx_. Readers never lock: slots
+   are published by storing the metaclass before its name, and removed
+   slots are tombstoned rather than reused, so a matching name can only
+   ever be paired with its own metaclass or NULL. When the table fills
+   up, a new generation is built and published with a single pointer
+   store; previous generations may still be in use by readers, so they
+   are only reclaimed when the type system is finalized. */
+typedef struct GblTypeLookupEntry_ {
+    _Atomic(GblQuark)        name;
+    _Atomic(GblMetaClass*)   pMeta;
+} GblTypeLookupEntry_;
+
+typedef struct GblTypeLookup_ {
+    struct GblTypeLookup_*   pRetired;
+    size_t                   mask;
+    size_t                   used;
+    GblTypeLookupEntry_      entries[];
+} GblTypeLookup_;
+
+static _Atomic(GblTypeLookup_*) pTypeLookup_     = NULL;
+static atomic_size_t            typeLookupCount_ = 0;
 
 GblContext*              pCtx_           = NULL;
 once_flag                initOnce_       = ONCE_FLAG_INIT;
@@ -40,10 +69,241 @@ static void metaClassElementFree_(const GblHashSet* pMap, void* item) {
     GBL_UNUSED(pMap);
     GBL_CTX_BEGIN(pCtx_);
     GblMetaClass** ppMetaClass = (GblMetaClass**)item;
+    if((*ppMetaClass)->pIFaces)
+        GBL_CTX_FREE((*ppMetaClass)->pIFaces);
+    if((*ppMetaClass)->pInstanceInits)
+        GBL_CTX_FREE((*ppMetaClass)->pInstanceInits);
+    GblProperty_tableFree_(*ppMetaClass);
+    GblInstance_poolFree_(*ppMetaClass);
     GBL_CTX_FREE(*ppMetaClass);
     GBL_CTX_END_BLOCK();
 }
 
+static size_t GblType_lookupHash_(GblQuark name) {
+    const uint64_t hash = (uint64_t)name * 0x9e3779b97f4a7c15ull;
+    return (size_t)(hash ^ (hash >> 32));
+}
+
+static GblMetaClass* GblType_lookup_(GblQuark name) {
+    const GblTypeLookup_* pTable = atomic_load_explicit(&pTypeLookup_, memory_order_acquire);
+
+    if(pTable) {
+        for(size_t i = GblType_lookupHash_(name) & pTable->mask; ; i = (i + 1) & pTable->mask) {
+            const GblQuark key = atomic_load_explicit(&pTable->entries[i].name, memory_order_acquire);
+
+            if(key == name)
+                return atomic_load_explicit(&pTable->entries[i].pMeta, memory_order_acquire);
+            else if(key == GBL_QUARK_INVALID)
+                break;
+        }
+    }
+
+    return NULL;
+}
+
+// Caller must hold typeRegMtx_
+static void GblType_lookupPlace_(GblTypeLookup_* pTable, GblMetaClass* pMeta) {
+    size_t i = GblType_lookupHash_(pMeta->name) & pTable->mask;
+
+    while(atomic_load_explicit(&pTable->entries[i].name, memory_order_relaxed) != GBL_QUARK_INVALID)
+        i = (i + 1) & pTable->mask;
+
+    atomic_store_explicit(&pTable->entries[i].pMeta, pMeta,       memory_order_relaxed);
+    atomic_store_explicit(&pTable->entries[i].name,  pMeta->name, memory_order_release);
+
+    ++pTable->used;
+}
+
+// Caller must hold typeRegMtx_
+static GBL_RESULT GblType_lookupInsert_(GblMetaClass* pMeta) {
+    GBL_CTX_BEGIN(pCtx_);
+
+    GblTypeLookup_* pTable = atomic_load_explicit(&pTypeLookup_, memory_order_relaxed);
+    const size_t    count  = atomic_load_explicit(&typeLookupCount_, memory_order_relaxed) + 1;
+
+    // Keep the load factor (including tombstones) at or below 1/2
+    if(!pTable || (pTable->used + 1) * 2 > pTable->mask + 1) {
+        size_t capacity = GBL_TYPE_LOOKUP_CAPACITY_DEFAULT_;
+
+        while(capacity < count * 4)
+            capacity <<= 1;
+
+        const size_t    bytes  = sizeof(GblTypeLookup_) + sizeof(GblTypeLookupEntry_) * capacity;
+        GblTypeLookup_* pGrown = GBL_CTX_MALLOC(gblAlignedAllocSizeDefault(bytes));
+
+        memset(pGrown, 0, bytes);
+        pGrown->mask     = capacity - 1;
+        pGrown->pRetired = pTable;
+
+        for(size_t e = 0; pTable && e <= pTable->mask; ++e) {
+            GblMetaClass* pEntry = atomic_load_explicit(&pTable->entries[e].pMeta,
+                                                        memory_order_relaxed);
+            if(pEntry)
+                GblType_lookupPlace_(pGrown, pEntry);
+        }
+
+        atomic_store_explicit(&pTypeLookup_, pGrown, memory_order_release);
+        pTable = pGrown;
+    }
+
+    GblType_lookupPlace_(pTable, pMeta);
+    atomic_store_explicit(&typeLookupCount_, count, memory_order_relaxed);
+
+    GBL_CTX_END();
+}
+
+// Caller must hold typeRegMtx_
+static void GblType_lookupRemove_(GblMetaClass* pMeta) {
+    GblTypeLookup_* pTable = atomic_load_explicit(&pTypeLookup_, memory_order_relaxed);
+
+    if(!pTable) return;
+
+    for(size_t i = GblType_lookupHash_(pMeta->name) & pTable->mask; ; i = (i + 1) & pTable->mask) {
+        const GblQuark key = atomic_load_explicit(&pTable->entries[i].name, memory_order_relaxed);
+
+        if(key == pMeta->name) {
+            atomic_store_explicit(&pTable->entries[i].pMeta, NULL,                       memory_order_release);
+            atomic_store_explicit(&pTable->entries[i].name,  GBL_TYPE_LOOKUP_TOMBSTONE_, memory_order_release);
+            atomic_fetch_sub_explicit(&typeLookupCount_, 1, memory_order_relaxed);
+            break;
+        } else if(key == GBL_QUARK_INVALID) {
+            break;
+        }
+    }
+}
+
+static void GblType_lookupFinal_(void) {
+    GBL_CTX_BEGIN(pCtx_);
+
+    GblTypeLookup_* pTable = atomic_exchange(&pTypeLookup_, NULL);
+
+    while(pTable) {
+        GblTypeLookup_* pRetired = pTable->pRetired;
+        GBL_CTX_FREE(pTable);
+        pTable = pRetired;
+    }
+
+    atomic_store(&typeLookupCount_, 0);
+
+    GBL_CTX_END_BLOCK();
+}
+
+static int GblType_ifaceComparator_(const void* pA, const void* pB) {
+    const GblMetaIFace_* pLhs = pA, *pRhs = pB;
+
+    if(pLhs->pIFace != pRhs->pIFace)
+        return (uintptr_t)pLhs->pIFace < (uintptr_t)pRhs->pIFace? -1 : 1;
+
+    // deepest level first, so it's the one kept when deduplicating
+    return (int)pRhs->depth - (int)pLhs->depth;
+}
+
+/* Flattens every interface reachable from the given type, its
+ * bases, and recursively from those interfaces and their own
+ * bases, into a sorted set, so GblType_typeIsA_() can resolve
+ * interface conformance with a binary search rather than by
+ * walking the hierarchy. Each entry remembers the deepest class
+ * level mapping to it, to preserve GblType_maps() semantics for
+ * interfaces which are also a class's base.
+ */
+static GBL_RESULT GblType_ifacesBuild_(GblMetaClass* pMeta) {
+    GBL_CTX_BEGIN(pCtx_);
+
+    const GblMetaClass* pParent  = pMeta->pParent;
+    const GblTypeInfo*  pInfo    = pMeta->pInfo;
+    size_t              capacity = pParent? pParent->ifaceCount : 0;
+    size_t              count    = 0;
+
+    for(size_t i = 0; i < pInfo->interfaceCount; ++i) {
+        const GblMetaClass* pIFace = GBL_META_CLASS_(pInfo->pInterfaceImpls[i].interfaceType);
+        capacity += 1 + pIFace->depth + pIFace->ifaceCount;
+    }
+
+    if(!capacity) GBL_CTX_DONE();
+
+    GblMetaIFace_* pIFaces = GBL_CTX_MALLOC(sizeof(GblMetaIFace_) * capacity);
+
+    if(pParent) {
+        memcpy(pIFaces, pParent->pIFaces, sizeof(GblMetaIFace_) * pParent->ifaceCount);
+        count = pParent->ifaceCount;
+    }
+
+    for(size_t i = 0; i < pInfo->interfaceCount; ++i) {
+        GblMetaClass* pIFace = GBL_META_CLASS_(pInfo->pInterfaceImpls[i].interfaceType);
+
+        pIFaces[count++] = (GblMetaIFace_){ pIFace, pMeta->depth };
+
+        for(size_t b = 0; b < pIFace->depth; ++b)
+            pIFaces[count++] = (GblMetaIFace_){ pIFace->pBases[b], pMeta->depth };
+
+        for(size_t e = 0; e < pIFace->ifaceCount; ++e)
+            pIFaces[count++] = (GblMetaIFace_){ pIFace->pIFaces[e].pIFace, pMeta->depth };
+    }
+
+    gblSortQuick(pIFaces, count, sizeof(GblMetaIFace_), GblType_ifaceComparator_);
+
+    size_t unique = 0;
+    for(size_t i = 0; i < count; ++i) {
+        if(!unique || pIFaces[unique-1].pIFace != pIFaces[i].pIFace)
+            pIFaces[unique++] = pIFaces[i];
+    }
+
+    GBL_CTX_VERIFY(unique <= UINT16_MAX,
+                   GBL_RESULT_ERROR_OVERFLOW,
+                   "Too many interfaces mapped by type: %s",
+                   GblQuark_toString(pMeta->name));
+
+    pMeta->pIFaces    = pIFaces;
+    pMeta->ifaceCount = (uint16_t)unique;
+
+    GBL_CTX_END();
+}
+
+/* Flattens the instance initializers of a type and all of its
+ * bases into a single array, skipping the levels which have none,
+ * so GblInstance construction can call straight through them
+ * rather than walking the hierarchy for every new instance.
+ */
+static GBL_RESULT GblType_instanceInitsBuild_(GblMetaClass* pMeta) {
+    GBL_CTX_BEGIN(pCtx_);
+
+    const GblMetaClass* pParent = pMeta->pParent;
+    const size_t        count   = (pParent? pParent->instanceInitCount : 0) +
+                                  (pMeta->pInfo->pFnInstanceInit? 1 : 0);
+
+    if(!count) GBL_CTX_DONE();
+
+    GblInstanceInitFn* pInits = GBL_CTX_MALLOC(sizeof(GblInstanceInitFn) * count);
+
+    if(pParent && pParent->instanceInitCount)
+        memcpy(pInits, pParent->pInstanceInits, sizeof(GblInstanceInitFn) * pParent->instanceInitCount);
+
+    if(pMeta->pInfo->pFnInstanceInit)
+        pInits[count-1] = pMeta->pInfo->pFnInstanceInit;
+
+    pMeta->pInstanceInits    = pInits;
+    pMeta->instanceInitCount = (uint8_t)count;
+
+    GBL_CTX_END();
+}
+
+static const GblMetaIFace_* GblType_ifacesFind_(const GblMetaClass* pMeta, const GblMetaClass* pIFace) {
+    size_t l = 0, r = pMeta->ifaceCount;
+
+    while(l < r) {
+        const size_t m = l + ((r - l) >> 1);
+
+        if(pMeta->pIFaces[m].pIFace == pIFace)
+            return &pMeta->pIFaces[m];
+        else if((uintptr_t)pMeta->pIFaces[m].pIFace < (uintptr_t)pIFace)
+            l = m + 1;
+        else
+            r = m;
+    }
+
+    return NULL;
+}
+
 GblInterface* GblType_extension_(GblType type, GblType ifaceType) {
     GblMetaClass* pMeta = GBL_META_CLASS_(type);
     GblInterface* pExt = NULL;
@@ -121,6 +381,7 @@ static GBL_RESULT typeLog_(GblType parent,
     GBL_CTX_VERBOSE("%-20s: %-100u", "BUILTIN",         (flags & GBL_TYPE_FLAG_BUILTIN)? 1 : 0);
     GBL_CTX_VERBOSE("%-20s: %-100u", "ABSTRACT",        (flags & GBL_TYPE_FLAG_ABSTRACT)? 1 : 0);
     GBL_CTX_VERBOSE("%-20s: %-100u", "FINAL",           (flags & GBL_TYPE_FLAG_FINAL)? 1 : 0);
+    GBL_CTX_VERBOSE("%-20s: %-100u", "INSTANCE_POOLED", (flags & GBL_TYPE_FLAG_INSTANCE_POOLED)? 1 : 0);
     GBL_CTX_POP(1);
 
     GBL_CTX_PUSH_VERBOSE("Class Info");
@@ -482,6 +743,9 @@ static GblType typeRegister_(GblType parent,
             GBL_CTX_VERIFY_EXPRESSION(GblType_updateTypeInfoClassChunk_(pMeta, pInfo));
         }
 
+        GBL_CTX_VERIFY_CALL(GblType_ifacesBuild_(pMeta));
+        GBL_CTX_VERIFY_CALL(GblType_instanceInitsBuild_(pMeta));
+
         mtx_lock(&typeRegMtx_);
         hasMutex = GBL_TRUE;
 
@@ -491,6 +755,8 @@ static GblType typeRegister_(GblType parent,
         GBL_CTX_VERIFY(!pOldData, GBL_RESULT_ERROR_INVALID_ARG,
                        "A previous metatype entry named %s existed already!", pName);
 
+        GBL_CTX_VERIFY_CALL(GblType_lookupInsert_(pMeta));
+
         newType = (GblType)pMeta;
         if(flags & GBL_TYPE_FLAG_BUILTIN) {
              GBL_CTX_CALL(GblArrayList_pushBack(&typeBuiltins_.vector, &newType));
@@ -709,6 +975,8 @@ static void GblType_final_(void) {
     GBL_CTX_CALL(GblArrayList_clear(&typeBuiltins_.vector));
     GBL_CTX_CALL(GblArrayList_destruct(&typeBuiltins_.vector));
     GBL_CTX_CALL(GblHashSet_destruct(&typeRegistry_));
+    GblType_lookupFinal_();
+    GblClass_castCacheClear_();
 
     GBL_CTX_POP(1);
     initialized_ = GBL_FALSE;
@@ -791,7 +1059,7 @@ GblType GblType_registerBuiltin_(size_t             expectedIndex,
 GBL_EXPORT GblType GblType_fromBuiltinIndex(size_t  index) {
     GblType type = GBL_INVALID_TYPE;
     GBL_TYPE_ENSURE_INITIALIZED_();
-    {
+    if(index < GblArrayList_size(&typeBuiltins_.vector)) {
         GblType* pType = GblArrayList_at(&typeBuiltins_.vector, index);
         if(pType) type = *pType;
     }
@@ -799,23 +1067,12 @@ GBL_EXPORT GblType GblType_fromBuiltinIndex(size_t  index) {
 }
 
 GBL_EXPORT GblType GblType_findQuark(GblQuark name) {
-    GblType foundType = GBL_INVALID_TYPE;
-    GBL_CTX_BEGIN(pCtx_);
-    if(name == GBL_QUARK_INVALID) GBL_CTX_DONE();
-    GBL_TYPE_ENSURE_INITIALIZED_();
-
-    GblMetaClass* pTempClass = GBL_ALLOCA(sizeof(GblMetaClass));
-    pTempClass->name = name;
+    if(name == GBL_QUARK_INVALID) GBL_UNLIKELY
+        return GBL_INVALID_TYPE;
 
-    mtx_lock(&typeRegMtx_);
-    GblMetaClass** ppReturnValue = (GblMetaClass**)GblHashSet_get(&typeRegistry_, &pTempClass);
-    if(ppReturnValue) {
-        foundType = (GblType)*ppReturnValue;
-    }
-    mtx_unlock(&typeRegMtx_);
+    GBL_TYPE_ENSURE_INITIALIZED_();
 
-    GBL_CTX_END_BLOCK();
-    return foundType;
+    return GBL_TYPE_(GblType_lookup_(name));
 }
 
 GBL_EXPORT GblType GblType_find(const char* pTypeName) {
@@ -823,14 +1080,8 @@ GBL_EXPORT GblType GblType_find(const char* pTypeName) {
 }
 
 GBL_EXPORT size_t  GblType_count(void) {
-    size_t  count = 0;
-    GBL_CTX_BEGIN(pCtx_);
     GBL_TYPE_ENSURE_INITIALIZED_();
-    mtx_lock(&typeRegMtx_);
-    count = GblHashSet_size(&typeRegistry_);
-    mtx_unlock(&typeRegMtx_);
-    GBL_CTX_END_BLOCK();
-    return count;
+    return atomic_load_explicit(&typeLookupCount_, memory_order_relaxed);
 }
 
 GBL_EXPORT size_t  GblType_builtinCount(void) {
@@ -845,24 +1096,21 @@ GBL_EXPORT size_t  GblType_builtinCount(void) {
 }
 
 GBL_EXPORT GblType GblType_next(GblType prevType) {
-    GblType next = GBL_INVALID_TYPE;
-    GBL_CTX_BEGIN(pCtx_);
-
-    GblBool useNext = (prevType == GBL_INVALID_TYPE);
-    for(size_t  p = 0; p < GblHashSet_bucketCount(&typeRegistry_); ++p) {
-        GblMetaClass** ppMeta = GblHashSet_probe(&typeRegistry_, p);
-        if(ppMeta) {
-            GblType type = GBL_TYPE_(*ppMeta);
-            if(useNext) {
-                next = type;
-                break;
-            } else if(type == prevType) {
+    const GblTypeLookup_* pTable = atomic_load_explicit(&pTypeLookup_, memory_order_acquire);
+    GblBool               useNext = (prevType == GBL_INVALID_TYPE);
+
+    for(size_t e = 0; pTable && e <= pTable->mask; ++e) {
+        GblMetaClass* pMeta = atomic_load_explicit(&pTable->entries[e].pMeta,
+                                                   memory_order_acquire);
+        if(pMeta) {
+            if(useNext)
+                return GBL_TYPE_(pMeta);
+            else if(GBL_TYPE_(pMeta) == prevType)
                 useNext = GBL_TRUE;
-            }
         }
     }
-    GBL_CTX_END_BLOCK();
-    return next;
+
+    return GBL_INVALID_TYPE;
 }
 
 GBL_EXPORT GblQuark GblType_nameQuark(GblType type) {
@@ -960,45 +1208,38 @@ GBL_EXPORT const GblTypeInfo* GblType_info(GblType type) {
     return NULL;
 }
 
-// If this ever needs to be optimized, make it non-recursive
+/* Constant-time for class derivation, since the base can only
+ * be at pBases[depth] within the derived type's ancestor table,
+ * and a binary search of the derived type's flattened interface
+ * set otherwise.
+ */
 static GblBool GblType_typeIsA_(GblType derived, GblType base, GblBool classChecks, GblBool ifaceChecks, GblBool castChecks) {
-    GblBool         result   = GBL_FALSE;
-    GblMetaClass*   pDerived = GBL_META_CLASS_(derived);
-    GblMetaClass*   pBase    = GBL_META_CLASS_(base);
-    GblMetaClass*   pIter    = pDerived;
-
-    if(derived == GBL_INVALID_TYPE && base == GBL_INVALID_TYPE) {
-        result = GBL_TRUE;
-    } else if(derived != GBL_INVALID_TYPE && base != GBL_INVALID_TYPE) {
-        GBL_ASSERT(GblType_verify(derived));
-        GBL_ASSERT(GblType_verify(base));
-
-        // Are we even checking for an interface type!?
-        if(!GBL_TYPE_INTERFACED_CHECK(base) || (pBase->flags & GBL_TYPE_FLAG_UNMAPPABLE))
-            ifaceChecks = GBL_FALSE;
-
-        while(pIter) {
-            if(pIter == pBase) {    // check if current class level is base
-                result = classChecks? GBL_TRUE : GBL_FALSE;
-                break;
-            } else if(ifaceChecks) {
-                // recurse over interfaces checking
-                for(size_t i = 0; i < pIter->pInfo->interfaceCount; ++i) {
-                    if(GblType_typeIsA_(pIter->pInfo->pInterfaceImpls[i].interfaceType,
-                                        base,
-                                        GBL_TRUE,
-                                        ifaceChecks,
-                                        castChecks)) {
-                        result = GBL_TRUE;
-                        goto done;
-                    }
-                }
-            }
-            pIter = pIter->pParent;
-        }
-    }
-    done:
-    return result;
+    GBL_UNUSED(castChecks);
+
+    if(derived == base)
+        return derived == GBL_INVALID_TYPE? GBL_TRUE : classChecks;
+    else if(derived == GBL_INVALID_TYPE || base == GBL_INVALID_TYPE)
+        return GBL_FALSE;
+
+    GBL_ASSERT(GblType_verify(derived));
+    GBL_ASSERT(GblType_verify(base));
+
+    const GblMetaClass* pDerived = GBL_META_CLASS_(derived);
+    const GblMetaClass* pBase    = GBL_META_CLASS_(base);
+    const GblBool       derives  = pBase->depth < pDerived->depth &&
+                                   pDerived->pBases[pBase->depth] == pBase;
+
+    if(derives && classChecks)
+        return GBL_TRUE;
+
+    // Are we even checking for an interface type!?
+    if(!ifaceChecks || !(pBase->flags & GBL_TYPE_ROOT_FLAG_INTERFACED) || (pBase->flags & GBL_TYPE_FLAG_UNMAPPABLE))
+        return GBL_FALSE;
+
+    const GblMetaIFace_* pEntry = GblType_ifacesFind_(pDerived, pBase);
+
+    // Only levels beneath the base itself may map to it when not checking classes
+    return pEntry && (!derives || pEntry->depth > pBase->depth);
 }
 
 GBL_EXPORT GblBool GblType_verify(GblType type) {
@@ -1138,6 +1379,9 @@ GBL_EXPORT GBL_RESULT GblType_unregister(GblType type) {
         GBL_CTX_VERIFY_CALL(GblType_freeTypeInfoClassChunk_(pMeta));
         mtx_lock(&typeRegMtx_);
 
+        GblType_lookupRemove_(pMeta);
+        GblClass_castCacheClear_();
+        GblVariant_converterCacheClear_();
         const GblBool success = GblHashSet_erase(&typeRegistry_, &pMeta);
         //GblHashSet_shrinkToFit(&typeRegistry_);
         mtx_unlock(&typeRegMtx_);
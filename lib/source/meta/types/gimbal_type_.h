@@ -9,6 +9,7 @@
 #include <gimbal/core/gimbal_atomics.h>
 
 #include <tinycthread.h>
+#include <stdatomic.h>
 
 #define GBL_CLASS_FLAGS_BIT_COUNT_                      5
 #define GBL_CLASS_FLAGS_BIT_MASK_                       0x1f
@@ -52,6 +53,17 @@ GBL_DECLARE_ENUM(GBL_CLASS_FLAGS_) {
 
 GBL_FORWARD_DECLARE_STRUCT(GblArrayMap);
 GBL_FORWARD_DECLARE_STRUCT(GblInterface);
+GBL_FORWARD_DECLARE_STRUCT(GblClosure);
+
+struct GblMetaClass;
+struct GblPropertyTable_;
+struct GblConcurrentPoolAllocator;
+
+// Entry within the flattened, sorted set of interfaces a type maps to
+typedef struct GblMetaIFace_ {
+    struct GblMetaClass*        pIFace;     // interface type or one of its bases
+    uint8_t                     depth;      // deepest class level which maps to pIFace
+} GblMetaIFace_;
 
 typedef struct GblMetaClass {
     union {
@@ -66,6 +78,14 @@ typedef struct GblMetaClass {
     GblArrayMap*                pExtensions;
     GblClass*                   pClass;
     uint8_t                     depth;
+    uint16_t                    ifaceCount;
+    uint8_t                     instanceInitCount;
+    GblMetaIFace_*              pIFaces;
+    GblInstanceInitFn*          pInstanceInits; // non-NULL initializers of the type and its bases, root first
+    _Atomic(struct GblPropertyTable_*)
+                                pProperties;    // lazily flattened, see gimbal_property.c
+    _Atomic(struct GblConcurrentPoolAllocator*)
+                                pInstancePool;  // lazily created for GBL_TYPE_FLAG_INSTANCE_POOLED
     ptrdiff_t                   classPrivateOffset;
     ptrdiff_t                   instancePrivateOffset;
     struct GblMetaClass*        pBases[];
@@ -94,11 +114,18 @@ extern GblType       GblType_registerBuiltin_          (size_t               exp
                                                         const GblTypeInfo*   pTypeInfo,
                                                         GblTypeFlags         flags);
 
+extern void          GblClass_castCacheClear_          (void);
+
 extern GBL_RESULT    GblThread_final_                  (void);
 extern GBL_RESULT    GblModule_final_                  (void);
 
 extern GBL_RESULT    GblProperty_init_                 (GblContext* pCtx);
 extern GBL_RESULT    GblProperty_final_                (GblContext* pCtx);
+extern void          GblProperty_tableFree_            (GblMetaClass* pMeta);
+
+extern void          GblInstance_poolFree_             (GblMetaClass* pMeta);
+
+extern GblClosure*   GblClosure_setCurrent_            (GblClosure* pClosure);
 
 extern GBL_RESULT    GblSignal_init_                   (GblContext* pCtx);
 extern GBL_RESULT    GblSignal_final_                  (GblContext* pCtx);
@@ -106,6 +133,7 @@ extern GBL_RESULT    GblSignal_removeInstance_         (GblInstance* pInstance);
 
 extern GBL_RESULT    GblVariant_init_                  (GblContext* pCtx);
 extern GBL_RESULT    GblVariant_final_                 (GblContext* pCtx);
+extern void          GblVariant_converterCacheClear_   (void);
 
 extern GBL_RESULT    GblIVariant_typeRegister_         (GblContext* pCtx);
 extern GBL_RESULT    GblPrimitive_valueTypesRegister_  (GblContext* pCtx);
@@ -7,6 +7,8 @@
 #include <gimbal/meta/instances/gimbal_object.h>
 #include <gimbal/containers/gimbal_tree_set.h>
 #include <gimbal/strings/gimbal_string_buffer.h>
+#include "gimbal_type_.h"
+#include <stdatomic.h>
 
 #define GBL_VARIANT_BEGIN_(type, classGetterSuffix)                                         \
     GBL_CTX_BEGIN(NULL); {                                                                  \
@@ -40,6 +42,22 @@ static GblTreeSet   converterRegistry_;
 static uint64_t     registryHint_       = 0;
 static GblBool      registryValid_      = GBL_FALSE;
 
+#define GBL_VARIANT_CONVERTER_CACHE_SIZE_   256
+
+/* Entry within the converter cache, mapping an exact (fromType, toType)
+ * pair to whatever converter the registry search resolved for it, or to
+ * NULL when there isn't one. Entries are guarded by a sequence counter,
+ * which is odd while being written, the same way the class cast cache is.
+ */
+typedef struct ConverterCacheEntry_ {
+    atomic_uint                     seq;
+    _Atomic(uintptr_t)              fromType;
+    _Atomic(uintptr_t)              toType;
+    _Atomic(GblVariantConverterFn)  pFnConverter;
+} ConverterCacheEntry_;
+
+static ConverterCacheEntry_ converterCache_[GBL_VARIANT_CONVERTER_CACHE_SIZE_];
+
 int GblVariant_converterComparator_(const GblTreeSet* pSet,
                                        const void*       pEntry1,
                                        const void*       pEntry2)
@@ -53,6 +71,124 @@ int GblVariant_converterComparator_(const GblTreeSet* pSet,
     else                                            return pConv1->toType - pConv2->toType;
 }
 
+static ConverterCacheEntry_* GblVariant_converterCacheEntry_(GblType fromType, GblType toType) {
+    const uint64_t hash = ((uint64_t)fromType ^ ((uint64_t)toType * 0x9e3779b97f4a7c15ull))
+                        * 0x9e3779b97f4a7c15ull;
+    return &converterCache_[(hash >> 32) & (GBL_VARIANT_CONVERTER_CACHE_SIZE_ - 1)];
+}
+
+static GblBool GblVariant_converterCacheFind_(GblType fromType, GblType toType, GblVariantConverterFn* ppFnConv) {
+    ConverterCacheEntry_* pEntry = GblVariant_converterCacheEntry_(fromType, toType);
+    const unsigned        seq    = atomic_load_explicit(&pEntry->seq, memory_order_acquire);
+
+    if(seq & 1)
+        return GBL_FALSE;
+
+    const uintptr_t             from  = atomic_load_explicit(&pEntry->fromType,     memory_order_relaxed);
+    const uintptr_t             to    = atomic_load_explicit(&pEntry->toType,       memory_order_relaxed);
+    const GblVariantConverterFn pFn   = atomic_load_explicit(&pEntry->pFnConverter, memory_order_relaxed);
+
+    atomic_thread_fence(memory_order_acquire);
+
+    if(atomic_load_explicit(&pEntry->seq, memory_order_relaxed) != seq ||
+       from != (uintptr_t)fromType || to != (uintptr_t)toType)
+        return GBL_FALSE;
+
+    *ppFnConv = pFn;
+    return GBL_TRUE;
+}
+
+static void GblVariant_converterCacheInsert_(GblType fromType, GblType toType, GblVariantConverterFn pFnConv) {
+    ConverterCacheEntry_* pEntry = GblVariant_converterCacheEntry_(fromType, toType);
+    unsigned              seq    = atomic_load_explicit(&pEntry->seq, memory_order_relaxed);
+
+    if((seq & 1) || !atomic_compare_exchange_strong_explicit(&pEntry->seq, &seq, seq + 1,
+                                                             memory_order_acquire,
+                                                             memory_order_relaxed))
+        return;
+
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&pEntry->fromType,     (uintptr_t)fromType, memory_order_relaxed);
+    atomic_store_explicit(&pEntry->toType,       (uintptr_t)toType,   memory_order_relaxed);
+    atomic_store_explicit(&pEntry->pFnConverter, pFnConv,             memory_order_relaxed);
+    atomic_store_explicit(&pEntry->seq,          seq + 2,             memory_order_release);
+}
+
+// Invalidates every cached converter, called whenever the registry or the type system changes
+void GblVariant_converterCacheClear_(void) {
+    for(size_t e = 0; e < GBL_VARIANT_CONVERTER_CACHE_SIZE_; ++e) {
+        ConverterCacheEntry_* pEntry = &converterCache_[e];
+        unsigned              seq;
+
+        do {
+            seq = atomic_load_explicit(&pEntry->seq, memory_order_relaxed) & ~1u;
+        } while(!atomic_compare_exchange_weak_explicit(&pEntry->seq, &seq, seq + 1,
+                                                       memory_order_acquire,
+                                                       memory_order_relaxed));
+
+        atomic_thread_fence(memory_order_release);
+        atomic_store_explicit(&pEntry->fromType,     0,       memory_order_relaxed);
+        atomic_store_explicit(&pEntry->toType,       0,       memory_order_relaxed);
+        atomic_store_explicit(&pEntry->pFnConverter, NULL,    memory_order_relaxed);
+        atomic_store_explicit(&pEntry->seq,          seq + 2, memory_order_release);
+    }
+}
+
+// Resolves compatible types, which need no converter, into a plain copy
+static GBL_RESULT GblVariant_copyConverter_(const GblVariant* pSelf, GblVariant* pOther) {
+    return GblVariant_setCopy(pOther, pSelf);
+}
+
+/* Returns the converter to use between two types, or NULL if there isn't
+ * one. Misses search the registry for a converter between the types or any
+ * of their bases, walking up toType, then up fromType for each of its bases,
+ * and cache whatever was found, so repeated conversions take one probe.
+ */
+static GblVariantConverterFn GblVariant_converter_(GblType fromType, GblType toType) {
+    GblVariantConverterFn pFnConv = NULL;
+
+    if(GblVariant_converterCacheFind_(fromType, toType, &pFnConv))
+        return pFnConv;
+
+    if(GblType_check(fromType, toType)) {
+        pFnConv = GblVariant_copyConverter_;
+    } else {
+        ConverterEntry_ entry         = { .toType = toType };
+        GblType         currentToType = toType;
+
+        while(!pFnConv && currentToType != GBL_INVALID_TYPE) {
+            GblType currentFromType = fromType;
+            entry.toType = currentToType;
+
+            while(!pFnConv && currentFromType != GBL_INVALID_TYPE) {
+                entry.fromType = currentFromType;
+
+                const ConverterEntry_* pEntry = GblTreeSet_get(&converterRegistry_,
+                                                               &entry);
+                if(pEntry) {
+                    pFnConv = pEntry->pFnConverter;
+                    break;
+                }
+
+                if(!GblType_check(currentFromType,
+                                  GblType_parent(currentFromType)))
+                    break;
+
+                currentFromType = GblType_parent(currentFromType);
+            }
+
+            if(!GblType_check(currentToType,
+                              GblType_parent(currentToType)))
+                break;
+
+            currentToType = GblType_parent(currentToType);
+        }
+    }
+
+    GblVariant_converterCacheInsert_(fromType, toType, pFnConv);
+    return pFnConv;
+}
+
 static GBL_RESULT GblVariant_initDefault_(GblVariant* pSelf, GblType type)  {
     GBL_CTX_BEGIN(NULL);
     GBL_CTX_VERIFY_POINTER(pSelf);
@@ -76,6 +212,7 @@ GBL_RESULT GblVariant_init_(GblContext* pCtx) {
                                              NULL,
                                              256,
                                              pCtx));
+    GblVariant_converterCacheClear_();
     registryValid_ = GBL_TRUE;
     GBL_CTX_END();
 }
@@ -87,6 +224,7 @@ GBL_RESULT GblVariant_final_(GblContext* pCtx) {
                    GBL_RESULT_PARTIAL,
                    "[GblVariant] Double finalize called?");
     GBL_CTX_VERIFY_CALL(GblTreeSet_destruct(&converterRegistry_));
+    GblVariant_converterCacheClear_();
     registryValid_ = GBL_FALSE;
     GBL_CTX_END();
 }
@@ -117,6 +255,7 @@ GBL_EXPORT GBL_RESULT GblVariant_registerConverter(GblType fromType, GblType toT
                                                         &entry,
                                                         &registryHint_);
         GBL_CTX_VERIFY_LAST_RECORD();
+        GblVariant_converterCacheClear_();
         if(pExisting) {
             GBL_CTX_WARN("[GblVariant] Overwrote exisitng converter: [%s => %s]",
                          GblType_name(pExisting->fromType), GblType_name(pExisting->toType));
@@ -137,49 +276,19 @@ GBL_EXPORT GBL_RESULT GblVariant_unregisterConverter(GblType fromType, GblType t
                        GBL_RESULT_NOT_FOUND,
                        "[GblVariant] Removing converter from [%s] to [%s]: NOT FOUND",
                        GblType_name(fromType), GblType_name(toType));
+        GblVariant_converterCacheClear_();
     } GBL_CTX_END();
 }
 
 GBL_EXPORT GblBool GblVariant_canConvert(GblType fromType, GblType toType) {
-    GblBool         result          = GBL_FALSE;
-    GblType         currentFromType = fromType;
-    GblType         currentToType   = toType;
-    ConverterEntry_ entry           = { .toType = toType };
+    GblBool result = GBL_FALSE;
 
     GBL_CTX_BEGIN(GblTreeSet_context(&converterRegistry_)); {
         GBL_CTX_VERIFY(fromType != GBL_INVALID_TYPE &&
                        toType   != GBL_INVALID_TYPE,
                        GBL_RESULT_ERROR_INVALID_TYPE);
 
-        if(GblType_check(fromType, toType)) {
-            result = GBL_TRUE;
-        } else {
-            while(!result && currentToType != GBL_INVALID_TYPE) {
-                entry.toType = currentToType;
-                currentFromType = fromType;
-
-                while(!result && currentFromType != GBL_INVALID_TYPE) {
-                    entry.fromType = currentFromType;
-
-                    result = GblTreeSet_contains(&converterRegistry_,
-                                                 &entry);
-
-                    if(result) GBL_CTX_DONE();
-
-                    if(!GblType_check(currentFromType,
-                                      GblType_parent(currentFromType)))
-                        break;
-
-                    currentFromType = GblType_parent(currentFromType);
-                }
-
-                if(!GblType_check(currentToType,
-                                  GblType_parent(currentToType)))
-                    break;
-
-                currentToType = GblType_parent(currentToType);
-            }
-        }
+        result = GblVariant_converter_(fromType, toType) != NULL;
     } GBL_CTX_END_BLOCK();
     return result;
 }
@@ -190,49 +299,14 @@ GBL_EXPORT GBL_RESULT GblVariant_convert(const GblVariant* pSelf, GblVariant* pO
                        GblVariant_typeOf(pOther) != GBL_INVALID_TYPE,
                        GBL_RESULT_ERROR_INVALID_TYPE);
 
-        // Check whether we actually have to convert shit.
-        if(GblType_check(GblVariant_typeOf(pSelf), GblVariant_typeOf(pOther))) {
-            GBL_CTX_VERIFY_CALL(GblVariant_setCopy(pOther, pSelf));
-
-        } else { // Okay, fine, we do.
-
-            const ConverterEntry_*  pEntry      = NULL;
-            GblType                 fromType    = GblVariant_typeOf(pSelf);
-            GblType                 toType      = GblVariant_typeOf(pOther);
-            ConverterEntry_         entry       = { .toType = GblVariant_typeOf(pOther) };
-
-            while(!pEntry && toType != GBL_INVALID_TYPE) {
-                entry.toType = toType;
-                fromType = GblVariant_typeOf(pSelf);
-
-                while(!pEntry && fromType != GBL_INVALID_TYPE) {
-                    entry.fromType = fromType;
-
-                    pEntry = GblTreeSet_get(&converterRegistry_,
-                                           &entry);
-
-                    if(pEntry) goto done;
-                    if(!GblType_check(fromType, GblType_parent(fromType)))
-                        break;
+        const GblVariantConverterFn pFnConv = GblVariant_converter_(GblVariant_typeOf(pSelf),
+                                                                    GblVariant_typeOf(pOther));
+        GBL_CTX_VERIFY(pFnConv,
+                       GBL_RESULT_ERROR_INVALID_CONVERSION,
+                       "[GblVariant] Conversion failed: No converter found! [%s => %s],",
+                       GblType_name(GblVariant_typeOf(pSelf)), GblType_name(GblVariant_typeOf(pOther)));
 
-                    fromType = GblType_parent(fromType);
-                }
-
-                if(!GblType_check(toType, GblType_parent(toType)))
-                    break;
-
-                toType = GblType_parent(toType);
-
-            }
-
-            done:
-            GBL_CTX_VERIFY(pEntry,
-                           GBL_RESULT_ERROR_INVALID_CONVERSION,
-                           "[GblVariant] Conversion failed: No converter found! [%s => %s],",
-                           GblType_name(GblVariant_typeOf(pSelf)), GblType_name(GblVariant_typeOf(pOther)));
-            GBL_CTX_VERIFY_LAST_RECORD();
-            GBL_CTX_VERIFY_CALL(pEntry->pFnConverter(pSelf, pOther));
-        }
+        GBL_CTX_VERIFY_CALL(pFnConv(pSelf, pOther));
 
     } GBL_CTX_END();
 }
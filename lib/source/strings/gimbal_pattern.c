@@ -1,10 +1,448 @@
-#include <gimbal/strings/gimbal_pattern.h>
 #include <gimbal/strings/gimbal_string_view.h>
-#include <re.h>
+#include <gimbal/algorithms/gimbal_hash.h>
+#include <tinycthread.h>
+#include <ctype.h>
+#include "gimbal_pattern_.h"
+
+#define GBL_PATTERN_CACHE_SIZE_     16          // # of compiled patterns kept around for the "Str" functions
+
+/* The matching engine is derived from tiny-regex-c, and keeps its syntax
+   and its backtracking semantics, but compiles each expression into its
+   own heap-allocated, immutable GblPattern rather than into shared static
+   buffers, so any number of threads can compile and match at once.
+   Every single-character atom other than a literal is compiled down to a
+   256-bit set, so that character classes and escapes are matched with a
+   single lookup rather than by walking the class's source text. */
+
+typedef struct GblPatternCacheEntry_ {
+    GblHash     hash;
+    GblPattern* pPattern;
+} GblPatternCacheEntry_;
+
+static once_flag             cacheOnce_ = ONCE_FLAG_INIT;
+static mtx_t                 cacheMtx_;
+static size_t                cacheCount_;
+static GblPatternCacheEntry_ cache_[GBL_PATTERN_CACHE_SIZE_];    // most recently used first
+
+GBL_INLINE GblBool GblPattern_matchOne_(const GblPatternNode_* pNode, char c) {
+    const uint8_t byte = (uint8_t)c;
+    return pNode->type == GBL_PATTERN_NODE_CHAR_?
+               pNode->ch == c : (GblBool)((pNode->set[byte >> 5] >> (byte & 31)) & 1);
+}
+
+GBL_INLINE void GblPattern_setAdd_(GblPatternNode_* pNode, int c) {
+    pNode->set[(uint8_t)c >> 5] |= 1u << ((uint8_t)c & 31);
+}
+
+static GblBool GblPattern_isAlphaNum_(char c) {
+    return c == '_' || isalnum((unsigned char)c);
+}
+
+static GblBool GblPattern_matchMeta_(char c, char meta) {
+    switch(meta) {
+    case 'd': return !!isdigit((unsigned char)c);
+    case 'D': return  !isdigit((unsigned char)c);
+    case 'w': return    GblPattern_isAlphaNum_(c);
+    case 'W': return   !GblPattern_isAlphaNum_(c);
+    case 's': return !!isspace((unsigned char)c);
+    case 'S': return  !isspace((unsigned char)c);
+    default:  return c == meta;
+    }
+}
+
+static GblBool GblPattern_isMeta_(char c) {
+    return c == 's' || c == 'S' || c == 'w' || c == 'W' || c == 'd' || c == 'D';
+}
+
+static GblBool GblPattern_matchRange_(char c, const char* pClass) {
+    return c != '-' && pClass[0] != '\0' && pClass[0] != '-' &&
+           pClass[1] == '-' && pClass[2] != '\0' &&
+           c >= pClass[0] && c <= pClass[2];
+}
+
+/* Evaluated against every character when compiling a class into a set,
+   preserving the quirks of how tiny-regex-c interprets them. pClass is
+   NULL-terminated, and also preceded by a NULL terminator. */
+static GblBool GblPattern_matchClass_(char c, const char* pClass) {
+    do {
+        if(GblPattern_matchRange_(c, pClass))
+            return GBL_TRUE;
+        else if(pClass[0] == '\\') {
+            ++pClass;
+            if(GblPattern_matchMeta_(c, pClass[0]) ||
+               (c == pClass[0] && !GblPattern_isMeta_(c)))
+                return GBL_TRUE;
+        } else if(c == pClass[0]) {
+            if(c == '-')
+                return pClass[-1] == '\0' || pClass[1] == '\0';
+            else
+                return GBL_TRUE;
+        }
+    } while(*pClass++ != '\0');
+
+    return GBL_FALSE;
+}
+
+// Compiles the bracket expression starting at pRegExp[i], returning the index of its ']', or 0 on failure
+static size_t GblPattern_compileClass_(const char* pRegExp, size_t i, GblPatternNode_* pNode, char* pBuffer) {
+    GblBool inverted = GBL_FALSE;
+    size_t  length   = 0;
+
+    if(pRegExp[i + 1] == '^') {
+        inverted = GBL_TRUE;
+        if(pRegExp[++i + 1] == '\0')
+            return 0;
+    }
+
+    pBuffer[length++] = '\0';
+    while(pRegExp[++i] != ']' && pRegExp[i] != '\0') {
+        if(pRegExp[i] == '\\') {
+            if(pRegExp[i + 1] == '\0')
+                return 0;
+            pBuffer[length++] = pRegExp[i++];
+        }
+        pBuffer[length++] = pRegExp[i];
+    }
+
+    if(pRegExp[i] == '\0')
+        return 0;
+
+    pBuffer[length] = '\0';
+
+    pNode->type = GBL_PATTERN_NODE_SET_;
+    for(int c = 1; c <= UINT8_MAX; ++c)
+        if(GblPattern_matchClass_((char)c, pBuffer + 1) != inverted)
+            GblPattern_setAdd_(pNode, c);
+
+    return i;
+}
+
+// Parses the "{n}", "{n,}", or "{n,m}" starting at pRegExp[i], returning the index of its '}', or 0 on failure
+static size_t GblPattern_compileRepeat_(const char* pRegExp, size_t i, GblPatternNode_* pNode) {
+    unsigned min = 0, max = 0;
+
+    if(!isdigit((unsigned char)pRegExp[i + 1]))
+        return 0;
+
+    while(isdigit((unsigned char)pRegExp[++i]) && min <= GBL_PATTERN_REPEAT_MAX_)
+        min = min * 10 + (unsigned)(pRegExp[i] - '0');
+
+    if(pRegExp[i] == ',') {
+        if(pRegExp[i + 1] == '}') {
+            max = GBL_PATTERN_REPEAT_MAX_;
+            ++i;
+        } else while(isdigit((unsigned char)pRegExp[++i]) && max <= GBL_PATTERN_REPEAT_MAX_)
+            max = max * 10 + (unsigned)(pRegExp[i] - '0');
+    } else max = min;
+
+    // an explicit bound of GBL_PATTERN_REPEAT_MAX_ would read as unbounded
+    if(pRegExp[i] != '}' || max < min || max > GBL_PATTERN_REPEAT_MAX_ ||
+       (max == GBL_PATTERN_REPEAT_MAX_ && pRegExp[i - 1] != ','))
+        return 0;
+
+    pNode->min = (uint16_t)min;
+    pNode->max = (uint16_t)max;
+    return i;
+}
+
+// Returns a description of the syntax error within pRegExp, or NULL if it compiled successfully
+static const char* GblPattern_compile_(GblPattern* pSelf, const char* pRegExp, char* pBuffer) {
+    GblPatternNode_* pNode      = pSelf->nodes;
+    GblBool          quantified = GBL_TRUE;     // whether the previous node can't take a quantifier
+    size_t           i          = 0;
+
+    if(pRegExp[0] == '^') {
+        pSelf->anchored = GBL_TRUE;
+        ++i;
+    }
+
+    for(; pRegExp[i] != '\0'; ++i) {
+        const char c = pRegExp[i];
+
+        if(c == '*' || c == '+' || c == '?' || c == '{') {
+            if(quantified)
+                return "Quantifier without a preceding character";
+
+            GblPatternNode_* pPrev = pNode - 1;
+
+            // a quantified '$' no longer marks the end
+            if(pPrev->type == GBL_PATTERN_NODE_END_)
+                pPrev->type = GBL_PATTERN_NODE_SET_;
+
+            switch(c) {
+            case '*': pPrev->min = 0; pPrev->max = GBL_PATTERN_REPEAT_MAX_; break;
+            case '+': pPrev->min = 1; pPrev->max = GBL_PATTERN_REPEAT_MAX_; break;
+            case '?': pPrev->min = 0; pPrev->max = 1; pPrev->lazy = GBL_TRUE; break;
+            default:
+                if(!(i = GblPattern_compileRepeat_(pRegExp, i, pPrev)))
+                    return "Invalid repetition";
+            }
+
+            quantified = GBL_TRUE;
+            continue;
+        }
+
+        pNode->min = pNode->max = 1;
+        quantified = GBL_FALSE;
+
+        switch(c) {
+        // only special at either end, otherwise they never match anything
+        case '^': pNode->type = GBL_PATTERN_NODE_SET_; break;
+        case '$': pNode->type = GBL_PATTERN_NODE_END_; break;
+        case '.':
+            pNode->type = GBL_PATTERN_NODE_SET_;
+            for(int ch = 1; ch <= UINT8_MAX; ++ch)
+                if(ch != '\n' && ch != '\r')
+                    GblPattern_setAdd_(pNode, ch);
+            break;
+        case '[':
+            if(!(i = GblPattern_compileClass_(pRegExp, i, pNode, pBuffer)))
+                return "Unterminated character class";
+            break;
+        case '\\':
+            if(pRegExp[++i] == '\0')
+                return "Trailing escape character";
+
+            if(GblPattern_isMeta_(pRegExp[i])) {
+                pNode->type = GBL_PATTERN_NODE_SET_;
+                for(int ch = 1; ch <= UINT8_MAX; ++ch)
+                    if(GblPattern_matchMeta_((char)ch, pRegExp[i]))
+                        GblPattern_setAdd_(pNode, ch);
+            } else {
+                pNode->type = GBL_PATTERN_NODE_CHAR_;
+                pNode->ch   = pRegExp[i];
+            }
+            break;
+        default:
+            pNode->type = GBL_PATTERN_NODE_CHAR_;
+            pNode->ch   = c;
+        }
+
+        ++pNode;
+    }
+
+    // '$' only anchors to the end when it's the very last node
+    for(GblPatternNode_* pIt = pSelf->nodes; pIt + 1 < pNode; ++pIt)
+        if(pIt->type == GBL_PATTERN_NODE_END_)
+            pIt->type = GBL_PATTERN_NODE_SET_;
+
+    pNode->type = GBL_PATTERN_NODE_NONE_;
+
+    return NULL;
+}
+
+GBL_EXPORT GblPattern* GblPattern_create(const char* pRegExp) {
+    GblPattern* pSelf = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pRegExp);
+
+    // no more nodes than characters, plus the terminator
+    const size_t length = strlen(pRegExp);
+    const size_t size   = sizeof(GblPattern) + sizeof(GblPatternNode_) * (length + 1);
+    char*        pBuffer;
+    char*        pString;
+
+    // the source string follows the nodes, then scratch space for compiling character classes
+    pSelf = GBL_CTX_MALLOC(size + 2 * length + 3);
+
+    GBL_CTX_VERIFY(pSelf,
+                   GBL_RESULT_ERROR_MEM_ALLOC,
+                   "Failed to allocate pattern: [%s]",
+                   pRegExp);
+
+    pString = (char*)pSelf + size;
+    pBuffer = pString + length + 1;
+
+    memset(pSelf, 0, size);
+    memcpy(pString, pRegExp, length + 1);
+    GBL_ATOMIC_INT16_INIT(pSelf->refCount, 1);
+    pSelf->pRegExp = pString;
 
+    const char* pError = GblPattern_compile_(pSelf, pRegExp, pBuffer);
+
+    if(pError) {
+        GBL_CTX_FREE(pSelf);
+        pSelf = NULL;
+    }
+
+    GBL_CTX_VERIFY(!pError,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "%s: [%s]",
+                   pError, pRegExp);
+
+    GBL_CTX_END_BLOCK();
+    return pSelf;
+}
+
+GBL_EXPORT GblPattern* GblPattern_ref(const GblPattern* pSelf) {
+    if(pSelf)
+        GBL_ATOMIC_INT16_INC(((GblPattern*)pSelf)->refCount);
+
+    return (GblPattern*)pSelf;
+}
+
+GBL_EXPORT GblRefCount GblPattern_unref(const GblPattern* pSelf) {
+    GblRefCount refCount = 0;
+
+    if(pSelf) {
+        GBL_CTX_BEGIN(NULL);
+        if(!(refCount = (GBL_ATOMIC_INT16_DEC(((GblPattern*)pSelf)->refCount) - 1)))
+            GBL_CTX_FREE((GblPattern*)pSelf);
+        GBL_CTX_END_BLOCK();
+    }
+
+    return refCount;
+}
+
+GBL_EXPORT GblRefCount GblPattern_refCount(const GblPattern* pSelf) {
+    return pSelf? GBL_ATOMIC_INT16_LOAD(((GblPattern*)pSelf)->refCount) : 0;
+}
+
+GBL_EXPORT const char* GblPattern_string(const GblPattern* pSelf) {
+    return pSelf? pSelf->pRegExp : NULL;
+}
+
+// Returns where a match of the given nodes starting at pText ends, or NULL if there isn't one
+static const char* GblPattern_matchHere_(const GblPatternNode_* pNode, const char* pText) {
+    for(;; ++pNode) {
+        switch(pNode->type) {
+        case GBL_PATTERN_NODE_NONE_:
+            return pText;
+        case GBL_PATTERN_NODE_END_:
+            return *pText? NULL : pText;
+        default:
+            break;
+        }
+
+        if(pNode->min == 1 && pNode->max == 1) {
+            if(!*pText || !GblPattern_matchOne_(pNode, *pText))
+                return NULL;
+            ++pText;
+            continue;
+        }
+
+        const char* pEnd;
+
+        if(pNode->lazy) {
+            if((pEnd = GblPattern_matchHere_(pNode + 1, pText)))
+                return pEnd;
+            if(*pText && GblPattern_matchOne_(pNode, *pText))
+                return GblPattern_matchHere_(pNode + 1, pText + 1);
+            return NULL;
+        }
+
+        // greedily consume as many as possible, then backtrack
+        const size_t max   = pNode->max == GBL_PATTERN_REPEAT_MAX_? SIZE_MAX : pNode->max;
+        size_t       count = 0;
+        while(count < max && pText[count] && GblPattern_matchOne_(pNode, pText[count]))
+            ++count;
+
+        if(count < pNode->min)
+            return NULL;
+
+        for(;;) {
+            if((pEnd = GblPattern_matchHere_(pNode + 1, pText + count)))
+                return pEnd;
+            if(count-- == pNode->min)
+                return NULL;
+        }
+    }
+}
+
+// Returns the offset of the first match within pText, or -1 if there isn't one
+static int GblPattern_search_(const GblPattern* pSelf, const char* pText, int* pLength) {
+    const GblPatternNode_* pFirst = &pSelf->nodes[0];
+    const char*            pStart = pText;
+    const char*            pEnd;
+
+    *pLength = 0;
+
+    if(pSelf->anchored) {
+        if(!(pEnd = GblPattern_matchHere_(pFirst, pText)))
+            return -1;
+
+        *pLength = (int)(pEnd - pText);
+        return 0;
+    }
+
+    // when the first node has to match, skip straight to where it does
+    const GblBool skip = (pFirst->type == GBL_PATTERN_NODE_CHAR_ ||
+                          pFirst->type == GBL_PATTERN_NODE_SET_) && pFirst->min;
+
+    do {
+        if(skip) {
+            if(pFirst->type == GBL_PATTERN_NODE_CHAR_)
+                pText = strchr(pText, pFirst->ch);
+            else while(*pText && !GblPattern_matchOne_(pFirst, *pText))
+                ++pText;
+
+            if(!pText || !*pText)
+                return -1;
+        }
+
+        if((pEnd = GblPattern_matchHere_(pFirst, pText))) {
+            // an empty match at the very end doesn't count
+            if(!*pText)
+                return -1;
+
+            *pLength = (int)(pEnd - pText);
+            return (int)(pText - pStart);
+        }
+    } while(*pText++ != '\0');
+
+    return -1;
+}
+
+static void GblPattern_cacheInit_(void) {
+    mtx_init(&cacheMtx_, mtx_plain);
+}
+
+// Returns a new reference to the compiled pattern for pRegExp, compiling it if it's not cached
+static GblPattern* GblPattern_cached_(const char* pRegExp) {
+    GblPattern* pPattern = NULL;
+
+    if(!pRegExp)
+        return NULL;
+
+    const GblHash hash = gblHash(pRegExp, strlen(pRegExp));
+    size_t        e    = 0;
+
+    call_once(&cacheOnce_, GblPattern_cacheInit_);
+    mtx_lock(&cacheMtx_);
+
+    for(; e < cacheCount_; ++e)
+        if(cache_[e].hash == hash && strcmp(cache_[e].pPattern->pRegExp, pRegExp) == 0)
+            break;
+
+    if(e < cacheCount_) {
+        GblPatternCacheEntry_ entry = cache_[e];
+        memmove(&cache_[1], &cache_[0], sizeof(GblPatternCacheEntry_) * e);
+        cache_[0] = entry;
+    } else if((pPattern = GblPattern_create(pRegExp))) {
+        // evict the least recently used pattern, which may still be in use by another thread
+        if(cacheCount_ == GBL_PATTERN_CACHE_SIZE_)
+            GblPattern_unref(cache_[--cacheCount_].pPattern);
+
+        memmove(&cache_[1], &cache_[0], sizeof(GblPatternCacheEntry_) * cacheCount_++);
+        cache_[0] = (GblPatternCacheEntry_) { .hash = hash, .pPattern = pPattern };
+    }
+
+    pPattern = GblPattern_ref(e < cacheCount_ || pPattern? cache_[0].pPattern : NULL);
+
+    mtx_unlock(&cacheMtx_);
+    return pPattern;
+}
 
 GBL_EXPORT const GblPattern* GblPattern_compile(const char* pRegExp) {
-    return pRegExp? (GblPattern*)re_compile(pRegExp) : NULL;
+    // Holds on to the pattern until the thread's next call, like the static buffer it used to be compiled into
+    static GBL_THREAD_LOCAL GblPattern* pPrevious = NULL;
+
+    GblPattern* pPattern = GblPattern_cached_(pRegExp);
+
+    GblPattern_unref(pPrevious);
+    return pPrevious = pPattern;
 }
 
 GBL_EXPORT GblBool (GblPattern_match)(const GblPattern* pSelf,
@@ -36,7 +474,7 @@ GBL_EXPORT GblBool (GblPattern_match)(const GblPattern* pSelf,
     // Only run if pattern + string are valid
     if(valid) {
         // Iterate over substring until no match is found
-        while((pos = re_matchp((re_t)pSelf, pString + prevPos + prevLength, &length)) != -1) {
+        while((pos = GblPattern_search_(pSelf, pString + prevPos + prevLength, &length)) != -1) {
             // Update moving window substring
             pString     += prevPos + prevLength;
             prevPos     = pos;
@@ -72,10 +510,13 @@ GBL_EXPORT GblBool (GblPattern_matchStr)(const char*    pRegExp,
                                          GblStringView* pMatch,
                                          int*       pCount)
 {
-    return GblPattern_match(GblPattern_compile(pRegExp),
-                            pString,
-                            pMatch,
-                            pCount);
+    GblPattern*   pPattern = GblPattern_cached_(pRegExp);
+    const GblBool result   = GblPattern_match(pPattern,
+                                              pString,
+                                              pMatch,
+                                              pCount);
+    GblPattern_unref(pPattern);
+    return result;
 }
 
 GBL_EXPORT GblBool (GblPattern_matchNot)(const GblPattern* pSelf,
@@ -126,11 +567,10 @@ GBL_EXPORT GblBool (GblPattern_matchNot)(const GblPattern* pSelf,
         ++totalCount;
     }
 
-    const size_t length = strlen(pString);
-
+    // Checked as we go rather than with strlen(), which would rescan the whole rest of the string
     prevToken = token;
     while((*pCount == -1 || totalCount < *pCount) &&
-          token.pData + token.length < pString + length &&
+          token.pData[token.length] != '\0' &&
           GblPattern_match(pSelf, token.pData += token.length, &token, &count))
     {
         *pMatch = GblStringView_fromStringSized(prevToken.pData + prevToken.length,
@@ -140,12 +580,11 @@ GBL_EXPORT GblBool (GblPattern_matchNot)(const GblPattern* pSelf,
         ++totalCount;
     }
 
-    // check if we still have one last token remaining
+    // check if we still have one last token remaining (a failed match clears the token)
     if((*pCount == -1 || totalCount < *pCount) &&
-       token.pData + token.length < pString + length) {
+       (!token.pData || token.pData[token.length] != '\0')) {
         const char* pNewHead = prevToken.pData + prevToken.length;
-        *pMatch = GblStringView_fromStringSized(pNewHead,
-                                                pString + length - pNewHead);
+        *pMatch = GblStringView_fromString(pNewHead);
 
         ++totalCount;
     }
@@ -173,10 +612,13 @@ GBL_EXPORT GblBool GblPattern_matchNotStr(const char*    pRegExp,
                                           GblStringView* pMatch,
                                           int*       pCount)
 {
-    return GblPattern_matchNot(GblPattern_compile(pRegExp),
-                               pString,
-                               pMatch,
-                               pCount);
+    GblPattern*   pPattern = GblPattern_cached_(pRegExp);
+    const GblBool result   = GblPattern_matchNot(pPattern,
+                                                 pString,
+                                                 pMatch,
+                                                 pCount);
+    GblPattern_unref(pPattern);
+    return result;
 }
 
 GBL_EXPORT GblBool GblPattern_matchExact(const GblPattern* pSelf, const char* pString) {
@@ -189,7 +631,7 @@ GBL_EXPORT GblBool GblPattern_matchExact(const GblPattern* pSelf, const char* pS
 
     if(GblPattern_match(pSelf, pString, &match, NULL)) {
         return (match.pData  == pString &&
-                match.length == strlen(pString));
+                match.pData[match.length] == '\0');
     }
 
     return GBL_FALSE;
@@ -198,7 +640,10 @@ GBL_EXPORT GblBool GblPattern_matchExact(const GblPattern* pSelf, const char* pS
 GBL_EXPORT GblBool GblPattern_matchExactStr(const char* pRegExp,
                                             const char* pString)
 {
-    return GblPattern_matchExact(GblPattern_compile(pRegExp), pString);
+    GblPattern*   pPattern = GblPattern_cached_(pRegExp);
+    const GblBool result   = GblPattern_matchExact(pPattern, pString);
+    GblPattern_unref(pPattern);
+    return result;
 }
 
 
@@ -209,5 +654,8 @@ GBL_EXPORT size_t GblPattern_matchCount(const GblPattern* pSelf, const char* pSt
 }
 
 GBL_EXPORT size_t GblPattern_matchCountStr(const char* pRegExp, const char* pString) {
-    return GblPattern_matchCount(GblPattern_compile(pRegExp), pString);
+    GblPattern*  pPattern = GblPattern_cached_(pRegExp);
+    const size_t count    = GblPattern_matchCount(pPattern, pString);
+    GblPattern_unref(pPattern);
+    return count;
 }
@@ -0,0 +1,36 @@
+#ifndef GIMBAL_PATTERN__H
+#define GIMBAL_PATTERN__H
+
+#include <gimbal/strings/gimbal_pattern.h>
+#include <gimbal/core/gimbal_atomics.h>
+
+#define GBL_PATTERN_REPEAT_MAX_     0xffff      // max of an unbounded repetition, explicit bounds must be lower
+
+/* Compiled representation of a GblPattern, shared with GblPatternSet,
+   which builds its automata from the same nodes rather than parsing
+   the expressions a second time. */
+
+typedef enum GBL_PATTERN_NODE_ {
+    GBL_PATTERN_NODE_NONE_,     // terminates the pattern
+    GBL_PATTERN_NODE_CHAR_,     // literal character
+    GBL_PATTERN_NODE_SET_,      // any character within a set
+    GBL_PATTERN_NODE_END_       // trailing '$'
+} GBL_PATTERN_NODE_;
+
+typedef struct GblPatternNode_ {
+    uint8_t  type;
+    char     ch;
+    GblBool  lazy;      // '?', tries to match the rest of the pattern before consuming anything
+    uint16_t min;       // repetitions, {1, 1} when the node isn't quantified
+    uint16_t max;
+    uint32_t set[8];
+} GblPatternNode_;
+
+struct GblPattern {
+    GBL_ATOMIC_INT16 refCount;
+    GblBool          anchored;  // leading '^'
+    const char*      pRegExp;   // stored immediately after the nodes
+    GblPatternNode_  nodes[];
+};
+
+#endif // GIMBAL_PATTERN__H
@@ -0,0 +1,814 @@
+#include <gimbal/strings/gimbal_pattern_set.h>
+#include <gimbal/algorithms/gimbal_hash.h>
+#include "gimbal_pattern_.h"
+
+#define GBL_PATTERN_SET_POSITIONS_MAX_  4096            // NFA positions across every pattern within a set
+#define GBL_PATTERN_SET_STATES_MAX_     16384           // states within any one of a set's DFAs
+#define GBL_PATTERN_SET_ACCEPT_         0x80000000u     // transition flag: the target state accepts
+#define GBL_PATTERN_SET_DEAD_           0x40000000u     // transition flag: the target state never accepts
+#define GBL_PATTERN_SET_STATE_MASK_     0x3fffffffu     // transition's target state, premultiplied by the class count
+
+/* Each pattern is first expanded into a position automaton: a sequence
+   of single-character atoms, with each {n,m} repetition unrolled into n
+   required atoms followed by either m - n optional atoms or one optional,
+   looping atom, which then ends in an accepting position. Sets of
+   positions are then built into DFAs via subset construction, with every
+   byte value mapped to the smallest number of equivalence classes which
+   no atom can tell apart, plus one extra class representing the edge of
+   the input, which the atoms for '^' and '$' consume.
+
+   Scanning a string takes one unanchored DFA over every pattern at once,
+   which is restarted after each match and reports where matches end.
+   Each pattern then has its own reversed DFA, for finding the leftmost
+   start of a match from its end, and forward DFA, for finding the
+   longest end from that start; these only ever run over the match. */
+
+typedef enum GBL_PATTERN_ATOM_FLAGS_ {
+    GBL_PATTERN_ATOM_OPTIONAL_ = 0x1,       // may be skipped
+    GBL_PATTERN_ATOM_LOOP_     = 0x2,       // may repeat
+    GBL_PATTERN_ATOM_EDGE_     = 0x4,       // only matches the edge of the input
+    GBL_PATTERN_ATOM_ACCEPT_   = 0x8        // final position of a pattern
+} GBL_PATTERN_ATOM_FLAGS_;
+
+typedef struct GblPatternAtom_ {
+    uint32_t set[8];
+    uint32_t pattern;
+    uint8_t  flags;
+} GblPatternAtom_;
+
+typedef struct GblPatternDfa_ {
+    uint32_t* pNext;        // transitions, indexed by premultiplied state + class
+    uint32_t* pAccepts;     // offsets into pAcceptList for each state, plus one
+    uint32_t* pAcceptList;  // patterns accepted by each state, in ascending order
+    uint32_t  start;        // transition into the initial state
+    uint32_t  restart;      // transition into the state scanning resumes from after a match
+    uint32_t  stateCount;
+} GblPatternDfa_;
+
+typedef struct GblPatternSetEntry_ {
+    GblPattern*    pPattern;
+    GblPatternDfa_ forward;     // anchored at the start of a match
+    GblPatternDfa_ reverse;     // anchored at the end of a match, reading backwards
+    size_t         first;       // index of the pattern's first atom within the set
+    GblBool        begin;       // leading '^'
+    GblBool        end;         // trailing '$'
+} GblPatternSetEntry_;
+
+struct GblPatternSet {
+    GBL_ATOMIC_INT16     refCount;
+    uint16_t             classCount;    // byte classes, plus the edge of the input
+    uint8_t              classes[256];
+    size_t               patternCount;
+    GblPatternDfa_       scanner;       // unanchored, over every pattern
+    int16_t              escape;        // the only byte which leaves the scanner's restart state, or -1
+    uint8_t              idle[256];     // bytes which leave the scanner in its restart state
+    GblPatternSetEntry_  entries[];
+};
+
+typedef struct GblPatternDfaBuilder_ {
+    const GblPatternSet*   pSet;
+    const GblPatternAtom_* pAtoms;
+    const uint8_t*         pReps;       // a byte belonging to each class
+    size_t                 words;       // 32-bit words per set of positions
+    uint32_t*              pSets;
+    uint8_t*               pFlags;
+    uint32_t*              pNext;
+    uint32_t*              pTable;      // open-addressed hash table of state indices + 1
+    size_t                 tableSize;
+    size_t                 capacity;
+    uint32_t               stateCount;
+} GblPatternDfaBuilder_;
+
+GBL_INLINE GblBool GblPatternSet_atomHas_(const GblPatternAtom_* pAtom, uint8_t byte) {
+    return (pAtom->set[byte >> 5] >> (byte & 31)) & 1;
+}
+
+// Returns the number of atoms in the position automaton for the given pattern, writing them to pAtoms if it isn't NULL
+static size_t GblPatternSet_expand_(const GblPattern* pPattern, uint32_t index, GblPatternAtom_* pAtoms) {
+    static const uint32_t none[8] = { 0 };     // edges and accepts don't consume any byte
+    size_t                count   = 0;
+
+#define GBL_PATTERN_SET_ATOM_(setPtr, atomFlags)                                       \
+        GBL_STMT_START {                                                               \
+            if(pAtoms) {                                                               \
+                memcpy(pAtoms[count].set, setPtr, sizeof(pAtoms->set));                \
+                pAtoms[count].pattern = index;                                         \
+                pAtoms[count].flags   = (atomFlags);                                   \
+            }                                                                          \
+            ++count;                                                                   \
+        } GBL_STMT_END
+
+    if(pPattern->anchored)
+        GBL_PATTERN_SET_ATOM_(none, GBL_PATTERN_ATOM_EDGE_);
+
+    for(const GblPatternNode_* pNode = pPattern->nodes; pNode->type != GBL_PATTERN_NODE_NONE_; ++pNode) {
+        if(pNode->type == GBL_PATTERN_NODE_END_) {
+            GBL_PATTERN_SET_ATOM_(none, GBL_PATTERN_ATOM_EDGE_);
+            continue;
+        }
+
+        uint32_t        literal[8] = { 0 };
+        const uint32_t* pSet       = pNode->set;
+
+        if(pNode->type == GBL_PATTERN_NODE_CHAR_) {
+            literal[(uint8_t)pNode->ch >> 5] = 1u << ((uint8_t)pNode->ch & 31);
+            pSet = literal;
+        }
+
+        for(unsigned r = 0; r < pNode->min; ++r)
+            GBL_PATTERN_SET_ATOM_(pSet, 0);
+
+        if(pNode->max == GBL_PATTERN_REPEAT_MAX_)
+            GBL_PATTERN_SET_ATOM_(pSet, GBL_PATTERN_ATOM_OPTIONAL_ | GBL_PATTERN_ATOM_LOOP_);
+        else for(unsigned r = pNode->min; r < pNode->max; ++r)
+            GBL_PATTERN_SET_ATOM_(pSet, GBL_PATTERN_ATOM_OPTIONAL_);
+    }
+
+    GBL_PATTERN_SET_ATOM_(none, GBL_PATTERN_ATOM_ACCEPT_);
+
+#undef GBL_PATTERN_SET_ATOM_
+
+    return count;
+}
+
+// Partitions every byte into classes which no atom distinguishes between
+static void GblPatternSet_classify_(GblPatternSet* pSelf, const GblPatternAtom_* pAtoms, size_t count) {
+    uint16_t classCount = 1;
+
+    memset(pSelf->classes, 0, sizeof(pSelf->classes));
+
+    for(size_t a = 0; a < count; ++a) {
+        int16_t split[256][2];
+        uint8_t classes[256];
+        uint16_t newCount = 0;
+
+        if(pAtoms[a].flags & (GBL_PATTERN_ATOM_EDGE_ | GBL_PATTERN_ATOM_ACCEPT_))
+            continue;
+
+        memset(split, 0xff, sizeof(int16_t) * 2 * classCount);
+
+        for(unsigned b = 0; b < 256; ++b) {
+            int16_t* pClass = &split[pSelf->classes[b]][GblPatternSet_atomHas_(&pAtoms[a], (uint8_t)b)];
+
+            if(*pClass < 0)
+                *pClass = (int16_t)newCount++;
+
+            classes[b] = (uint8_t)*pClass;
+        }
+
+        memcpy(pSelf->classes, classes, sizeof(classes));
+        classCount = newCount;
+    }
+
+    pSelf->classCount = classCount + 1;
+}
+
+// Adds position p to the given set, along with every position reachable from it by skipping optional atoms
+GBL_INLINE void GblPatternSet_close_(const GblPatternAtom_* pAtoms, uint32_t* pSet, size_t p) {
+    for(;;) {
+        pSet[p >> 5] |= 1u << (p & 31);
+        if(!(pAtoms[p].flags & GBL_PATTERN_ATOM_OPTIONAL_))
+            break;
+        ++p;
+    }
+}
+
+static GblHash GblPatternSet_hashSet_(const GblPatternDfaBuilder_* pBuilder, const uint32_t* pSet) {
+    return gblHash(pSet, sizeof(uint32_t) * pBuilder->words);
+}
+
+// Looks up the state with the given set of positions, adding it if it's new
+static GBL_RESULT GblPatternSet_intern_(GblPatternDfaBuilder_* pBuilder, const uint32_t* pSet, uint32_t* pState) {
+    const size_t bytes = sizeof(uint32_t) * pBuilder->words;
+    const size_t mask  = pBuilder->tableSize - 1;
+    size_t       slot  = GblPatternSet_hashSet_(pBuilder, pSet) & mask;
+
+    for(; pBuilder->pTable[slot]; slot = (slot + 1) & mask) {
+        if(memcmp(&pBuilder->pSets[(pBuilder->pTable[slot] - 1) * pBuilder->words], pSet, bytes) == 0) {
+            *pState = pBuilder->pTable[slot] - 1;
+            return GBL_RESULT_SUCCESS;
+        }
+    }
+
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY(pBuilder->stateCount < GBL_PATTERN_SET_STATES_MAX_,
+                   GBL_RESULT_ERROR_OVERFLOW,
+                   "Patterns require more than %u DFA states",
+                   GBL_PATTERN_SET_STATES_MAX_);
+
+    if(pBuilder->stateCount == pBuilder->capacity) {
+        pBuilder->capacity *= 2;
+        pBuilder->pSets    = GBL_CTX_REALLOC(pBuilder->pSets,  bytes * pBuilder->capacity);
+        pBuilder->pFlags   = GBL_CTX_REALLOC(pBuilder->pFlags, pBuilder->capacity);
+        pBuilder->pNext    = GBL_CTX_REALLOC(pBuilder->pNext,
+                                             sizeof(uint32_t) * pBuilder->pSet->classCount * pBuilder->capacity);
+    }
+
+    const uint32_t state  = pBuilder->stateCount++;
+    GblBool        empty  = GBL_TRUE;
+    GblBool        accept = GBL_FALSE;
+
+    memcpy(&pBuilder->pSets[state * pBuilder->words], pSet, bytes);
+
+    for(size_t w = 0; w < pBuilder->words; ++w) {
+        if(pSet[w])
+            empty = GBL_FALSE;
+
+        for(uint32_t bits = pSet[w]; bits; bits &= bits - 1)
+            if(pBuilder->pAtoms[w * 32 + GBL_BITMASK_CTZ(bits)].flags & GBL_PATTERN_ATOM_ACCEPT_)
+                accept = GBL_TRUE;
+    }
+
+    pBuilder->pFlags[state] = accept? GBL_PATTERN_SET_ACCEPT_ >> 24 :
+                              empty?  GBL_PATTERN_SET_DEAD_   >> 24 : 0;
+    *pState = state;
+
+    // keep the table at most half full
+    if(pBuilder->stateCount * 2 > pBuilder->tableSize) {
+        GBL_CTX_FREE(pBuilder->pTable);
+        pBuilder->tableSize *= 2;
+        pBuilder->pTable = GBL_CTX_MALLOC(sizeof(uint32_t) * pBuilder->tableSize);
+        memset(pBuilder->pTable, 0, sizeof(uint32_t) * pBuilder->tableSize);
+
+        for(uint32_t s = 0; s < pBuilder->stateCount; ++s) {
+            slot = GblPatternSet_hashSet_(pBuilder, &pBuilder->pSets[s * pBuilder->words]) &
+                   (pBuilder->tableSize - 1);
+
+            while(pBuilder->pTable[slot])
+                slot = (slot + 1) & (pBuilder->tableSize - 1);
+
+            pBuilder->pTable[slot] = s + 1;
+        }
+    } else pBuilder->pTable[slot] = state + 1;
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblPatternSet_construct_(GblPatternDfaBuilder_* pBuilder,
+                                           GblPatternDfa_*        pDfa,
+                                           const uint32_t*        pStart,
+                                           const uint32_t*        pRestart,
+                                           uint32_t*              pNextSet,
+                                           GblBool                acceptLists)
+{
+    const GblPatternAtom_* pAtoms     = pBuilder->pAtoms;
+    const size_t           classCount = pBuilder->pSet->classCount;
+    const size_t           words      = pBuilder->words;
+    uint8_t                reps[256];
+    uint32_t               restart    = 0;
+
+    GBL_CTX_BEGIN(NULL);
+
+    for(int b = 255; b >= 0; --b)
+        reps[pBuilder->pSet->classes[b]] = (uint8_t)b;
+
+    uint32_t start;
+    GBL_CTX_VERIFY_CALL(GblPatternSet_intern_(pBuilder, pStart, &start));
+
+    if(pRestart)
+        GBL_CTX_VERIFY_CALL(GblPatternSet_intern_(pBuilder, pRestart, &restart));
+
+    // each new state is appended to the end, so this visits every reachable state
+    for(uint32_t state = 0; state < pBuilder->stateCount; ++state) {
+        for(size_t c = 0; c < classCount; ++c) {
+            const GblBool edge = (c == classCount - 1);
+
+            if(pRestart)
+                memcpy(pNextSet, pRestart, sizeof(uint32_t) * words);
+            else
+                memset(pNextSet, 0, sizeof(uint32_t) * words);
+
+            for(size_t w = 0; w < words; ++w) {
+                for(uint32_t bits = pBuilder->pSets[state * words + w]; bits; bits &= bits - 1) {
+                    const size_t           p     = w * 32 + GBL_BITMASK_CTZ(bits);
+                    const GblPatternAtom_* pAtom = &pAtoms[p];
+
+                    if(pAtom->flags & GBL_PATTERN_ATOM_ACCEPT_)
+                        continue;
+
+                    if(edge? !(pAtom->flags & GBL_PATTERN_ATOM_EDGE_) :
+                             ((pAtom->flags & GBL_PATTERN_ATOM_EDGE_) ||
+                              !GblPatternSet_atomHas_(pAtom, reps[c])))
+                        continue;
+
+                    if(pAtom->flags & GBL_PATTERN_ATOM_LOOP_)
+                        GblPatternSet_close_(pAtoms, pNextSet, p);
+
+                    GblPatternSet_close_(pAtoms, pNextSet, p + 1);
+                }
+            }
+
+            uint32_t next;
+            GBL_CTX_VERIFY_CALL(GblPatternSet_intern_(pBuilder, pNextSet, &next));
+
+            pBuilder->pNext[state * classCount + c] = next;
+        }
+    }
+
+    // encode each transition as its target state, premultiplied by the class count, with its flags
+#define GBL_PATTERN_SET_ENCODE_(state) \
+        ((uint32_t)((state) * classCount) | ((uint32_t)pBuilder->pFlags[state] << 24))
+
+    for(size_t t = 0; t < pBuilder->stateCount * classCount; ++t)
+        pBuilder->pNext[t] = GBL_PATTERN_SET_ENCODE_(pBuilder->pNext[t]);
+
+    pDfa->start      = GBL_PATTERN_SET_ENCODE_(start);
+    pDfa->restart    = GBL_PATTERN_SET_ENCODE_(restart);
+    pDfa->stateCount = pBuilder->stateCount;
+    pDfa->pNext      = GBL_CTX_REALLOC(pBuilder->pNext, sizeof(uint32_t) * classCount * pBuilder->stateCount);
+    pBuilder->pNext  = NULL;
+
+#undef GBL_PATTERN_SET_ENCODE_
+
+    if(acceptLists) {
+        size_t accepts = 0;
+
+        pDfa->pAccepts = GBL_CTX_MALLOC(sizeof(uint32_t) * (pBuilder->stateCount + 1));
+
+        // count them all, then fill them in
+        for(int pass = 0; pass < 2; ++pass) {
+            accepts = 0;
+
+            for(uint32_t state = 0; state < pBuilder->stateCount; ++state) {
+                pDfa->pAccepts[state] = (uint32_t)accepts;
+
+                for(size_t w = 0; w < words; ++w) {
+                    for(uint32_t bits = pBuilder->pSets[state * words + w]; bits; bits &= bits - 1) {
+                        const GblPatternAtom_* pAtom = &pAtoms[w * 32 + GBL_BITMASK_CTZ(bits)];
+
+                        if(pAtom->flags & GBL_PATTERN_ATOM_ACCEPT_) {
+                            if(pass)
+                                pDfa->pAcceptList[accepts] = pAtom->pattern;
+                            ++accepts;
+                        }
+                    }
+                }
+            }
+
+            pDfa->pAccepts[pBuilder->stateCount] = (uint32_t)accepts;
+
+            if(!pass)
+                pDfa->pAcceptList = GBL_CTX_MALLOC(sizeof(uint32_t) * (accepts + 1));
+        }
+    }
+
+    GBL_CTX_END();
+}
+
+/* Builds a DFA over the given atoms by subset construction, starting from
+   the positions in pStart, and adding the positions in pRestart after
+   every transition when it isn't NULL. */
+static GBL_RESULT GblPatternSet_build_(const GblPatternSet*   pSelf,
+                                       GblPatternDfa_*        pDfa,
+                                       const GblPatternAtom_* pAtoms,
+                                       size_t                 atomCount,
+                                       const uint32_t*        pStart,
+                                       const uint32_t*        pRestart,
+                                       GblBool                acceptLists)
+{
+    GblPatternDfaBuilder_ builder = {
+        .pSet      = pSelf,
+        .pAtoms    = pAtoms,
+        .words     = (atomCount + 31) / 32,
+        .tableSize = 128,
+        .capacity  = 64
+    };
+
+    uint32_t* pNextSet = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    builder.pTable = GBL_CTX_MALLOC(sizeof(uint32_t) * builder.tableSize);
+    memset(builder.pTable, 0, sizeof(uint32_t) * builder.tableSize);
+    pNextSet       = GBL_CTX_MALLOC(sizeof(uint32_t) * builder.words);
+    builder.pSets  = GBL_CTX_MALLOC(sizeof(uint32_t) * builder.words * builder.capacity);
+    builder.pFlags = GBL_CTX_MALLOC(builder.capacity);
+    builder.pNext  = GBL_CTX_MALLOC(sizeof(uint32_t) * pSelf->classCount * builder.capacity);
+
+    GBL_CTX_CALL(GblPatternSet_construct_(&builder, pDfa, pStart, pRestart, pNextSet, acceptLists));
+
+    GBL_CTX_FREE(builder.pSets);
+    GBL_CTX_FREE(builder.pFlags);
+    if(builder.pNext)
+        GBL_CTX_FREE(builder.pNext);
+    GBL_CTX_FREE(builder.pTable);
+    GBL_CTX_FREE(pNextSet);
+
+    GBL_CTX_END();
+}
+
+static void GblPatternSet_freeDfa_(GblPatternDfa_* pDfa) {
+    GBL_CTX_BEGIN(NULL);
+
+    if(pDfa->pNext)
+        GBL_CTX_FREE(pDfa->pNext);
+    if(pDfa->pAccepts)
+        GBL_CTX_FREE(pDfa->pAccepts);
+    if(pDfa->pAcceptList)
+        GBL_CTX_FREE(pDfa->pAcceptList);
+
+    GBL_CTX_END_BLOCK();
+}
+
+static void GblPatternSet_destroy_(GblPatternSet* pSelf) {
+    GBL_CTX_BEGIN(NULL);
+
+    GblPatternSet_freeDfa_(&pSelf->scanner);
+
+    for(size_t p = 0; p < pSelf->patternCount; ++p) {
+        GblPattern_unref(pSelf->entries[p].pPattern);
+        GblPatternSet_freeDfa_(&pSelf->entries[p].forward);
+        GblPatternSet_freeDfa_(&pSelf->entries[p].reverse);
+    }
+
+    GBL_CTX_FREE(pSelf);
+
+    GBL_CTX_END_BLOCK();
+}
+
+static GBL_RESULT GblPatternSet_compile_(GblPatternSet*   pSelf,
+                                         GblPatternAtom_* pAtoms,
+                                         GblPatternAtom_* pReversed,
+                                         size_t           atomCount,
+                                         uint32_t*        pStart,
+                                         uint32_t*        pRestart)
+{
+    GBL_CTX_BEGIN(NULL);
+
+    const size_t words = (atomCount + 31) / 32;
+    size_t       first = 0;
+
+    // expand every pattern first, since the byte classes depend on all of them
+    for(size_t p = 0; p < pSelf->patternCount; ++p) {
+        GblPatternSetEntry_* pEntry = &pSelf->entries[p];
+        const size_t         count  = GblPatternSet_expand_(pEntry->pPattern, (uint32_t)p, &pAtoms[first]);
+        size_t               a      = 0;
+
+        // patterns which can match without consuming a character would match everywhere
+        while(pAtoms[first + a].flags & (GBL_PATTERN_ATOM_OPTIONAL_ | GBL_PATTERN_ATOM_EDGE_))
+            ++a;
+
+        GBL_CTX_VERIFY(!(pAtoms[first + a].flags & GBL_PATTERN_ATOM_ACCEPT_),
+                       GBL_RESULT_ERROR_INVALID_ARG,
+                       "Pattern matches an empty string: [%s]",
+                       GblPattern_string(pEntry->pPattern));
+
+        for(a = 0; a + 1 < count; ++a)
+            pReversed[first + a] = pAtoms[first + count - 2 - a];
+        pReversed[first + count - 1] = pAtoms[first + count - 1];
+
+        pEntry->first = first;
+        pEntry->begin = !!(pAtoms[first].flags & GBL_PATTERN_ATOM_EDGE_);
+        pEntry->end   = !!(pAtoms[first + count - 2].flags & GBL_PATTERN_ATOM_EDGE_);
+
+        first += count;
+    }
+
+    GblPatternSet_classify_(pSelf, pAtoms, atomCount);
+
+    memset(pRestart, 0, sizeof(uint32_t) * words);
+
+    // each pattern's own DFAs, plus where it starts within the combined one
+    for(size_t p = 0; p < pSelf->patternCount; ++p) {
+        GblPatternSetEntry_* pEntry = &pSelf->entries[p];
+        const size_t         count  = (p + 1 < pSelf->patternCount?
+                                           pSelf->entries[p + 1].first : atomCount) - pEntry->first;
+
+        first = pEntry->first;
+
+        memset(pStart, 0, sizeof(uint32_t) * words);
+        GblPatternSet_close_(&pAtoms[first], pStart, 0);
+        GBL_CTX_VERIFY_CALL(GblPatternSet_build_(pSelf, &pEntry->forward, &pAtoms[first],
+                                                 count, pStart, NULL, GBL_FALSE));
+
+        memset(pStart, 0, sizeof(uint32_t) * words);
+        GblPatternSet_close_(&pReversed[first], pStart, 0);
+        GBL_CTX_VERIFY_CALL(GblPatternSet_build_(pSelf, &pEntry->reverse, &pReversed[first],
+                                                 count, pStart, NULL, GBL_FALSE));
+
+        // only patterns without a leading '^' can start after the beginning
+        if(!pEntry->begin)
+            GblPatternSet_close_(pAtoms, pRestart, first);
+    }
+
+    memset(pStart, 0, sizeof(uint32_t) * words);
+
+    for(size_t p = 0, a = 0; p < pSelf->patternCount; ++p) {
+        GblPatternSet_close_(pAtoms, pStart, a);
+        while(!(pAtoms[a++].flags & GBL_PATTERN_ATOM_ACCEPT_));
+    }
+
+    GBL_CTX_VERIFY_CALL(GblPatternSet_build_(pSelf, &pSelf->scanner, pAtoms, atomCount,
+                                             pStart, pRestart, GBL_TRUE));
+
+    // most of a scan is spent waiting in the restart state, which can be skipped through without the DFA
+    const uint32_t restart = pSelf->scanner.restart & GBL_PATTERN_SET_STATE_MASK_;
+    size_t         escapes = 0;
+
+    for(unsigned b = 0; b < 256; ++b) {
+        const uint32_t next = pSelf->scanner.pNext[restart + pSelf->classes[b]];
+
+        pSelf->idle[b] = (next & (GBL_PATTERN_SET_ACCEPT_ | GBL_PATTERN_SET_STATE_MASK_)) == restart;
+
+        if(!pSelf->idle[b] && !escapes++)
+            pSelf->escape = (int16_t)b;
+    }
+
+    if(escapes != 1)
+        pSelf->escape = -1;
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblPatternSet_init_(GblPatternSet* pSelf, const char* const* ppRegExps, size_t count) {
+    GblPatternAtom_* pAtoms    = NULL;
+    GblPatternAtom_* pReversed = NULL;
+    uint32_t*        pStart    = NULL;
+    uint32_t*        pRestart  = NULL;
+    size_t           atoms     = 0;
+
+    GBL_CTX_BEGIN(NULL);
+
+    for(size_t p = 0; p < count; ++p) {
+        pSelf->entries[p].pPattern = GblPattern_create(ppRegExps[p]);
+
+        GBL_CTX_VERIFY(pSelf->entries[p].pPattern,
+                       GBL_RESULT_ERROR_INVALID_ARG,
+                       "Invalid pattern at index %zu",
+                       p);
+
+        ++pSelf->patternCount;
+        atoms += GblPatternSet_expand_(pSelf->entries[p].pPattern, (uint32_t)p, NULL);
+    }
+
+    GBL_CTX_VERIFY(atoms <= GBL_PATTERN_SET_POSITIONS_MAX_,
+                   GBL_RESULT_ERROR_OVERFLOW,
+                   "Patterns expand to more than %u positions",
+                   GBL_PATTERN_SET_POSITIONS_MAX_);
+
+    pAtoms    = GBL_CTX_MALLOC(sizeof(GblPatternAtom_) * atoms);
+    pReversed = GBL_CTX_MALLOC(sizeof(GblPatternAtom_) * atoms);
+    pStart    = GBL_CTX_MALLOC(sizeof(uint32_t) * ((atoms + 31) / 32));
+    pRestart  = GBL_CTX_MALLOC(sizeof(uint32_t) * ((atoms + 31) / 32));
+
+    GBL_CTX_CALL(GblPatternSet_compile_(pSelf, pAtoms, pReversed, atoms, pStart, pRestart));
+
+    GBL_CTX_FREE(pAtoms);
+    GBL_CTX_FREE(pReversed);
+    GBL_CTX_FREE(pStart);
+    GBL_CTX_FREE(pRestart);
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblPatternSet* GblPatternSet_create(const char* const* ppRegExps, size_t count) {
+    GblPatternSet* pSelf = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(ppRegExps);
+    GBL_CTX_VERIFY(count,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Cannot create an empty pattern set");
+
+    pSelf = GBL_CTX_MALLOC(sizeof(GblPatternSet) + sizeof(GblPatternSetEntry_) * count);
+    memset(pSelf, 0, sizeof(GblPatternSet) + sizeof(GblPatternSetEntry_) * count);
+    GBL_ATOMIC_INT16_INIT(pSelf->refCount, 1);
+
+    const GBL_RESULT result = GblPatternSet_init_(pSelf, ppRegExps, count);
+
+    // tearing down what was built clears the last error, so it's recorded again afterwards
+    if(!GBL_RESULT_SUCCESS(result)) {
+        GblPatternSet_destroy_(pSelf);
+        pSelf = NULL;
+    }
+
+    GBL_CTX_VERIFY(GBL_RESULT_SUCCESS(result),
+                   result,
+                   "Failed to compile pattern set");
+
+    GBL_CTX_END_BLOCK();
+    return pSelf;
+}
+
+GBL_EXPORT GblPatternSet* GblPatternSet_ref(const GblPatternSet* pSelf) {
+    if(pSelf)
+        GBL_ATOMIC_INT16_INC(((GblPatternSet*)pSelf)->refCount);
+
+    return (GblPatternSet*)pSelf;
+}
+
+GBL_EXPORT GblRefCount GblPatternSet_unref(const GblPatternSet* pSelf) {
+    GblRefCount refCount = 0;
+
+    if(pSelf && !(refCount = (GBL_ATOMIC_INT16_DEC(((GblPatternSet*)pSelf)->refCount) - 1)))
+        GblPatternSet_destroy_((GblPatternSet*)pSelf);
+
+    return refCount;
+}
+
+GBL_EXPORT GblRefCount GblPatternSet_refCount(const GblPatternSet* pSelf) {
+    return pSelf? GBL_ATOMIC_INT16_LOAD(((GblPatternSet*)pSelf)->refCount) : 0;
+}
+
+GBL_EXPORT size_t GblPatternSet_patternCount(const GblPatternSet* pSelf) {
+    return pSelf? pSelf->patternCount : 0;
+}
+
+GBL_EXPORT const GblPattern* GblPatternSet_pattern(const GblPatternSet* pSelf, size_t index) {
+    GblPattern* pPattern = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    GBL_CTX_VERIFY_POINTER(pSelf);
+    GBL_CTX_VERIFY(index < pSelf->patternCount,
+                   GBL_RESULT_ERROR_OUT_OF_RANGE);
+
+    pPattern = pSelf->entries[index].pPattern;
+
+    GBL_CTX_END_BLOCK();
+    return pPattern;
+}
+
+GBL_EXPORT size_t GblPatternSet_stateCount(const GblPatternSet* pSelf) {
+    return pSelf? pSelf->scanner.stateCount : 0;
+}
+
+// Returns the leftmost start of a match of the given pattern which ends at pEnd and doesn't begin before pLower
+static const char* GblPatternSet_start_(const GblPatternSet* pSelf,
+                                        size_t               pattern,
+                                        const char*          pBegin,
+                                        const char*          pLower,
+                                        const char*          pEnd)
+{
+    const GblPatternSetEntry_* pEntry = &pSelf->entries[pattern];
+    const uint32_t*            pNext  = pEntry->reverse.pNext;
+    const uint16_t             edge   = pSelf->classCount - 1;
+    uint32_t                   state  = pEntry->reverse.start;
+    const char*                pStart = pEnd;
+
+    // a trailing '$' means the match ends at the end of the input
+    if(pEntry->end)
+        state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + edge];
+
+    while(pEnd > pLower && !(state & GBL_PATTERN_SET_DEAD_)) {
+        state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + pSelf->classes[(uint8_t)*--pEnd]];
+
+        if(state & GBL_PATTERN_SET_ACCEPT_)
+            pStart = pEnd;
+    }
+
+    if(pEnd == pBegin && !(state & GBL_PATTERN_SET_DEAD_) &&
+       (pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + edge] & GBL_PATTERN_SET_ACCEPT_))
+        pStart = pBegin;
+
+    return pStart;
+}
+
+// Returns the end of the longest match of the given pattern beginning at pStart
+static const char* GblPatternSet_end_(const GblPatternSet* pSelf,
+                                      size_t               pattern,
+                                      const char*          pStart,
+                                      const char*          pLast)
+{
+    const GblPatternSetEntry_* pEntry = &pSelf->entries[pattern];
+    const uint32_t*            pNext  = pEntry->forward.pNext;
+    const uint16_t             edge   = pSelf->classCount - 1;
+    uint32_t                   state  = pEntry->forward.start;
+    const char*                pEnd   = pStart;
+
+    // a leading '^' means the match starts at the beginning of the input
+    if(pEntry->begin)
+        state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + edge];
+
+    while(pStart < pLast && !(state & GBL_PATTERN_SET_DEAD_)) {
+        state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + pSelf->classes[(uint8_t)*pStart++]];
+
+        if(state & GBL_PATTERN_SET_ACCEPT_)
+            pEnd = pStart;
+    }
+
+    if(pStart == pLast && !(state & GBL_PATTERN_SET_DEAD_) &&
+       (pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + edge] & GBL_PATTERN_SET_ACCEPT_))
+        pEnd = pLast;
+
+    return pEnd;
+}
+
+GBL_EXPORT size_t GblPatternSet_scan(const GblPatternSet* pSelf,
+                                     GblStringView        string,
+                                     GblPatternSetIterFn  pFnIter,
+                                     void*                pClosure)
+{
+    if(!pSelf || !string.length)
+        return 0;
+
+    const uint32_t* pNext  = pSelf->scanner.pNext;
+    const uint8_t*  pClass = pSelf->classes;
+    const uint8_t*  pIdle  = pSelf->idle;
+    const uint32_t  resume = pSelf->scanner.restart & GBL_PATTERN_SET_STATE_MASK_;
+    const uint16_t  edge   = pSelf->classCount - 1;
+    const char*     pBegin = string.pData;
+    const char*     pLast  = pBegin + string.length;
+    const char*     pLower = pBegin;   // where the next match can start
+    const char*     pIt    = pBegin;
+    size_t          count  = 0;
+
+    // enter through the beginning of the input, so patterns with a leading '^' can start
+    uint32_t state = pNext[(pSelf->scanner.start & GBL_PATTERN_SET_STATE_MASK_) + edge];
+
+    for(;;) {
+        while(!(state & GBL_PATTERN_SET_ACCEPT_) && pIt != pLast) {
+            if((state & GBL_PATTERN_SET_STATE_MASK_) == resume) {
+                if(pSelf->escape >= 0) {
+                    if(!(pIt = memchr(pIt, pSelf->escape, pLast - pIt)))
+                        pIt = pLast;
+                } else while(pIt != pLast && pIdle[(uint8_t)*pIt])
+                    ++pIt;
+
+                if(pIt == pLast)
+                    break;
+            }
+
+            state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + pClass[(uint8_t)*pIt++]];
+        }
+
+        // only patterns with a trailing '$' can match through the end of the input
+        if(!(state & GBL_PATTERN_SET_ACCEPT_) &&
+           !((state = pNext[(state & GBL_PATTERN_SET_STATE_MASK_) + edge]) & GBL_PATTERN_SET_ACCEPT_))
+            break;
+
+        // of every pattern ending here, take the one whose match starts first
+        const uint32_t  index   = (state & GBL_PATTERN_SET_STATE_MASK_) / pSelf->classCount;
+        const uint32_t* pAccept = &pSelf->scanner.pAcceptList[pSelf->scanner.pAccepts[index]];
+        const uint32_t* pDone   = &pSelf->scanner.pAcceptList[pSelf->scanner.pAccepts[index + 1]];
+        size_t          pattern = *pAccept;
+        const char*     pStart  = GblPatternSet_start_(pSelf, pattern, pBegin, pLower, pIt);
+
+        while(++pAccept != pDone) {
+            const char* pOther = GblPatternSet_start_(pSelf, *pAccept, pBegin, pLower, pIt);
+
+            if(pOther < pStart) {
+                pStart  = pOther;
+                pattern = *pAccept;
+            }
+        }
+
+        pIt = GblPatternSet_end_(pSelf, pattern, pStart, pLast);
+        ++count;
+
+        if(pFnIter && pFnIter(pSelf,
+                              pattern,
+                              GblStringView_fromStringSized(pStart, pIt - pStart),
+                              pClosure))
+            break;
+
+        if(pIt == pLast)
+            break;
+
+        pLower = pIt;
+        state  = pSelf->scanner.restart;
+    }
+
+    return count;
+}
+
+typedef struct GblPatternSetFind_ {
+    GblStringView match;
+    size_t        pattern;
+} GblPatternSetFind_;
+
+static GblBool GblPatternSet_findIter_(const GblPatternSet* pSelf,
+                                       size_t               pattern,
+                                       GblStringView        match,
+                                       void*                pClosure)
+{
+    GBL_UNUSED(pSelf);
+    GblPatternSetFind_* pFind = pClosure;
+
+    pFind->match   = match;
+    pFind->pattern = pattern;
+
+    return GBL_TRUE;
+}
+
+GBL_EXPORT GblBool (GblPatternSet_find)(const GblPatternSet* pSelf,
+                                        GblStringView        string,
+                                        GblStringView*       pMatch,
+                                        size_t*              pPattern)
+{
+    GblPatternSetFind_ find  = { 0 };
+    const GblBool      found = GblPatternSet_scan(pSelf, string, GblPatternSet_findIter_, &find) != 0;
+
+    if(pMatch)
+        *pMatch = find.match;
+    if(pPattern)
+        *pPattern = find.pattern;
+
+    return found;
+}
+
+GBL_EXPORT size_t GblPatternSet_matchCount(const GblPatternSet* pSelf, GblStringView string) {
+    return GblPatternSet_scan(pSelf, string, NULL, NULL);
+}
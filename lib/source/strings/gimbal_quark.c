@@ -1,19 +1,60 @@
 #include <gimbal/strings/gimbal_quark.h>
-#include <gimbal/containers/gimbal_hash_set.h>
 #include <gimbal/algorithms/gimbal_hash.h>
 #include <gimbal/allocators/gimbal_arena_allocator.h>
-#include <limits.h>
+#include <stdatomic.h>
 
 #include <tinycthread.h>
 
 #define GBL_QUARK_PAGE_SIZE_DEFAULT_            1024
 #define GBL_QUARK_REGISTRY_CAPACITY_DEFAULT_    64
+#define GBL_QUARK_REGISTRY_CAPACITY_MIN_        16
+#define GBL_QUARK_CACHE_SIZE_                   64      // entries in each thread's lookup cache, power of 2
 #define GBL_QUARK_ENSURE_INITIALIZED_()                         \
     GBL_STMT_START {                                            \
         if(!inittedOnce_) call_once(&initOnce_, gblQuarkInit_); \
         else if(!initialized_) gblQuarkInit_();                 \
     } GBL_STMT_END
 
+/* Lock-free registry of interned strings.
+
+   Open-addressed table of quarks which is only ever modified while
+   holding registryMtx_, so interning a new string is the only thing
+   which locks. Readers never do: each slot's hash and length are written
+   before its quark is published with a release store, and slots are never
+   removed, so a reader which finds a quark can trust what's beside it, and
+   only compares bytes once both match. Strings are looked up by pointer
+   and length, so substrings never have to be copied or terminated until
+   they're actually interned. When the table fills up, a new generation
+   is built and published with a single pointer store; previous
+   generations may still be in use by readers, so they are only reclaimed
+   when the registry is finalized. */
+typedef struct GblQuarkSlot_ {
+    _Atomic(GblQuark)      quark;
+    GblHash                hash;
+    size_t                 length;
+} GblQuarkSlot_;
+
+typedef struct GblQuarkTable_ {
+    struct GblQuarkTable_* pRetired;
+    size_t                 mask;
+    GblQuarkSlot_          slots[];
+} GblQuarkTable_;
+
+#if GBL_CONFIG_QUARK_CACHE_ENABLED
+/* Direct-mapped cache of each thread's recent lookups, in front of the
+   registry, which is dropped whenever the registry is finalized. */
+typedef struct GblQuarkCache_ {
+    unsigned generation;
+    struct {
+        GblHash  hash;
+        size_t   length;
+        GblQuark quark;
+    }        entries[GBL_QUARK_CACHE_SIZE_];
+} GblQuarkCache_;
+
+static GBL_THREAD_LOCAL GblQuarkCache_ cache_;
+#endif
+
 static struct {
     GblArenaAllocatorPage page;
     char                  staticBytes[GBL_QUARK_PAGE_SIZE_DEFAULT_-1];
@@ -24,38 +65,139 @@ static struct {
     }
 };
 
-static GblArenaAllocator arena_;
-static GblHashSet        registry_;
-static GblBool           initialized_    = GBL_FALSE;
-static GblBool           inittedOnce_    = GBL_FALSE;
-static once_flag         initOnce_       = ONCE_FLAG_INIT;
-static mtx_t             registryMtx_;
-
-static GblContext*       pCtx_           = NULL;
-static size_t            pageSize_       = GBL_QUARK_PAGE_SIZE_DEFAULT_;
-static size_t            registryCap_    = GBL_QUARK_REGISTRY_CAPACITY_DEFAULT_;
-
-static int registryComparator_(const GblHashSet* pSet, const char** pA, const char** pB) {
-    GBL_UNUSED(pSet);
-    if(!pA || !*pA) return INT_MIN;
-    else if(!pB || !*pB) return INT_MAX;
-    else return (strcmp(*pA, *pB) == 0);
+static GblArenaAllocator          arena_;
+static _Atomic(GblQuarkTable_*)   pRegistry_      = NULL;
+static atomic_size_t              registryCount_  = 0;
+static atomic_uint                generation_     = 1;
+static GblBool                    initialized_    = GBL_FALSE;
+static GblBool                    inittedOnce_    = GBL_FALSE;
+static once_flag                  initOnce_       = ONCE_FLAG_INIT;
+static mtx_t                      registryMtx_;
+
+static GblContext*                pCtx_           = NULL;
+static size_t                     pageSize_       = GBL_QUARK_PAGE_SIZE_DEFAULT_;
+static size_t                     registryCap_    = GBL_QUARK_REGISTRY_CAPACITY_DEFAULT_;
+
+static GblQuark GblQuark_probe_(const GblQuarkTable_* pTable,
+                               const char*           pString,
+                               size_t                length,
+                               GblHash               hash)
+{
+    if(pTable) {
+        for(size_t i = hash & pTable->mask; ; i = (i + 1) & pTable->mask) {
+            const GblQuark quark = atomic_load_explicit(&pTable->slots[i].quark, memory_order_acquire);
+
+            if(quark == GBL_QUARK_INVALID)
+                break;
+            else if(pTable->slots[i].hash   == hash   &&
+                    pTable->slots[i].length == length &&
+                    memcmp((const char*)quark, pString, length) == 0)
+                return quark;
+        }
+    }
+
+    return GBL_QUARK_INVALID;
 }
 
-static GblHash registryHasher_(const GblHashSet* pSet, const char** pStr) {
-    GBL_UNUSED(pSet);
-    return gblHash(*pStr, strlen(*pStr));
+static GblQuark GblQuark_find_(const char* pString, size_t length, GblHash hash) {
+#if GBL_CONFIG_QUARK_CACHE_ENABLED
+    const unsigned generation = atomic_load_explicit(&generation_, memory_order_acquire);
+    const size_t   entry      = hash & (GBL_QUARK_CACHE_SIZE_ - 1);
+
+    if(cache_.generation != generation) {
+        memset(&cache_, 0, sizeof(cache_));
+        cache_.generation = generation;
+    } else if(cache_.entries[entry].hash   == hash   &&
+              cache_.entries[entry].length == length &&
+              cache_.entries[entry].quark            &&
+              memcmp((const char*)cache_.entries[entry].quark, pString, length) == 0) {
+        return cache_.entries[entry].quark;
+    }
+#endif
+
+    const GblQuark quark = GblQuark_probe_(atomic_load_explicit(&pRegistry_, memory_order_acquire),
+                                           pString,
+                                           length,
+                                           hash);
+#if GBL_CONFIG_QUARK_CACHE_ENABLED
+    if(quark) {
+        cache_.entries[entry].hash   = hash;
+        cache_.entries[entry].length = length;
+        cache_.entries[entry].quark  = quark;
+    }
+#endif
+
+    return quark;
 }
 
-static const char* quarkStringAllocCopy_(const char* pString) {
-    char* pNewString = NULL;
-    GBL_ASSERT(pString);
+// Caller must hold registryMtx_
+static void GblQuark_place_(GblQuarkTable_* pTable, GblQuark quark, size_t length, GblHash hash) {
+    size_t i = hash & pTable->mask;
 
-    const size_t  size = strlen(pString) + 1;
-    pNewString = GblArenaAllocator_alloc(&arena_, size, 1);
-    if(pNewString) strcpy(pNewString, pString);
+    while(atomic_load_explicit(&pTable->slots[i].quark, memory_order_relaxed) != GBL_QUARK_INVALID)
+        i = (i + 1) & pTable->mask;
 
-    return pNewString;
+    pTable->slots[i].hash   = hash;
+    pTable->slots[i].length = length;
+    atomic_store_explicit(&pTable->slots[i].quark, quark, memory_order_release);
+}
+
+// Caller must hold registryMtx_, only copying the string into the arena if it's new and alloc is set
+static GblQuark GblQuark_insert_(const char* pString, size_t length, GblHash hash, GblBool alloc) {
+    GblQuark quark = GBL_QUARK_INVALID;
+
+    GBL_CTX_BEGIN(pCtx_);
+
+    GblQuarkTable_* pTable = atomic_load_explicit(&pRegistry_, memory_order_relaxed);
+    const size_t    count  = atomic_load_explicit(&registryCount_, memory_order_relaxed) + 1;
+
+    // another thread may have interned the same string since it was looked up
+    quark = GblQuark_probe_(pTable, pString, length, hash);
+    if(quark) GBL_CTX_DONE();
+
+    // Keep the load factor at or below 1/2
+    if(!pTable || count * 2 > pTable->mask + 1) {
+        size_t capacity = GBL_QUARK_REGISTRY_CAPACITY_MIN_;
+
+        while(capacity < count * 4 || capacity < registryCap_)
+            capacity <<= 1;
+
+        const size_t    bytes  = sizeof(GblQuarkTable_) + sizeof(GblQuarkSlot_) * capacity;
+        GblQuarkTable_* pGrown = GBL_CTX_MALLOC(gblAlignedAllocSizeDefault(bytes));
+
+        memset(pGrown, 0, bytes);
+        pGrown->mask     = capacity - 1;
+        pGrown->pRetired = pTable;
+
+        for(size_t s = 0; pTable && s <= pTable->mask; ++s) {
+            const GblQuark entry = atomic_load_explicit(&pTable->slots[s].quark, memory_order_relaxed);
+            if(entry)
+                GblQuark_place_(pGrown, entry, pTable->slots[s].length, pTable->slots[s].hash);
+        }
+
+        atomic_store_explicit(&pRegistry_, pGrown, memory_order_release);
+        pTable = pGrown;
+    }
+
+    if(alloc) {
+        char* pCopy = GblArenaAllocator_alloc(&arena_, length + 1, 1);
+
+        GBL_CTX_VERIFY(pCopy,
+                       GBL_RESULT_ERROR_MEM_ALLOC,
+                       "Failed to allocate interned string: [%.*s]",
+                       (int)length, pString);
+
+        memcpy(pCopy, pString, length);
+        pCopy[length] = '\0';
+        pString       = pCopy;
+    }
+
+    quark = (GblQuark)pString;
+    GblQuark_place_(pTable, quark, length, hash);
+    atomic_store_explicit(&registryCount_, count, memory_order_relaxed);
+
+    GBL_CTX_END_BLOCK();
+    return quark;
 }
 
 static void GblQuark_final_(void) {
@@ -70,13 +212,6 @@ static void gblQuarkInit_(void) {
     mtx_init(&registryMtx_, mtx_plain);
     mtx_lock(&registryMtx_);
     mtxLocked = GBL_TRUE;
-    GBL_CTX_CALL(GblHashSet_construct(&registry_,
-                                      sizeof(const char*),
-                                      (GblHashSetHashFn)registryHasher_,
-                                      (GblHashSetCmpFn)registryComparator_,
-                                      NULL,
-                                      registryCap_,
-                                      pCtx_));
 
     GBL_CTX_CALL(GblArenaAllocator_construct(&arena_,
                                              pageSize_,
@@ -91,33 +226,23 @@ static void gblQuarkInit_(void) {
     if(mtxLocked) mtx_unlock(&registryMtx_);
 }
 
-static  GblQuark quarkFromString_(const char* pString, GblBool alloc) {
-    GblQuark quark = 0;
-    if(pString) {
-        GBL_QUARK_ENSURE_INITIALIZED_();
-        quark = GblQuark_tryString(pString);
-        if(!quark) {
-            mtx_lock(&registryMtx_);
-            if(alloc) pString = quarkStringAllocCopy_(pString);
-            GBL_ASSERT(pString);
-            if(pString) {
-                GblBool inserted = GblHashSet_insert(&registry_, &pString);
-                mtx_unlock(&registryMtx_);
-                GBL_UNUSED(inserted);
-                GBL_ASSERT(inserted);
-            }
-            quark = (GblQuark)pString;
-        }
-    }
-    return quark;
+// A quark is a C string, so a sized string can't extend past an embedded terminator
+static size_t GblQuark_clampLength_(const char* pString, size_t length) {
+    const char* pEnd = memchr(pString, '\0', length);
+    return pEnd? (size_t)(pEnd - pString) : length;
 }
 
-static inline GblQuark* GblQuark_tryString_(const char* pString) {
-    GblQuark* pQuark  = NULL;
-    mtx_lock(&registryMtx_);
-    pQuark = (GblQuark*)GblHashSet_get(&registry_, &pString);
-    mtx_unlock(&registryMtx_);
-    return pQuark;
+static  GblQuark quarkFromString_(const char* pString, size_t length, GblBool alloc) {
+    GBL_QUARK_ENSURE_INITIALIZED_();
+    const GblHash hash  = gblHash(pString, length);
+    GblQuark      quark = GblQuark_find_(pString, length, hash);
+    if(!quark) {
+        mtx_lock(&registryMtx_);
+        quark = GblQuark_insert_(pString, length, hash, alloc);
+        mtx_unlock(&registryMtx_);
+        GBL_ASSERT(quark);
+    }
+    return quark;
 }
 
 GBL_EXPORT GBL_RESULT GblQuark_final(void) {
@@ -127,7 +252,17 @@ GBL_EXPORT GBL_RESULT GblQuark_final(void) {
     GBL_CTX_VERIFY_EXPRESSION(initialized_);
     mtx_lock(&registryMtx_);
     hasMutex = GBL_TRUE;
-    GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&registry_));
+
+    GblQuarkTable_* pTable = atomic_exchange(&pRegistry_, NULL);
+
+    while(pTable) {
+        GblQuarkTable_* pRetired = pTable->pRetired;
+        GBL_CTX_FREE(pTable);
+        pTable = pRetired;
+    }
+
+    atomic_store(&registryCount_, 0);
+    atomic_fetch_add(&generation_, 1);
 
     GBL_CTX_VERIFY_CALL(GblArenaAllocator_destruct(&arena_));
 
@@ -218,7 +353,7 @@ GBL_EXPORT float GblQuark_utilization(void) {
 GBL_EXPORT size_t  GblQuark_count(void) {
     size_t  count = 0;
     if(initialized_) {
-        count = GblHashSet_size(&registry_);
+        count = atomic_load_explicit(&registryCount_, memory_order_relaxed);
     }
     return count;
 }
@@ -230,11 +365,8 @@ GBL_EXPORT GblContext* GblQuark_context(void) {
 GBL_EXPORT GblQuark GblQuark_tryStringSized(const char* pString, size_t  length) {
     GblQuark quark = GBL_QUARK_INVALID;
     if(initialized_ && pString && length) {
-        char* pCString = GBL_ALLOCA(length + 1);
-        strncpy(pCString, pString, length);
-        pCString[length] = '\0';
-        GblQuark* pQuark = GblQuark_tryString_(pCString);
-        if(pQuark) quark = *pQuark;
+        length = GblQuark_clampLength_(pString, length);
+        quark  = GblQuark_find_(pString, length, gblHash(pString, length));
     }
     return quark;
 }
@@ -242,29 +374,26 @@ GBL_EXPORT GblQuark GblQuark_tryStringSized(const char* pString, size_t  length)
 GBL_EXPORT GblQuark GblQuark_tryString(const char* pString) {
     GblQuark quark = GBL_QUARK_INVALID;
     if(initialized_ && pString) {
-        GblQuark* pQuark = GblQuark_tryString_(pString);
-        if(pQuark) quark = *pQuark;
+        const size_t length = strlen(pString);
+        quark = GblQuark_find_(pString, length, gblHash(pString, length));
     }
     return quark;
 }
 
 GBL_EXPORT GblQuark GblQuark_fromString(const char* pString) {
-    return quarkFromString_(pString, GBL_TRUE);
+    return pString? quarkFromString_(pString, strlen(pString), GBL_TRUE) : GBL_QUARK_INVALID;
 }
 
 GBL_EXPORT GblQuark GblQuark_fromStringSized(const char* pString, size_t  length) {
     GblQuark quark = GBL_QUARK_INVALID;
     if(pString && length) { //maybe we're interning an empty string!?
-        char* pCString = GBL_ALLOCA(length + 1);
-        strncpy(pCString, pString, length);
-        pCString[length] = '\0';
-        quark = GblQuark_fromString(pCString);
+        quark = quarkFromString_(pString, GblQuark_clampLength_(pString, length), GBL_TRUE);
     }
     return quark;
 }
 
 GBL_EXPORT GblQuark GblQuark_fromStringStatic(const char* pString) {
-    return quarkFromString_(pString, GBL_FALSE);
+    return pString? quarkFromString_(pString, strlen(pString), GBL_FALSE) : GBL_QUARK_INVALID;
 }
 
 GBL_EXPORT const char* GblQuark_toString(GblQuark quark) {
@@ -415,7 +415,7 @@ GBL_EXPORT GblStringList* GblStringList_createFilter(const GblStringList* pOther
                                                      const char*          pPattern) {
     GblStringList* pList = GblStringList_createEmpty();
 
-    const GblPattern* pCompiled = GblPattern_compile(pPattern);
+    GblPattern*    pCompiled = GblPattern_create(pPattern);
 
     for(GblStringList* pNode = pOther->ringNode.pNext;
         pNode != pOther;
@@ -426,6 +426,7 @@ GBL_EXPORT GblStringList* GblStringList_createFilter(const GblStringList* pOther
         }
     }
 
+    GblPattern_unref(pCompiled);
     return pList;
 }
 
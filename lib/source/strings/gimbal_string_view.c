@@ -4,91 +4,707 @@
 #include <errno.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
+#include <float.h>
 
-#define GblStringView_toInt_(postfix, type, min, max, func, tempType) \
-    GBL_EXPORT type GblStringView_to##postfix(GblStringView self, GblBool* pSuccess) { \
-        type        result      = 0; \
-        GblBool     valid       = GBL_TRUE; \
-        char*       pEnd        = NULL; \
-        const char* pCString    = GBL_STRING_VIEW_CSTR(self); \
+#include "gimbal_string_view_.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define GBL_STRING_VIEW_SSE2_
+#   include <emmintrin.h>
+#endif
+
+#define GBL_STRING_VIEW_BLOCK_SIZE_     16  // # of candidate positions filtered at once
+
+/* Substring searches are bounded by the length of the view, so they
+   never need a NULL-terminated copy of either string. Candidates are
+   filtered by comparing the first and last characters of the needle
+   against a whole block of positions at once, and only the positions
+   where both match are compared in full. */
+
+// Index of the highest set bit of a non-zero mask
+GBL_INLINE unsigned GblStringView_maskLast_(uint32_t mask) {
+#if defined(__clang__) || defined(__GNUC__)
+    return 31 - (unsigned)__builtin_clz(mask);
+#else
+    unsigned idx = 0;
+    while(mask >>= 1) ++idx;
+    return idx;
+#endif
+}
+
+#ifdef GBL_STRING_VIEW_SSE2_
+// Bitmask of the positions within the block at "pHay" where both the first and last characters match
+GBL_INLINE uint32_t GblStringView_blockMatch_(const char* pHay, size_t lastOffset, __m128i first, __m128i last) {
+    const __m128i firstBlock = _mm_loadu_si128((const __m128i*)pHay);
+    const __m128i lastBlock  = _mm_loadu_si128((const __m128i*)(pHay + lastOffset));
+    return (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firstBlock, first),
+                                                     _mm_cmpeq_epi8(lastBlock, last)));
+}
+#endif
+
+// Returns the position of the first occurrence of the needle within the haystack, or GBL_STRING_VIEW_NPOS
+static size_t GblStringView_search_(const char* pHay, size_t hayLength, const char* pNeedle, size_t needleLength) {
+    if(needleLength > hayLength)
+        return GBL_STRING_VIEW_NPOS;
+
+    if(needleLength == 1) {
+        const char* pFound = memchr(pHay, pNeedle[0], hayLength);
+        return pFound? (size_t)(pFound - pHay) : GBL_STRING_VIEW_NPOS;
+    }
+
+    const size_t candidates = hayLength - needleLength + 1;
+    const size_t last       = needleLength - 1;
+    size_t       pos        = 0;
+
+#ifdef GBL_STRING_VIEW_SSE2_
+    const __m128i first  = _mm_set1_epi8(pNeedle[0]);
+    const __m128i lastCh = _mm_set1_epi8(pNeedle[last]);
+
+    for(; pos + GBL_STRING_VIEW_BLOCK_SIZE_ <= candidates; pos += GBL_STRING_VIEW_BLOCK_SIZE_) {
+        uint32_t mask = GblStringView_blockMatch_(pHay + pos, last, first, lastCh);
+
+        while(mask) {
+            const size_t bit = GBL_BITMASK_CTZ(mask);
+            if(memcmp(pHay + pos + bit + 1, pNeedle + 1, needleLength - 2) == 0)
+                return pos + bit;
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    // skip between occurrences of the first character for whatever remains
+    while(pos < candidates) {
+        const char* pFound = memchr(pHay + pos, pNeedle[0], candidates - pos);
+        if(!pFound) break;
+
+        pos = (size_t)(pFound - pHay);
+        if(pHay[pos + last] == pNeedle[last] &&
+           memcmp(pHay + pos + 1, pNeedle + 1, needleLength - 2) == 0)
+            return pos;
+        ++pos;
+    }
+
+    return GBL_STRING_VIEW_NPOS;
+}
+
+// Returns the position of the last occurrence of the needle within the haystack, or GBL_STRING_VIEW_NPOS
+static size_t GblStringView_searchReverse_(const char* pHay, size_t hayLength, const char* pNeedle, size_t needleLength) {
+    if(needleLength > hayLength)
+        return GBL_STRING_VIEW_NPOS;
+
+    const size_t last = needleLength - 1;
+    size_t       end  = hayLength - needleLength + 1;    // one past the last candidate
+
+#ifdef GBL_STRING_VIEW_SSE2_
+    const __m128i first  = _mm_set1_epi8(pNeedle[0]);
+    const __m128i lastCh = _mm_set1_epi8(pNeedle[last]);
+
+    for(; end >= GBL_STRING_VIEW_BLOCK_SIZE_; end -= GBL_STRING_VIEW_BLOCK_SIZE_) {
+        const size_t pos  = end - GBL_STRING_VIEW_BLOCK_SIZE_;
+        uint32_t     mask = GblStringView_blockMatch_(pHay + pos, last, first, lastCh);
+
+        while(mask) {
+            const size_t bit = GblStringView_maskLast_(mask);
+            if(memcmp(pHay + pos + bit, pNeedle, needleLength) == 0)
+                return pos + bit;
+            mask &= ~(1u << bit);
+        }
+    }
+#endif
+
+    while(end) {
+        --end;
+        if(pHay[end] == pNeedle[0] &&
+           pHay[end + last] == pNeedle[last] &&
+           memcmp(pHay + end, pNeedle, needleLength) == 0)
+            return end;
+    }
+
+    return GBL_STRING_VIEW_NPOS;
+}
+
+/* Character classes for the *Of() family are a 256-bit lookup table
+   with one bit per byte value, so each byte of the view is classified
+   with a single lookup, regardless of how many characters are given. */
+typedef struct GblStringViewCharSet_ {
+    uint32_t bits[8];
+} GblStringViewCharSet_;
+
+GBL_INLINE void GblStringView_charSetInit_(GblStringViewCharSet_* pSet, GblStringView chars) {
+    memset(pSet, 0, sizeof(GblStringViewCharSet_));
+    for(size_t c = 0; c < chars.length; ++c) {
+        const uint8_t byte = (uint8_t)chars.pData[c];
+        pSet->bits[byte >> 5] |= 1u << (byte & 31);
+    }
+}
+
+GBL_INLINE GblBool GblStringView_charSetHas_(const GblStringViewCharSet_* pSet, char value) {
+    const uint8_t byte = (uint8_t)value;
+    return (pSet->bits[byte >> 5] >> (byte & 31)) & 1;
+}
+
+#ifdef GBL_STRING_VIEW_SSE2_
+#   define GBL_STRING_VIEW_SSE2_SET_MAX_    16  // largest character set compared directly, rather than looked up
+
+// Bitmask of the positions within the block at "pData" whose membership within the set equals "in"
+GBL_INLINE uint32_t GblStringView_blockMatchSet_(const char* pData, const __m128i* pChars, size_t count, GblBool in) {
+    const __m128i block = _mm_loadu_si128((const __m128i*)pData);
+    __m128i       match = _mm_cmpeq_epi8(block, pChars[0]);
+
+    for(size_t c = 1; c < count; ++c)
+        match = _mm_or_si128(match, _mm_cmpeq_epi8(block, pChars[c]));
+
+    const uint32_t mask = (uint32_t)_mm_movemask_epi8(match);
+    return in? mask : ~mask & 0xffff;
+}
+#endif
+
+// Returns the first position in [begin, end) whose membership within the set equals "in"
+static size_t GblStringView_scanSet_(const char* pData, size_t begin, size_t end, GblStringView chars, GblBool in) {
+    if(chars.length == 1 && in) {
+        const char* pFound = memchr(pData + begin, chars.pData[0], end - begin);
+        return pFound? (size_t)(pFound - pData) : GBL_STRING_VIEW_NPOS;
+    }
+
+#ifdef GBL_STRING_VIEW_SSE2_
+    if(chars.length && chars.length <= GBL_STRING_VIEW_SSE2_SET_MAX_) {
+        __m128i vChars[GBL_STRING_VIEW_SSE2_SET_MAX_];
+        for(size_t c = 0; c < chars.length; ++c)
+            vChars[c] = _mm_set1_epi8(chars.pData[c]);
+
+        for(; begin + GBL_STRING_VIEW_BLOCK_SIZE_ <= end; begin += GBL_STRING_VIEW_BLOCK_SIZE_) {
+            const uint32_t mask = GblStringView_blockMatchSet_(pData + begin, vChars, chars.length, in);
+            if(mask) return begin + GBL_BITMASK_CTZ(mask);
+        }
+    }
+#endif
+
+    GblStringViewCharSet_ set;
+    GblStringView_charSetInit_(&set, chars);
+
+    for(size_t i = begin; i < end; ++i)
+        if(GblStringView_charSetHas_(&set, pData[i]) == in)
+            return i;
+
+    return GBL_STRING_VIEW_NPOS;
+}
+
+// Returns the last position in [0, end) whose membership within the set equals "in"
+static size_t GblStringView_scanSetReverse_(const char* pData, size_t end, GblStringView chars, GblBool in) {
+#ifdef GBL_STRING_VIEW_SSE2_
+    if(chars.length && chars.length <= GBL_STRING_VIEW_SSE2_SET_MAX_) {
+        __m128i vChars[GBL_STRING_VIEW_SSE2_SET_MAX_];
+        for(size_t c = 0; c < chars.length; ++c)
+            vChars[c] = _mm_set1_epi8(chars.pData[c]);
+
+        for(; end >= GBL_STRING_VIEW_BLOCK_SIZE_; end -= GBL_STRING_VIEW_BLOCK_SIZE_) {
+            const uint32_t mask = GblStringView_blockMatchSet_(pData + end - GBL_STRING_VIEW_BLOCK_SIZE_,
+                                                               vChars, chars.length, in);
+            if(mask) return end - GBL_STRING_VIEW_BLOCK_SIZE_ + GblStringView_maskLast_(mask);
+        }
+    }
+#endif
+
+    GblStringViewCharSet_ set;
+    GblStringView_charSetInit_(&set, chars);
+
+    for(size_t i = end; i > 0; --i)
+        if(GblStringView_charSetHas_(&set, pData[i - 1]) == in)
+            return i - 1;
+
+    return GBL_STRING_VIEW_NPOS;
+}
+
+/* Numbers are parsed directly out of the view, without copying it into a
+   NULL-terminated buffer or depending on the current locale. Runs of 8
+   decimal digits are converted at once as a single 64-bit word, and
+   floating-point values are rounded correctly using Clinger's fast path
+   when it's exact, or otherwise the Eisel-Lemire algorithm. Anything
+   those don't cover (hexadecimal floats, infinities and NaNs, more than
+   19 significant digits, or results which underflow or overflow) is
+   still handed off to strtod() or strtof(), so that the edge cases are
+   resolved exactly as they were before. */
+
+#if GBL_BIG_ENDIAN == 0
+#   define GBL_STRING_VIEW_SWAR_
+#endif
+
+#define GBL_STRING_VIEW_NUMBER_BUFFER_SIZE_ 64  // largest fallback copy made on the stack without alloca()
+
+typedef enum GBL_STRING_VIEW_PARSE_ {
+    GBL_STRING_VIEW_PARSE_OK_,          // decimal number which the fast path can convert
+    GBL_STRING_VIEW_PARSE_INVALID_,     // not a number, or has trailing characters
+    GBL_STRING_VIEW_PARSE_FALLBACK_     // valid syntax which only strtod() handles
+} GBL_STRING_VIEW_PARSE_;
+
+typedef struct GblStringViewDecimal_ {
+    uint64_t mantissa;  // up to 19 significant decimal digits
+    int64_t  exponent;  // power of ten the mantissa is scaled by
+    GblBool  negative;
+} GblStringViewDecimal_;
+
+typedef struct GblStringViewFloatFormat_ {
+    int      mantissaBits;      // explicitly stored bits of the mantissa
+    int      minExponent;       // exponent bias, negated
+    int      infinitePower;     // biased exponent of infinity
+    int      minPow10;          // smallest power of ten which doesn't round down to zero
+    int      maxPow10;          // largest power of ten which doesn't round up to infinity
+    int      minRoundToEven;    // range of powers of ten whose products can land exactly halfway
+    int      maxRoundToEven;
+} GblStringViewFloatFormat_;
+
+static const GblStringViewFloatFormat_ GblStringView_doubleFormat_ = { 52, -1023, 0x7ff, -342, 308, -4, 23 };
+static const GblStringViewFloatFormat_ GblStringView_floatFormat_  = { 23, -127,  0xff,  -65,  38,  -17, 10 };
+
+static const double GblStringView_pow10d_[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const float GblStringView_pow10f_[] = {
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+GBL_INLINE GblBool GblStringView_isSpace_(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+GBL_INLINE GblBool GblStringView_isDigit_(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+// Returns the value of a hexadecimal digit, or 16 if it isn't one
+GBL_INLINE unsigned GblStringView_hexDigit_(char c) {
+    if(GblStringView_isDigit_(c))
+        return (unsigned)(c - '0');
+
+    c |= 0x20;
+    return ((unsigned char)(c - 'a') < 6)? (unsigned)(c - 'a' + 10) : 16;
+}
+
+#ifdef GBL_STRING_VIEW_SWAR_
+// Loads 8 characters as a little-endian word, returning whether they're all decimal digits
+GBL_INLINE GblBool GblStringView_load8Digits_(const char* pData, uint64_t* pWord) {
+    uint64_t word;
+    memcpy(&word, pData, sizeof(word));
+    *pWord = word;
+    return (((word & 0xf0f0f0f0f0f0f0f0ull) |
+            (((word + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4))
+            == 0x3333333333333333ull);
+}
+
+// Converts a word of 8 decimal digits into its value, combining pairs of digits in parallel
+GBL_INLINE uint32_t GblStringView_parse8Digits_(uint64_t word) {
+    const uint64_t mask = 0x000000ff000000ffull;
+    const uint64_t mul1 = 100 + (1000000ull << 32);
+    const uint64_t mul2 = 1 + (10000ull << 32);
+
+    word -= 0x3030303030303030ull;
+    word  = (word * 10) + (word >> 8);
+    return (uint32_t)((((word & mask) * mul1) + (((word >> 16) & mask) * mul2)) >> 32);
+}
+#endif
+
+// Accumulates decimal digits onto *pValue (wrapping on overflow), returning where they end
+static const char* GblStringView_parseDigits_(const char* pIt, const char* pEnd, uint64_t* pValue) {
+    uint64_t value = *pValue;
+
+#ifdef GBL_STRING_VIEW_SWAR_
+    uint64_t word;
+    while(pEnd - pIt >= 8 && GblStringView_load8Digits_(pIt, &word)) {
+        value = value * 100000000 + GblStringView_parse8Digits_(word);
+        pIt += 8;
+    }
+#endif
+
+    while(pIt != pEnd && GblStringView_isDigit_(*pIt)) {
+        value = value * 10 + (uint64_t)(*pIt - '0');
+        ++pIt;
+    }
+
+    *pValue = value;
+    return pIt;
+}
+
+// Parses a power-of-two radix, which must make up the rest of the view and not overflow
+static GblBool GblStringView_parseRadix_(const char* pIt, const char* pEnd, unsigned bits, uint64_t* pValue) {
+    uint64_t value = 0;
+
+    if(pIt == pEnd)
+        return GBL_FALSE;
+
+    do {
+        const unsigned digit = GblStringView_hexDigit_(*pIt);
+
+        if((digit >> bits) || (value >> (64 - bits)))
+            return GBL_FALSE;
+
+        value = (value << bits) | digit;
+    } while(++pIt != pEnd);
+
+    *pValue = value;
+    return GBL_TRUE;
+}
+
+/* Parses an integer the way strtol() does with a base of 0: leading
+   whitespace, then an optional sign, then a decimal, "0x" hexadecimal, or
+   leading-zero octal magnitude, which has to make up the rest of the view.
+   An empty view is also accepted as 0, as it always has been. */
+static GblBool GblStringView_parseInt_(GblStringView self, uint64_t* pMagnitude, GblBool* pNegative) {
+    const char* pIt  = self.pData;
+    const char* pEnd = pIt + self.length;
+
+    *pMagnitude = 0;
+    *pNegative  = GBL_FALSE;
+
+    if(!self.length)
+        return GBL_TRUE;
+
+    while(pIt != pEnd && GblStringView_isSpace_(*pIt))
+        ++pIt;
+
+    if(pIt != pEnd && (*pIt == '-' || *pIt == '+'))
+        *pNegative = (*pIt++ == '-');
+
+    if(pIt == pEnd)
+        return GBL_FALSE;
+
+    if(*pIt == '0' && pEnd - pIt > 1)
+        return ((pIt[1] | 0x20) == 'x')?
+                    GblStringView_parseRadix_(pIt + 2, pEnd, 4, pMagnitude) :
+                    GblStringView_parseRadix_(pIt + 1, pEnd, 3, pMagnitude);
+
+    // 19 digits can't overflow, so only a 20th needs to be checked
+    const char* pDigits = pIt;
+    const char* pLimit  = (pEnd - pIt > 19)? pIt + 19 : pEnd;
+    uint64_t    value   = 0;
+
+    pIt = GblStringView_parseDigits_(pIt, pLimit, &value);
+
+    if(pIt == pDigits)
+        return GBL_FALSE;
+
+    if(pIt != pEnd) {
+        const unsigned digit = (unsigned)(unsigned char)(*pIt - '0');
+
+        if(digit >= 10 || pIt + 1 != pEnd || value > (UINT64_MAX - digit) / 10)
+            return GBL_FALSE;
+
+        value = value * 10 + digit;
+    }
+
+    *pMagnitude = value;
+    return GBL_TRUE;
+}
+
+// Splits a decimal floating-point number into its significant digits and power of ten
+static GBL_STRING_VIEW_PARSE_ GblStringView_parseDecimal_(GblStringView self, GblStringViewDecimal_* pDecimal) {
+    const char* pIt      = self.pData;
+    const char* pEnd     = pIt + self.length;
+    uint64_t    mantissa = 0;
+    int64_t     exponent = 0;
+
+    while(pIt != pEnd && GblStringView_isSpace_(*pIt))
+        ++pIt;
+
+    pDecimal->negative = GBL_FALSE;
+    if(pIt != pEnd && (*pIt == '-' || *pIt == '+'))
+        pDecimal->negative = (*pIt++ == '-');
+
+    const char* pDigits = pIt;
+    pIt = GblStringView_parseDigits_(pIt, pEnd, &mantissa);
+    int64_t digitCount = pIt - pDigits;
+
+    if(pIt != pEnd && *pIt == '.') {
+        const char* pFraction = ++pIt;
+        pIt = GblStringView_parseDigits_(pIt, pEnd, &mantissa);
+        exponent    = pFraction - pIt;
+        digitCount -= exponent;
+    }
+
+    if(pIt != pEnd) {
+        // Hexadecimal, "inf", "infinity", and "nan" are left to strtod()
+        if((digitCount == 1 && *pDigits == '0' && pIt == pDigits + 1 && (*pIt | 0x20) == 'x') ||
+           (!digitCount && pIt == pDigits && ((*pIt | 0x20) == 'i' || (*pIt | 0x20) == 'n')))
+            return GBL_STRING_VIEW_PARSE_FALLBACK_;
+    }
+
+    if(!digitCount)
+        return GBL_STRING_VIEW_PARSE_INVALID_;
+
+    if(pIt != pEnd && (*pIt | 0x20) == 'e') {
+        GblBool negative = GBL_FALSE;
+        int64_t exp10    = 0;
+
+        if(++pIt != pEnd && (*pIt == '-' || *pIt == '+'))
+            negative = (*pIt++ == '-');
+
+        if(pIt == pEnd || !GblStringView_isDigit_(*pIt))
+            return GBL_STRING_VIEW_PARSE_INVALID_;
+
+        do {
+            if(exp10 < 0x10000)     // saturate, it's out of range either way
+                exp10 = exp10 * 10 + (*pIt - '0');
+        } while(++pIt != pEnd && GblStringView_isDigit_(*pIt));
+
+        exponent += negative? -exp10 : exp10;
+    }
+
+    if(pIt != pEnd)
+        return GBL_STRING_VIEW_PARSE_INVALID_;
+
+    // Leading zeroes aren't significant, but anything past 19 digits is lost
+    if(digitCount > 19) {
+        for(const char* pZero = pDigits; pZero != pEnd && (*pZero == '0' || *pZero == '.'); ++pZero)
+            if(*pZero == '0') --digitCount;
+
+        if(digitCount > 19)
+            return GBL_STRING_VIEW_PARSE_FALLBACK_;
+    }
+
+    pDecimal->mantissa = mantissa;
+    pDecimal->exponent = exponent;
+    return GBL_STRING_VIEW_PARSE_OK_;
+}
+
+GBL_INLINE uint64_t GblStringView_mul128_(uint64_t a, uint64_t b, uint64_t* pHigh) {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 product = (unsigned __int128)a * b;
+    *pHigh = (uint64_t)(product >> 64);
+    return (uint64_t)product;
+#else
+    const uint64_t aLo = (uint32_t)a, aHi = a >> 32;
+    const uint64_t bLo = (uint32_t)b, bHi = b >> 32;
+    const uint64_t ll  = aLo * bLo,  lh  = aLo * bHi;
+    const uint64_t hl  = aHi * bLo,  hh  = aHi * bHi;
+    const uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *pHigh = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (uint32_t)ll;
+#endif
+}
+
+GBL_INLINE int GblStringView_clz64_(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    while(!(value & 0x8000000000000000ull)) {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/* Eisel-Lemire: multiplies the normalized mantissa by a 128-bit
+   approximation of the power of five, which determines every bit needed
+   to round correctly, including halfway cases. Returns GBL_FALSE for
+   results which aren't normal, finite values, which are left to
+   strtod() so that it reports them as range errors. */
+static GblBool GblStringView_eiselLemire_(const GblStringViewDecimal_*     pDecimal,
+                                          const GblStringViewFloatFormat_* pFormat,
+                                          uint64_t*                        pBits)
+{
+    const int64_t q = pDecimal->exponent;
+
+    if(q < pFormat->minPow10 || q > pFormat->maxPow10)
+        return GBL_FALSE;
+
+    const int      lz    = GblStringView_clz64_(pDecimal->mantissa);
+    const uint64_t w     = pDecimal->mantissa << lz;
+    const uint64_t* pPow = GblStringView_pow5_[q - GBL_STRING_VIEW_POW5_MIN_];
+    const uint64_t mask  = UINT64_MAX >> (pFormat->mantissaBits + 3);
+    uint64_t       high;
+    uint64_t       low   = GblStringView_mul128_(w, pPow[0], &high);
+
+    // Only the truncated low bits of the power are unknown, refine if they could matter
+    if((high & mask) == mask) {
+        uint64_t high2;
+        GblStringView_mul128_(w, pPow[1], &high2);
+        low += high2;
+        if(high2 > low) ++high;
+    }
+
+    const int upperBit = (int)(high >> 63);
+    const int shift    = upperBit + 64 - pFormat->mantissaBits - 3;
+    uint64_t  mantissa = high >> shift;
+    int64_t   power2   = ((((int64_t)152170 + 65536) * q) >> 16) + 63 +
+                         upperBit - lz - pFormat->minExponent;
+
+    if(power2 <= 0)
+        return GBL_FALSE;
+
+    // Exactly halfway between two values, round to even rather than up
+    if(low <= 1 && q >= pFormat->minRoundToEven && q <= pFormat->maxRoundToEven &&
+       (mantissa & 3) == 1 && (mantissa << shift) == high)
+        mantissa &= ~(uint64_t)1;
+
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+
+    if(mantissa >= ((uint64_t)2 << pFormat->mantissaBits)) {
+        mantissa = (uint64_t)1 << pFormat->mantissaBits;
+        ++power2;
+    }
+
+    if(power2 >= pFormat->infinitePower)
+        return GBL_FALSE;
+
+    mantissa &= ~((uint64_t)1 << pFormat->mantissaBits);
+    *pBits = mantissa | ((uint64_t)power2 << pFormat->mantissaBits);
+    return GBL_TRUE;
+}
+
+#define GblStringView_strtoFloat_(type, func) \
+    static type GblStringView_##func##_(GblStringView self, GblBool* pValid) { \
+        char        buffer[GBL_STRING_VIEW_NUMBER_BUFFER_SIZE_]; \
+        char*       pEnd     = NULL; \
+        const char* pCString = self.nullTerminated?                  self.pData : \
+                               self.length < sizeof(buffer)?         GblStringView_toCString(self, buffer, sizeof(buffer)) : \
+                                                                     GBL_STRING_VIEW_CSTR_ALLOCA(self); \
      \
         errno = 0; \
-        tempType retVal = func(pCString, &pEnd, 0); \
+        type retVal = func(pCString, &pEnd); \
+     \
+        if(pEnd != pCString + self.length) { \
+            *pValid = GBL_FALSE; \
+            return 0; \
+        } \
+     \
+        *pValid = (errno == 0); \
+        return retVal; \
+    }
+
+GblStringView_strtoFloat_(float, strtof)
+GblStringView_strtoFloat_(double, strtod)
+
+#define GblStringView_toInt_(postfix, type, min, max) \
+    GBL_EXPORT type GblStringView_to##postfix(GblStringView self, GblBool* pSuccess) { \
+        uint64_t magnitude; \
+        GblBool  negative; \
+        GblBool  valid = GblStringView_parseInt_(self, &magnitude, &negative); \
      \
-        if(pEnd != pCString + self.length || retVal > max || retVal < min || errno != 0) { \
-            result = 0; \
-            valid = GBL_FALSE; \
-        } else result = retVal; \
+        /* Magnitude of min, computed without overflowing */ \
+        if(valid) valid = negative? magnitude <= (uint64_t)-((min) + 1) + 1u : \
+                                    magnitude <= (uint64_t)(max); \
      \
         if(pSuccess) \
             *pSuccess = valid; \
      \
-        return result; \
+        if(!valid) return 0; \
+        return negative? (type)(0 - magnitude) : (type)magnitude; \
     }
 
-GblStringView_toInt_(Uint8, uint8_t, 0, UINT8_MAX, strtoul, unsigned long)
-GblStringView_toInt_(Int8, int8_t, INT8_MIN, INT8_MAX, strtol, long)
-GblStringView_toInt_(Uint16, uint16_t, 0, UINT16_MAX, strtoul, unsigned long)
-GblStringView_toInt_(Int16, int16_t, INT16_MIN, INT16_MAX, strtol, long)
-GblStringView_toInt_(Uint32, uint32_t, 0, UINT32_MAX, strtoul, unsigned long)
-GblStringView_toInt_(Int32, int32_t, INT32_MIN, INT32_MAX, strtol, long)
-GblStringView_toInt_(Uint64, uint64_t, 0, UINT64_MAX, strtoul, unsigned long)
-GblStringView_toInt_(Int64, int64_t, INT64_MIN, INT64_MAX, strtol, long)
+GblStringView_toInt_(Uint8, uint8_t, 0, UINT8_MAX)
+GblStringView_toInt_(Int8, int8_t, INT8_MIN, INT8_MAX)
+GblStringView_toInt_(Uint16, uint16_t, 0, UINT16_MAX)
+GblStringView_toInt_(Int16, int16_t, INT16_MIN, INT16_MAX)
+GblStringView_toInt_(Uint32, uint32_t, 0, UINT32_MAX)
+GblStringView_toInt_(Int32, int32_t, INT32_MIN, INT32_MAX)
+GblStringView_toInt_(Uint64, uint64_t, 0, UINT64_MAX)
+GblStringView_toInt_(Int64, int64_t, INT64_MIN, INT64_MAX)
 
 GBL_EXPORT float GblStringView_toFloat(GblStringView self, GblBool* pSuccess) {
-    float       retVal      = 0.0f;
-    GblBool     valid       = GBL_TRUE;
-    char*       pEnd        = NULL;
-    const char* pCString    = GBL_STRING_VIEW_CSTR(self);
+    GblStringViewDecimal_ decimal;
+    GblBool               valid  = GBL_TRUE;
+    float                 retVal = 0.0f;
+    uint64_t              bits;
 
-    errno = 0;
-    retVal = strtof(pCString, &pEnd);
-
-    if(pEnd != pCString + self.length) {
-        retVal = 0.0f;
+    if(!self.length) {
+        // strtof() consumes the empty string as 0
+    } else switch(GblStringView_parseDecimal_(self, &decimal)) {
+    case GBL_STRING_VIEW_PARSE_INVALID_:
         valid = GBL_FALSE;
+        break;
+    case GBL_STRING_VIEW_PARSE_OK_:
+        if(!decimal.mantissa) {
+            retVal = decimal.negative? -0.0f : 0.0f;
+            break;
+        }
+#if FLT_EVAL_METHOD == 0
+        if(decimal.mantissa <= (1u << 24) && decimal.exponent >= -10 && decimal.exponent <= 10) {
+            retVal = (float)decimal.mantissa;
+            retVal = (decimal.exponent < 0)? retVal / GblStringView_pow10f_[-decimal.exponent] :
+                                             retVal * GblStringView_pow10f_[decimal.exponent];
+            if(decimal.negative) retVal = -retVal;
+            break;
+        }
+#endif
+        if(GblStringView_eiselLemire_(&decimal, &GblStringView_floatFormat_, &bits)) {
+            const uint32_t bits32 = (uint32_t)bits | ((uint32_t)decimal.negative << 31);
+            memcpy(&retVal, &bits32, sizeof(retVal));
+            break;
+        }
+        retVal = GblStringView_strtof_(self, &valid);
+        break;
+    case GBL_STRING_VIEW_PARSE_FALLBACK_:
+        retVal = GblStringView_strtof_(self, &valid);
+        break;
     }
 
     if(pSuccess)
-        *pSuccess = !!(valid && errno == 0);
+        *pSuccess = valid;
 
     return retVal;
 }
 
 GBL_EXPORT double GblStringView_toDouble(GblStringView self, GblBool* pSuccess) {
-    double      retVal      = 0.0;
-    GblBool     valid       = GBL_TRUE;
-    char*       pEnd        = NULL;
-    const char* pCString    = GBL_STRING_VIEW_CSTR(self);
+    GblStringViewDecimal_ decimal;
+    GblBool               valid  = GBL_TRUE;
+    double                retVal = 0.0;
+    uint64_t              bits;
 
-    errno = 0;
-    retVal = strtod(pCString, &pEnd);
-
-    if(pEnd != pCString + self.length) {
-        retVal = 0.0;
+    if(!self.length) {
+        // strtod() consumes the empty string as 0
+    } else switch(GblStringView_parseDecimal_(self, &decimal)) {
+    case GBL_STRING_VIEW_PARSE_INVALID_:
         valid = GBL_FALSE;
+        break;
+    case GBL_STRING_VIEW_PARSE_OK_:
+        if(!decimal.mantissa) {
+            retVal = decimal.negative? -0.0 : 0.0;
+            break;
+        }
+#if FLT_EVAL_METHOD == 0
+        if(decimal.mantissa <= (1ull << 53) && decimal.exponent >= -22 && decimal.exponent <= 22) {
+            retVal = (double)decimal.mantissa;
+            retVal = (decimal.exponent < 0)? retVal / GblStringView_pow10d_[-decimal.exponent] :
+                                             retVal * GblStringView_pow10d_[decimal.exponent];
+            if(decimal.negative) retVal = -retVal;
+            break;
+        }
+#endif
+        if(GblStringView_eiselLemire_(&decimal, &GblStringView_doubleFormat_, &bits)) {
+            bits |= (uint64_t)decimal.negative << 63;
+            memcpy(&retVal, &bits, sizeof(retVal));
+            break;
+        }
+        retVal = GblStringView_strtod_(self, &valid);
+        break;
+    case GBL_STRING_VIEW_PARSE_FALLBACK_:
+        retVal = GblStringView_strtod_(self, &valid);
+        break;
     }
 
     if(pSuccess)
-        *pSuccess = !!(valid && errno == 0);
+        *pSuccess = valid;
 
     return retVal;
 }
 
 GBL_EXPORT GblBool GblStringView_toNil(GblStringView self) {
-    const char* pCStr = GBL_STRING_VIEW_CSTR(self);
     if(!self.length ||
-       gblStrnCaseCmp(pCStr, "nil", sizeof("nil")) == 0 ||
-       gblStrnCaseCmp(pCStr, "null", sizeof("null")) == 0) {
+       (self.length == 3 && gblStrnCaseCmp(self.pData, "nil", 3) == 0) ||
+       (self.length == 4 && gblStrnCaseCmp(self.pData, "null", 4) == 0)) {
         return GBL_TRUE;
     }
     return GBL_FALSE;
 }
 
 GBL_EXPORT GblBool GblStringView_toBool(GblStringView self, GblBool* pSuccess) {
-    const char* pCStr = GBL_STRING_VIEW_CSTR(self);
-    if(gblStrnCaseCmp(pCStr, "true", sizeof("true")) == 0 ||
-       gblStrnCaseCmp(pCStr, "yes",  sizeof("yes"))  == 0) {
+    if((self.length == 4 && gblStrnCaseCmp(self.pData, "true", 4) == 0) ||
+       (self.length == 3 && gblStrnCaseCmp(self.pData, "yes",  3) == 0)) {
         return GBL_TRUE;
     } else {
         return (GblStringView_toUint32(self, pSuccess) != 0)?
@@ -97,15 +713,16 @@ GBL_EXPORT GblBool GblStringView_toBool(GblStringView self, GblBool* pSuccess) {
 }
 
 GBL_EXPORT void* GblStringView_toPointer(GblStringView self, GblBool* pSuccess) {
-    const char* pCStr = GBL_STRING_VIEW_CSTR(self);
-    unsigned int tempUint = 0;
+    uint64_t value = 0;
 
-    const GblBool success = !!(sscanf(pCStr, "0x%x", &tempUint) == 1);
+    const GblBool success = self.length > 2 && self.pData[0] == '0' && (self.pData[1] | 0x20) == 'x' &&
+                            GblStringView_parseRadix_(self.pData + 2, self.pData + self.length, 4, &value) &&
+                            value <= UINTPTR_MAX;
 
     if(pSuccess)
         *pSuccess = success;
 
-    return (void*)(uintptr_t)tempUint;
+    return success? (void*)(uintptr_t)value : NULL;
 }
 
 GBL_EXPORT char* GblStringView_strdup(GblStringView self) {
@@ -135,19 +752,7 @@ GBL_EXPORT size_t  GblStringView_findLastNotOf(GblStringView self, GblStringView
     if(end == GBL_STRING_VIEW_NPOS) end = self.length - 1;
     GBL_CTX_VERIFY(end < self.length,
                    GBL_RESULT_ERROR_OUT_OF_RANGE);
-    for(size_t i = end + 1; i >= 1; --i) {
-        GblBool found = GBL_FALSE;
-        for(size_t c = 0; c < chars.length; ++c) {
-            if(self.pData[i - 1] == chars.pData[c]) {
-                found = GBL_TRUE;
-                break;
-            }
-        }
-        if(!found) {
-            pos = i - 1;
-            break;
-        }
-    }
+    pos = GblStringView_scanSetReverse_(self.pData, end + 1, chars, GBL_FALSE);
     GBL_CTX_END_BLOCK();
     return pos;
 }
@@ -195,21 +800,9 @@ GBL_EXPORT size_t GblStringView_findFirstNotOf(GblStringView self, GblStringView
     GBL_CTX_VERIFY(offset < self.length || (!self.length && !offset),
                    GBL_RESULT_ERROR_OUT_OF_RANGE);
     if(!chars.length) {
-        pos = 0;
+        pos = offset;
     } else {
-        for(size_t i = 0; i < self.length; ++i) {
-            GblBool found = GBL_FALSE;
-            for(size_t c = 0; c < chars.length; ++c) {
-                if(self.pData[i] == chars.pData[c]) {
-                    found = GBL_TRUE;
-                    break;
-                }
-            }
-            if(!found) {
-                pos = i;
-                break;
-            }
-        }
+        pos = GblStringView_scanSet_(self.pData, offset, self.length, chars, GBL_FALSE);
     }
     GBL_CTX_END_BLOCK();
     return pos;
@@ -296,70 +889,58 @@ GBL_EXPORT GblBool GblStringView_contains(GblStringView self, GblStringView subs
     if(!self.length && !substr.length) {
         result = GBL_TRUE;
     } else if(self.length && substr.length) {
-        const char* pCStr1 = GBL_STRING_VIEW_CSTR(self);
-        const char* pCStr2 = GBL_STRING_VIEW_CSTR(substr);
-        result = (strstr(pCStr1, pCStr2) != GBL_NULL);
+        result = GblStringView_search_(self.pData, self.length,
+                                       substr.pData, substr.length) != GBL_STRING_VIEW_NPOS;
     }
     return result;
 }
 
 GBL_EXPORT size_t  GblStringView_count(GblStringView self, GblStringView substr) {
-    size_t  count = 0;
+    size_t  count  = 0;
     size_t  offset = 0;
-    while((offset = GblStringView_find(self, substr, offset)) != GBL_STRING_VIEW_NPOS) {
+    size_t  pos    = 0;
+
+    if(!substr.length) return 0;
+
+    while(offset < self.length &&
+          (pos = GblStringView_search_(self.pData + offset, self.length - offset,
+                                       substr.pData, substr.length)) != GBL_STRING_VIEW_NPOS)
+    {
         ++count;
-        offset += substr.length;
-        if(offset >= self.length) break;
+        offset += pos + substr.length;
     }
+
     return count;
 }
 
 GBL_EXPORT size_t  GblStringView_find(GblStringView self, GblStringView substr, size_t  offset) {
     size_t  pos = GBL_STRING_VIEW_NPOS;
-    GBL_CTX_BEGIN(NULL);
-    if(!self.length && !offset) GBL_CTX_DONE();
-    GBL_CTX_VERIFY(offset < self.length,
-                   GBL_RESULT_ERROR_OUT_OF_RANGE);
+    GBL_CTX_LEAF_BEGIN();
+    if(!self.length && !offset) GBL_CTX_LEAF_DONE();
+    GBL_CTX_LEAF_VERIFY(offset < self.length,
+                        GBL_RESULT_ERROR_OUT_OF_RANGE);
     if(self.length && substr.length) {
-        const char* pCStr1  = GBL_STRING_VIEW_CSTR(self);
-        const char* pCStr2  = GBL_STRING_VIEW_CSTR(substr);
-        const char* pSubstr = strstr(pCStr1+offset, pCStr2);
-        if(pSubstr) {
-            pos = (size_t )(pSubstr - pCStr1);
-        }
+        pos = GblStringView_search_(self.pData + offset, self.length - offset,
+                                    substr.pData, substr.length);
+        if(pos != GBL_STRING_VIEW_NPOS) pos += offset;
     }
-    GBL_CTX_END_BLOCK();
+    GBL_CTX_LEAF_END_BLOCK();
     return pos;
 }
 
 GBL_EXPORT size_t  GblStringView_rfind(GblStringView self, GblStringView substr, size_t  end) {
     size_t  pos = GBL_STRING_VIEW_NPOS;
-    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_LEAF_BEGIN();
     if(!self.length && end == GBL_STRING_VIEW_NPOS)
-        GBL_CTX_DONE();
+        GBL_CTX_LEAF_DONE();
     if(end == GBL_STRING_VIEW_NPOS) end = self.length-1;
-    GBL_CTX_VERIFY(end < self.length,
-                   GBL_RESULT_ERROR_OUT_OF_RANGE);
+    GBL_CTX_LEAF_VERIFY(end < self.length,
+                        GBL_RESULT_ERROR_OUT_OF_RANGE);
     if(self.length && substr.length) {
-        char* pCStr1 = (char*)GBL_ALLOCA(end + 2);
-        char* pCStr2 = (char*)GBL_ALLOCA(substr.length + 1);
-
-        for(size_t  i = end+1; i > 0; --i) {
-            pCStr1[i-1] = self.pData[end+1 - i];
-        }
-        pCStr1[end+1] = '\0';
-
-        for(size_t  i = substr.length; i > 0; --i) {
-            pCStr2[i-1] = substr.pData[substr.length - i];
-        }
-        pCStr2[substr.length] = '\0';
-
-        const char* pSubstr = strstr(pCStr1, pCStr2);
-        if(pSubstr) {
-            pos = end-(size_t )(pSubstr - pCStr1)-(substr.length-1);
-        }
+        pos = GblStringView_searchReverse_(self.pData, end + 1,
+                                           substr.pData, substr.length);
     }
-    GBL_CTX_END_BLOCK();
+    GBL_CTX_LEAF_END_BLOCK();
     return pos;
 }
 
@@ -388,14 +969,8 @@ GBL_EXPORT size_t GblStringView_findFirstOf(GblStringView self, GblStringView ch
     GBL_CTX_BEGIN(GBL_NULL);
     GBL_CTX_VERIFY(offset < self.length || (!self.length && !offset),
                    GBL_RESULT_ERROR_OUT_OF_RANGE);
-    for(size_t i = offset; i < self.length; ++i) {
-        for(size_t c = 0; c < chars.length; ++c) {
-            if(self.pData[i] == chars.pData[c]) {
-                pos = i;
-                GBL_CTX_DONE();
-            }
-        }
-    }
+    if(chars.length)
+        pos = GblStringView_scanSet_(self.pData, offset, self.length, chars, GBL_TRUE);
     GBL_CTX_END_BLOCK();
     return pos;
 }
@@ -409,14 +984,8 @@ GBL_EXPORT size_t GblStringView_findLastOf(GblStringView self, GblStringView cha
     if(end == GBL_STRING_VIEW_NPOS) end = self.length - 1;
     GBL_CTX_VERIFY(end < self.length,
                    GBL_RESULT_ERROR_OUT_OF_RANGE);
-    for(size_t i = end + 1; i >= 1; --i) {
-        for(size_t c = 0; c < chars.length; ++c) {
-            if(self.pData[i - 1] == chars.pData[c]) {
-                pos = i - 1;
-                GBL_CTX_DONE();
-            }
-        }
-    }
+    if(chars.length)
+        pos = GblStringView_scanSetReverse_(self.pData, end + 1, chars, GBL_TRUE);
     GBL_CTX_END_BLOCK();
     return pos;
 }
@@ -502,15 +1071,15 @@ GBL_EXPORT GblBool GblStringView_blank(GblStringView self) {
 }
 
 GBL_EXPORT GblQuark GblStringView_quark(GblStringView self) {
-    return GblQuark_fromString(GBL_STRING_VIEW_CSTR(self));
+    return self.length? GblQuark_fromStringSized(self.pData, self.length) : GblQuark_fromString("");
 }
 
 GBL_EXPORT GblQuark GblStringView_quarkTry(GblStringView self) {
-    return GblQuark_tryString(GBL_STRING_VIEW_CSTR(self));
+    return self.length? GblQuark_tryStringSized(self.pData, self.length) : GblQuark_tryString("");
 }
 
 GBL_EXPORT const char* GblStringView_intern(GblStringView self) {
-    return GblQuark_internString(GBL_STRING_VIEW_CSTR(self));
+    return self.length? GblQuark_internStringSized(self.pData, self.length) : GblQuark_internString("");
 }
 
 GBL_EXPORT GblHash GblStringView_hash(GblStringView self) {
@@ -3,11 +3,13 @@
 #include <gimbal/utils/gimbal_timer.h>
 #include <gimbal/allocators/gimbal_allocation_tracker.h>
 #include <time.h>
+#include <tinycthread.h>
 
 #define GBL_TEST_SCENARIO_(inst)    (GBL_PRIVATE(GblTestScenario, inst))
 
 typedef struct GblTestScenario_ {
     GblAllocationTracker*   pAllocTracker;
+    mtx_t                   allocMtx;   // test cases may allocate from multiple threads
     GblTestSuite*           pCurSuite;
     const char*             pCurCase;
     double                  suiteMs;
@@ -316,8 +318,11 @@ static GBL_RESULT GblTestScenarioClass_IAllocator_alloc_(GblIAllocator* pIAlloca
     GblContextClass* pCtxClass = GBL_CONTEXT_CLASS(GblClass_weakRefDefault(GBL_CONTEXT_TYPE));
     GblTestScenario* pSelf = (GblTestScenario*)pIAllocator;
     GblTestScenario_* pSelf_ = GBL_TEST_SCENARIO_(pSelf);
-    GBL_CTX_VERIFY_CALL(pCtxClass->GblIAllocatorImpl.pFnAlloc(pIAllocator, pFrame, size, align, pDbgStr, ppData));
-    GBL_CTX_VERIFY_CALL(GblAllocationTracker_allocEvent(pSelf_->pAllocTracker, *ppData, size, align, pDbgStr, pFrame->record.srcLocation));
+    mtx_lock(&pSelf_->allocMtx);
+    GBL_CTX_CALL(pCtxClass->GblIAllocatorImpl.pFnAlloc(pIAllocator, pFrame, size, align, pDbgStr, ppData));
+    if(GBL_RESULT_SUCCESS(GBL_CTX_RESULT()))
+        GBL_CTX_CALL(GblAllocationTracker_allocEvent(pSelf_->pAllocTracker, *ppData, size, align, pDbgStr, pFrame->record.srcLocation));
+    mtx_unlock(&pSelf_->allocMtx);
     GBL_CTX_END();
 }
 
@@ -327,8 +332,11 @@ static GBL_RESULT GblTestScenarioClass_IAllocator_realloc_(GblIAllocator* pIAllo
     GblContextClass* pCtxClass = GBL_CONTEXT_CLASS(GblClass_weakRefDefault(GBL_CONTEXT_TYPE));
     GblTestScenario* pSelf = (GblTestScenario*)pIAllocator;
     GblTestScenario_* pSelf_ = GBL_TEST_SCENARIO_(pSelf);
-    GBL_CTX_VERIFY_CALL(pCtxClass->GblIAllocatorImpl.pFnRealloc(pIAllocator, pFrame, pData, newSize, newAlign, ppNewData));
-    GBL_CTX_VERIFY_CALL(GblAllocationTracker_reallocEvent(pSelf_->pAllocTracker, pData, *ppNewData, newSize, newAlign, pFrame->record.srcLocation));
+    mtx_lock(&pSelf_->allocMtx);
+    GBL_CTX_CALL(pCtxClass->GblIAllocatorImpl.pFnRealloc(pIAllocator, pFrame, pData, newSize, newAlign, ppNewData));
+    if(GBL_RESULT_SUCCESS(GBL_CTX_RESULT()))
+        GBL_CTX_CALL(GblAllocationTracker_reallocEvent(pSelf_->pAllocTracker, pData, *ppNewData, newSize, newAlign, pFrame->record.srcLocation));
+    mtx_unlock(&pSelf_->allocMtx);
     GBL_CTX_END();
 }
 
@@ -338,8 +346,11 @@ static GBL_RESULT GblTestScenarioClass_IAllocator_free_(GblIAllocator* pIAllocat
     GblContextClass* pCtxClass = GBL_CONTEXT_CLASS(GblClass_weakRefDefault(GBL_CONTEXT_TYPE));
     GblTestScenario* pSelf = (GblTestScenario*)pIAllocator;
     GblTestScenario_* pSelf_ = GBL_TEST_SCENARIO_(pSelf);
-    GBL_CTX_VERIFY_CALL(pCtxClass->GblIAllocatorImpl.pFnFree(pIAllocator, pFrame, pData));
-    GBL_CTX_VERIFY_CALL(GblAllocationTracker_freeEvent(pSelf_->pAllocTracker, pData, pFrame->record.srcLocation));
+    mtx_lock(&pSelf_->allocMtx);
+    GBL_CTX_CALL(pCtxClass->GblIAllocatorImpl.pFnFree(pIAllocator, pFrame, pData));
+    if(GBL_RESULT_SUCCESS(GBL_CTX_RESULT()))
+        GBL_CTX_CALL(GblAllocationTracker_freeEvent(pSelf_->pAllocTracker, pData, pFrame->record.srcLocation));
+    mtx_unlock(&pSelf_->allocMtx);
     GBL_CTX_END();
 }
 
@@ -353,6 +364,7 @@ static GBL_RESULT GblTestScenarioClass_constructor_(GblObject* pObject) {
 
     GblContext* pParentCtx      = GblContext_parentContext(GBL_CONTEXT(pObject));
     pSelf_->pAllocTracker       = GblAllocationTracker_create(pParentCtx);
+    mtx_init(&pSelf_->allocMtx, mtx_recursive);
 
     GBL_CTX_END();
 }
@@ -364,6 +376,7 @@ static GBL_RESULT GblTestScenarioClass_destructor_(GblBox* pRecord) {
     GblTestScenario_*   pSelf_  = GBL_TEST_SCENARIO_(pSelf);
 
     GBL_CTX_VERIFY_CALL(GblAllocationTracker_destroy(pSelf_->pAllocTracker));
+    mtx_destroy(&pSelf_->allocMtx);
 
     GblContextClass* pCtxClass = GBL_CONTEXT_CLASS(GblClass_weakRefDefault(GBL_CONTEXT_TYPE));
     GBL_CTX_VERIFY_CALL(pCtxClass->base.base.pFnDestructor(pRecord));
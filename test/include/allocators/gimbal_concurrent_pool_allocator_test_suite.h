@@ -0,0 +1,21 @@
+#ifndef GIMBAL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_H
+#define GIMBAL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_H
+
+#include <gimbal/test/gimbal_test_suite.h>
+
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_TYPE             (GBL_TYPEID(GblConcurrentPoolAllocatorTestSuite))
+
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE(inst)            (GBL_CAST(inst, GblConcurrentPoolAllocatorTestSuite))
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_CLASS(klass)     (GBL_CLASS_CAST(klass, GblConcurrentPoolAllocatorTestSuite))
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_GET_CLASS(inst)  (GBL_CLASSOF(inst, GblConcurrentPoolAllocatorTestSuite))
+
+GBL_DECLS_BEGIN
+
+GBL_CLASS_DERIVE_EMPTY   (GblConcurrentPoolAllocatorTestSuite, GblTestSuite)
+GBL_INSTANCE_DERIVE_EMPTY(GblConcurrentPoolAllocatorTestSuite, GblTestSuite)
+
+GBL_EXPORT GblType GblConcurrentPoolAllocatorTestSuite_type(void) GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#endif // GIMBAL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_H
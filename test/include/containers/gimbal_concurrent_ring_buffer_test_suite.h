@@ -0,0 +1,22 @@
+#ifndef GIMBAL_CONCURRENT_RING_BUFFER_TEST_SUITE_H
+#define GIMBAL_CONCURRENT_RING_BUFFER_TEST_SUITE_H
+
+#include <gimbal/test/gimbal_test_suite.h>
+
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_TYPE             (GblConcurrentRingBufferTestSuite_type())
+
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE(inst)            (GBL_CAST(inst, GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_TYPE, GblConcurrentRingBufferTestSuite))
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_CLASS(klass)     (GBL_CLASS_CAST(klass, GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_TYPE, GblConcurrentRingBufferTestSuiteClass))
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_GET_CLASS(inst)  (GBL_INSTANCE_GET_CLASS_CAST(inst, GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_TYPE, GblConcurrentRingBufferTestSuiteClass))
+
+GBL_DECLS_BEGIN
+
+GBL_CLASS_DERIVE_EMPTY(GblConcurrentRingBufferTestSuite, GblTestSuite)
+
+GBL_INSTANCE_DERIVE_EMPTY(GblConcurrentRingBufferTestSuite, GblTestSuite)
+
+GBL_EXPORT GblType GblConcurrentRingBufferTestSuite_type(void) GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#endif // GIMBAL_CONCURRENT_RING_BUFFER_TEST_SUITE_H
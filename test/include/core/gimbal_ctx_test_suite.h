@@ -0,0 +1,22 @@
+#ifndef GIMBAL_CTX_TEST_SUITE_H
+#define GIMBAL_CTX_TEST_SUITE_H
+
+#include <gimbal/test/gimbal_test_suite.h>
+
+#define GBL_CTX_TEST_SUITE_TYPE             (GBL_TYPEID(GblCtxTestSuite))
+
+#define GBL_CTX_TEST_SUITE(inst)            (GBL_CAST(inst, GBL_CTX_TEST_SUITE_TYPE, GblCtxTestSuite))
+#define GBL_CTX_TEST_SUITE_CLASS(klass)     (GBL_CLASS_CAST(klass, GBL_CTX_TEST_SUITE_TYPE, GblCtxTestSuiteClass))
+#define GBL_CTX_TEST_SUITE_GET_CLASS(inst)  (GBL_INSTANCE_GET_CLASS_CAST(inst, GBL_CTX_TEST_SUITE_TYPE, GblCtxTestSuiteClass))
+
+GBL_DECLS_BEGIN
+
+GBL_CLASS_DERIVE_EMPTY(GblCtxTestSuite, GblTestSuite)
+
+GBL_INSTANCE_DERIVE_EMPTY(GblCtxTestSuite, GblTestSuite)
+
+GBL_EXPORT GblType GblCtxTestSuite_type(void) GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#endif // GIMBAL_CTX_TEST_SUITE_H
@@ -0,0 +1,22 @@
+#ifndef GIMBAL_MAIN_LOOP_TEST_SUITE_H
+#define GIMBAL_MAIN_LOOP_TEST_SUITE_H
+
+#include <gimbal/test/gimbal_test_suite.h>
+
+#define GBL_MAIN_LOOP_TEST_SUITE_TYPE             (GblMainLoopTestSuite_type())
+
+#define GBL_MAIN_LOOP_TEST_SUITE(inst)            (GBL_CAST(inst, GBL_MAIN_LOOP_TEST_SUITE_TYPE, GblMainLoopTestSuite))
+#define GBL_MAIN_LOOP_TEST_SUITE_CLASS(klass)     (GBL_CLASS_CAST(klass, GBL_MAIN_LOOP_TEST_SUITE_TYPE, GblMainLoopTestSuiteClass))
+#define GBL_MAIN_LOOP_TEST_SUITE_GET_CLASS(inst)  (GBL_INSTANCE_GET_CLASS_CAST(inst, GBL_MAIN_LOOP_TEST_SUITE_TYPE, GblMainLoopTestSuiteClass))
+
+GBL_DECLS_BEGIN
+
+GBL_CLASS_DERIVE_EMPTY(GblMainLoopTestSuite, GblTestSuite)
+
+GBL_INSTANCE_DERIVE_EMPTY(GblMainLoopTestSuite, GblTestSuite)
+
+GBL_EXPORT GblType GblMainLoopTestSuite_type(void) GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#endif // GIMBAL_MAIN_LOOP_TEST_SUITE_H
@@ -0,0 +1,22 @@
+#ifndef GIMBAL_PATTERN_SET_TEST_SUITE_H
+#define GIMBAL_PATTERN_SET_TEST_SUITE_H
+
+#include <gimbal/test/gimbal_test_suite.h>
+
+#define GBL_PATTERN_SET_TEST_SUITE_TYPE             (GblPatternSetTestSuite_type())
+
+#define GBL_PATTERN_SET_TEST_SUITE(inst)            (GBL_CAST(inst, GBL_PATTERN_SET_TEST_SUITE_TYPE, GblPatternSetTestSuite))
+#define GBL_PATTERN_SET_TEST_SUITE_CLASS(klass)     (GBL_CLASS_CAST(klass, GBL_PATTERN_SET_TEST_SUITE_TYPE, GblPatternSetTestSuiteClass))
+#define GBL_PATTERN_SET_TEST_SUITE_GET_CLASS(inst)  (GBL_INSTANCE_GET_CLASS_CAST(inst, GBL_PATTERN_SET_TEST_SUITE_TYPE, GblPatternSetTestSuiteClass))
+
+GBL_DECLS_BEGIN
+
+GBL_CLASS_DERIVE_EMPTY(GblPatternSetTestSuite, GblTestSuite)
+
+GBL_INSTANCE_DERIVE_EMPTY(GblPatternSetTestSuite, GblTestSuite)
+
+GBL_EXPORT GblType GblPatternSetTestSuite_type(void) GBL_NOEXCEPT;
+
+GBL_DECLS_END
+
+#endif // GIMBAL_PATTERN_SET_TEST_SUITE_H
@@ -1,6 +1,7 @@
 #include "algorithms/gimbal_sort_test_suite.h"
 #include <gimbal/algorithms/gimbal_sort.h>
 #include <gimbal/test/gimbal_test_macros.h>
+#include <math.h>
 
 #define GBL_SORT_TEST_SUITE_(inst)   (GBL_PRIVATE(GblSortTestSuite, inst))
 
@@ -8,6 +9,18 @@
 #define GBL_SORT_TEST_SUITE_WORD_SIZE_MAX_  50
 #define GBL_SORT_TEST_SUITE_WORD_SIZE_MIN_  20
 #define GBL_SORT_TEST_SUITE_WORD_CHARS_     NULL
+#define GBL_SORT_TEST_SUITE_RECORD_COUNT_   3000
+#define GBL_SORT_TEST_SUITE_RECORD_KEYS_    20
+
+// Input orderings which the sorts are each run over
+typedef enum GBL_SORT_TEST_SUITE_ORDER_ {
+    GBL_SORT_TEST_SUITE_ORDER_RANDOM_,
+    GBL_SORT_TEST_SUITE_ORDER_SORTED_,
+    GBL_SORT_TEST_SUITE_ORDER_REVERSED_,
+    GBL_SORT_TEST_SUITE_ORDER_FEW_UNIQUE_,
+    GBL_SORT_TEST_SUITE_ORDER_ORGAN_PIPE_,
+    GBL_SORT_TEST_SUITE_ORDER_COUNT_
+} GBL_SORT_TEST_SUITE_ORDER_;
 
 typedef struct GblSortTestSuite_ {
     char words[GBL_SORT_TEST_SUITE_WORD_COUNT_][GBL_SORT_TEST_SUITE_WORD_SIZE_MAX_+1];
@@ -27,6 +40,112 @@ static int GblSortTestSuite_comparator_(const void* p1, const void* p2) {
     return strcmp((const char*)p1, (const char*)p2);
 }
 
+static GBL_RESULT GblSortTestSuite_verifyWords_(GblTestSuite* pSelf) {
+    GBL_CTX_BEGIN(pSelf);
+    GblSortTestSuite_* pSelf_ = GBL_SORT_TEST_SUITE_(pSelf);
+
+    for(size_t w = 1; w < GBL_SORT_TEST_SUITE_WORD_COUNT_; ++w)
+        GBL_TEST_VERIFY(strcmp(pSelf_->words[w - 1], pSelf_->words[w]) <= 0);
+
+    GBL_CTX_END();
+}
+
+/* Records are a uint32_t key, followed by their original position
+   when there's room, for checking stability, then padding. */
+static void GblSortTestSuite_fillRecords_(char*                      pRecords,
+                                          size_t                     count,
+                                          size_t                     width,
+                                          GBL_SORT_TEST_SUITE_ORDER_ order)
+{
+    for(uint32_t r = 0; r < count; ++r) {
+        uint32_t key = 0;
+
+        switch(order) {
+        case GBL_SORT_TEST_SUITE_ORDER_RANDOM_:     key = (uint32_t)gblRand();                     break;
+        case GBL_SORT_TEST_SUITE_ORDER_SORTED_:     key = r;                                       break;
+        case GBL_SORT_TEST_SUITE_ORDER_REVERSED_:   key = (uint32_t)count - r;                     break;
+        case GBL_SORT_TEST_SUITE_ORDER_FEW_UNIQUE_: key = (uint32_t)gblRand() % GBL_SORT_TEST_SUITE_RECORD_KEYS_; break;
+        case GBL_SORT_TEST_SUITE_ORDER_ORGAN_PIPE_: key = r < count / 2? r : (uint32_t)count - r;  break;
+        default: break;
+        }
+
+        memset(pRecords + r * width, 0xcd, width);
+        memcpy(pRecords + r * width, &key, sizeof(key));
+
+        if(width >= sizeof(uint32_t) * 2)
+            memcpy(pRecords + r * width + sizeof(uint32_t), &r, sizeof(r));
+    }
+}
+
+static GBL_RESULT GblSortTestSuite_verifyRecords_(GblTestSuite* pSelf,
+                                                  const char*   pRecords,
+                                                  size_t        count,
+                                                  size_t        width,
+                                                  GblBool       stable)
+{
+    GBL_CTX_BEGIN(pSelf);
+
+    for(size_t r = 1; r < count; ++r) {
+        uint32_t prevKey, key;
+
+        memcpy(&prevKey, pRecords + (r - 1) * width, sizeof(prevKey));
+        memcpy(&key,     pRecords + r * width,       sizeof(key));
+
+        GBL_TEST_VERIFY(prevKey <= key);
+
+        if(stable && prevKey == key && width >= sizeof(uint32_t) * 2) {
+            uint32_t prevPos, pos;
+
+            memcpy(&prevPos, pRecords + (r - 1) * width + sizeof(uint32_t), sizeof(prevPos));
+            memcpy(&pos,     pRecords + r * width + sizeof(uint32_t),       sizeof(pos));
+
+            GBL_TEST_VERIFY(prevPos < pos);
+        }
+    }
+
+    GBL_CTX_END();
+}
+
+static int GblSortTestSuite_recordComparator_(const void* p1, const void* p2) {
+    uint32_t key1, key2;
+
+    memcpy(&key1, p1, sizeof(key1));
+    memcpy(&key2, p2, sizeof(key2));
+
+    return (key1 > key2) - (key1 < key2);
+}
+
+static uint64_t GblSortTestSuite_recordKey_(const void* pRecord) {
+    uint32_t key;
+
+    memcpy(&key, pRecord, sizeof(key));
+
+    return key;
+}
+
+// Sorts records of each specialized width plus a couple of generic ones, in every ordering
+static GBL_RESULT GblSortTestSuite_testRecords_(GblTestSuite* pSelf, GblSortFn pFnSort, GblBool stable) {
+    const size_t widths[] = { 4, 8, 12, 16, 72 };
+
+    GBL_CTX_BEGIN(pSelf);
+
+    char* pRecords = GBL_CTX_MALLOC(GBL_SORT_TEST_SUITE_RECORD_COUNT_ * 72);
+
+    for(size_t w = 0; w < GBL_COUNT_OF(widths); ++w) {
+        for(int o = 0; o < GBL_SORT_TEST_SUITE_ORDER_COUNT_; ++o) {
+            // small counts stay within the insertion sort and stack scratch thresholds
+            for(size_t count = 0; count <= GBL_SORT_TEST_SUITE_RECORD_COUNT_; count = count? count * 6 : 1) {
+                GblSortTestSuite_fillRecords_(pRecords, count, widths[w], (GBL_SORT_TEST_SUITE_ORDER_)o);
+                pFnSort(pRecords, count, widths[w], GblSortTestSuite_recordComparator_);
+                GBL_CTX_VERIFY_CALL(GblSortTestSuite_verifyRecords_(pSelf, pRecords, count, widths[w], stable));
+            }
+        }
+    }
+
+    GBL_CTX_FREE(pRecords);
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblSortTestSuite_testSort_(GblTestSuite* pSelf, GblSortFn pFnSort) {
     GBL_CTX_BEGIN(pSelf);
 
@@ -72,12 +191,99 @@ static GBL_RESULT GblSortTestSuite_shellSort_(GblTestSuite* pSelf, GblContext* p
 static GBL_RESULT GblSortTestSuite_mergeSort_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GBL_CTX_VERIFY_CALL(GblSortTestSuite_testSort_(pSelf, gblSortMerge));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_verifyWords_(pSelf));
     GBL_CTX_END();
 }
 
 static GBL_RESULT GblSortTestSuite_quickSort_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GBL_CTX_VERIFY_CALL(GblSortTestSuite_testSort_(pSelf, gblSortQuick));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_verifyWords_(pSelf));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSortTestSuite_pdqSort_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_testSort_(pSelf, gblSortPdq));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_verifyWords_(pSelf));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_testRecords_(pSelf, gblSortPdq, GBL_FALSE));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSortTestSuite_timSort_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_testSort_(pSelf, gblSortTim));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_verifyWords_(pSelf));
+    GBL_CTX_VERIFY_CALL(GblSortTestSuite_testRecords_(pSelf, gblSortTim, GBL_TRUE));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSortTestSuite_radixSort_(GblTestSuite* pSelf, GblContext* pCtx) {
+    int32_t  ints[]    = { 7, -3, 0, INT32_MAX, -1, INT32_MIN, 42, -3, 1 };
+    float    floats[]  = { 2.5f, -0.0f, -1e30f, 0.0f, 1e-30f, -2.5f, 3.0f, -1e-30f };
+    int64_t  longs[]   = { 5, INT64_MIN, -5, INT64_MAX, 0, 1ll << 40, -(1ll << 40) };
+    double   doubles[] = { 1.0, -1e300, 0.5, -0.5, 1e300, -0.0, 0.0, -1e-300 };
+
+    GBL_CTX_BEGIN(pCtx);
+
+    // keys with nothing else around them
+    GBL_TEST_CALL(gblSortRadix(ints, GBL_COUNT_OF(ints), sizeof(int32_t), 0, GBL_SORT_KEY_INT32));
+    for(size_t i = 1; i < GBL_COUNT_OF(ints); ++i)
+        GBL_TEST_VERIFY(ints[i - 1] <= ints[i]);
+
+    GBL_TEST_CALL(gblSortRadix(floats, GBL_COUNT_OF(floats), sizeof(float), 0, GBL_SORT_KEY_FLOAT));
+    for(size_t i = 1; i < GBL_COUNT_OF(floats); ++i)
+        GBL_TEST_VERIFY(floats[i - 1] <= floats[i]);
+    GBL_TEST_VERIFY(signbit(floats[3]) && !signbit(floats[4]));
+
+    GBL_TEST_CALL(gblSortRadix(longs, GBL_COUNT_OF(longs), sizeof(int64_t), 0, GBL_SORT_KEY_INT64));
+    for(size_t i = 1; i < GBL_COUNT_OF(longs); ++i)
+        GBL_TEST_VERIFY(longs[i - 1] <= longs[i]);
+
+    GBL_TEST_CALL(gblSortRadix(doubles, GBL_COUNT_OF(doubles), sizeof(double), 0, GBL_SORT_KEY_DOUBLE));
+    for(size_t i = 1; i < GBL_COUNT_OF(doubles); ++i)
+        GBL_TEST_VERIFY(doubles[i - 1] <= doubles[i]);
+    GBL_TEST_VERIFY(signbit(doubles[3]) && !signbit(doubles[4]));
+
+    // keys within larger records, which must stay stable
+    char* pRecords = GBL_CTX_MALLOC(GBL_SORT_TEST_SUITE_RECORD_COUNT_ * 24);
+
+    for(int o = 0; o < GBL_SORT_TEST_SUITE_ORDER_COUNT_; ++o) {
+        GblSortTestSuite_fillRecords_(pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 24, (GBL_SORT_TEST_SUITE_ORDER_)o);
+        GBL_TEST_CALL(gblSortRadix(pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 24, 0, GBL_SORT_KEY_UINT32));
+        GBL_TEST_CALL(GblSortTestSuite_verifyRecords_(pSelf, pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 24, GBL_TRUE));
+
+        GblSortTestSuite_fillRecords_(pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 8, (GBL_SORT_TEST_SUITE_ORDER_)o);
+        GBL_TEST_CALL(gblSortRadixKey(pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 8, GblSortTestSuite_recordKey_));
+        GBL_TEST_CALL(GblSortTestSuite_verifyRecords_(pSelf, pRecords, GBL_SORT_TEST_SUITE_RECORD_COUNT_, 8, GBL_TRUE));
+    }
+
+    GBL_CTX_FREE(pRecords);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSortTestSuite_radixSortInvalid_(GblTestSuite* pSelf, GblContext* pCtx) {
+    uint32_t keys[2] = { 2, 1 };
+
+    GBL_CTX_BEGIN(pCtx);
+    GBL_UNUSED(pSelf);
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(gblSortRadix(keys, 2, sizeof(uint32_t), 2, GBL_SORT_KEY_UINT32),
+                     GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(gblSortRadix(keys, 2, sizeof(uint32_t), 0, GBL_SORT_KEY_UINT64),
+                     GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(gblSortRadixKey(keys, 2, sizeof(uint32_t), NULL),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(keys[0], 2);
     GBL_CTX_END();
 }
 
@@ -91,6 +297,10 @@ GBL_EXPORT GblType GblSortTestSuite_type(void) {
         { "shellSort",          GblSortTestSuite_shellSort_        },
         { "mergeSort",          GblSortTestSuite_mergeSort_        },
         { "quickSort",          GblSortTestSuite_quickSort_        },
+        { "pdqSort",            GblSortTestSuite_pdqSort_          },
+        { "timSort",            GblSortTestSuite_timSort_          },
+        { "radixSort",          GblSortTestSuite_radixSort_        },
+        { "radixSortInvalid",   GblSortTestSuite_radixSortInvalid_ },
         { NULL,                 NULL                               }
     };
 
@@ -1,9 +1,15 @@
 #include "allocators/gimbal_arena_allocator_test_suite.h"
 #include <gimbal/allocators/gimbal_arena_allocator.h>
 #include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_ARENA_ALLOCATOR_TEST_SUITE_(inst)   (GBL_PRIVATE(GblArenaAllocatorTestSuite, inst))
 
+#define GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_      100000
+#define GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_PAGE_SIZE_   4096
+#define GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_FRAME_       1000
+#define GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_MAX_PAGE_    65536
+
 typedef struct GblArenaAllocatorTestSuite_ {
     GblArenaAllocator arena;
     struct {
@@ -87,7 +93,7 @@ static GBL_RESULT GblArenaAllocatorTestSuite_allocFail_(GblTestSuite* pSelf, Gbl
 
     GBL_TEST_EXPECT_ERROR();
 
-    void* pPtr = GblArenaAllocator_alloc(&pSelf_->arena, 256, 64);
+    void* pPtr = GblArenaAllocator_alloc(&pSelf_->arena, SIZE_MAX, 64);
     GBL_TEST_VERIFY(!pPtr);
     GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_OVERFLOW);
     GBL_CTX_CLEAR_LAST_RECORD();
@@ -95,6 +101,44 @@ static GBL_RESULT GblArenaAllocatorTestSuite_allocFail_(GblTestSuite* pSelf, Gbl
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblArenaAllocatorTestSuite_allocLarge_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblArenaAllocatorTestSuite_* pSelf_ = GBL_ARENA_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    const size_t bytesUsed      = GblArenaAllocator_bytesUsed(&pSelf_->arena);
+    const size_t bytesAvailable = GblArenaAllocator_bytesAvailable(&pSelf_->arena);
+    const size_t pageCount      = GblArenaAllocator_pageCount(&pSelf_->arena);
+    const size_t capacity       = GblArenaAllocator_totalCapacity(&pSelf_->arena);
+
+    GblArenaAllocatorState state;
+    GblArenaAllocator_saveState(&pSelf_->arena, &state);
+
+    char* pPtr = GblArenaAllocator_alloc(&pSelf_->arena, 256, 64);
+    GBL_TEST_VERIFY(pPtr);
+    GBL_TEST_VERIFY(!((uintptr_t)pPtr & 0x3f));
+    memset(pPtr, 'L', 256);
+
+    GBL_TEST_COMPARE(GblArenaAllocator_pageCount(&pSelf_->arena), pageCount + 1);
+    GBL_TEST_COMPARE(GblArenaAllocator_bytesAvailable(&pSelf_->arena), bytesAvailable);
+    GBL_TEST_VERIFY(GblArenaAllocator_totalCapacity(&pSelf_->arena) >= capacity + 256);
+    GBL_TEST_VERIFY(GblArenaAllocator_bytesUsed(&pSelf_->arena) >= bytesUsed + 256);
+    GBL_TEST_COMPARE(GblArenaAllocator_bytesUsed(&pSelf_->arena)       +
+                     GblArenaAllocator_fragmentedBytes(&pSelf_->arena) +
+                     GblArenaAllocator_bytesAvailable(&pSelf_->arena),
+                     GblArenaAllocator_totalCapacity(&pSelf_->arena));
+
+    GBL_CTX_VERIFY_CALL(GblArenaAllocator_loadState(&pSelf_->arena, &state));
+
+    GBL_TEST_COMPARE(GblArenaAllocator_pageCount(&pSelf_->arena), pageCount);
+    GBL_TEST_COMPARE(GblArenaAllocator_bytesUsed(&pSelf_->arena), bytesUsed);
+    GBL_TEST_COMPARE(GblArenaAllocator_totalCapacity(&pSelf_->arena), capacity);
+
+    // leave one behind for freeAll() to reclaim
+    GBL_TEST_VERIFY(GblArenaAllocator_alloc(&pSelf_->arena, 1024));
+
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblArenaAllocatorTestSuite_saveLoadState_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GblArenaAllocatorTestSuite_* pSelf_ = GBL_ARENA_ALLOCATOR_TEST_SUITE_(pSelf);
@@ -143,6 +187,149 @@ static GBL_RESULT GblArenaAllocatorTestSuite_destruct_(GblTestSuite* pSelf, GblC
     GBL_CTX_END();
 }
 
+static size_t GblArenaAllocatorTestSuite_profileSize_(size_t i) {
+    return 8 + (i * 7) % 57;
+}
+
+static GBL_RESULT GblArenaAllocatorTestSuite_allocProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    void**            ppPtrs = malloc(sizeof(void*) * GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_);
+    GblArenaAllocator arena;
+    GblTimer          timer;
+    size_t            samples = 0;
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i)
+        ppPtrs[i] = malloc(GblArenaAllocatorTestSuite_profileSize_(i));
+    for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i)
+        free(ppPtrs[i]);
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("malloc:        %zu allocs: %lf ms",
+                 (size_t)GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_,
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_CTX_VERIFY_CALL(GblArenaAllocator_construct(&arena, GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_PAGE_SIZE_));
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i)
+        ppPtrs[i] = (GblArenaAllocator_alloc)(&arena, GblArenaAllocatorTestSuite_profileSize_(i), 0);
+    GBL_CTX_VERIFY_CALL(GblArenaAllocator_freeAll(&arena));
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("arena (call):  %zu allocs: %lf ms",
+                 (size_t)GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_,
+                 GblTimer_elapsedMs(&timer));
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i)
+        ppPtrs[i] = GblArenaAllocator_alloc(&arena, GblArenaAllocatorTestSuite_profileSize_(i));
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("arena:         %zu allocs: %lf ms",
+                 (size_t)GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_,
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_TEST_COMPARE(arena.allocCount, GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_);
+    for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i)
+        GBL_TEST_VERIFY(!((uintptr_t)ppPtrs[i] & (GBL_ALIGNOF(GBL_MAX_ALIGN_T) - 1)));
+
+    GblTimer_start(&timer);
+    for(size_t f = 0; f < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_FRAME_; ++f) {
+        samples += GblArenaAllocator_bytesUsed(&arena)      +
+                   GblArenaAllocator_totalCapacity(&arena)  +
+                   GblArenaAllocator_fragmentedBytes(&arena);
+        samples += GblArenaAllocator_utilization(&arena) > 0.0f;
+    }
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("statistics:    %zu samples over %zu pages: %lf ms",
+                 (size_t)GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_FRAME_,
+                 GblArenaAllocator_pageCount(&arena),
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_TEST_VERIFY(samples);
+    GBL_TEST_VERIFY(GblArenaAllocator_bytesUsed(&arena) <= GblArenaAllocator_totalCapacity(&arena));
+    GBL_TEST_COMPARE(GblArenaAllocator_totalCapacity(&arena),
+                     GblArenaAllocator_pageCount(&arena) * GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_PAGE_SIZE_);
+    GBL_TEST_COMPARE(GblArenaAllocator_bytesUsed(&arena)       +
+                     GblArenaAllocator_fragmentedBytes(&arena) +
+                     GblArenaAllocator_bytesAvailable(&arena),
+                     GblArenaAllocator_totalCapacity(&arena));
+
+    GBL_CTX_VERIFY_CALL(GblArenaAllocator_destruct(&arena));
+    free(ppPtrs);
+
+    GBL_CTX_END();
+}
+
+// Mostly small nodes, some medium buffers, and rare large blobs, like building a parse tree
+static size_t GblArenaAllocatorTestSuite_growthSize_(uint32_t* pSeed) {
+    *pSeed = *pSeed * 1664525u + 1013904223u;
+    const uint32_t r = *pSeed >> 8;
+
+    if(r % 1000 < 900)      return 16   + r % 49;
+    else if(r % 1000 < 995) return 256  + r % 769;
+    else                    return 8192 + r % 57345;
+}
+
+static GBL_RESULT GblArenaAllocatorTestSuite_growthProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    static const struct {
+        GBL_ARENA_GROWTH growth;
+        const char*      pName;
+    } policies[] = {
+        { GBL_ARENA_GROWTH_FIXED,     "fixed"     },
+        { GBL_ARENA_GROWTH_GEOMETRIC, "geometric" },
+        { GBL_ARENA_GROWTH_CAPPED,    "capped"    }
+    };
+
+    GblArenaAllocator arena;
+    GblTimer          timer;
+
+    for(size_t p = 0; p < GBL_COUNT_OF(policies); ++p) {
+        uint32_t seed      = 0xdeadbeef;
+        size_t   requested = 0;
+
+        GBL_CTX_VERIFY_CALL(GblArenaAllocator_construct(&arena,
+                                                        GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_PAGE_SIZE_,
+                                                        16,
+                                                        NULL,
+                                                        NULL,
+                                                        policies[p].growth,
+                                                        GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_MAX_PAGE_));
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_; ++i) {
+            const size_t size = GblArenaAllocatorTestSuite_growthSize_(&seed);
+            requested += size;
+            GBL_TEST_VERIFY(GblArenaAllocator_alloc(&arena, size));
+        }
+        GblTimer_stop(&timer);
+
+        GBL_CTX_INFO("%-10s %zu allocs (%zu bytes): %zu pages, %zu peak bytes, %.3f util: %lf ms",
+                     policies[p].pName,
+                     (size_t)GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_,
+                     requested,
+                     GblArenaAllocator_pageCount(&arena),
+                     GblArenaAllocator_totalCapacity(&arena),
+                     GblArenaAllocator_utilization(&arena),
+                     GblTimer_elapsedMs(&timer));
+
+        GBL_TEST_COMPARE(arena.allocCount, GBL_ARENA_ALLOCATOR_TEST_SUITE_PROFILE_ALLOCS_);
+        GBL_TEST_VERIFY(GblArenaAllocator_bytesUsed(&arena) >= requested);
+        GBL_TEST_COMPARE(GblArenaAllocator_bytesUsed(&arena)       +
+                         GblArenaAllocator_fragmentedBytes(&arena) +
+                         GblArenaAllocator_bytesAvailable(&arena),
+                         GblArenaAllocator_totalCapacity(&arena));
+
+        GBL_CTX_VERIFY_CALL(GblArenaAllocator_freeAll(&arena));
+        GBL_TEST_COMPARE(GblArenaAllocator_pageCount(&arena), 0);
+        GBL_TEST_COMPARE(GblArenaAllocator_totalCapacity(&arena), 0);
+        GBL_CTX_VERIFY_CALL(GblArenaAllocator_destruct(&arena));
+    }
+
+    GBL_CTX_END();
+}
+
 GBL_EXPORT GblType GblArenaAllocatorTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
 
@@ -152,9 +339,12 @@ GBL_EXPORT GblType GblArenaAllocatorTestSuite_type(void) {
         { "allocNewPage",   GblArenaAllocatorTestSuite_allocNewPage_ },
         { "allocAligned",   GblArenaAllocatorTestSuite_allocAligned_ },
         { "allocFail",      GblArenaAllocatorTestSuite_allocFail_    },
+        { "allocLarge",     GblArenaAllocatorTestSuite_allocLarge_   },
         { "saveLoadState",  GblArenaAllocatorTestSuite_saveLoadState_},
         { "freeAll",        GblArenaAllocatorTestSuite_freeAll_      },
         { "destruct",       GblArenaAllocatorTestSuite_destruct_     },
+        { "allocProfile",   GblArenaAllocatorTestSuite_allocProfile_ },
+        { "growthProfile",  GblArenaAllocatorTestSuite_growthProfile_},
         { NULL,             NULL                                     }
     };
 
@@ -0,0 +1,355 @@
+#include "allocators/gimbal_concurrent_pool_allocator_test_suite.h"
+#include <gimbal/allocators/gimbal_concurrent_pool_allocator.h>
+#include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/utils/gimbal_timer.h>
+#include <tinycthread.h>
+
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(inst)    (GBL_PRIVATE(GblConcurrentPoolAllocatorTestSuite, inst))
+
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_MAGAZINE_  8
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_DEPOT_     4
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_   64
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_   4
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ROUNDS_    2000
+#define GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_     32
+
+typedef struct GblConcurrentPoolMessage_ {
+    void*    pReserved;     // clobbered by the free list
+    uint32_t owner;
+    uint32_t sequence;
+    char     payload[48];
+} GblConcurrentPoolMessage_;
+
+typedef struct GblConcurrentPoolAllocatorTestSuite_ {
+    GblConcurrentPoolAllocator pool;
+    GblConcurrentPoolMessage_* pEntries[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_];
+} GblConcurrentPoolAllocatorTestSuite_;
+
+// Each worker either allocates from the shared pool or frees a batch handed to it
+typedef struct GblConcurrentPoolWorker_ {
+    GblConcurrentPoolAllocator* pPool;
+    GblPoolAllocator*           pLockedPool;
+    mtx_t*                      pLockedMtx;
+    GblConcurrentPoolMessage_** ppEntries;
+    size_t                      count;
+    uint32_t                    id;
+    size_t                      errors;
+} GblConcurrentPoolWorker_;
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_init_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+    memset(pSelf_, 0, sizeof(GblConcurrentPoolAllocatorTestSuite_));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_construct_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_construct(&pSelf_->pool,
+                                                             sizeof(GblConcurrentPoolMessage_),
+                                                             16,
+                                                             32,
+                                                             GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_MAGAZINE_,
+                                                             GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_DEPOT_,
+                                                             pCtx));
+
+    GBL_TEST_COMPARE(pSelf_->pool.entrySize, sizeof(GblConcurrentPoolMessage_));
+    GBL_TEST_COMPARE(pSelf_->pool.magazineSize, GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_MAGAZINE_);
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool), 0);
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_depotSize(&pSelf_->pool), 0);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_new_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    for(size_t e = 0; e < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_; ++e) {
+        GblConcurrentPoolMessage_* pEntry = GblConcurrentPoolAllocator_new(&pSelf_->pool);
+        GBL_TEST_VERIFY(pEntry);
+        GBL_TEST_VERIFY(!((uintptr_t)pEntry & 0x1f));
+
+        for(size_t p = 0; p < e; ++p)
+            GBL_TEST_VERIFY(pSelf_->pEntries[p] != pEntry);
+
+        pEntry->owner    = 0;
+        pEntry->sequence = e;
+        pSelf_->pEntries[e] = pEntry;
+    }
+
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool),
+                     GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_delete_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    for(size_t e = 0; e < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_; ++e) {
+        GBL_TEST_COMPARE(pSelf_->pEntries[e]->sequence, e);
+        GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_delete(&pSelf_->pool, pSelf_->pEntries[e]));
+    }
+
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool), 0);
+    // two magazines stay cached by this thread, the rest went to the depot
+    GBL_TEST_VERIFY(GblConcurrentPoolAllocator_depotSize(&pSelf_->pool) > 0);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_renew_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    for(size_t e = 0; e < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_; ++e) {
+        pSelf_->pEntries[e] = GblConcurrentPoolAllocator_new(&pSelf_->pool);
+        GBL_TEST_VERIFY(pSelf_->pEntries[e]);
+    }
+
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_depotSize(&pSelf_->pool), 0);
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool),
+                     GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_deleteRun_(GblThread* pThread) {
+    GblConcurrentPoolWorker_* pWorker = GblBox_userdata(GBL_BOX(pThread));
+
+    for(size_t e = 0; e < pWorker->count; ++e)
+        GblConcurrentPoolAllocator_delete(pWorker->pPool, pWorker->ppEntries[e]);
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_deleteCrossThread_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    GblConcurrentPoolWorker_ worker = {
+        .pPool     = &pSelf_->pool,
+        .ppEntries = pSelf_->pEntries,
+        .count     = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_
+    };
+
+    GblThread* pThread = GblThread_create(GblConcurrentPoolAllocatorTestSuite_deleteRun_, &worker);
+    GblThread_join(pThread);
+    GblThread_unref(pThread);
+
+    // the exiting thread's cache was flushed back, overflowing the depot into the backing pool
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool), 0);
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_depotSize(&pSelf_->pool),
+                     GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_DEPOT_);
+
+    for(size_t e = 0; e < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_; ++e) {
+        pSelf_->pEntries[e] = GblConcurrentPoolAllocator_new(&pSelf_->pool);
+        GBL_TEST_VERIFY(pSelf_->pEntries[e]);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_stressRun_(GblThread* pThread) {
+    GblConcurrentPoolWorker_*  pWorker = GblBox_userdata(GBL_BOX(pThread));
+    GblConcurrentPoolMessage_* pBurst[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_];
+
+    for(size_t r = 0; r < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ROUNDS_; ++r) {
+        const size_t burst = 1 + (r * 7 + pWorker->id) % GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_;
+
+        for(size_t b = 0; b < burst; ++b) {
+            pBurst[b] = GblConcurrentPoolAllocator_new(pWorker->pPool);
+
+            if(!pBurst[b]) {
+                ++pWorker->errors;
+                return GBL_RESULT_ERROR_MEM_ALLOC;
+            }
+
+            pBurst[b]->owner    = pWorker->id;
+            pBurst[b]->sequence = (uint32_t)b;
+        }
+
+        // any entry handed out twice would have been overwritten by another thread
+        for(size_t b = 0; b < burst; ++b) {
+            if(pBurst[b]->owner != pWorker->id || pBurst[b]->sequence != b)
+                ++pWorker->errors;
+
+            GblConcurrentPoolAllocator_delete(pWorker->pPool, pBurst[b]);
+        }
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_stress_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    GblConcurrentPoolWorker_ workers[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_];
+    GblThread*               pThreads[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_];
+
+    for(size_t t = 0; t < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_; ++t) {
+        memset(&workers[t], 0, sizeof(GblConcurrentPoolWorker_));
+        workers[t].pPool = &pSelf_->pool;
+        workers[t].id    = t + 1;
+        pThreads[t]      = GblThread_create(GblConcurrentPoolAllocatorTestSuite_stressRun_, &workers[t]);
+    }
+
+    for(size_t t = 0; t < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+        GBL_TEST_COMPARE(workers[t].errors, 0);
+    }
+
+    GBL_TEST_COMPARE(GblConcurrentPoolAllocator_activeEntries(&pSelf_->pool),
+                     GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ENTRIES_);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_destruct_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentPoolAllocatorTestSuite_* pSelf_ = GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_destruct(&pSelf_->pool));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_profileRun_(GblThread* pThread) {
+    GblConcurrentPoolWorker_*  pWorker = GblBox_userdata(GBL_BOX(pThread));
+    GblConcurrentPoolMessage_* pBurst[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_];
+
+    for(size_t r = 0; r < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ROUNDS_ * 10; ++r) {
+        for(size_t b = 0; b < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_; ++b) {
+            if(pWorker->pPool) {
+                pBurst[b] = GblConcurrentPoolAllocator_new(pWorker->pPool);
+            } else {
+                mtx_lock(pWorker->pLockedMtx);
+                pBurst[b] = GblPoolAllocator_new(pWorker->pLockedPool);
+                mtx_unlock(pWorker->pLockedMtx);
+            }
+            pBurst[b]->owner = pWorker->id;
+        }
+
+        for(size_t b = 0; b < GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_; ++b) {
+            if(pWorker->pPool) {
+                GblConcurrentPoolAllocator_delete(pWorker->pPool, pBurst[b]);
+            } else {
+                mtx_lock(pWorker->pLockedMtx);
+                GblPoolAllocator_delete(pWorker->pLockedPool, pBurst[b]);
+                mtx_unlock(pWorker->pLockedMtx);
+            }
+        }
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_profileThreads_(GblContext*                 pCtx,
+                                                                      GblConcurrentPoolAllocator* pPool,
+                                                                      GblPoolAllocator*           pLockedPool,
+                                                                      mtx_t*                      pLockedMtx,
+                                                                      size_t                      threadCount)
+{
+    GBL_CTX_BEGIN(pCtx);
+
+    GblConcurrentPoolWorker_ workers[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_];
+    GblThread*               pThreads[GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_];
+    GblTimer                 timer;
+
+    GblTimer_start(&timer);
+
+    for(size_t t = 0; t < threadCount; ++t) {
+        memset(&workers[t], 0, sizeof(GblConcurrentPoolWorker_));
+        workers[t].pPool       = pPool;
+        workers[t].pLockedPool = pLockedPool;
+        workers[t].pLockedMtx  = pLockedMtx;
+        workers[t].id          = t;
+        pThreads[t] = GblThread_create(GblConcurrentPoolAllocatorTestSuite_profileRun_, &workers[t]);
+    }
+
+    for(size_t t = 0; t < threadCount; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+    }
+
+    GblTimer_stop(&timer);
+
+    GBL_CTX_INFO("%-10s %zu new/delete pairs on each of %zu thread(s): %lf ms",
+                 pPool? "concurrent" : "mutex",
+                 (size_t)GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_ROUNDS_ * 10 *
+                         GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_BURST_,
+                 threadCount,
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentPoolAllocatorTestSuite_profile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblConcurrentPoolAllocator pool;
+    GblPoolAllocator           lockedPool;
+    mtx_t                      lockedMtx;
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_construct(&pool,
+                                                             sizeof(GblConcurrentPoolMessage_),
+                                                             256));
+    GBL_CTX_VERIFY_CALL(GblPoolAllocator_construct(&lockedPool,
+                                                   sizeof(GblConcurrentPoolMessage_),
+                                                   256,
+                                                   GBL_ALIGNOF(GBL_MAX_ALIGN_T)));
+    mtx_init(&lockedMtx, mtx_plain);
+
+    for(size_t t = 1; t <= GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_THREADS_; t *= 2) {
+        GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocatorTestSuite_profileThreads_(pCtx, NULL, &lockedPool, &lockedMtx, t));
+        GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocatorTestSuite_profileThreads_(pCtx, &pool, NULL, NULL, t));
+    }
+
+    mtx_destroy(&lockedMtx);
+    GBL_CTX_VERIFY_CALL(GblPoolAllocator_destruct(&lockedPool));
+    GBL_CTX_VERIFY_CALL(GblConcurrentPoolAllocator_destruct(&pool));
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblType GblConcurrentPoolAllocatorTestSuite_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+
+    const static GblTestCase cases[] = {
+        { "construct",          GblConcurrentPoolAllocatorTestSuite_construct_          },
+        { "new",                GblConcurrentPoolAllocatorTestSuite_new_                },
+        { "delete",             GblConcurrentPoolAllocatorTestSuite_delete_             },
+        { "renew",              GblConcurrentPoolAllocatorTestSuite_renew_              },
+        { "deleteCrossThread",  GblConcurrentPoolAllocatorTestSuite_deleteCrossThread_  },
+        { "stress",             GblConcurrentPoolAllocatorTestSuite_stress_             },
+        { "destruct",           GblConcurrentPoolAllocatorTestSuite_destruct_           },
+        { "profile",            GblConcurrentPoolAllocatorTestSuite_profile_            },
+        { NULL,                 NULL                                                    }
+    };
+
+    const static GblTestSuiteVTable vTable = {
+        .pFnSuiteInit   = GblConcurrentPoolAllocatorTestSuite_init_,
+        .pCases         = cases
+    };
+
+    if(type == GBL_INVALID_TYPE) {
+        GBL_CTX_BEGIN(NULL);
+        type = GblTestSuite_register(GblQuark_internStringStatic("GblConcurrentPoolAllocatorTestSuite"),
+                                     &vTable,
+                                     sizeof(GblConcurrentPoolAllocatorTestSuite),
+                                     sizeof(GblConcurrentPoolAllocatorTestSuite_),
+                                     GBL_TYPE_FLAGS_NONE);
+        GBL_CTX_VERIFY_LAST_RECORD();
+        GBL_CTX_END_BLOCK();
+    }
+
+    return type;
+}
@@ -24,13 +24,17 @@ typedef struct GblVariantList_ {
 
 typedef struct GblPoolAllocatorTestSuite_ {
     GblPoolAllocator pool;
-    struct {
-    GBL_ALIGNAS(32)    GblArenaAllocatorPage  page;
-        char           bytes[63];
-    };
     GblVariantListNode_ variantList;
 } GblPoolAllocatorTestSuite_;
 
+/* The initial page lives in static storage, since instance private data
+   isn't guaranteed to honor its 32-byte alignment, and any padding the
+   arena needed to align entries would throw off the expected byte counts. */
+static struct {
+GBL_ALIGNAS(32)    GblArenaAllocatorPage  page;
+    char           bytes[63];
+} initialPage_;
+
 
 
 static GBL_RESULT GblPoolAllocatorTestSuite_init_(GblTestSuite* pSelf, GblContext* pCtx) {
@@ -40,8 +44,9 @@ static GBL_RESULT GblPoolAllocatorTestSuite_init_(GblTestSuite* pSelf, GblContex
 
     GblDoublyLinkedList_init(&pSelf_->variantList.list);
 
-    pSelf_->page.capacity    = 64;
-    pSelf_->page.staticAlloc = GBL_TRUE;
+    memset(&initialPage_, 0, sizeof(initialPage_));
+    initialPage_.page.capacity    = 64;
+    initialPage_.page.staticAlloc = GBL_TRUE;
 
     GBL_CTX_END();
 }
@@ -55,7 +60,7 @@ static GBL_RESULT GblPoolAllocatorTestSuite_construct_(GblTestSuite* pSelf, GblC
                                                    sizeof(GblVariantList_),
                                                    5,
                                                    32,
-                                                   &pSelf_->page,
+                                                   &initialPage_.page,
                                                    pCtx));
 
     GBL_TEST_COMPARE(GblPoolAllocator_freeListSize(&pSelf_->pool), 0);
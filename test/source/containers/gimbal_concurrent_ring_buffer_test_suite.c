@@ -0,0 +1,450 @@
+#include "containers/gimbal_concurrent_ring_buffer_test_suite.h"
+#include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/containers/gimbal_concurrent_ring_buffer.h>
+#include <gimbal/containers/gimbal_ring_buffer.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/utils/gimbal_timer.h>
+#include <tinycthread.h>
+
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(inst)    (GBL_PRIVATE(GblConcurrentRingBufferTestSuite, inst))
+
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_  4
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_    20000
+#define GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_    16
+
+typedef struct GblConcurrentRingBufferTestSuite_ {
+    GblConcurrentRingBuffer mpmc;
+    GblConcurrentRingBuffer spsc;
+} GblConcurrentRingBufferTestSuite_;
+
+/* Producers push "count" values tagged with their id in the upper bits, and
+   consumers pop "count" values, checking that every producer's values still
+   arrive in the order they were pushed. Either side goes through the
+   mutex-protected GblRingBuffer instead when "pLocked" is set. */
+typedef struct GblConcurrentRingBufferWorker_ {
+    GblConcurrentRingBuffer* pBuffer;
+    GblRingBuffer*           pLocked;
+    mtx_t*                   pLockedMtx;
+    uint32_t                 id;
+    size_t                   count;
+    size_t                   batch;
+    uint64_t                 sum;
+    size_t                   errors;
+} GblConcurrentRingBufferWorker_;
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_init_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+    memset(pSelf_, 0, sizeof(GblConcurrentRingBufferTestSuite_));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_construct_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_construct(&pSelf_->mpmc, sizeof(uint32_t), 6));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_construct(&pSelf_->spsc,
+                                                          sizeof(uint32_t),
+                                                          8,
+                                                          GBL_CONCURRENT_RING_BUFFER_SPSC,
+                                                          pCtx));
+
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_capacity(&pSelf_->mpmc), 8);
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_elementSize(&pSelf_->mpmc), sizeof(uint32_t));
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_mode(&pSelf_->mpmc), GBL_CONCURRENT_RING_BUFFER_MPMC);
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_context(&pSelf_->mpmc), NULL);
+    GBL_TEST_VERIFY(GblConcurrentRingBuffer_empty(&pSelf_->mpmc));
+    GBL_TEST_VERIFY(!GblConcurrentRingBuffer_full(&pSelf_->mpmc));
+
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_capacity(&pSelf_->spsc), 8);
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_mode(&pSelf_->spsc), GBL_CONCURRENT_RING_BUFFER_SPSC);
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_context(&pSelf_->spsc), pCtx);
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_size(&pSelf_->spsc), 0);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_constructInvalid_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblConcurrentRingBuffer buffer;
+
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_construct(&buffer, 0, 8), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_construct(&buffer, sizeof(int), 0), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_pushPop_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+    GblConcurrentRingBuffer* buffers[] = { &pSelf_->mpmc, &pSelf_->spsc };
+
+    for(size_t b = 0; b < GBL_COUNT_OF(buffers); ++b) {
+        // Go around the buffer several times to exercise wrapping
+        for(uint32_t lap = 0; lap < 3; ++lap) {
+            for(uint32_t v = 0; v < 8; ++v) {
+                const uint32_t value = lap * 100 + v;
+                GBL_TEST_VERIFY(GblConcurrentRingBuffer_pushBack(buffers[b], &value));
+            }
+
+            const uint32_t extra = 999;
+            GBL_TEST_VERIFY(GblConcurrentRingBuffer_full(buffers[b]));
+            GBL_TEST_VERIFY(!GblConcurrentRingBuffer_pushBack(buffers[b], &extra));
+            GBL_TEST_COMPARE(GblConcurrentRingBuffer_size(buffers[b]), 8);
+
+            for(uint32_t v = 0; v < 8; ++v) {
+                uint32_t value = 0;
+                GBL_TEST_VERIFY(GblConcurrentRingBuffer_popFront(buffers[b], &value));
+                GBL_TEST_COMPARE(value, lap * 100 + v);
+            }
+
+            uint32_t value = 0;
+            GBL_TEST_VERIFY(GblConcurrentRingBuffer_empty(buffers[b]));
+            GBL_TEST_VERIFY(!GblConcurrentRingBuffer_popFront(buffers[b], &value));
+        }
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_emplaceBack_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+    GblConcurrentRingBuffer* buffers[] = { &pSelf_->mpmc, &pSelf_->spsc };
+
+    for(size_t b = 0; b < GBL_COUNT_OF(buffers); ++b) {
+        uint32_t* pSlots[8];
+
+        /* MPMC slots may all be claimed up-front, then published together,
+           while the SPSC producer has to publish each slot as it goes. */
+        for(uint32_t s = 0; s < 8; ++s) {
+            pSlots[s] = GblConcurrentRingBuffer_emplaceBack(buffers[b]);
+            GBL_TEST_VERIFY(pSlots[s]);
+            *pSlots[s] = s * 3;
+
+            if(GblConcurrentRingBuffer_mode(buffers[b]) == GBL_CONCURRENT_RING_BUFFER_SPSC)
+                GblConcurrentRingBuffer_commitBack(buffers[b], pSlots[s]);
+        }
+
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_emplaceBack(buffers[b]), NULL);
+
+        if(GblConcurrentRingBuffer_mode(buffers[b]) == GBL_CONCURRENT_RING_BUFFER_MPMC)
+            for(uint32_t s = 0; s < 8; ++s)
+                GblConcurrentRingBuffer_commitBack(buffers[b], pSlots[s]);
+
+        for(uint32_t s = 0; s < 8; ++s) {
+            uint32_t value = 0;
+            GBL_TEST_VERIFY(GblConcurrentRingBuffer_popFront(buffers[b], &value));
+            GBL_TEST_COMPARE(value, s * 3);
+        }
+
+        GBL_TEST_VERIFY(GblConcurrentRingBuffer_empty(buffers[b]));
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_batch_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+    GblConcurrentRingBuffer* buffers[] = { &pSelf_->mpmc, &pSelf_->spsc };
+    const uint32_t           values[]  = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+    for(size_t b = 0; b < GBL_COUNT_OF(buffers); ++b) {
+        uint32_t out[12] = { 0 };
+
+        // Offset the buffer so that batches straddle the end of the array
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_pushBackMany(buffers[b], values, 5), 5);
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_popFrontMany(buffers[b], out, 5), 5);
+        GBL_TEST_VERIFY(memcmp(out, values, sizeof(uint32_t) * 5) == 0);
+
+        // Only as many elements as fit are pushed
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_pushBackMany(buffers[b], values, 12), 8);
+        GBL_TEST_VERIFY(GblConcurrentRingBuffer_full(buffers[b]));
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_pushBackMany(buffers[b], values, 1), 0);
+
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_popFrontMany(buffers[b], out, 3), 3);
+        GBL_TEST_VERIFY(memcmp(out, values, sizeof(uint32_t) * 3) == 0);
+
+        // Only as many elements as are available are popped
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_popFrontMany(buffers[b], out, 12), 5);
+        GBL_TEST_VERIFY(memcmp(out, &values[3], sizeof(uint32_t) * 5) == 0);
+        GBL_TEST_COMPARE(GblConcurrentRingBuffer_popFrontMany(buffers[b], out, 12), 0);
+        GBL_TEST_VERIFY(GblConcurrentRingBuffer_empty(buffers[b]));
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_produce_(GblThread* pThread) {
+    GblConcurrentRingBufferWorker_* pWorker = GblBox_userdata(GBL_BOX(pThread));
+    uint32_t                        values[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_];
+    size_t                          produced = 0;
+
+    while(produced < pWorker->count) {
+        const size_t batch = GBL_MIN(pWorker->batch, pWorker->count - produced);
+        size_t       pushed = 0;
+
+        for(size_t v = 0; v < batch; ++v)
+            values[v] = (pWorker->id << 24) | (uint32_t)(produced + v);
+
+        if(pWorker->pLocked) {
+            mtx_lock(pWorker->pLockedMtx);
+            while(pushed < batch && !GblRingBuffer_full(pWorker->pLocked))
+                GblRingBuffer_pushBack(pWorker->pLocked, &values[pushed++]);
+            mtx_unlock(pWorker->pLockedMtx);
+        } else if(batch == 1) {
+            pushed = GblConcurrentRingBuffer_pushBack(pWorker->pBuffer, values);
+        } else {
+            pushed = GblConcurrentRingBuffer_pushBackMany(pWorker->pBuffer, values, batch);
+        }
+
+        if(!pushed) thrd_yield();
+
+        for(size_t v = 0; v < pushed; ++v)
+            pWorker->sum += values[v];
+
+        produced += pushed;
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_consume_(GblThread* pThread) {
+    GblConcurrentRingBufferWorker_* pWorker = GblBox_userdata(GBL_BOX(pThread));
+    uint32_t                        values[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_];
+    uint32_t                        next[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_] = { 0 };
+    size_t                          consumed = 0;
+
+    while(consumed < pWorker->count) {
+        const size_t batch = GBL_MIN(pWorker->batch, pWorker->count - consumed);
+        size_t       popped = 0;
+
+        if(pWorker->pLocked) {
+            mtx_lock(pWorker->pLockedMtx);
+            while(popped < batch && !GblRingBuffer_empty(pWorker->pLocked))
+                values[popped++] = *(uint32_t*)GblRingBuffer_popFront(pWorker->pLocked);
+            mtx_unlock(pWorker->pLockedMtx);
+        } else if(batch == 1) {
+            popped = GblConcurrentRingBuffer_popFront(pWorker->pBuffer, values);
+        } else {
+            popped = GblConcurrentRingBuffer_popFrontMany(pWorker->pBuffer, values, batch);
+        }
+
+        if(!popped) thrd_yield();
+
+        for(size_t v = 0; v < popped; ++v) {
+            const uint32_t producer = values[v] >> 24;
+            const uint32_t sequence = values[v] & 0xffffff;
+
+            if(producer >= GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_ || sequence < next[producer])
+                ++pWorker->errors;
+            else
+                next[producer] = sequence + 1;
+
+            pWorker->sum += values[v];
+        }
+
+        consumed += popped;
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+// Runs "pairs" producers against "pairs" consumers to completion, returning the elapsed time
+static GBL_RESULT GblConcurrentRingBufferTestSuite_run_(GblContext*              pCtx,
+                                                        GblConcurrentRingBuffer* pBuffer,
+                                                        GblRingBuffer*           pLocked,
+                                                        mtx_t*                   pLockedMtx,
+                                                        size_t                   pairs,
+                                                        size_t                   count,
+                                                        size_t                   batch,
+                                                        double*                  pMs)
+{
+    GBL_CTX_BEGIN(pCtx);
+
+    GblConcurrentRingBufferWorker_ producers[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_];
+    GblConcurrentRingBufferWorker_ consumers[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_];
+    GblThread*                     pThreads[GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_ * 2];
+    uint64_t                       produced = 0;
+    uint64_t                       consumed = 0;
+    size_t                         errors   = 0;
+    GblTimer                       timer;
+
+    GblTimer_start(&timer);
+
+    for(size_t t = 0; t < pairs; ++t) {
+        GblConcurrentRingBufferWorker_* pWorkers[] = { &producers[t], &consumers[t] };
+
+        for(size_t w = 0; w < GBL_COUNT_OF(pWorkers); ++w) {
+            memset(pWorkers[w], 0, sizeof(GblConcurrentRingBufferWorker_));
+            pWorkers[w]->pBuffer    = pBuffer;
+            pWorkers[w]->pLocked    = pLocked;
+            pWorkers[w]->pLockedMtx = pLockedMtx;
+            pWorkers[w]->id         = t;
+            pWorkers[w]->count      = count;
+            pWorkers[w]->batch      = batch;
+        }
+
+        pThreads[t * 2]     = GblThread_create(GblConcurrentRingBufferTestSuite_produce_, &producers[t]);
+        pThreads[t * 2 + 1] = GblThread_create(GblConcurrentRingBufferTestSuite_consume_, &consumers[t]);
+    }
+
+    for(size_t t = 0; t < pairs * 2; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+    }
+
+    GblTimer_stop(&timer);
+
+    for(size_t t = 0; t < pairs; ++t) {
+        produced += producers[t].sum;
+        consumed += consumers[t].sum;
+        errors   += consumers[t].errors;
+    }
+
+    GBL_TEST_COMPARE(errors, 0);
+    GBL_TEST_COMPARE(produced, consumed);
+    GBL_TEST_VERIFY(pLocked? GblRingBuffer_empty(pLocked) : GblConcurrentRingBuffer_empty(pBuffer));
+
+    if(pMs) *pMs = GblTimer_elapsedMs(&timer);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_spscThreads_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &pSelf_->spsc, NULL, NULL, 1,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_,
+                                                              1, NULL));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &pSelf_->spsc, NULL, NULL, 1,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_, NULL));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_mpmcThreads_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &pSelf_->mpmc, NULL, NULL,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_,
+                                                              1, NULL));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &pSelf_->mpmc, NULL, NULL,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_,
+                                                              GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_ / 2, NULL));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_destruct_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblConcurrentRingBufferTestSuite_* pSelf_ = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_destruct(&pSelf_->mpmc));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_destruct(&pSelf_->spsc));
+
+    GBL_TEST_COMPARE(GblConcurrentRingBuffer_capacity(&pSelf_->mpmc), 0);
+    GBL_TEST_VERIFY(GblConcurrentRingBuffer_empty(&pSelf_->spsc));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblConcurrentRingBufferTestSuite_profile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    const size_t            count = GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_ITEMS_ * 10;
+    GblConcurrentRingBuffer spsc, mpmc;
+    GblRingBuffer           locked;
+    mtx_t                   lockedMtx;
+    double                  ms[4];
+
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_construct(&spsc, sizeof(uint32_t), 1024,
+                                                          GBL_CONCURRENT_RING_BUFFER_SPSC));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_construct(&mpmc, sizeof(uint32_t), 1024));
+    GBL_CTX_VERIFY_CALL(GblRingBuffer_construct(&locked, sizeof(uint32_t), 1024));
+    mtx_init(&lockedMtx, mtx_plain);
+
+    for(size_t p = 1; p <= GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_THREADS_; p *= 2) {
+        GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, NULL, &locked, &lockedMtx,
+                                                                  p, count, 1, &ms[0]));
+        GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &mpmc, NULL, NULL,
+                                                                  p, count, 1, &ms[1]));
+        GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &mpmc, NULL, NULL,
+                                                                  p, count,
+                                                                  GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_,
+                                                                  &ms[2]));
+
+        GBL_CTX_INFO("%zu producer(s) -> %zu consumer(s), %zu elements each", p, p, count);
+        GBL_CTX_PUSH();
+        GBL_CTX_INFO("%-16s: %lf ms", "mutex",      ms[0]);
+        GBL_CTX_INFO("%-16s: %lf ms", "mpmc",       ms[1]);
+        GBL_CTX_INFO("%-16s: %lf ms", "mpmc (batch)", ms[2]);
+
+        if(p == 1) {
+            GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &spsc, NULL, NULL,
+                                                                      1, count, 1, &ms[3]));
+            GBL_CTX_INFO("%-16s: %lf ms", "spsc", ms[3]);
+            GBL_CTX_VERIFY_CALL(GblConcurrentRingBufferTestSuite_run_(pCtx, &spsc, NULL, NULL,
+                                                                      1, count,
+                                                                      GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_BATCH_,
+                                                                      &ms[3]));
+            GBL_CTX_INFO("%-16s: %lf ms", "spsc (batch)", ms[3]);
+        }
+        GBL_CTX_POP(1);
+    }
+
+    mtx_destroy(&lockedMtx);
+    GBL_CTX_VERIFY_CALL(GblRingBuffer_destruct(&locked));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_destruct(&mpmc));
+    GBL_CTX_VERIFY_CALL(GblConcurrentRingBuffer_destruct(&spsc));
+
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblType GblConcurrentRingBufferTestSuite_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+
+    const static GblTestCase cases[] = {
+        { "construct",          GblConcurrentRingBufferTestSuite_construct_         },
+        { "constructInvalid",   GblConcurrentRingBufferTestSuite_constructInvalid_  },
+        { "pushPop",            GblConcurrentRingBufferTestSuite_pushPop_           },
+        { "emplaceBack",        GblConcurrentRingBufferTestSuite_emplaceBack_       },
+        { "batch",              GblConcurrentRingBufferTestSuite_batch_             },
+        { "spscThreads",        GblConcurrentRingBufferTestSuite_spscThreads_       },
+        { "mpmcThreads",        GblConcurrentRingBufferTestSuite_mpmcThreads_       },
+        { "destruct",           GblConcurrentRingBufferTestSuite_destruct_          },
+        { "profile",            GblConcurrentRingBufferTestSuite_profile_           },
+        { NULL,                 NULL                                                }
+    };
+
+    const static GblTestSuiteVTable vTable = {
+        .pFnSuiteInit   = GblConcurrentRingBufferTestSuite_init_,
+        .pCases         = cases
+    };
+
+    if(type == GBL_INVALID_TYPE) {
+        GBL_CTX_BEGIN(NULL);
+        type = GblTestSuite_register(GblQuark_internStringStatic("GblConcurrentRingBufferTestSuite"),
+                                     &vTable,
+                                     sizeof(GblConcurrentRingBufferTestSuite),
+                                     sizeof(GblConcurrentRingBufferTestSuite_),
+                                     GBL_TYPE_FLAGS_NONE);
+        GBL_CTX_VERIFY_LAST_RECORD();
+        GBL_CTX_END_BLOCK();
+    }
+
+    return type;
+}
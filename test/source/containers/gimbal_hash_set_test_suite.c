@@ -1,8 +1,13 @@
 #include "containers/gimbal_hash_set_test_suite.h"
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/containers/gimbal_hash_set.h>
+#include <gimbal/algorithms/gimbal_hash.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_HASH_SET_TEST_SUITE_STRESS_TEST_ENTRY_COUNT_     2047
+#define GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_           50000
+#define GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_        5000
+#define GBL_HASH_SET_TEST_SUITE_PROFILE_ENTRY_COUNT_MAX_     10000000
 
 #define GBL_HASH_SET_TEST_SUITE_(inst)     (GBL_PRIVATE(GblHashSetTestSuite, inst))
 
@@ -642,6 +647,291 @@ static GBL_RESULT GblHashSetTestSuite_collidingConstruct_(GblTestSuite* pSelf, G
     GBL_CTX_END();
 }
 
+// Scrambles an index into a pointer-sized key, with hits and misses drawn from disjoint sets
+static uintptr_t pointerKey_(size_t index, GblBool miss) {
+    return (((uintptr_t)index * (uintptr_t)0x9e3779b97f4a7c15ull) << 1) | (miss? 1 : 0);
+}
+
+static GblHash pointerHasher_(const GblHashSet* pSet, const void* pEntry) {
+    GBL_UNUSED(pSet);
+    return gblHashMurmur(pEntry, sizeof(uintptr_t));
+}
+
+static GblBool pointerComparator_(const GblHashSet* pSet, const void* pEntryA, const void* pEntryB) {
+    GBL_UNUSED(pSet);
+    return *(const uintptr_t*)pEntryA == *(const uintptr_t*)pEntryB;
+}
+
+static GblBool pointerCounter_(const GblHashSet* pSet, void* pEntry, void* pUd) {
+    GBL_UNUSED(pSet, pEntry);
+    ++*(size_t*)pUd;
+    return GBL_TRUE;
+}
+
+static GBL_RESULT GblHashSetTestSuite_churn_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblHashSet set;
+    size_t     visited = 0;
+
+    GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_insert(&set, &key));
+    }
+
+    // Erase every other entry, leaving holes scattered throughout every probe sequence
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_; k += 2) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_erase(&set, &key));
+    }
+
+    GBL_TEST_COMPARE(GblHashSet_size(&set), GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_ / 2);
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_COMPARE(GblHashSet_contains(&set, &key), (k & 1)? GBL_TRUE : GBL_FALSE);
+    }
+
+    // Refill the holes with entries that were never present
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_; k += 2) {
+        const uintptr_t key = pointerKey_(k, GBL_TRUE);
+        GBL_TEST_VERIFY(GblHashSet_insert(&set, &key));
+        GBL_TEST_VERIFY(!GblHashSet_insert(&set, &key));
+    }
+
+    GBL_TEST_COMPARE(GblHashSet_size(&set), GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_);
+    GBL_TEST_VERIFY(GblHashSet_foreach(&set, pointerCounter_, &visited));
+    GBL_TEST_COMPARE(visited, GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_);
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_CHURN_ENTRY_COUNT_; ++k) {
+        const uintptr_t  key    = pointerKey_(k, !(k & 1));
+        const uintptr_t* pEntry = GblHashSet_get(&set, &key);
+        GBL_TEST_VERIFY(pEntry);
+        GBL_TEST_COMPARE(*pEntry, key);
+        GBL_TEST_VERIFY(GblHashSet_erase(&set, &key));
+    }
+
+    GBL_TEST_VERIFY(GblHashSet_empty(&set));
+    GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblHashSetTestSuite_reserve_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblHashSet set;
+    GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+
+    GBL_CTX_VERIFY_CALL(GblHashSet_reserve(&set, GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_));
+    const size_t bucketCount = GblHashSet_bucketCount(&set);
+    GBL_TEST_VERIFY(bucketCount >= GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_);
+    GBL_TEST_VERIFY(GblHashSet_empty(&set));
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_insert(&set, &key));
+    }
+
+    // Nothing should have grown past the reservation, and reserving less than the size does nothing
+    GBL_TEST_COMPARE(GblHashSet_bucketCount(&set), bucketCount);
+    GBL_CTX_VERIFY_CALL(GblHashSet_reserve(&set, 0));
+    GBL_TEST_COMPARE(GblHashSet_bucketCount(&set), bucketCount);
+
+    // Erasing shouldn't shrink the table back down below the reservation either
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_erase(&set, &key));
+    }
+
+    GBL_TEST_COMPARE(GblHashSet_bucketCount(&set), bucketCount);
+    GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblHashSetTestSuite_insertMany_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblHashSet set;
+    uintptr_t  keys[GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_];
+    size_t     visited = 0;
+
+    GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+
+    // Half of the keys are already present, and each of the rest appears twice within the array
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 4; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_insert(&set, &key));
+    }
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_; ++k)
+        keys[k] = pointerKey_(k % (GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 2), GBL_FALSE);
+
+    GBL_TEST_COMPARE(GblHashSet_insertMany(&set, keys, GBL_COUNT_OF(keys)),
+                     GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 4);
+    GBL_TEST_COMPARE(GblHashSet_size(&set), GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 2);
+    GBL_TEST_VERIFY(GblHashSet_foreach(&set, pointerCounter_, &visited));
+    GBL_TEST_COMPARE(visited, GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 2);
+
+    for(size_t k = 0; k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_; ++k) {
+        const uintptr_t hit  = pointerKey_(k, GBL_FALSE);
+        const uintptr_t miss = pointerKey_(k, GBL_TRUE);
+        GBL_TEST_COMPARE(GblHashSet_contains(&set, &hit),
+                         (k < GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 2)? GBL_TRUE : GBL_FALSE);
+        GBL_TEST_VERIFY(!GblHashSet_contains(&set, &miss));
+    }
+
+    // Inserting them all again changes nothing
+    GBL_TEST_COMPARE(GblHashSet_insertMany(&set, keys, GBL_COUNT_OF(keys)), 0);
+    GBL_TEST_COMPARE(GblHashSet_insertMany(&set, NULL, 0), 0);
+    GBL_TEST_COMPARE(GblHashSet_size(&set), GBL_HASH_SET_TEST_SUITE_BULK_ENTRY_COUNT_ / 2);
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblHashSet_insertMany(&set, NULL, 1), 0);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblHashSetTestSuite_rehash_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblHashSet set;
+    GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+
+    for(size_t k = 0; k < 1000; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_insert(&set, &key));
+    }
+
+    // Spread the entries out to a load factor below 1/4, rounding up to a power of two
+    GBL_CTX_VERIFY_CALL(GblHashSet_rehash(&set, 4000));
+    GBL_TEST_COMPARE(GblHashSet_bucketCount(&set), 4096);
+
+    for(size_t k = 0; k < 1000; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_contains(&set, &key));
+    }
+
+    // Asking for fewer buckets than fit the entries packs them in as tightly as possible
+    GBL_CTX_VERIFY_CALL(GblHashSet_rehash(&set, 0));
+    GBL_TEST_COMPARE(GblHashSet_bucketCount(&set), 2048);
+    GBL_TEST_COMPARE(GblHashSet_size(&set), 1000);
+
+    for(size_t k = 0; k < 1000; ++k) {
+        const uintptr_t key = pointerKey_(k, GBL_FALSE);
+        GBL_TEST_VERIFY(GblHashSet_contains(&set, &key));
+    }
+
+    GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblHashSetTestSuite_profileBulk_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    for(size_t count = 1000; count <= GBL_HASH_SET_TEST_SUITE_PROFILE_ENTRY_COUNT_MAX_ / 10; count *= 10) {
+        GblHashSet set;
+        GblTimer   timer;
+        double     insertMs, reserveMs, manyMs;
+        uintptr_t* pKeys = GBL_CTX_MALLOC(sizeof(uintptr_t) * count);
+
+        for(size_t k = 0; k < count; ++k)
+            pKeys[k] = pointerKey_(k, GBL_FALSE);
+
+        GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+        GblTimer_start(&timer);
+        for(size_t k = 0; k < count; ++k)
+            GblHashSet_insert(&set, &pKeys[k]);
+        GblTimer_stop(&timer);
+        insertMs = GblTimer_elapsedMs(&timer);
+        GBL_TEST_COMPARE(GblHashSet_size(&set), count);
+        GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+        GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+        GblTimer_start(&timer);
+        GBL_CTX_VERIFY_CALL(GblHashSet_reserve(&set, count));
+        for(size_t k = 0; k < count; ++k)
+            GblHashSet_insert(&set, &pKeys[k]);
+        GblTimer_stop(&timer);
+        reserveMs = GblTimer_elapsedMs(&timer);
+        GBL_TEST_COMPARE(GblHashSet_size(&set), count);
+        GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+        GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+        GblTimer_start(&timer);
+        GBL_TEST_COMPARE(GblHashSet_insertMany(&set, pKeys, count), count);
+        GblTimer_stop(&timer);
+        manyMs = GblTimer_elapsedMs(&timer);
+        GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+
+        GBL_CTX_INFO("%8zu entries: insert %lf ms, reserve + insert %lf ms, insertMany %lf ms",
+                     count, insertMs, reserveMs, manyMs);
+
+        GBL_CTX_FREE(pKeys);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblHashSetTestSuite_profile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    for(size_t count = 1000; count <= GBL_HASH_SET_TEST_SUITE_PROFILE_ENTRY_COUNT_MAX_; count *= 10) {
+        GblHashSet set;
+        GblTimer   timer;
+        double     insertMs, hitMs, missMs;
+        size_t     found = 0;
+
+        GBL_CTX_VERIFY_CALL(GblHashSet_construct(&set, sizeof(uintptr_t), pointerHasher_, pointerComparator_));
+
+        GblTimer_start(&timer);
+        for(size_t k = 0; k < count; ++k) {
+            const uintptr_t key = pointerKey_(k, GBL_FALSE);
+            GblHashSet_set(&set, &key);
+        }
+        GblTimer_stop(&timer);
+        insertMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t k = 0; k < count; ++k) {
+            const uintptr_t key = pointerKey_(k, GBL_FALSE);
+            found += GblHashSet_get(&set, &key) != NULL;
+        }
+        GblTimer_stop(&timer);
+        hitMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t k = 0; k < count; ++k) {
+            const uintptr_t key = pointerKey_(k, GBL_TRUE);
+            found += GblHashSet_get(&set, &key) != NULL;
+        }
+        GblTimer_stop(&timer);
+        missMs = GblTimer_elapsedMs(&timer);
+
+        GBL_TEST_COMPARE(found, count);
+        GBL_CTX_INFO("%8zu entries: insert %lf ms, hit %lf ms, miss %lf ms",
+                     count, insertMs, hitMs, missMs);
+
+        GBL_CTX_VERIFY_CALL(GblHashSet_destruct(&set));
+    }
+
+    GBL_CTX_END();
+}
+
 GBL_EXPORT GblType GblHashSetTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
 
@@ -679,6 +969,12 @@ GBL_EXPORT GblType GblHashSetTestSuite_type(void) {
         { "collidingErase",                  GblHashSetTestSuite_erase_                     },
         { "collidingExtract",                GblHashSetTestSuite_extract_                   },
         { "collidingDestruct",               GblHashSetTestSuite_destruct_                  },
+        { "churn",                           GblHashSetTestSuite_churn_                     },
+        { "reserve",                         GblHashSetTestSuite_reserve_                   },
+        { "insertMany",                      GblHashSetTestSuite_insertMany_                },
+        { "rehash",                          GblHashSetTestSuite_rehash_                    },
+        { "profileBulk",                     GblHashSetTestSuite_profileBulk_               },
+        { "profile",                         GblHashSetTestSuite_profile_                   },
         { NULL,                              NULL                                           }
     };
 
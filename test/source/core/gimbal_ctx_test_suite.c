@@ -0,0 +1,236 @@
+#include "core/gimbal_ctx_test_suite.h"
+#include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/core/gimbal_ctx.h>
+#include <gimbal/containers/gimbal_hash_set.h>
+#include <gimbal/strings/gimbal_string_view.h>
+#include <gimbal/utils/gimbal_timer.h>
+
+#define GBL_SELF_TYPE GblCtxTestSuite
+
+#define GBL_CTX_TEST_SUITE_PROFILE_CALLS_       1000000
+#define GBL_CTX_TEST_SUITE_PROFILE_ALLOC_CALLS_ 100000
+
+GBL_TEST_FIXTURE {
+    unsigned dummy;
+};
+
+GBL_TEST_NO_INIT
+
+GBL_TEST_NO_FINAL
+
+static GBL_RESULT GblCtxTestSuite_bareCall_(int value) {
+    return value? GBL_RESULT_ERROR_INVALID_ARG : GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblCtxTestSuite_frameCall_(int value) {
+    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_VERIFY(!value,
+                   GBL_RESULT_ERROR_INVALID_ARG,
+                   "Invalid value: %d", value);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblCtxTestSuite_outerFrameCall_(int value) {
+    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_VERIFY_CALL(GblCtxTestSuite_frameCall_(value));
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblCtxTestSuite_leafCall_(int value) {
+    GBL_CTX_LEAF_BEGIN();
+    GBL_CTX_LEAF_VERIFY(!value,
+                        GBL_RESULT_ERROR_INVALID_ARG,
+                        "Invalid value: %d", value);
+    GBL_CTX_LEAF_END();
+}
+
+static GBL_RESULT GblCtxTestSuite_leafDefaultCall_(const void* pValue) {
+    GBL_CTX_LEAF_BEGIN();
+    GBL_CTX_LEAF_VERIFY_POINTER(pValue);
+    GBL_CTX_LEAF_VERIFY(*(const int*)pValue >= 0,
+                        GBL_RESULT_ERROR_OUT_OF_RANGE);
+    GBL_CTX_LEAF_END();
+}
+
+static GBL_RESULT GblCtxTestSuite_outerLeafCall_(int value) {
+    GBL_CTX_BEGIN(NULL);
+    GBL_CTX_VERIFY_CALL(GblCtxTestSuite_leafCall_(value));
+    GBL_CTX_END();
+}
+
+// Keeps the calls being profiled from being inlined into their loops
+static GBL_RESULT (*volatile pFnBare_)(int)  = GblCtxTestSuite_bareCall_;
+static GBL_RESULT (*volatile pFnFrame_)(int) = GblCtxTestSuite_frameCall_;
+static GBL_RESULT (*volatile pFnLeaf_)(int)  = GblCtxTestSuite_leafCall_;
+
+static GblBool GblCtxTestSuite_hashSetCmp_(const GblHashSet* pSet, const void* pA, const void* pB) {
+    GBL_UNUSED(pSet);
+    return *(const int*)pA == *(const int*)pB;
+}
+
+static GblHash GblCtxTestSuite_hashSetHash_(const GblHashSet* pSet, const void* pItem) {
+    GBL_UNUSED(pSet);
+    return *(const int*)pItem;
+}
+
+GBL_TEST_CASE(frame)
+    GBL_TEST_COMPARE(GBL_CTX_FRAME(), GBL_CTX_FRAME_NAME);
+    GBL_TEST_COMPARE(GBL_CTX_CONTEXT(), pCtx);
+    GBL_TEST_VERIFY(sizeof(GblLeafFrame) < sizeof(GblStackFrame));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(recordSet)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_frameCall_(7), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, "Invalid value: 7");
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().srcLocation.pFunc, "GblCtxTestSuite_frameCall_");
+
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(recordCleared)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_frameCall_(7), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_frameCall_(0), GBL_RESULT_SUCCESS);
+    GBL_TEST_VERIFY(!GBL_RESULT_ERROR(GBL_CTX_LAST_RESULT()));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(recordNested)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_outerFrameCall_(3), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, "Invalid value: 3");
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().srcLocation.pFunc, "GblCtxTestSuite_frameCall_");
+
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(leaf)
+    const GblStackFrame* pFrame = GBL_CTX_FRAME();
+
+    GBL_TEST_CALL(GblCtxTestSuite_leafCall_(0));
+    GBL_TEST_COMPARE(GBL_CTX_FRAME(), pFrame);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(leafRecordSet)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_leafCall_(7), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, "Invalid value: 7");
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().srcLocation.pFunc, "GblCtxTestSuite_leafCall_");
+
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(leafRecordDefault)
+    const int value = -1;
+
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_leafDefaultCall_(NULL), GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, "Invalid Pointer");
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_leafDefaultCall_(&value), GBL_RESULT_ERROR_OUT_OF_RANGE);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, gblResultString(GBL_RESULT_ERROR_OUT_OF_RANGE));
+
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(leafRecordNested)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblCtxTestSuite_outerLeafCall_(3), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().message, "Invalid value: 3");
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RECORD().srcLocation.pFunc, "GblCtxTestSuite_leafCall_");
+
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(profileFrame)
+    GblTimer timer;
+    size_t   failures = 0;
+    double   bareNs, frameNs, leafNs;
+
+    GblTimer_start(&timer);
+    for(size_t c = 0; c < GBL_CTX_TEST_SUITE_PROFILE_CALLS_; ++c)
+        failures += !GBL_RESULT_SUCCESS(pFnBare_(0));
+    GblTimer_stop(&timer);
+    bareNs = (double)GblTimer_elapsedNs(&timer) / GBL_CTX_TEST_SUITE_PROFILE_CALLS_;
+
+    GblTimer_start(&timer);
+    for(size_t c = 0; c < GBL_CTX_TEST_SUITE_PROFILE_CALLS_; ++c)
+        failures += !GBL_RESULT_SUCCESS(pFnFrame_(0));
+    GblTimer_stop(&timer);
+    frameNs = (double)GblTimer_elapsedNs(&timer) / GBL_CTX_TEST_SUITE_PROFILE_CALLS_;
+
+    GblTimer_start(&timer);
+    for(size_t c = 0; c < GBL_CTX_TEST_SUITE_PROFILE_CALLS_; ++c)
+        failures += !GBL_RESULT_SUCCESS(pFnLeaf_(0));
+    GblTimer_stop(&timer);
+    leafNs = (double)GblTimer_elapsedNs(&timer) / GBL_CTX_TEST_SUITE_PROFILE_CALLS_;
+
+    GBL_TEST_COMPARE(failures, 0);
+
+    GBL_CTX_INFO("bare call %lf ns, GBL_CTX_BEGIN()/GBL_CTX_END() call %lf ns, frame overhead %lf ns",
+                 bareNs, frameNs, frameNs - bareNs);
+    GBL_CTX_INFO("GBL_CTX_LEAF_BEGIN()/GBL_CTX_LEAF_END() call %lf ns, leaf frame overhead %lf ns",
+                 leafNs, leafNs - bareNs);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(profileStringViewFind)
+    GblTimer  timer;
+    size_t    found = 0;
+    const GblStringView view   = GBL_STRV("the quick brown fox");
+    const GblStringView substr = GBL_STRV("fox");
+
+    GblTimer_start(&timer);
+    for(size_t c = 0; c < GBL_CTX_TEST_SUITE_PROFILE_CALLS_; ++c)
+        found += GblStringView_find(view, substr, 0) == 16;
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(found, GBL_CTX_TEST_SUITE_PROFILE_CALLS_);
+
+    GBL_CTX_INFO("GblStringView_find() %lf ns",
+                 (double)GblTimer_elapsedNs(&timer) / GBL_CTX_TEST_SUITE_PROFILE_CALLS_);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(profileHashSetConstruct)
+    GblTimer   timer;
+    GblHashSet set;
+    size_t     failures = 0;
+
+    GblTimer_start(&timer);
+    for(size_t c = 0; c < GBL_CTX_TEST_SUITE_PROFILE_ALLOC_CALLS_; ++c) {
+        failures += !GBL_RESULT_SUCCESS(GblHashSet_construct(&set,
+                                                             sizeof(int),
+                                                             GblCtxTestSuite_hashSetHash_,
+                                                             GblCtxTestSuite_hashSetCmp_));
+        failures += !GBL_RESULT_SUCCESS(GblHashSet_destruct(&set));
+    }
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(failures, 0);
+
+    GBL_CTX_INFO("GblHashSet_construct() + GblHashSet_destruct() %lf ns",
+                 (double)GblTimer_elapsedNs(&timer) / GBL_CTX_TEST_SUITE_PROFILE_ALLOC_CALLS_);
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(frame,
+                  recordSet,
+                  recordCleared,
+                  recordNested,
+                  leaf,
+                  leafRecordSet,
+                  leafRecordDefault,
+                  leafRecordNested,
+                  profileFrame,
+                  profileStringViewFind,
+                  profileHashSetConstruct)
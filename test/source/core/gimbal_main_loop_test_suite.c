@@ -0,0 +1,533 @@
+#include "core/gimbal_main_loop_test_suite.h"
+#include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/core/gimbal_main_loop.h>
+#include <gimbal/core/gimbal_task.h>
+#include <gimbal/utils/gimbal_timer.h>
+#include <stdatomic.h>
+
+#define GBL_SELF_TYPE GblMainLoopTestSuite
+
+#define GBL_TEST_TASK_TYPE_                 (GBL_TYPEID(GblTestTask))
+#define GBL_TEST_TASK_(self)                (GBL_CAST(GblTestTask, self))
+
+#define GBL_MAIN_LOOP_TEST_TASK_COUNT_      256
+#define GBL_MAIN_LOOP_TEST_CHILD_COUNT_     8
+#define GBL_MAIN_LOOP_PROFILE_TASK_COUNT_   4096
+#define GBL_MAIN_LOOP_PROFILE_WORKERS_      4
+
+GBL_FORWARD_DECLARE_STRUCT(GblTestTask);
+
+GBL_CLASS_DERIVE_EMPTY(GblTestTask, GblTask)
+
+GBL_INSTANCE_DERIVE(GblTestTask, GblTask)
+    GblPriority    priority;
+    atomic_size_t* pCounter;
+    GblTestTask**  ppOrder;
+    GblMainLoop*   pStopLoop;
+    GblMainLoop*   pSpawnLoop;
+    GblMainLoop*   pExecLoop;
+    GBL_RESULT     execResult;
+    GblBool        execRunning;
+    GblTestTask**  ppChildren;
+    size_t         childCount;
+GBL_INSTANCE_END
+
+GBL_TEST_FIXTURE {
+    GblMainLoop*  pLoop;
+    GblTestTask*  pTasks[GBL_MAIN_LOOP_TEST_TASK_COUNT_];
+    GblTestTask*  pOrder[GBL_MAIN_LOOP_TEST_TASK_COUNT_];
+    atomic_size_t counter;
+    size_t        idleCount;
+    size_t        enqueuedCount;
+    GblTask*      pLastEnqueued;
+};
+
+static GblType GblTestTask_type(void);
+
+static GBL_RESULT GblTestTask_GblTask_exec_(GblTask* pTask) {
+    GblTestTask* pSelf = (GblTestTask*)pTask;
+
+    if(pSelf->pCounter)
+        atomic_fetch_add_explicit(pSelf->pCounter, 1, memory_order_relaxed);
+
+    if(pSelf->ppOrder)
+        *pSelf->ppOrder = pSelf;
+
+    if(pSelf->pStopLoop)
+        GblMainLoop_stop(pSelf->pStopLoop);
+
+    if(pSelf->pExecLoop) {
+        pSelf->execResult  = GblMainLoop_exec(pSelf->pExecLoop);
+        pSelf->execRunning = GblMainLoop_isRunning(pSelf->pExecLoop);
+    }
+
+    for(size_t c = 0; c < pSelf->childCount; ++c)
+        GblMainLoop_dispatch(pSelf->pSpawnLoop, GBL_TASK(pSelf->ppChildren[c]));
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTestTask_GblTask_priority_(const GblTask* pTask, GblPriority* pPriority) {
+    *pPriority = ((const GblTestTask*)pTask)->priority;
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTestTask_init_(GblInstance* pInstance) {
+    ((GblTestTask*)pInstance)->priority = GBL_PRIORITY_DEFAULT;
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTestTaskClass_init_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pUd);
+
+    GBL_TASK_CLASS(pClass)->pFnExec     = GblTestTask_GblTask_exec_;
+    GBL_TASK_CLASS(pClass)->pFnPriority = GblTestTask_GblTask_priority_;
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GblType GblTestTask_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+
+    if(type == GBL_INVALID_TYPE) {
+        type = GblType_register(GblQuark_internStringStatic("GblTestTask"),
+                                GBL_TASK_TYPE,
+                                &(GblTypeInfo) {
+                                    .pFnClassInit    = GblTestTaskClass_init_,
+                                    .classSize       = sizeof(GblTestTaskClass),
+                                    .pFnInstanceInit = GblTestTask_init_,
+                                    .instanceSize    = sizeof(GblTestTask)
+                                },
+                                GBL_TYPE_FLAGS_NONE);
+    }
+
+    return type;
+}
+
+static void GblMainLoopTestSuite_execIdle_(GblMainLoop* pLoop) {
+    GBL_UNUSED(pLoop);
+    GblTestFixture* pFixture = GblClosure_currentUserdata();
+    ++pFixture->idleCount;
+}
+
+static void GblMainLoopTestSuite_taskEnqueued_(GblMainLoop* pLoop, GblTask* pTask) {
+    GBL_UNUSED(pLoop);
+    GblTestFixture* pFixture = GblClosure_currentUserdata();
+    ++pFixture->enqueuedCount;
+    pFixture->pLastEnqueued = pTask;
+}
+
+static GBL_RESULT GblMainLoopTestSuite_resetTasks_(GblTestFixture* pFixture, size_t count) {
+    GBL_CTX_BEGIN(NULL);
+
+    atomic_store(&pFixture->counter, 0);
+
+    for(size_t t = 0; t < count; ++t) {
+        GblTestTask* pTask = pFixture->pTasks[t];
+
+        GBL_CTX_VERIFY_CALL(GblTask_reset(GBL_TASK(pTask)));
+        pTask->priority        = GBL_PRIORITY_DEFAULT;
+        pTask->pCounter        = &pFixture->counter;
+        pTask->ppOrder         = NULL;
+        pTask->pStopLoop       = NULL;
+        pTask->pSpawnLoop      = NULL;
+        pTask->pExecLoop       = NULL;
+        pTask->execResult      = GBL_RESULT_UNKNOWN;
+        pTask->execRunning     = GBL_FALSE;
+        pTask->ppChildren      = NULL;
+        pTask->childCount      = 0;
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblMainLoopTestSuite_dispatchAll_(GblTestFixture* pFixture, size_t count) {
+    GBL_CTX_BEGIN(NULL);
+
+    for(size_t t = 0; t < count; ++t)
+        GBL_CTX_VERIFY_CALL(GblMainLoop_dispatch(pFixture->pLoop, GBL_TASK(pFixture->pTasks[t])));
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_wait(pFixture->pLoop));
+
+    GBL_CTX_VERIFY(atomic_load(&pFixture->counter) == count,
+                   GBL_RESULT_ERROR_INVALID_OPERATION,
+                   "Only %zu/%zu tasks were executed!",
+                   atomic_load(&pFixture->counter), count);
+
+    GBL_CTX_END();
+}
+
+GBL_TEST_INIT()
+    atomic_init(&pFixture->counter, 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_FINAL()
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(create)
+    pFixture->pLoop = GBL_NEW(GblMainLoop);
+
+    GBL_TEST_VERIFY(pFixture->pLoop);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+    GBL_TEST_COMPARE(GblMainLoop_top(pFixture->pLoop), NULL);
+    GBL_TEST_COMPARE(GblMainLoop_workerCount(pFixture->pLoop), 0);
+    GBL_TEST_COMPARE(GblMainLoop_pending(pFixture->pLoop), 0);
+    GBL_TEST_VERIFY(!GblMainLoop_isRunning(pFixture->pLoop));
+
+    for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+        pFixture->pTasks[t] = GBL_NEW(GblTestTask);
+
+    for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+        GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pFixture->pTasks[t])), GBL_TASK_STATE_READY);
+
+    GBL_TEST_CALL(GblSignal_connect(GBL_INSTANCE(pFixture->pLoop),
+                                    "execIdle",
+                                    GBL_INSTANCE(pFixture->pLoop),
+                                    GBL_CALLBACK(GblMainLoopTestSuite_execIdle_),
+                                    pFixture));
+
+    GBL_TEST_CALL(GblSignal_connect(GBL_INSTANCE(pFixture->pLoop),
+                                    "taskEnqueued",
+                                    GBL_INSTANCE(pFixture->pLoop),
+                                    GBL_CALLBACK(GblMainLoopTestSuite_taskEnqueued_),
+                                    pFixture));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(enqueueInvalid)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblMainLoop_enqueue(pFixture->pLoop, NULL),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(enqueue)
+    static const GblPriority priorities[] = {
+        GBL_PRIORITY_LOW,
+        GBL_PRIORITY_HIGH,
+        GBL_PRIORITY_DEFAULT,
+        GBL_PRIORITY_HIGH,
+        GBL_PRIORITY_IDLE
+    };
+
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, GBL_COUNT_OF(priorities)));
+
+    for(size_t t = 0; t < GBL_COUNT_OF(priorities); ++t) {
+        GblTestTask* pTask = pFixture->pTasks[t];
+
+        pTask->priority = priorities[t];
+        pTask->ppOrder  = &pFixture->pOrder[t];
+
+        GBL_TEST_CALL(GblMainLoop_enqueue(pFixture->pLoop, GBL_TASK(pTask)));
+        GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pTask)), GBL_TASK_STATE_QUEUED);
+    }
+
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), GBL_COUNT_OF(priorities));
+    GBL_TEST_COMPARE(pFixture->enqueuedCount, GBL_COUNT_OF(priorities));
+    GBL_TEST_COMPARE(pFixture->pLastEnqueued, GBL_TASK(pFixture->pTasks[GBL_COUNT_OF(priorities) - 1]));
+    GBL_TEST_COMPARE(GblMainLoop_top(pFixture->pLoop), GBL_TASK(pFixture->pTasks[1]));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(enqueueQueued)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblMainLoop_enqueue(pFixture->pLoop, GBL_TASK(pFixture->pTasks[0])),
+                     GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 5);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(cancel)
+    GBL_TEST_CALL(GblMainLoop_cancel(pFixture->pLoop, GBL_TASK(pFixture->pTasks[2])));
+
+    GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pFixture->pTasks[2])), GBL_TASK_STATE_CANCELED);
+    GBL_TEST_VERIFY(GblTask_isDone(GBL_TASK(pFixture->pTasks[2])));
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 4);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(cancelInvalid)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblMainLoop_cancel(pFixture->pLoop, GBL_TASK(pFixture->pTasks[2])),
+                     GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 4);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(iteration)
+    static const size_t order[] = { 1, 3, 0, 4 };
+
+    for(size_t i = 0; i < GBL_COUNT_OF(order); ++i) {
+        GblTestTask* pTask = pFixture->pTasks[order[i]];
+
+        GBL_TEST_COMPARE(GblMainLoop_top(pFixture->pLoop), GBL_TASK(pTask));
+        GBL_TEST_CALL(GblMainLoop_iteration(pFixture->pLoop));
+        GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pTask)), GBL_TASK_STATE_FINISHED);
+        GBL_TEST_COMPARE(GblTask_result(GBL_TASK(pTask)), GBL_RESULT_SUCCESS);
+        GBL_TEST_COMPARE(pFixture->pOrder[order[i]], pTask);
+        GBL_TEST_COMPARE(pFixture->pLoop->prevTaskPriority, (GBL_PRIORITY_LEVEL)pTask->priority);
+    }
+
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), GBL_COUNT_OF(order));
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+    GBL_TEST_COMPARE(GblMainLoop_top(pFixture->pLoop), NULL);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(reset)
+    GblTask* pFinished = GBL_TASK(pFixture->pTasks[1]);
+    GblTask* pCanceled = GBL_TASK(pFixture->pTasks[2]);
+
+    GBL_TEST_CALL(GblTask_reset(pFinished));
+    GBL_TEST_COMPARE(GblTask_state(pFinished), GBL_TASK_STATE_READY);
+    GBL_TEST_COMPARE(GblTask_result(pFinished), GBL_RESULT_UNKNOWN);
+    GBL_TEST_VERIFY(!GblTask_isDone(pFinished));
+
+    GBL_TEST_CALL(GblTask_reset(pCanceled));
+    GBL_TEST_COMPARE(GblTask_state(pCanceled), GBL_TASK_STATE_READY);
+
+    // resetting a task which is already ready does nothing
+    GBL_TEST_CALL(GblTask_reset(pCanceled));
+    GBL_TEST_COMPARE(GblTask_state(pCanceled), GBL_TASK_STATE_READY);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(resetQueued)
+    GblTask* pTask = GBL_TASK(pFixture->pTasks[1]);
+
+    GBL_TEST_CALL(GblMainLoop_enqueue(pFixture->pLoop, pTask));
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblTask_reset(pTask), GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+    GBL_TEST_COMPARE(GblTask_state(pTask), GBL_TASK_STATE_QUEUED);
+
+    GBL_TEST_CALL(GblMainLoop_cancel(pFixture->pLoop, pTask));
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(iterationIdle)
+    GBL_TEST_CALL(GblMainLoop_iteration(pFixture->pLoop));
+    GBL_TEST_COMPARE(pFixture->idleCount, 1);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(exec)
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, 3));
+
+    pFixture->pTasks[2]->priority  = GBL_PRIORITY_LOW;
+    pFixture->pTasks[2]->pStopLoop = pFixture->pLoop;
+
+    for(size_t t = 0; t < 3; ++t)
+        GBL_TEST_CALL(GblMainLoop_enqueue(pFixture->pLoop, GBL_TASK(pFixture->pTasks[t])));
+
+    GBL_TEST_CALL(GblMainLoop_exec(pFixture->pLoop));
+
+    GBL_TEST_VERIFY(!GblMainLoop_isRunning(pFixture->pLoop));
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), 3);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(execNested)
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, 2));
+
+    pFixture->pTasks[0]->pExecLoop = pFixture->pLoop;
+    pFixture->pTasks[1]->priority  = GBL_PRIORITY_LOW;
+    pFixture->pTasks[1]->pStopLoop = pFixture->pLoop;
+
+    for(size_t t = 0; t < 2; ++t)
+        GBL_TEST_CALL(GblMainLoop_enqueue(pFixture->pLoop, GBL_TASK(pFixture->pTasks[t])));
+
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_CALL(GblMainLoop_exec(pFixture->pLoop));
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(pFixture->pTasks[0]->execResult, GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_TEST_VERIFY(pFixture->pTasks[0]->execRunning);
+    GBL_TEST_VERIFY(!GblMainLoop_isRunning(pFixture->pLoop));
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), 2);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatchNoWorkers)
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, 1));
+
+    GBL_TEST_CALL(GblMainLoop_dispatch(pFixture->pLoop, GBL_TASK(pFixture->pTasks[0])));
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 1);
+    GBL_TEST_COMPARE(GblMainLoop_pending(pFixture->pLoop), 0);
+
+    GBL_TEST_CALL(GblMainLoop_iteration(pFixture->pLoop));
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), 1);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(startWorkers)
+    GBL_TEST_CALL(GblMainLoop_startWorkers(pFixture->pLoop, GBL_MAIN_LOOP_PROFILE_WORKERS_));
+    GBL_TEST_COMPARE(GblMainLoop_workerCount(pFixture->pLoop), GBL_MAIN_LOOP_PROFILE_WORKERS_);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(startWorkersInvalid)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblMainLoop_startWorkers(pFixture->pLoop, 2),
+                     GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblMainLoop_workerCount(pFixture->pLoop), GBL_MAIN_LOOP_PROFILE_WORKERS_);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatch)
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+    GBL_TEST_CALL(GblMainLoopTestSuite_dispatchAll_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+
+    for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+        GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pFixture->pTasks[t])), GBL_TASK_STATE_FINISHED);
+
+    GBL_TEST_COMPARE(GblMainLoop_pending(pFixture->pLoop), 0);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatchFromWorkers)
+    const size_t parents = GBL_MAIN_LOOP_TEST_CHILD_COUNT_;
+    const size_t total   = parents * (GBL_MAIN_LOOP_TEST_CHILD_COUNT_ + 1);
+
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, total));
+
+    // Children are dispatched onto the worker's own deque, then stolen by its peers
+    for(size_t p = 0; p < parents; ++p) {
+        GblTestTask* pParent = pFixture->pTasks[p];
+
+        pParent->pSpawnLoop = pFixture->pLoop;
+        pParent->ppChildren = &pFixture->pTasks[parents + p * GBL_MAIN_LOOP_TEST_CHILD_COUNT_];
+        pParent->childCount = GBL_MAIN_LOOP_TEST_CHILD_COUNT_;
+    }
+
+    for(size_t p = 0; p < parents; ++p)
+        GBL_TEST_CALL(GblMainLoop_dispatch(pFixture->pLoop, GBL_TASK(pFixture->pTasks[p])));
+
+    GBL_TEST_CALL(GblMainLoop_wait(pFixture->pLoop));
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), total);
+
+    for(size_t t = 0; t < total; ++t)
+        GBL_TEST_COMPARE(GblTask_state(GBL_TASK(pFixture->pTasks[t])), GBL_TASK_STATE_FINISHED);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatchQueued)
+    GBL_TEST_EXPECT_ERROR();
+
+    atomic_store(&GBL_TASK(pFixture->pTasks[0])->state, GBL_TASK_STATE_QUEUED);
+
+    GBL_TEST_COMPARE(GblMainLoop_dispatch(pFixture->pLoop, GBL_TASK(pFixture->pTasks[0])),
+                     GBL_RESULT_ERROR_INVALID_OPERATION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblMainLoop_pending(pFixture->pLoop), 0);
+
+    atomic_store(&GBL_TASK(pFixture->pTasks[0])->state, GBL_TASK_STATE_READY);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(stopWorkers)
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+
+    for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+        GBL_TEST_CALL(GblMainLoop_dispatch(pFixture->pLoop, GBL_TASK(pFixture->pTasks[t])));
+
+    // Must drain everything which was dispatched before joining
+    GBL_TEST_CALL(GblMainLoop_stopWorkers(pFixture->pLoop));
+
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), GBL_MAIN_LOOP_TEST_TASK_COUNT_);
+    GBL_TEST_COMPARE(GblMainLoop_workerCount(pFixture->pLoop), 0);
+    GBL_TEST_COMPARE(GblMainLoop_pending(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(sequentialProfile)
+    GblTimer timer;
+
+    GBL_TEST_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+
+    GblTimer_start(&timer);
+
+    for(size_t r = 0; r < GBL_MAIN_LOOP_PROFILE_TASK_COUNT_ / GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++r) {
+        for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+            GBL_TEST_CALL(GblMainLoop_enqueue(pFixture->pLoop, GBL_TASK(pFixture->pTasks[t])));
+
+        while(GblMainLoop_depth(pFixture->pLoop))
+            GBL_TEST_CALL(GblMainLoop_iteration(pFixture->pLoop));
+    }
+
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(atomic_load(&pFixture->counter), GBL_MAIN_LOOP_PROFILE_TASK_COUNT_);
+    GBL_CTX_INFO("%u tasks on the priority queues: %lf ms",
+                 GBL_MAIN_LOOP_PROFILE_TASK_COUNT_, GblTimer_elapsedMs(&timer));
+GBL_TEST_CASE_END
+
+static GBL_RESULT GblMainLoopTestSuite_workersProfile_(GblContext* pCtx, GblTestFixture* pFixture, size_t workers) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblTimer timer;
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_startWorkers(pFixture->pLoop, workers));
+    GBL_CTX_VERIFY_CALL(GblMainLoopTestSuite_resetTasks_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+
+    GblTimer_start(&timer);
+
+    for(size_t r = 0; r < GBL_MAIN_LOOP_PROFILE_TASK_COUNT_ / GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++r) {
+        atomic_store(&pFixture->counter, 0);
+        GBL_CTX_VERIFY_CALL(GblMainLoopTestSuite_dispatchAll_(pFixture, GBL_MAIN_LOOP_TEST_TASK_COUNT_));
+    }
+
+    GblTimer_stop(&timer);
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_stopWorkers(pFixture->pLoop));
+
+    GBL_CTX_INFO("%u tasks on %zu worker(s): %lf ms",
+                 GBL_MAIN_LOOP_PROFILE_TASK_COUNT_, workers, GblTimer_elapsedMs(&timer));
+
+    GBL_CTX_END();
+}
+
+GBL_TEST_CASE(dispatchProfile1)
+    GBL_TEST_CALL(GblMainLoopTestSuite_workersProfile_(pCtx, pFixture, 1));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatchProfile2)
+    GBL_TEST_CALL(GblMainLoopTestSuite_workersProfile_(pCtx, pFixture, 2));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(dispatchProfile4)
+    GBL_TEST_CALL(GblMainLoopTestSuite_workersProfile_(pCtx, pFixture, GBL_MAIN_LOOP_PROFILE_WORKERS_));
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(unref)
+    for(size_t t = 0; t < GBL_MAIN_LOOP_TEST_TASK_COUNT_; ++t)
+        GBL_TEST_COMPARE(GBL_UNREF(pFixture->pTasks[t]), 0);
+
+    GBL_TEST_COMPARE(GBL_UNREF(pFixture->pLoop), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(create,
+                  enqueueInvalid,
+                  enqueue,
+                  enqueueQueued,
+                  cancel,
+                  cancelInvalid,
+                  iteration,
+                  reset,
+                  resetQueued,
+                  iterationIdle,
+                  exec,
+                  execNested,
+                  dispatchNoWorkers,
+                  startWorkers,
+                  startWorkersInvalid,
+                  dispatch,
+                  dispatchFromWorkers,
+                  dispatchQueued,
+                  stopWorkers,
+                  sequentialProfile,
+                  dispatchProfile1,
+                  dispatchProfile2,
+                  dispatchProfile4,
+                  unref)
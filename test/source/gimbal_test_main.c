@@ -7,6 +7,7 @@
 #include "containers/gimbal_array_list_test_suite.h"
 #include "containers/gimbal_ring_list_test_suite.h"
 #include "containers/gimbal_ring_buffer_test_suite.h"
+#include "containers/gimbal_concurrent_ring_buffer_test_suite.h"
 #include "containers/gimbal_array_map_test_suite.h"
 #include "containers/gimbal_tree_set_test_suite.h"
 #include "containers/gimbal_hash_set_test_suite.h"
@@ -14,6 +15,7 @@
 #include "containers/gimbal_array_heap_test_suite.h"
 #include "allocators/gimbal_arena_allocator_test_suite.h"
 #include "allocators/gimbal_pool_allocator_test_suite.h"
+#include "allocators/gimbal_concurrent_pool_allocator_test_suite.h"
 #include "allocators/gimbal_scope_allocator_test_suite.h"
 #include "utils/gimbal_ref_test_suite.h"
 #include "utils/gimbal_byte_array_test_suite.h"
@@ -23,6 +25,7 @@
 #include "strings/gimbal_string_buffer_test_suite.h"
 #include "strings/gimbal_string_list_test_suite.h"
 #include "strings/gimbal_pattern_test_suite.h"
+#include "strings/gimbal_pattern_set_test_suite.h"
 #include "meta/types/gimbal_type_test_suite.h"
 #include "meta/classes/gimbal_class_test_suite.h"
 #include "meta/ifaces/gimbal_interface_test_suite.h"
@@ -43,8 +46,10 @@
 #include "utils/gimbal_cmd_parser_test_suite.h"
 #include "utils/gimbal_date_time_test_suite.h"
 #include "utils/gimbal_bit_view_test_suite.h"
+#include "core/gimbal_ctx_test_suite.h"
 #include "core/gimbal_module_test_suite.h"
 #include "core/gimbal_thread_test_suite.h"
+#include "core/gimbal_main_loop_test_suite.h"
 #include "utils/gimbal_scanner_test_suite.h"
 
 #include <math.h>
@@ -141,6 +146,8 @@ int main(int argc, char* pArgv[]) {
                                  GblTestSuite_create(GBL_RING_LIST_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_RING_BUFFER_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(pScenario,
+                                 GblTestSuite_create(GBL_CONCURRENT_RING_BUFFER_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_ARRAY_MAP_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
@@ -155,6 +162,8 @@ int main(int argc, char* pArgv[]) {
                                  GblTestSuite_create(GBL_ARENA_ALLOCATOR_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_POOL_ALLOCATOR_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(pScenario,
+                                 GblTestSuite_create(GBL_CONCURRENT_POOL_ALLOCATOR_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_SCOPE_ALLOCATOR_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
@@ -173,6 +182,8 @@ int main(int argc, char* pArgv[]) {
                                  GblTestSuite_create(GBL_STRING_BUFFER_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_PATTERN_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(pScenario,
+                                 GblTestSuite_create(GBL_PATTERN_SET_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_STRING_LIST_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
@@ -213,10 +224,14 @@ int main(int argc, char* pArgv[]) {
                                  GblTestSuite_create(GBL_BIT_VIEW_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_SCANNER_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(pScenario,
+                                 GblTestSuite_create(GBL_CTX_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_MODULE_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_THREAD_TEST_SUITE_TYPE));
+    GblTestScenario_enqueueSuite(pScenario,
+                                 GblTestSuite_create(GBL_MAIN_LOOP_TEST_SUITE_TYPE));
     GblTestScenario_enqueueSuite(pScenario,
                                  GblTestSuite_create(GBL_ITABLE_VARIANT_TEST_SUITE_TYPE));
 
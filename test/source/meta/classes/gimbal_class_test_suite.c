@@ -2,9 +2,15 @@
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/core/gimbal_ctx.h>
 #include <gimbal/meta/classes/gimbal_class.h>
+#include <gimbal/meta/ifaces/gimbal_ivariant.h>
+#include <gimbal/meta/ifaces/gimbal_ievent_filter.h>
+#include <gimbal/meta/instances/gimbal_object.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_CLASS_TEST_SUITE_(inst)     (GBL_PRIVATE(GblClassTestSuite, inst))
 
+#define GBL_CLASS_TEST_SUITE_CAST_PROFILE_ITERATIONS_   100000
+
 typedef struct GblClassTestSuite_ {
     size_t      initialStaticClassRefCount;
     GblClass*   pClassRef;
@@ -432,6 +438,50 @@ static GBL_RESULT GblClassTestSuite_destructFloating_(GblTestSuite* pSelf, GblCo
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblClassTestSuite_castProfileRun_(GblContext* pCtx, GblClass* pClass, GblType toType) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblClass* pExpected = GblClass_cast(pClass, toType);
+    size_t    hits      = 0;
+    GblTimer  timer;
+
+    GBL_TEST_VERIFY(pExpected);
+    GBL_TEST_VERIFY(GblClass_check(pExpected, toType));
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_CLASS_TEST_SUITE_CAST_PROFILE_ITERATIONS_; ++i)
+        hits += (GblClass_cast(pClass, toType) == pExpected);
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(hits, GBL_CLASS_TEST_SUITE_CAST_PROFILE_ITERATIONS_);
+
+    GBL_CTX_INFO("%s => %s: %zu casts: %lf ms",
+                 GblType_name(GblClass_typeOf(pClass)),
+                 GblType_name(toType),
+                 (size_t)GBL_CLASS_TEST_SUITE_CAST_PROFILE_ITERATIONS_,
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblClassTestSuite_castProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblClass* pClass = GblClass_refDefault(GBL_OBJECT_TYPE);
+
+    GBL_CTX_VERIFY_CALL(GblClassTestSuite_castProfileRun_(pCtx, pClass, GBL_BOX_TYPE));
+    GBL_CTX_VERIFY_CALL(GblClassTestSuite_castProfileRun_(pCtx, pClass, GBL_IVARIANT_TYPE));
+    GBL_CTX_VERIFY_CALL(GblClassTestSuite_castProfileRun_(pCtx, pClass, GBL_IEVENT_FILTER_TYPE));
+    GBL_CTX_VERIFY_CALL(GblClassTestSuite_castProfileRun_(pCtx,
+                                                          GblClass_cast(pClass, GBL_IEVENT_FILTER_TYPE),
+                                                          GBL_IVARIANT_TYPE));
+
+    GblClass_unrefDefault(pClass);
+
+    GBL_CTX_END();
+}
+
 GBL_EXPORT GblType GblClassTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
 
@@ -468,6 +518,7 @@ GBL_EXPORT GblType GblClassTestSuite_type(void) {
         { "constructFloating",          GblClassTestSuite_constructFloating_        },
         { "destroyFloatingInvalid",     GblClassTestSuite_destroyFloatingInvalid_   },
         { "destructFloating",           GblClassTestSuite_destructFloating_         },
+        { "castProfile",                GblClassTestSuite_castProfile_              },
         { NULL,                         NULL                                        }
     };
 
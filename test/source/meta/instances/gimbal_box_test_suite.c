@@ -1,22 +1,62 @@
 #include "meta/instances/gimbal_box_test_suite.h"
 #include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_SELF_TYPE GblBoxTestSuite
 
+#define GBL_BOX_TEST_SUITE_POOL_THREADS_        4
+#define GBL_BOX_TEST_SUITE_POOL_ROUNDS_         2000
+#define GBL_BOX_TEST_SUITE_PROFILE_BOXES_       10000
+
+// Small, high-churn GblBox, registered both with and without GBL_TYPE_FLAG_INSTANCE_POOLED
+typedef struct PoolBox_ {
+    GblBox   base;
+    uint64_t payload[4];
+} PoolBox_;
+
+typedef struct PoolBoxWorker_ {
+    GblType type;
+    size_t  errors;
+} PoolBoxWorker_;
+
 GBL_TEST_FIXTURE {
     size_t       refCount;
     GblQuark     testQuark;
     GblBool      userDtorCalled;
     size_t       fieldDtorsCalled;
     GblBoxClass* pBoxClass;
+    GblType      pooledType;
+    GblType      unpooledType;
 };
 
 GBL_TEST_INIT()
+    static const GblTypeInfo poolBoxInfo = {
+        .classSize           = sizeof(GblBoxClass),
+        .instanceSize        = sizeof(PoolBox_),
+        .instancePrivateSize = sizeof(uint64_t)
+    };
+
     pFixture->testQuark = GblQuark_fromStringStatic("test");
     pFixture->refCount  = GblRef_activeCount();
+
+    pFixture->pooledType = GblType_register("PooledBox",
+                                            GBL_BOX_TYPE,
+                                            &poolBoxInfo,
+                                            GBL_TYPE_FLAG_TYPEINFO_STATIC |
+                                            GBL_TYPE_FLAG_INSTANCE_POOLED);
+    GBL_CTX_VERIFY_LAST_RECORD();
+
+    pFixture->unpooledType = GblType_register("UnpooledBox",
+                                              GBL_BOX_TYPE,
+                                              &poolBoxInfo,
+                                              GBL_TYPE_FLAG_TYPEINFO_STATIC);
+    GBL_CTX_VERIFY_LAST_RECORD();
 GBL_TEST_CASE_END
 
 GBL_TEST_FINAL()
+    GBL_TEST_CALL(GblType_unregister(pFixture->pooledType));
+    GBL_TEST_CALL(GblType_unregister(pFixture->unpooledType));
     GBL_TEST_COMPARE(pFixture->refCount, GblRef_activeCount());
 GBL_TEST_CASE_END
 
@@ -206,6 +246,102 @@ GBL_TEST_CASE(classDestructField)
     GBL_TEST_COMPARE(pFixture->fieldDtorsCalled, 3);
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(pooledCreateInvalid)
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_VERIFY(!GblBox_create(pFixture->pooledType, sizeof(PoolBox_) * 2));
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(pooledCreateUnref)
+    PoolBox_* pBox = (PoolBox_*)GblBox_create(pFixture->pooledType, sizeof(PoolBox_));
+    GBL_TEST_VERIFY(pBox);
+    GBL_TEST_COMPARE(GBL_TYPEOF(pBox), pFixture->pooledType);
+    GBL_TEST_COMPARE(GblBox_refCount(GBL_BOX(pBox)), 1);
+    GBL_TEST_COMPARE(pBox->payload[3], 0);
+    GBL_TEST_COMPARE(*(uint64_t*)GblInstance_private(GBL_INSTANCE(pBox), pFixture->pooledType), 0);
+
+    // dirty the entry, to make sure it comes back out of the pool zeroed
+    PoolBox_* pOld = pBox;
+    pBox->payload[3] = 0xdeadbeef;
+    *(uint64_t*)GblInstance_private(GBL_INSTANCE(pBox), pFixture->pooledType) = 0xdeadbeef;
+    GBL_TEST_COMPARE(GblBox_unref(GBL_BOX(pBox)), 0);
+
+    pBox = (PoolBox_*)GblBox_create(pFixture->pooledType);
+    GBL_TEST_COMPARE(pBox, pOld);
+    GBL_TEST_COMPARE(pBox->payload[3], 0);
+    GBL_TEST_COMPARE(*(uint64_t*)GblInstance_private(GBL_INSTANCE(pBox), pFixture->pooledType), 0);
+    GBL_TEST_COMPARE(GblBox_unref(GBL_BOX(pBox)), 0);
+    GBL_TEST_COMPARE(GblType_instanceCount(pFixture->pooledType), 0);
+GBL_TEST_CASE_END
+
+static GBL_RESULT pooledThreadRun_(GblThread* pThread) {
+    PoolBoxWorker_* pWorker = GblBox_userdata(GBL_BOX(pThread));
+    GblBox*         pBoxes[8];
+
+    for(size_t r = 0; r < GBL_BOX_TEST_SUITE_POOL_ROUNDS_; ++r) {
+        const size_t burst = 1 + r % 8;
+
+        for(size_t b = 0; b < burst; ++b)
+            if(!(pBoxes[b] = GblBox_create(pWorker->type)))
+                ++pWorker->errors;
+
+        for(size_t b = 0; b < burst; ++b)
+            if(pBoxes[b] && GblBox_unref(pBoxes[b]) != 0)
+                ++pWorker->errors;
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+GBL_TEST_CASE(pooledCreateUnrefThreaded)
+    PoolBoxWorker_ workers[GBL_BOX_TEST_SUITE_POOL_THREADS_];
+    GblThread*     pThreads[GBL_BOX_TEST_SUITE_POOL_THREADS_];
+
+    // keep the class alive, so the workers aren't racing to create and destroy it
+    GblBox* pKeepAlive = GblBox_create(pFixture->pooledType);
+
+    for(size_t t = 0; t < GBL_BOX_TEST_SUITE_POOL_THREADS_; ++t) {
+        workers[t]  = (PoolBoxWorker_){ .type = pFixture->pooledType };
+        pThreads[t] = GblThread_create(pooledThreadRun_, &workers[t]);
+    }
+
+    for(size_t t = 0; t < GBL_BOX_TEST_SUITE_POOL_THREADS_; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+        GBL_TEST_COMPARE(workers[t].errors, 0);
+    }
+
+    GBL_TEST_COMPARE(GblBox_unref(pKeepAlive), 0);
+    GBL_TEST_COMPARE(GblType_instanceCount(pFixture->pooledType), 0);
+GBL_TEST_CASE_END
+
+static double profileCreateUnref_(GblType type) {
+    GblTimer timer;
+
+    // keep the class alive, so it isn't torn down and rebuilt every iteration
+    GblBox* pKeepAlive = GblBox_create(type);
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_BOX_TEST_SUITE_PROFILE_BOXES_; ++i)
+        GblBox_unref(GblBox_create(type));
+    GblTimer_stop(&timer);
+
+    GblBox_unref(pKeepAlive);
+
+    return (double)GblTimer_elapsedNs(&timer) / GBL_BOX_TEST_SUITE_PROFILE_BOXES_;
+}
+
+GBL_TEST_CASE(profilePooledCreateUnref)
+    const double unpooled = profileCreateUnref_(pFixture->unpooledType);
+    const double pooled   = profileCreateUnref_(pFixture->pooledType);
+    GBL_CTX_VERIFY_LAST_RECORD();
+
+    GBL_CTX_INFO("GblBox_create()/unref() [unpooled]: %lf ns", unpooled);
+    GBL_CTX_INFO("GblBox_create()/unref() [pooled]:   %lf ns", pooled);
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(classCreateFloatingInvalid,
                   classConstructFloatingInvalid,
                   classCreateDestroyFloating,
@@ -214,4 +350,8 @@ GBL_TEST_REGISTER(classCreateFloatingInvalid,
                   classTakeField,
                   classReplaceField,
                   classClearField,
-                  classDestructField)
+                  classDestructField,
+                  pooledCreateInvalid,
+                  pooledCreateUnref,
+                  pooledCreateUnrefThreaded,
+                  profilePooledCreateUnref)
@@ -1,9 +1,13 @@
 #include "meta/instances/gimbal_instance_test_suite.h"
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/meta/instances/gimbal_instance.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_INSTANCE_TEST_SUITE_(inst)      (GBL_PRIVATE(GblInstanceTestSuite, inst))
 
+#define GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_        8
+#define GBL_INSTANCE_TEST_SUITE_PROFILE_INSTANCES_  10000
+
 // instantiate from: 1) non instantiable
 //                   2) type with private data
 // swizzling incompatible class
@@ -15,8 +19,20 @@ typedef struct GblInstanceTestSuite_ {
     size_t          instanceStartInstanceRefCount;
     size_t          instanceStartClassRefCount;
     GblInstance*    pInstance;
+    GblType         chainTypes[GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_];
 } GblInstanceTestSuite_;
 
+// Instance shared by every level of the chain, each of which also adds some private data
+typedef struct ChainInstance_ {
+    GblInstance base;
+    size_t      initCount;
+} ChainInstance_;
+
+static GBL_RESULT ChainInstance_init_(GblInstance* pInstance) {
+    ++((ChainInstance_*)pInstance)->initCount;
+    return GBL_RESULT_SUCCESS;
+}
+
 GBL_EXPORT GBL_RESULT GblInstanceTestSuite_init_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
 
@@ -25,6 +41,24 @@ GBL_EXPORT GBL_RESULT GblInstanceTestSuite_init_(GblTestSuite* pSelf, GblContext
     pSelf_->instanceStartInstanceRefCount   = GblType_instanceCount(GBL_INSTANCE_TYPE);
     pSelf_->instanceStartClassRefCount      = GblType_classRefCount(GBL_INSTANCE_TYPE);
 
+    static const GblTypeInfo chainInfo = {
+        .classSize              = sizeof(GblClass),
+        .instanceSize           = sizeof(ChainInstance_),
+        .instancePrivateSize    = sizeof(uint32_t),
+        .pFnInstanceInit        = ChainInstance_init_
+    };
+
+    GblType base = GBL_INSTANCE_TYPE;
+    for(size_t d = 0; d < GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_; ++d) {
+        char name[32];
+        snprintf(name, sizeof(name), "ChainInstance%zu", d);
+        base = pSelf_->chainTypes[d] = GblType_register(name,
+                                                        base,
+                                                        &chainInfo,
+                                                        GBL_TYPE_FLAG_TYPEINFO_STATIC);
+        GBL_CTX_VERIFY_LAST_RECORD();
+    }
+
     GBL_CTX_END();
 }
 
@@ -247,10 +281,69 @@ GBL_EXPORT GBL_RESULT GblInstanceTestSuite_floatClassInvalid(GblTestSuite* pSelf
     GBL_CTX_END();
 }
 
+GBL_EXPORT GBL_RESULT GblInstanceTestSuite_initChain(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblInstanceTestSuite_* pSelf_ = GBL_INSTANCE_TEST_SUITE_(pSelf);
+
+    for(size_t d = 0; d < GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_; ++d) {
+        GblInstance* pInstance = GblInstance_create(pSelf_->chainTypes[d]);
+        GBL_CTX_VERIFY_LAST_RECORD();
+        GBL_TEST_COMPARE(GBL_TYPEOF(pInstance), pSelf_->chainTypes[d]);
+        GBL_TEST_COMPARE(((ChainInstance_*)pInstance)->initCount, d + 1);
+        for(size_t p = 0; p <= d; ++p)
+            GBL_TEST_COMPARE(*(uint32_t*)GblInstance_private(pInstance, pSelf_->chainTypes[p]), 0);
+        GBL_TEST_COMPARE(GblType_instanceCount(pSelf_->chainTypes[d]), 1);
+        GBL_TEST_COMPARE(GblInstance_destroy(pInstance), 0);
+        GBL_TEST_COMPARE(GblType_classRefCount(pSelf_->chainTypes[d]), 0);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblInstanceTestSuite_profileCreateDestroy_(GblContext* pCtx, GblType type, const char* pLabel) {
+    GBL_CTX_BEGIN(pCtx);
+    GblTimer timer;
+
+    // keep one instance alive, so the default class isn't torn down and rebuilt every iteration
+    GblInstance* pKeepAlive = GblInstance_create(type);
+    GBL_CTX_VERIFY_LAST_RECORD();
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_INSTANCE_TEST_SUITE_PROFILE_INSTANCES_; ++i) {
+        GblInstance* pInstance = GblInstance_create(type);
+        GBL_TEST_VERIFY(pInstance);
+        GblInstance_destroy(pInstance);
+    }
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(GblInstance_destroy(pKeepAlive), 0);
+    GBL_CTX_VERIFY_LAST_RECORD();
+
+    GBL_CTX_INFO("GblInstance_create()/destroy() [%s]: %lf ns",
+                 pLabel,
+                 (double)GblTimer_elapsedNs(&timer) / GBL_INSTANCE_TEST_SUITE_PROFILE_INSTANCES_);
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GBL_RESULT GblInstanceTestSuite_profileCreateShallow(GblTestSuite* pSelf, GblContext* pCtx) {
+    return GblInstanceTestSuite_profileCreateDestroy_(pCtx,
+                                                      GBL_INSTANCE_TEST_SUITE_(pSelf)->chainTypes[0],
+                                                      "depth 1");
+}
+
+GBL_EXPORT GBL_RESULT GblInstanceTestSuite_profileCreateDeep(GblTestSuite* pSelf, GblContext* pCtx) {
+    return GblInstanceTestSuite_profileCreateDestroy_(pCtx,
+                                                      GBL_INSTANCE_TEST_SUITE_(pSelf)->chainTypes[GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_-1],
+                                                      "depth " GBL_STRINGIFY(GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_));
+}
+
 GBL_EXPORT GBL_RESULT GblInstanceTestSuite_final_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
 
     GblInstanceTestSuite_* pSelf_ = GBL_INSTANCE_TEST_SUITE_(pSelf);
+
+    for(size_t d = GBL_INSTANCE_TEST_SUITE_CHAIN_DEPTH_; d > 0; --d)
+        GBL_CTX_VERIFY_CALL(GblType_unregister(pSelf_->chainTypes[d-1]));
     GBL_TEST_COMPARE(GblType_instanceCount(GBL_INSTANCE_TYPE),   pSelf_->instanceStartInstanceRefCount);
     GBL_TEST_COMPARE(GblType_classRefCount(GBL_INSTANCE_TYPE),      pSelf_->instanceStartClassRefCount);
 
@@ -280,6 +373,9 @@ GBL_EXPORT GblType GblInstanceTestSuite_type(void) {
         { "swizzleClassInvalid",        GblInstanceTestSuite_swizzleClassInvalid        },
         { "sinkClassInvalid",           GblInstanceTestSuite_sinkClassInvalid           },
         { "floatClassInvalid",          GblInstanceTestSuite_floatClassInvalid          },
+        { "initChain",                  GblInstanceTestSuite_initChain                  },
+        { "profileCreateShallow",       GblInstanceTestSuite_profileCreateShallow       },
+        { "profileCreateDeep",          GblInstanceTestSuite_profileCreateDeep          },
         { NULL,                         NULL                                            }
     };
 
@@ -3,9 +3,15 @@
 #include <gimbal/meta/instances/gimbal_event.h>
 #include <gimbal/meta/types/gimbal_variant.h>
 #include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/utils/gimbal_option_group.h>
+#include <gimbal/utils/gimbal_timer.h>
 #include <math.h>
 
+#define GBL_OBJECT_TEST_SUITE_PROFILE_OBJECTS_  1000
+#define GBL_OBJECT_TEST_SUITE_PROFILE_ACCESSES_ 2000
+
 GBL_FORWARD_DECLARE_STRUCT(TestObject);
+GBL_FORWARD_DECLARE_STRUCT(TestPropertyObject);
 
 #define GBL_OBJECT_TEST_SUITE_(inst)        (GBL_PRIVATE(GblObjectTestSuite, inst))
 
@@ -189,6 +195,75 @@ GBL_EXPORT GblType TestObject_type(void) {
     return type;
 }
 
+#define TEST_PROPERTY_OBJECT_TYPE           (GBL_TYPEID(TestPropertyObject))
+#define TEST_PROPERTY_OBJECT(instance)      (GBL_CAST(TestPropertyObject, instance))
+
+GBL_EXPORT GblType TestPropertyObject_type(void);
+
+typedef struct TestPropertyObject {
+    GblObject   base;
+    int32_t     values[20];
+} TestPropertyObject;
+
+GBL_PROPERTIES(TestPropertyObject,
+    (p0,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p1,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p2,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p3,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p4,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p5,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p6,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p7,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p8,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p9,  GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p10, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p11, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p12, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p13, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p14, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p15, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p16, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p17, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p18, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE),
+    (p19, GBL_GENERIC, (READ, WRITE, CONSTRUCT), GBL_INT32_TYPE)
+)
+
+static GBL_RESULT TestPropertyObject_property_(const GblObject* pSelf, const GblProperty* pProp, GblVariant* pValue) {
+    return GblVariant_setValueCopy(pValue, pProp->valueType, TEST_PROPERTY_OBJECT(pSelf)->values[pProp->id]);
+}
+
+static GBL_RESULT TestPropertyObject_setProperty_(GblObject* pSelf, const GblProperty* pProp, GblVariant* pValue) {
+    return GblVariant_copyValue(pValue, &TEST_PROPERTY_OBJECT(pSelf)->values[pProp->id]);
+}
+
+static GBL_RESULT TestPropertyObjectClass_init_(GblClass* pClass, const void* pUd) {
+    GBL_UNUSED(pUd);
+    GBL_CTX_BEGIN(NULL);
+    if(!GblType_classRefCount(TEST_PROPERTY_OBJECT_TYPE)) {
+        GBL_PROPERTIES_REGISTER(TestPropertyObject);
+    }
+    GBL_OBJECT_CLASS(pClass)->pFnProperty    = TestPropertyObject_property_;
+    GBL_OBJECT_CLASS(pClass)->pFnSetProperty = TestPropertyObject_setProperty_;
+    GBL_CTX_END();
+}
+
+GBL_EXPORT GblType TestPropertyObject_type(void) {
+    static GblType type = GBL_INVALID_TYPE;
+    if(type == GBL_INVALID_TYPE) {
+        const GblTypeInfo info = {
+            .pFnClassInit   = TestPropertyObjectClass_init_,
+            .classSize      = sizeof(GblObjectClass),
+            .instanceSize   = sizeof(TestPropertyObject)
+        };
+
+        type = GblType_register("TestPropertyObject",
+                                GBL_OBJECT_TYPE,
+                                &info,
+                                GBL_TYPE_FLAGS_NONE);
+    }
+    return type;
+}
+
 static GBL_RESULT GblObjectTestSuite_init_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GblObjectTestSuite_* pSelf_ = GBL_OBJECT_TEST_SUITE_(pSelf);
@@ -202,6 +277,8 @@ static GBL_RESULT GblObjectTestSuite_final_(GblTestSuite* pSelf, GblContext* pCt
     GBL_CTX_BEGIN(pCtx);
     GBL_TEST_COMPARE(GblType_classRefCount(TEST_OBJECT_TYPE), 0);
     GblType_unregister(TestObject_type());
+    GBL_TEST_COMPARE(GblType_classRefCount(TEST_PROPERTY_OBJECT_TYPE), 0);
+    GblType_unregister(TestPropertyObject_type());
     GBL_CTX_END();
 }
 
@@ -599,6 +676,185 @@ static GBL_RESULT GblObjectTestSuite_propertySet_(GblTestSuite* pSelf, GblContex
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblObjectTestSuite_propertyTable_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblObject* pObj = GblObject_create(TEST_OBJECT_TYPE,
+                                       "floater",  7.0f,
+                                       "stringer", "Table",
+                                       NULL);
+
+    const size_t baseCount = GblProperty_count(GBL_OBJECT_TYPE);
+    GBL_TEST_COMPARE(GblProperty_count(TEST_OBJECT_TYPE), baseCount + TestObject_Property_Id_count);
+
+    // inherited properties keep their indices within derived types
+    for(size_t p = 0; p < baseCount; ++p) {
+        const GblProperty* pProp = GblProperty_at(GBL_OBJECT_TYPE, p);
+        GBL_TEST_COMPARE(GblProperty_index(pProp), p);
+        GBL_TEST_COMPARE(GblProperty_at(TEST_OBJECT_TYPE, p), pProp);
+        GBL_TEST_COMPARE(GblProperty_find(TEST_OBJECT_TYPE, GblProperty_nameString(pProp)), pProp);
+    }
+
+    // own properties follow, in declaration order
+    const GblProperty* pFloater = GblProperty_find(TEST_OBJECT_TYPE, "floater");
+    GBL_TEST_COMPARE(GblProperty_index(pFloater), baseCount + TestObject_Property_Id_floater);
+    GBL_TEST_COMPARE(GblProperty_at(TEST_OBJECT_TYPE, GblProperty_count(TEST_OBJECT_TYPE)), NULL);
+
+    // iteration only visits the type's own properties
+    GBL_TEST_COMPARE(GblProperty_next(TEST_OBJECT_TYPE, NULL, GBL_PROPERTY_FLAG_ALL), pFloater);
+    const GblProperty* pStringer = GblProperty_next(TEST_OBJECT_TYPE, pFloater, GBL_PROPERTY_FLAG_WRITE);
+    GBL_TEST_COMPARE(GblProperty_nameString(pStringer), "stringer");
+    GBL_TEST_COMPARE(GblProperty_next(TEST_OBJECT_TYPE, pStringer, GBL_PROPERTY_FLAG_WRITE), NULL);
+
+    // accessing properties by index
+    float floater = 0.0f;
+    GBL_CTX_VERIFY_CALL(GblObject_propertyById(pObj, GblProperty_index(pFloater), &floater));
+    GBL_TEST_COMPARE(floater, 7.0f);
+    GBL_CTX_VERIFY_CALL(GblObject_setPropertyById(pObj, GblProperty_index(pFloater), 8.0f));
+    GBL_TEST_COMPARE(TEST_OBJECT(pObj)->floater, 8.0f);
+
+    GblVariant variant = GBL_VARIANT_INIT;
+    GBL_CTX_VERIFY_CALL(GblVariant_constructValueCopy(&variant, GBL_STRING_TYPE, "ById"));
+    GBL_CTX_VERIFY_CALL(GblObject_setPropertyVariantById(pObj, GblProperty_index(pStringer), &variant));
+    GBL_CTX_VERIFY_CALL(GblObject_propertyVariantById(pObj, GblProperty_index(pStringer), &variant));
+    GBL_TEST_COMPARE(GblVariant_toString(&variant), "ById");
+    GBL_CTX_VERIFY_CALL(GblVariant_destruct(&variant));
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblObject_propertyById(pObj, GblProperty_count(TEST_OBJECT_TYPE), &floater),
+                     GBL_RESULT_ERROR_INVALID_PROPERTY);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblBox_unref(GBL_BOX(pObj)), 0);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblObjectTestSuite_propertyOverride_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblClass* pClass = GblClass_refDefault(GBL_OPTION_GROUP_TYPE);
+
+    const GblProperty* pBase     = GblProperty_find(GBL_OBJECT_TYPE, "name");
+    const GblProperty* pOverride = GblProperty_find(GBL_OPTION_GROUP_TYPE, "name");
+
+    // overrides take over the slot of the property they override
+    GBL_TEST_VERIFY(pBase != pOverride);
+    GBL_TEST_COMPARE(GblProperty_objectType(pOverride), GBL_OPTION_GROUP_TYPE);
+    GBL_TEST_COMPARE(GblProperty_index(pOverride), GblProperty_index(pBase));
+    GBL_TEST_COMPARE(GblProperty_at(GBL_OPTION_GROUP_TYPE, GblProperty_index(pBase)), pOverride);
+    GBL_TEST_COMPARE(GblProperty_count(GBL_OPTION_GROUP_TYPE),
+                     GblProperty_count(GBL_OBJECT_TYPE) + GblOptionGroup_Property_Id_count - 1);
+
+    GblClass_unrefDefault(pClass);
+    GBL_CTX_END();
+}
+
+static GblBool GblObjectTestSuite_propertyInstallIter_(const GblProperty* pProp, void* pClosure) {
+    GBL_UNUSED(pProp);
+    GblProperty** ppInstalled = pClosure;
+
+    // Replaces the table being iterated over, which must stay readable until the iteration is done
+    if(!*ppInstalled) {
+        *ppInstalled = GblProperty_create(GBL_PROPERTY_TYPE,
+                                          "installedDuringIteration",
+                                          TestObject_Property_Id_count,
+                                          GBL_PROPERTY_FLAG_READ,
+                                          1,
+                                          GBL_INT32_TYPE);
+        GblProperty_install(TEST_OBJECT_TYPE, *ppInstalled);
+    }
+
+    return GBL_FALSE;
+}
+
+static GBL_RESULT GblObjectTestSuite_propertyInstallIterating_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblProperty* pInstalled = NULL;
+    const size_t count      = GblProperty_count(TEST_OBJECT_TYPE);
+
+    GBL_TEST_VERIFY(!GblProperty_foreach(TEST_OBJECT_TYPE,
+                                         GBL_PROPERTY_FLAG_ALL,
+                                         GblObjectTestSuite_propertyInstallIter_,
+                                         &pInstalled));
+    GBL_TEST_VERIFY(pInstalled);
+    GBL_TEST_COMPARE(GblProperty_count(TEST_OBJECT_TYPE), count + 1);
+    GBL_TEST_COMPARE(GblProperty_find(TEST_OBJECT_TYPE, "installedDuringIteration"), pInstalled);
+    GBL_TEST_COMPARE(GblProperty_index(pInstalled), count);
+
+    GBL_TEST_VERIFY(GblProperty_uninstall(TEST_OBJECT_TYPE, "installedDuringIteration"));
+    GBL_TEST_COMPARE(GblProperty_count(TEST_OBJECT_TYPE), count);
+    GBL_TEST_COMPARE(GblProperty_find(TEST_OBJECT_TYPE, "installedDuringIteration"), NULL);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblObjectTestSuite_profilePropertyConstruct_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblTimer timer;
+
+    GblTimer_start(&timer);
+    for(size_t o = 0; o < GBL_OBJECT_TEST_SUITE_PROFILE_OBJECTS_; ++o) {
+        GblObject* pObj = GblObject_create(TEST_PROPERTY_OBJECT_TYPE,
+                                           "p0",  0,  "p1",  1,  "p2",  2,  "p3",  3,
+                                           "p4",  4,  "p5",  5,  "p6",  6,  "p7",  7,
+                                           "p8",  8,  "p9",  9,  "p10", 10, "p11", 11,
+                                           "p12", 12, "p13", 13, "p14", 14, "p15", 15,
+                                           "p16", 16, "p17", 17, "p18", 18, "p19", 19,
+                                           NULL);
+        GBL_TEST_COMPARE(TEST_PROPERTY_OBJECT(pObj)->values[19], 19);
+        GBL_TEST_COMPARE(GblBox_unref(GBL_BOX(pObj)), 0);
+    }
+    GblTimer_stop(&timer);
+
+    GBL_CTX_INFO("GblObject_create() with 20 properties: %lf us",
+                 GblTimer_elapsedUs(&timer) / GBL_OBJECT_TEST_SUITE_PROFILE_OBJECTS_);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblObjectTestSuite_profilePropertyAccess_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    static const char* pNames[TestPropertyObject_Property_Id_count] = {
+        "p0",  "p1",  "p2",  "p3",  "p4",  "p5",  "p6",  "p7",  "p8",  "p9",
+        "p10", "p11", "p12", "p13", "p14", "p15", "p16", "p17", "p18", "p19"
+    };
+    const size_t accesses = GBL_OBJECT_TEST_SUITE_PROFILE_ACCESSES_ * TestPropertyObject_Property_Id_count;
+    GblObject*   pObj     = GblObject_create(TEST_PROPERTY_OBJECT_TYPE, NULL);
+    const size_t first    = GblProperty_index(GblProperty_find(TEST_PROPERTY_OBJECT_TYPE, "p0"));
+    int32_t      value    = 0;
+    int64_t      sum      = 0;
+    GblTimer     timer;
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_OBJECT_TEST_SUITE_PROFILE_ACCESSES_; ++i) {
+        for(size_t p = 0; p < TestPropertyObject_Property_Id_count; ++p) {
+            GBL_CTX_VERIFY_CALL(GblObject_setProperty(pObj, pNames[p], (int32_t)(i + p)));
+            GBL_CTX_VERIFY_CALL(GblObject_property(pObj, pNames[p], &value));
+            sum += value;
+        }
+    }
+    GblTimer_stop(&timer);
+    const double byName = (double)GblTimer_elapsedNs(&timer) / accesses;
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_OBJECT_TEST_SUITE_PROFILE_ACCESSES_; ++i) {
+        for(size_t p = 0; p < TestPropertyObject_Property_Id_count; ++p) {
+            GBL_CTX_VERIFY_CALL(GblObject_setPropertyById(pObj, first + p, (int32_t)(i + p)));
+            GBL_CTX_VERIFY_CALL(GblObject_propertyById(pObj, first + p, &value));
+            sum -= value;
+        }
+    }
+    GblTimer_stop(&timer);
+    const double byId   = (double)GblTimer_elapsedNs(&timer) / accesses;
+
+    GBL_TEST_COMPARE(sum, 0);
+    GBL_CTX_INFO("set + get by name: %lf ns, by id: %lf ns", byName, byId);
+
+    GBL_TEST_COMPARE(GblBox_unref(GBL_BOX(pObj)), 0);
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblObjectTestSuite_parenting_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_UNUSED(pSelf);
     GBL_CTX_BEGIN(pCtx);
@@ -865,6 +1121,11 @@ GBL_EXPORT GblType GblObjectTestSuite_type(void) {
         { "newInPlaceVariantsWithClass",        GblObjectTestSuite_newInPlaceVariantsWithClass_         },
         { "propertyGet",                        GblObjectTestSuite_propertyGet_                         },
         { "propertySet",                        GblObjectTestSuite_propertySet_                         },
+        { "propertyTable",                      GblObjectTestSuite_propertyTable_                       },
+        { "propertyOverride",                   GblObjectTestSuite_propertyOverride_                    },
+        { "propertyInstallIterating",           GblObjectTestSuite_propertyInstallIterating_            },
+        { "profilePropertyConstruct",           GblObjectTestSuite_profilePropertyConstruct_            },
+        { "profilePropertyAccess",              GblObjectTestSuite_profilePropertyAccess_               },
         { "parenting",                          GblObjectTestSuite_parenting_                           },
         { "classSwizzle",                       GblObjectTestSuite_classSwizzle_                        },
         { "eventNotify",                        GblObjectTestSuite_eventNotify_                         },
@@ -3,8 +3,16 @@
 #include <gimbal/meta/signals/gimbal_signal.h>
 #include <gimbal/meta/signals/gimbal_closure.h>
 #include <gimbal/meta/signals/gimbal_c_closure.h>
+#include <gimbal/utils/gimbal_timer.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/core/gimbal_main_loop.h>
 
-#define GBL_SIGNAL_TEST_SUITE_(inst)    (GBL_PRIVATE(GblSignalTestSuite, inst))
+#define GBL_SIGNAL_TEST_SUITE_(inst)                (GBL_PRIVATE(GblSignalTestSuite, inst))
+#define GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_   20000
+#define GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_     256
+#define GBL_SIGNAL_TEST_SUITE_THREADS_              8
+#define GBL_SIGNAL_TEST_SUITE_THREAD_CHURN_         2000
+#define GBL_SIGNAL_TEST_SUITE_THREAD_EMITS_         100000
 
 typedef enum TYPE_ {
     TYPE_I_A_,
@@ -79,6 +87,7 @@ typedef struct GblSignalTestSuite_ {
     GblInstance*        pSignalCurrentEmitters[SIGNAL_COUNT_][INSTANCE_COUNT_];
     void*               pClosureUserdata;
     GblClosure*         pClosure;
+    size_t              profileCount;
 } GblSignalTestSuite_;
 
 void s_IA_Slot_(SignalInstance_* pReceiver, GblBool arg) {
@@ -124,6 +133,45 @@ void s_2_CB_Slot_(SignalInstance_* pReceiver, double arg) {
     pReceiver->pSelf_->pClosureUserdata = GblBox_userdata(GBL_BOX(GblClosure_current()));
 }
 
+void s_Profile_Slot_(SignalInstance_* pReceiver, uint32_t arg) {
+    pReceiver->pSelf_->profileCount += arg;
+}
+
+// Works for any receiver, finding the test suite through the closure's userdata
+void s_Any_Slot_(GblInstance* pReceiver, uint32_t arg) {
+    GBL_UNUSED(pReceiver);
+    ((GblSignalTestSuite_*)GblClosure_currentUserdata())->profileCount += arg;
+}
+
+static GBL_THREAD_LOCAL size_t threadReceived_ = 0;
+
+// Counts deliveries per emitting thread, without any shared state between them
+void s_Thread_Slot_(GblInstance* pReceiver, uint32_t arg) {
+    GBL_UNUSED(pReceiver);
+    threadReceived_ += arg;
+}
+
+typedef struct SignalWorker_ {
+    GblInstance*    pEmitter;   // NULL to emit on a private emitter
+    GblSignalId     id;
+    size_t          count;
+    GblBool         churn;      // connect and disconnect around every emission
+    size_t          received;
+    GBL_RESULT      result;
+} SignalWorker_;
+
+// Does the same thing as the builtin marshal, but isn't one, so it can't be skipped
+static GBL_RESULT customMarshal_(GblClosure* pClosure,
+                                 GblVariant* pRetValue,
+                                 size_t      argCount,
+                                 GblVariant* pArgs,
+                                 GblPtr      pMarshalData)
+{
+    return GblVariant_typeOf(&pArgs[1]) == GBL_DOUBLE_TYPE?
+               GblMarshal_CClosure_VOID__INSTANCE_DOUBLE(pClosure, pRetValue, argCount, pArgs, pMarshalData) :
+               GblMarshal_CClosure_VOID__INSTANCE_UINT32(pClosure, pRetValue, argCount, pArgs, pMarshalData);
+}
+
 static GBL_RESULT classInit_(GblClass* pClass, const void* pUd) {
     GBL_CTX_BEGIN(NULL);
 
@@ -963,6 +1011,512 @@ static GBL_RESULT GblSignalTestSuite_disconnect_(GblTestSuite* pSelf, GblContext
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblSignalTestSuite_id_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_ = GBL_SIGNAL_TEST_SUITE_(pSelf);
+
+    const GblSignalId id = GblSignal_id(pSelf_->types[TYPE_I_A_], "S_IA");
+    GBL_TEST_VERIFY(id != GBL_SIGNAL_ID_INVALID);
+
+    // Signals are resolved through base types and their interfaces
+    GBL_TEST_COMPARE(GblSignal_id(pSelf_->types[TYPE_C_A_], "S_IA"), id);
+    GBL_TEST_COMPARE(GblSignal_id(pSelf_->types[TYPE_C_B_], "S_IA"), id);
+    GBL_TEST_VERIFY(GblSignal_id(pSelf_->types[TYPE_C_B_], "S_IBBase") != GBL_SIGNAL_ID_INVALID);
+
+    // ...but never through derived types
+    GBL_TEST_COMPARE(GblSignal_id(pSelf_->types[TYPE_C_A_], "S_1_CB"), GBL_SIGNAL_ID_INVALID);
+    GBL_TEST_COMPARE(GblSignal_id(pSelf_->types[TYPE_C_B_], "lolol"), GBL_SIGNAL_ID_INVALID);
+    GBL_TEST_COMPARE(GblSignal_id(pSelf_->types[TYPE_C_B_], NULL), GBL_SIGNAL_ID_INVALID);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_emitByIdInvalid_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GBL_TEST_EXPECT_ERROR();
+
+    GblSignalTestSuite_* pSelf_ = GBL_SIGNAL_TEST_SUITE_(pSelf);
+
+    GBL_TEST_COMPARE(GblSignal_emitById(GBL_INSTANCE(pSelf_->pInstances[INSTANCE_5_]), GBL_SIGNAL_ID_INVALID, 1.0),
+                     GBL_RESULT_ERROR_INVALID_HANDLE);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblSignal_emitById(NULL, GblSignal_id(pSelf_->types[TYPE_C_B_], "S_2_CB"), 1.0),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_emitById_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_    = GBL_SIGNAL_TEST_SUITE_(pSelf);
+    GblInstance*         pEmitter  = GBL_INSTANCE(pSelf_->pInstances[INSTANCE_5_]);
+    GblInstance*         pReceiver = GBL_INSTANCE(pSelf_->pInstances[INSTANCE_4_]);
+    const GblSignalId    id        = GblSignal_id(pSelf_->types[TYPE_C_B_], "S_2_CB");
+    size_t               emissions = pSelf_->signalEmissions[SIGNAL_2_C_B_];
+    GblVariant           v;
+
+    GBL_CTX_VERIFY_CALL(GblSignal_connectClosure(pEmitter,
+                                                 "S_2_CB",
+                                                 pReceiver,
+                                                 GBL_CLOSURE(GblCClosure_create(GBL_CALLBACK(s_2_CB_Slot_),
+                                                                                (void*)0xcafebabe))));
+
+    // A plain C callback with the signal's own marshal gets called directly
+    GBL_CTX_VERIFY_CALL(GblSignal_emitById(pEmitter, id, 12.0));
+
+    GBL_TEST_COMPARE(pSelf_->signalEmissions[SIGNAL_2_C_B_], emissions + 1);
+    GBL_TEST_COMPARE(pSelf_->signalArgs[SIGNAL_2_C_B_][emissions], 12);
+    GBL_TEST_COMPARE(pSelf_->signalReceivers[SIGNAL_2_C_B_][emissions], INSTANCE_4_);
+    GBL_TEST_COMPARE(pSelf_->pSignalCurrentEmitters[SIGNAL_2_C_B_][emissions], pEmitter);
+    GBL_TEST_COMPARE(pSelf_->pSignalCurrentReceivers[SIGNAL_2_C_B_][emissions], pReceiver);
+    GBL_TEST_COMPARE(pSelf_->pClosureUserdata, (void*)0xcafebabe);
+    GBL_TEST_COMPARE(GblSignal_emitter(), NULL);
+    GBL_TEST_COMPARE(GblClosure_current(), NULL);
+    ++emissions;
+
+    GBL_CTX_VERIFY_CALL(GblVariant_constructDouble(&v, 13.0));
+    GBL_CTX_VERIFY_CALL(GblSignal_emitVariantsById(pEmitter, id, &v));
+    GBL_CTX_VERIFY_CALL(GblVariant_destruct(&v));
+
+    GBL_TEST_COMPARE(pSelf_->signalEmissions[SIGNAL_2_C_B_], emissions + 1);
+    GBL_TEST_COMPARE(pSelf_->signalArgs[SIGNAL_2_C_B_][emissions], 13);
+    ++emissions;
+
+    // A closure with a different marshal is still given boxed arguments, alongside the direct one
+    GblClosure* pClosure = GBL_CLOSURE(GblCClosure_create(GBL_CALLBACK(s_2_CB_Slot_), (void*)0xdeadbeef));
+    GblClosure_setMarshal(pClosure, customMarshal_);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_connectClosure(pEmitter, "S_2_CB", pEmitter, pClosure));
+    GBL_CTX_VERIFY_CALL(GblSignal_emitById(pEmitter, id, 14.0));
+
+    GBL_TEST_COMPARE(pSelf_->signalEmissions[SIGNAL_2_C_B_], emissions + 2);
+    GBL_TEST_COMPARE(pSelf_->signalArgs[SIGNAL_2_C_B_][emissions], 14);
+    GBL_TEST_COMPARE(pSelf_->signalReceivers[SIGNAL_2_C_B_][emissions], INSTANCE_4_);
+    GBL_TEST_COMPARE(pSelf_->signalArgs[SIGNAL_2_C_B_][emissions + 1], 14);
+    GBL_TEST_COMPARE(pSelf_->signalReceivers[SIGNAL_2_C_B_][emissions + 1], INSTANCE_5_);
+    GBL_TEST_COMPARE(pSelf_->pSignalCurrentReceivers[SIGNAL_2_C_B_][emissions + 1], pEmitter);
+    GBL_TEST_COMPARE(pSelf_->pClosureUserdata, (void*)0xdeadbeef);
+
+    GBL_TEST_COMPARE(GblSignal_disconnect(pEmitter, NULL, NULL, NULL), 2);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_profileEmit_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_   = GBL_SIGNAL_TEST_SUITE_(pSelf);
+    GblInstance*         pEmitter = GBL_INSTANCE(pSelf_->pInstances[INSTANCE_5_]);
+    const size_t         counts[] = { 0, 1, 16 };
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(pSelf_->types[TYPE_C_A_],
+                                          "S_Profile",
+                                          GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(pSelf_->types[TYPE_C_A_],
+                                          "S_ProfileBoxed",
+                                          customMarshal_,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    const GblSignalId id      = GblSignal_id(pSelf_->types[TYPE_C_A_], "S_Profile");
+    const GblSignalId boxedId = GblSignal_id(pSelf_->types[TYPE_C_A_], "S_ProfileBoxed");
+
+    for(size_t c = 0; c < GBL_COUNT_OF(counts); ++c) {
+        GblTimer timer;
+        double   boxedMs, nameMs, idMs;
+
+        while(GblSignal_connectionCount(pEmitter, "S_Profile") < counts[c]) {
+            GBL_CTX_VERIFY_CALL(GblSignal_connect(pEmitter, "S_Profile", GBL_CALLBACK(s_Profile_Slot_)));
+            GBL_CTX_VERIFY_CALL(GblSignal_connect(pEmitter, "S_ProfileBoxed", GBL_CALLBACK(s_Profile_Slot_)));
+        }
+
+        pSelf_->profileCount = 0;
+
+        GblTimer_start(&timer);
+        for(size_t e = 0; e < GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_; ++e)
+            GblSignal_emitById(pEmitter, boxedId, 1);
+        GblTimer_stop(&timer);
+        boxedMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t e = 0; e < GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_; ++e)
+            GblSignal_emit(pEmitter, "S_Profile", 1);
+        GblTimer_stop(&timer);
+        nameMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t e = 0; e < GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_; ++e)
+            GblSignal_emitById(pEmitter, id, 1);
+        GblTimer_stop(&timer);
+        idMs = GblTimer_elapsedMs(&timer);
+
+        GBL_TEST_COMPARE(pSelf_->profileCount, 3 * counts[c] * GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_);
+
+        GBL_CTX_INFO("%2zu connections x %d emits: boxed %lf ms, by name %lf ms, by ID %lf ms",
+                     counts[c], GBL_SIGNAL_TEST_SUITE_PROFILE_EMIT_COUNT_, boxedMs, nameMs, idMs);
+    }
+
+    GBL_TEST_COMPARE(GblSignal_disconnect(pEmitter, NULL, NULL, NULL), 32);
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(pSelf_->types[TYPE_C_A_], "S_Profile"));
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(pSelf_->types[TYPE_C_A_], "S_ProfileBoxed"));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_boxEmitter_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_    = GBL_SIGNAL_TEST_SUITE_(pSelf);
+    GblInstance*         pInstance = GBL_INSTANCE(pSelf_->pInstances[INSTANCE_5_]);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(GBL_BOX_TYPE,
+                                          "S_Box",
+                                          GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    GblBox* pBox1 = GblBox_create(GBL_BOX_TYPE);
+    GblBox* pBox2 = GblBox_create(GBL_BOX_TYPE);
+
+    // box emitting to a bare instance, and a bare instance emitting to a box
+    GBL_CTX_VERIFY_CALL(GblSignal_connect(GBL_INSTANCE(pBox1), "S_Box", pInstance, GBL_CALLBACK(s_Any_Slot_), pSelf_));
+    GBL_CTX_VERIFY_CALL(GblSignal_connect(GBL_INSTANCE(pBox1), "S_Box", GBL_INSTANCE(pBox2), GBL_CALLBACK(s_Any_Slot_), pSelf_));
+    GBL_CTX_VERIFY_CALL(GblSignal_connect(pInstance, "S_IA", GBL_INSTANCE(pBox2), GBL_CALLBACK(s_Any_Slot_), pSelf_));
+
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pBox1), "S_Box"), 2);
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pBox2), NULL), 0);
+
+    pSelf_->profileCount = 0;
+    GBL_CTX_VERIFY_CALL(GblSignal_emit(GBL_INSTANCE(pBox1), "S_Box", 3));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 6);
+
+    GBL_TEST_COMPARE(GblSignal_blockAll(GBL_INSTANCE(pBox1), GBL_TRUE), GBL_FALSE);
+    GBL_CTX_VERIFY_CALL(GblSignal_emit(GBL_INSTANCE(pBox1), "S_Box", 3));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 6);
+    GBL_TEST_COMPARE(GblSignal_blockAll(GBL_INSTANCE(pBox1), GBL_FALSE), GBL_TRUE);
+
+    // destroying the box receiver drops its connections from both emitters
+    GBL_TEST_COMPARE(GBL_UNREF(pBox2), 0);
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pBox1), "S_Box"), 1);
+    GBL_TEST_COMPARE(GblSignal_connectionCount(pInstance, "S_IA"), 0);
+
+    // destroying the box emitter drops its connection from the bare receiver
+    GBL_TEST_COMPARE(GBL_UNREF(pBox1), 0);
+    GBL_TEST_COMPARE(GblSignal_disconnect(NULL, NULL, pInstance, NULL), 0);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(GBL_BOX_TYPE, "S_Box"));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_profileEmitters_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_      = GBL_SIGNAL_TEST_SUITE_(pSelf);
+    GblInstance**        ppInstances = GBL_CTX_MALLOC(sizeof(GblInstance*) *
+                                                      GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_);
+    // kept under the 16-bit live instance count of a type, which also applies to the closures
+    const GblType        types[]     = { pSelf_->types[TYPE_C_A_], GBL_BOX_TYPE };
+    const char*          pNames[]    = { "GblInstance", "GblBox" };
+
+    for(size_t t = 0; t < GBL_COUNT_OF(types); ++t) {
+        GblTimer timer;
+        double   connectMs, emitMs, disconnectMs;
+
+        GBL_CTX_VERIFY_CALL(GblSignal_install(types[t],
+                                              "S_Emitters",
+                                              GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                              1,
+                                              GBL_UINT32_TYPE));
+
+        const GblSignalId id = GblSignal_id(types[t], "S_Emitters");
+
+        for(size_t i = 0; i < GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_; ++i)
+            ppInstances[i] = t? GBL_INSTANCE(GblBox_create(types[t])) : GblInstance_create(types[t]);
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_; ++i)
+            GblSignal_connect(ppInstances[i], "S_Emitters", ppInstances[i], GBL_CALLBACK(s_Any_Slot_), pSelf_);
+        GblTimer_stop(&timer);
+        connectMs = GblTimer_elapsedMs(&timer);
+
+        pSelf_->profileCount = 0;
+
+        GblTimer_start(&timer);
+        for(size_t r = 0; r < 10; ++r)
+            for(size_t i = 0; i < GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_; ++i)
+                GblSignal_emitById(ppInstances[i], id, 1);
+        GblTimer_stop(&timer);
+        emitMs = GblTimer_elapsedMs(&timer) / 10;
+
+        GBL_TEST_COMPARE(pSelf_->profileCount, 10 * GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_);
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_; ++i)
+            GblSignal_disconnect(ppInstances[i], "S_Emitters", NULL, NULL);
+        GblTimer_stop(&timer);
+        disconnectMs = GblTimer_elapsedMs(&timer);
+
+        for(size_t i = 0; i < GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_; ++i) {
+            if(t) GBL_UNREF(ppInstances[i]);
+            else  GblInstance_destroy(ppInstances[i]);
+        }
+
+        GBL_CTX_VERIFY_CALL(GblSignal_uninstall(types[t], "S_Emitters"));
+
+        GBL_CTX_INFO("%d %s emitters: connect %lf ms, emit %lf ms, disconnect %lf ms",
+                     GBL_SIGNAL_TEST_SUITE_PROFILE_EMITTERS_, pNames[t], connectMs, emitMs, disconnectMs);
+    }
+
+    GBL_CTX_FREE(ppInstances);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_connectQueuedInvalid_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_    = GBL_SIGNAL_TEST_SUITE_(pSelf);
+    GblInstance*         pInstance = GBL_INSTANCE(pSelf_->pInstances[INSTANCE_1_]);
+    GblMainLoop*         pLoop     = GBL_NEW(GblMainLoop);
+
+    GBL_TEST_EXPECT_ERROR();
+
+    GBL_TEST_COMPARE(GblSignal_connectQueued(pInstance, "S_IA", pInstance, NULL, GBL_CALLBACK(s_Any_Slot_), NULL),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblSignal_connectQueued(pInstance, "S_IA", pInstance, pLoop, NULL, NULL),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblSignal_connectClosureQueued(pInstance, "S_IA", pInstance, pLoop, NULL),
+                     GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_COMPARE(GblSignal_connectQueued(pInstance, "S_Lolol", pInstance, pLoop, GBL_CALLBACK(s_Any_Slot_), NULL),
+                     GBL_RESULT_ERROR_INVALID_HANDLE);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    // failed connections don't hang onto the loop
+    GBL_TEST_COMPARE(GBL_UNREF(pLoop), 0);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_connectQueued_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblSignalTestSuite_* pSelf_ = GBL_SIGNAL_TEST_SUITE_(pSelf);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(GBL_BOX_TYPE,
+                                          "S_Queued",
+                                          GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    GblMainLoop* pLoop     = GBL_NEW(GblMainLoop);
+    GblBox*      pEmitter  = GblBox_create(GBL_BOX_TYPE);
+    GblBox*      pReceiver = GblBox_create(GBL_BOX_TYPE);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_connectQueued(GBL_INSTANCE(pEmitter), "S_Queued", GBL_INSTANCE(pReceiver),
+                                                pLoop, GBL_CALLBACK(s_Any_Slot_), pSelf_));
+    GBL_CTX_VERIFY_CALL(GblSignal_connect(GBL_INSTANCE(pEmitter), "S_Queued", GBL_INSTANCE(pEmitter),
+                                          GBL_CALLBACK(s_Any_Slot_), pSelf_));
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pEmitter), "S_Queued"), 2);
+
+    // direct connections are called right away, queued ones wait on the loop
+    pSelf_->profileCount = 0;
+    GBL_CTX_VERIFY_CALL(GblSignal_emit(GBL_INSTANCE(pEmitter), "S_Queued", 3));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 3);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pLoop), 1);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_emit(GBL_INSTANCE(pEmitter), "S_Queued", 4));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 7);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pLoop), 2);
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_iteration(pLoop));
+    GBL_CTX_VERIFY_CALL(GblMainLoop_iteration(pLoop));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 14);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pLoop), 0);
+
+    // deliveries which are still pending when the connection goes away are dropped
+    GBL_CTX_VERIFY_CALL(GblSignal_emit(GBL_INSTANCE(pEmitter), "S_Queued", 5));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 19);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pLoop), 1);
+
+    GBL_TEST_COMPARE(GBL_UNREF(pReceiver), 0);
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pEmitter), "S_Queued"), 1);
+
+    GBL_CTX_VERIFY_CALL(GblMainLoop_iteration(pLoop));
+    GBL_TEST_COMPARE(pSelf_->profileCount, 19);
+    GBL_TEST_COMPARE(GblMainLoop_depth(pLoop), 0);
+
+    GBL_TEST_COMPARE(GBL_UNREF(pEmitter), 0);
+    GBL_TEST_COMPARE(GBL_UNREF(pLoop), 0);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(GBL_BOX_TYPE, "S_Queued"));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_work_(GblThread* pThread) {
+    SignalWorker_* pWorker   = GblBox_userdata(GBL_BOX(pThread));
+    GblInstance*   pEmitter  = pWorker->pEmitter;
+    GblBox*        pPrivate  = NULL;
+    GblBox*        pReceiver = NULL;
+
+    GBL_CTX_BEGIN(NULL);
+
+    threadReceived_ = 0;
+
+    if(!pEmitter) {
+        pPrivate = GblBox_create(GBL_BOX_TYPE);
+        pEmitter = GBL_INSTANCE(pPrivate);
+        GBL_CTX_VERIFY_CALL(GblSignal_connect(pEmitter, "S_Threads", pEmitter, GBL_CALLBACK(s_Thread_Slot_)));
+    }
+
+    if(pWorker->churn)
+        pReceiver = GblBox_create(GBL_BOX_TYPE);
+
+    for(size_t e = 0; e < pWorker->count; ++e) {
+        if(pReceiver)
+            GBL_CTX_VERIFY_CALL(GblSignal_connect(pEmitter, "S_Threads", GBL_INSTANCE(pReceiver),
+                                                  GBL_CALLBACK(s_Thread_Slot_)));
+
+        GBL_CTX_VERIFY_CALL(GblSignal_emitById(pEmitter, pWorker->id, 1));
+
+        if(pReceiver)
+            GBL_CTX_VERIFY(GblSignal_disconnect(NULL, "S_Threads", GBL_INSTANCE(pReceiver), NULL) == 1,
+                           GBL_RESULT_ERROR_INVALID_OPERATION);
+    }
+
+    GBL_CTX_END_BLOCK();
+
+    pWorker->received = threadReceived_;
+    pWorker->result   = GBL_CTX_RESULT();
+
+    if(pReceiver) GBL_UNREF(pReceiver);
+    if(pPrivate)  GBL_UNREF(pPrivate);
+
+    return GBL_CTX_RESULT();
+}
+
+static GBL_RESULT GblSignalTestSuite_runWorkers_(GblContext*  pCtx,
+                                                 size_t       threads,
+                                                 GblInstance* pShared,
+                                                 size_t       count,
+                                                 GblBool      churn,
+                                                 double*      pMs)
+{
+    GBL_CTX_BEGIN(pCtx);
+
+    SignalWorker_ workers[GBL_SIGNAL_TEST_SUITE_THREADS_];
+    GblThread*    pThreads[GBL_SIGNAL_TEST_SUITE_THREADS_];
+    GblTimer      timer;
+
+    GblTimer_start(&timer);
+
+    for(size_t t = 0; t < threads; ++t) {
+        workers[t] = (SignalWorker_) {
+            .pEmitter = pShared,
+            .id       = GblSignal_id(GBL_BOX_TYPE, "S_Threads"),
+            .count    = count,
+            .churn    = churn
+        };
+
+        pThreads[t] = GblThread_create(GblSignalTestSuite_work_, &workers[t]);
+    }
+
+    for(size_t t = 0; t < threads; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+    }
+
+    GblTimer_stop(&timer);
+
+    // a churning worker also sees whatever the others had connected at the time
+    for(size_t t = 0; t < threads; ++t) {
+        GBL_TEST_COMPARE(workers[t].result, GBL_RESULT_SUCCESS);
+        GBL_TEST_VERIFY(churn? workers[t].received >= count : workers[t].received == count);
+    }
+
+    if(pMs) *pMs = GblTimer_elapsedMs(&timer);
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_emitThreads_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(GBL_BOX_TYPE,
+                                          "S_Threads",
+                                          GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    GblBox* pEmitter = GblBox_create(GBL_BOX_TYPE);
+
+    // every thread connects, emits, and disconnects on the same emitter at once
+    GBL_CTX_VERIFY_CALL(GblSignalTestSuite_runWorkers_(pCtx,
+                                                       GBL_SIGNAL_TEST_SUITE_THREADS_,
+                                                       GBL_INSTANCE(pEmitter),
+                                                       GBL_SIGNAL_TEST_SUITE_THREAD_CHURN_,
+                                                       GBL_TRUE,
+                                                       NULL));
+
+    GBL_TEST_COMPARE(GblSignal_connectionCount(GBL_INSTANCE(pEmitter), "S_Threads"), 0);
+    GBL_TEST_COMPARE(GBL_UNREF(pEmitter), 0);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(GBL_BOX_TYPE, "S_Threads"));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblSignalTestSuite_profileEmitThreads_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_install(GBL_BOX_TYPE,
+                                          "S_Threads",
+                                          GblMarshal_CClosure_VOID__INSTANCE_UINT32,
+                                          1,
+                                          GBL_UINT32_TYPE));
+
+    GblBox* pShared = GblBox_create(GBL_BOX_TYPE);
+    GBL_CTX_VERIFY_CALL(GblSignal_connect(GBL_INSTANCE(pShared), "S_Threads", GBL_INSTANCE(pShared),
+                                          GBL_CALLBACK(s_Thread_Slot_)));
+
+    for(size_t threads = 1; threads <= GBL_SIGNAL_TEST_SUITE_THREADS_; threads *= 2) {
+        double privateMs, sharedMs;
+
+        GBL_CTX_VERIFY_CALL(GblSignalTestSuite_runWorkers_(pCtx, threads, NULL,
+                                                           GBL_SIGNAL_TEST_SUITE_THREAD_EMITS_,
+                                                           GBL_FALSE, &privateMs));
+
+        GBL_CTX_VERIFY_CALL(GblSignalTestSuite_runWorkers_(pCtx, threads, GBL_INSTANCE(pShared),
+                                                           GBL_SIGNAL_TEST_SUITE_THREAD_EMITS_,
+                                                           GBL_FALSE, &sharedMs));
+
+        GBL_CTX_INFO("%zu thread(s) x %d emissions: private emitters %lf ms, shared emitter %lf ms",
+                     threads, GBL_SIGNAL_TEST_SUITE_THREAD_EMITS_, privateMs, sharedMs);
+    }
+
+    GBL_TEST_COMPARE(GBL_UNREF(pShared), 0);
+
+    GBL_CTX_VERIFY_CALL(GblSignal_uninstall(GBL_BOX_TYPE, "S_Threads"));
+
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblSignalTestSuite_uninstallInvalid_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_UNUSED(pSelf);
     GBL_CTX_BEGIN(pCtx);
@@ -1047,6 +1601,16 @@ GBL_EXPORT GblType GblSignalTestSuite_type(void) {
         { "blockAllBeforeConnecting",   GblSignalTestSuite_blockAllBeforeConnecting_},
         { "disconnectInvalid",          GblSignalTestSuite_disconnectInvalid_       },
         { "disconnect",                 GblSignalTestSuite_disconnect_              },
+        { "id",                         GblSignalTestSuite_id_                      },
+        { "emitByIdInvalid",            GblSignalTestSuite_emitByIdInvalid_         },
+        { "emitById",                   GblSignalTestSuite_emitById_                },
+        { "profileEmit",                GblSignalTestSuite_profileEmit_             },
+        { "boxEmitter",                 GblSignalTestSuite_boxEmitter_              },
+        { "profileEmitters",            GblSignalTestSuite_profileEmitters_         },
+        { "connectQueuedInvalid",       GblSignalTestSuite_connectQueuedInvalid_    },
+        { "connectQueued",              GblSignalTestSuite_connectQueued_           },
+        { "emitThreads",                GblSignalTestSuite_emitThreads_             },
+        { "profileEmitThreads",         GblSignalTestSuite_profileEmitThreads_      },
         { "uninstallInvalid",           GblSignalTestSuite_uninstallInvalid_        },
         { "uninstall",                  GblSignalTestSuite_uninstall_               },
         { NULL,                         NULL                                        }
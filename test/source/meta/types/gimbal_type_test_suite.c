@@ -5,9 +5,23 @@
 #include <gimbal/strings/gimbal_quark.h>
 #include <gimbal/meta/classes/gimbal_class.h>
 #include <gimbal/meta/ifaces/gimbal_interface.h>
+#include <gimbal/meta/ifaces/gimbal_ivariant.h>
+#include <gimbal/core/gimbal_thread.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_TYPE_TEST_SUITE_(inst)  (GBL_PRIVATE(GblTypeTestSuite, inst))
 
+#define GBL_TYPE_TEST_SUITE_FIND_PROFILE_ITERATIONS_    100000
+#define GBL_TYPE_TEST_SUITE_FIND_PROFILE_THREADS_       4
+#define GBL_TYPE_TEST_SUITE_IS_A_PROFILE_DEPTH_         32
+#define GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_    100000
+
+typedef struct GblTypeTestSuiteFindProfile_ {
+    GblQuark names[GBL_TYPE_BUILTIN_COUNT];
+    GblType  types[GBL_TYPE_BUILTIN_COUNT];
+    size_t   misses;
+} GblTypeTestSuiteFindProfile_;
+
 typedef struct GblTypeTestSuite_ {
     GblType blankType;
     GblType derivable;
@@ -878,6 +892,146 @@ static GBL_RESULT GblTypeTestSuite_fundamental_dependent_derive_depends_dependen
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblTypeTestSuite_findProfileRun_(GblThread* pThread) {
+    GblTypeTestSuiteFindProfile_* pProfile = GblBox_userdata(GBL_BOX(pThread));
+
+    for(size_t i = 0; i < GBL_TYPE_TEST_SUITE_FIND_PROFILE_ITERATIONS_; ++i) {
+        const size_t t = i % GBL_TYPE_BUILTIN_COUNT;
+
+        if(GblType_findQuark(pProfile->names[t]) != pProfile->types[t])
+            ++pProfile->misses;
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+static GBL_RESULT GblTypeTestSuite_findProfileThreads_(GblContext* pCtx, size_t threadCount) {
+    GBL_CTX_BEGIN(pCtx);
+
+    GblTypeTestSuiteFindProfile_ profiles[GBL_TYPE_TEST_SUITE_FIND_PROFILE_THREADS_];
+    GblThread*                   pThreads[GBL_TYPE_TEST_SUITE_FIND_PROFILE_THREADS_];
+    GblTimer                     timer;
+
+    for(size_t p = 0; p < threadCount; ++p) {
+        for(size_t t = 0; t < GBL_TYPE_BUILTIN_COUNT; ++t) {
+            profiles[p].types[t] = GblType_fromBuiltinIndex(t);
+            profiles[p].names[t] = GblType_nameQuark(profiles[p].types[t]);
+        }
+
+        profiles[p].misses = 0;
+    }
+
+    GblTimer_start(&timer);
+
+    for(size_t p = 0; p < threadCount; ++p)
+        pThreads[p] = GblThread_create(GblTypeTestSuite_findProfileRun_, &profiles[p]);
+
+    for(size_t p = 0; p < threadCount; ++p) {
+        GblThread_join(pThreads[p]);
+        GblThread_unref(pThreads[p]);
+    }
+
+    GblTimer_stop(&timer);
+
+    for(size_t p = 0; p < threadCount; ++p)
+        GBL_TEST_COMPARE(profiles[p].misses, 0);
+
+    GBL_CTX_INFO("%u lookups on each of %zu thread(s): %lf ms",
+                 GBL_TYPE_TEST_SUITE_FIND_PROFILE_ITERATIONS_,
+                 threadCount,
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblTypeTestSuite_findProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblQuark names[GBL_TYPE_BUILTIN_COUNT];
+    GblType  types[GBL_TYPE_BUILTIN_COUNT];
+
+    for(size_t t = 0; t < GBL_TYPE_BUILTIN_COUNT; ++t) {
+        types[t] = GblType_fromBuiltinIndex(t);
+        names[t] = GblType_nameQuark(types[t]);
+    }
+
+    for(size_t i = 0; i < GBL_TYPE_TEST_SUITE_FIND_PROFILE_ITERATIONS_; ++i) {
+        const size_t t = i % GBL_TYPE_BUILTIN_COUNT;
+        GBL_TEST_COMPARE(GblType_findQuark(names[t]), types[t]);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblTypeTestSuite_findThreadedProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    GBL_CTX_VERIFY_CALL(GblTypeTestSuite_findProfileThreads_(pCtx, 1));
+    GBL_CTX_VERIFY_CALL(GblTypeTestSuite_findProfileThreads_(pCtx, GBL_TYPE_TEST_SUITE_FIND_PROFILE_THREADS_));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblTypeTestSuite_isAProfile_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+
+    static const GblTypeInfo info = {
+        .classSize    = sizeof(GblObjectClass),
+        .instanceSize = sizeof(GblObject)
+    };
+
+    GblType types[GBL_TYPE_TEST_SUITE_IS_A_PROFILE_DEPTH_];
+    GblType parent = GBL_OBJECT_TYPE;
+
+    for(size_t d = 0; d < GBL_TYPE_TEST_SUITE_IS_A_PROFILE_DEPTH_; ++d) {
+        char name[32];
+        snprintf(name, sizeof(name), "IsAProfile%u", (unsigned)d);
+
+        types[d] = parent = GblType_register(name, parent, &info, GBL_TYPE_FLAG_TYPEINFO_STATIC);
+        GBL_CTX_VERIFY_LAST_RECORD();
+    }
+
+    const GblType deepest = types[GBL_TYPE_TEST_SUITE_IS_A_PROFILE_DEPTH_-1];
+    size_t        hits    = 0;
+    GblTimer      timer;
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_; ++i)
+        hits += GblType_derives(deepest, GBL_INSTANCE_TYPE);
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("derives: %zu calls at depth %zu: %lf ms",
+                 (size_t)GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_,
+                 GblType_depth(deepest),
+                 GblTimer_elapsedMs(&timer));
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_; ++i)
+        hits += GblType_maps(deepest, GBL_IVARIANT_TYPE);
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("maps:    %zu calls at depth %zu: %lf ms",
+                 (size_t)GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_,
+                 GblType_depth(deepest),
+                 GblTimer_elapsedMs(&timer));
+
+    GblTimer_start(&timer);
+    for(size_t i = 0; i < GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_; ++i)
+        hits += !GblType_check(deepest, GBL_THREAD_TYPE);
+    GblTimer_stop(&timer);
+    GBL_CTX_INFO("check:   %zu misses at depth %zu: %lf ms",
+                 (size_t)GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_,
+                 GblType_depth(deepest),
+                 GblTimer_elapsedMs(&timer));
+
+    GBL_TEST_COMPARE(hits, GBL_TYPE_TEST_SUITE_IS_A_PROFILE_ITERATIONS_ * 3);
+
+    for(size_t d = GBL_TYPE_TEST_SUITE_IS_A_PROFILE_DEPTH_; d > 0; --d)
+        GBL_CTX_VERIFY_CALL(GblType_unregister(types[d-1]));
+
+    GBL_CTX_END();
+}
 
 GBL_EXPORT GblType GblTypeTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
@@ -910,6 +1064,9 @@ GBL_EXPORT GblType GblTypeTestSuite_type(void) {
         { "dependent",                              GblTypeTestSuite_fundamental_dependent_register_valid_                  },
         { "dependentDependsDependent",              GblTypeTestSuite_fundamental_dependent_depends_dependent_valid_         },
         { "dependentDeriveDependsDependent",        GblTypeTestSuite_fundamental_dependent_derive_depends_dependent_valid_  },
+        { "findProfile",                            GblTypeTestSuite_findProfile_                                           },
+        { "findThreadedProfile",                    GblTypeTestSuite_findThreadedProfile_                                   },
+        { "isAProfile",                             GblTypeTestSuite_isAProfile_                                            },
         { NULL,                                     NULL                                                                    }
     };
 
@@ -2,8 +2,11 @@
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/core/gimbal_ctx.h>
 #include <gimbal/meta/types/gimbal_variant.h>
+#include <gimbal/utils/gimbal_timer.h>
 #include <string.h>
 
+#define GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_    10000
+
 static GBL_RESULT GblVariantTestSuite_checkTypeCompatible_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GBL_TEST_VERIFY(GblVariant_checkTypeCompatible(GBL_INVALID_TYPE));
@@ -2426,6 +2429,126 @@ static GBL_RESULT GblVariantTestSuite_to_(GblTestSuite* pSuite, GblContext* pCtx
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblVariantTestSuite_converterCacheConv_(const GblVariant* pSelf, GblVariant* pOther) {
+    GBL_UNUSED(pSelf);
+    return GblVariant_setFloat(pOther, 42.0f);
+}
+
+static GBL_RESULT GblVariantTestSuite_converterCache_(GblTestSuite* pSuite, GblContext* pCtx) {
+    GBL_UNUSED(pSuite);
+    GBL_CTX_BEGIN(pCtx);
+
+    GBL_VARIANT(from);
+    GBL_VARIANT(to);
+
+    GBL_CTX_VERIFY_CALL(GblVariant_constructDefault(&from, GBL_POINTER_TYPE));
+    GBL_CTX_VERIFY_CALL(GblVariant_constructFloat(&to, 0.0f));
+
+    // Resolve and cache the lack of a converter
+    GBL_TEST_VERIFY(!GblVariant_canConvert(GBL_POINTER_TYPE, GBL_FLOAT_TYPE));
+    GBL_TEST_VERIFY(!GblVariant_canConvert(GBL_POINTER_TYPE, GBL_FLOAT_TYPE));
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblVariant_convert(&from, &to), GBL_RESULT_ERROR_INVALID_CONVERSION);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    // Registering has to invalidate the cached miss
+    const size_t count = GblVariant_converterCount();
+    GBL_CTX_VERIFY_CALL(GblVariant_registerConverter(GBL_POINTER_TYPE,
+                                                     GBL_FLOAT_TYPE,
+                                                     GblVariantTestSuite_converterCacheConv_));
+    GBL_TEST_COMPARE(GblVariant_converterCount(), count + 1);
+    GBL_TEST_VERIFY(GblVariant_canConvert(GBL_POINTER_TYPE, GBL_FLOAT_TYPE));
+    GBL_CTX_VERIFY_CALL(GblVariant_convert(&from, &to));
+    GBL_TEST_COMPARE(GblVariant_getFloat(&to), 42.0f);
+
+    // As does unregistering the cached hit
+    GBL_CTX_VERIFY_CALL(GblVariant_unregisterConverter(GBL_POINTER_TYPE, GBL_FLOAT_TYPE));
+    GBL_TEST_COMPARE(GblVariant_converterCount(), count);
+    GBL_TEST_VERIFY(!GblVariant_canConvert(GBL_POINTER_TYPE, GBL_FLOAT_TYPE));
+
+    // Compatible types are cached as copies
+    GBL_TEST_VERIFY(GblVariant_canConvert(GBL_FLOAT_TYPE, GBL_FLOAT_TYPE));
+    GBL_CTX_VERIFY_CALL(GblVariant_setFloat(&from, 7.0f));
+    GBL_CTX_VERIFY_CALL(GblVariant_convert(&from, &to));
+    GBL_TEST_COMPARE(GblVariant_getFloat(&to), 7.0f);
+
+    GBL_CTX_VERIFY_CALL(GblVariant_destruct(&from));
+    GBL_CTX_VERIFY_CALL(GblVariant_destruct(&to));
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblVariantTestSuite_profileConversions_(GblTestSuite* pSuite, GblContext* pCtx) {
+    GBL_UNUSED(pSuite);
+    GBL_CTX_BEGIN(pCtx);
+
+    GblVariant sources[4];
+    GBL_CTX_VERIFY_CALL(GblVariant_constructUint8(&sources[0], 17));
+    GBL_CTX_VERIFY_CALL(GblVariant_constructUint32(&sources[1], 17));
+    GBL_CTX_VERIFY_CALL(GblVariant_constructDouble(&sources[2], 17.0));
+    GBL_CTX_VERIFY_CALL(GblVariant_constructString(&sources[3], "17"));
+
+    for(size_t s = 0; s < GBL_COUNT_OF(sources); ++s) {
+        GBL_VARIANT(v);
+        GblTimer timer;
+        double   lookupMs, stringMs, int32Ms, floatMs;
+        size_t   lookups = 0;
+        int32_t  i32Sum  = 0;
+        float    f32Sum = 0.0f;
+
+        GBL_CTX_VERIFY_CALL(GblVariant_constructCopy(&v, &sources[s]));
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_; ++i) {
+            lookups += GblVariant_canConvert(GblVariant_typeOf(&sources[s]), GBL_STRING_TYPE);
+            lookups += GblVariant_canConvert(GblVariant_typeOf(&sources[s]), GBL_INT32_TYPE);
+            lookups += GblVariant_canConvert(GblVariant_typeOf(&sources[s]), GBL_FLOAT_TYPE);
+        }
+        GblTimer_stop(&timer);
+        lookupMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_; ++i) {
+            GblVariant_setCopy(&v, &sources[s]);
+            GblVariant_toString(&v);
+        }
+        GblTimer_stop(&timer);
+        stringMs = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_; ++i) {
+            GblVariant_setCopy(&v, &sources[s]);
+            i32Sum += GblVariant_toInt32(&v);
+        }
+        GblTimer_stop(&timer);
+        int32Ms = GblTimer_elapsedMs(&timer);
+
+        GblTimer_start(&timer);
+        for(size_t i = 0; i < GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_; ++i) {
+            GblVariant_setCopy(&v, &sources[s]);
+            f32Sum += GblVariant_toFloat(&v);
+        }
+        GblTimer_stop(&timer);
+        floatMs = GblTimer_elapsedMs(&timer);
+
+        GBL_CTX_VERIFY_LAST_RECORD();
+        GBL_TEST_COMPARE(lookups, 3 * GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_);
+        GBL_TEST_VERIFY(i32Sum > 0 && f32Sum > 0.0f);
+
+        GBL_CTX_INFO("%-6s x %d: canConvert x3 %lf ms, toString %lf ms, toInt32 %lf ms, toFloat %lf ms",
+                     GblType_name(GblVariant_typeOf(&sources[s])),
+                     GBL_VARIANT_TEST_SUITE_PROFILE_CONVERSION_COUNT_,
+                     lookupMs, stringMs, int32Ms, floatMs);
+
+        GBL_CTX_VERIFY_CALL(GblVariant_destruct(&v));
+    }
+
+    for(size_t s = 0; s < GBL_COUNT_OF(sources); ++s)
+        GBL_CTX_VERIFY_CALL(GblVariant_destruct(&sources[s]));
+
+    GBL_CTX_END();
+}
+
 
 GBL_EXPORT GblType GblVariantTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
@@ -2469,6 +2592,8 @@ GBL_EXPORT GblType GblVariantTestSuite_type(void) {
         { "typeName",               GblVariantTestSuite_typeName_                   },
         { "toInvalid",              GblVariantTestSuite_to_invalid_                 },
         { "to",                     GblVariantTestSuite_to_                         },
+        { "converterCache",         GblVariantTestSuite_converterCache_             },
+        { "profileConversions",     GblVariantTestSuite_profileConversions_         },
         { NULL,                     NULL                                            }
     };
 
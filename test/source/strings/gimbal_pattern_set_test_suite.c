@@ -0,0 +1,243 @@
+#include "strings/gimbal_pattern_set_test_suite.h"
+#include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/strings/gimbal_pattern_set.h>
+#include <gimbal/utils/gimbal_timer.h>
+
+#define GBL_SELF_TYPE GblPatternSetTestSuite
+
+#define GBL_PATTERN_SET_TEST_SUITE_PROFILE_SIZE_    (1024 * 1024)
+#define GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_     8
+
+GBL_TEST_FIXTURE {
+    GblPatternSet* pSet;
+};
+
+typedef struct GblPatternSetTestMatches_ {
+    size_t count;
+    size_t patterns[GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_];
+    size_t offsets[GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_];
+    size_t lengths[GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_];
+    const char* pString;
+} GblPatternSetTestMatches_;
+
+static GblBool GblPatternSetTestSuite_collect_(const GblPatternSet* pSet,
+                                               size_t               pattern,
+                                               GblStringView        match,
+                                               void*                pClosure)
+{
+    GBL_UNUSED(pSet);
+    GblPatternSetTestMatches_* pMatches = pClosure;
+
+    pMatches->patterns[pMatches->count] = pattern;
+    pMatches->offsets[pMatches->count]  = match.pData - pMatches->pString;
+    pMatches->lengths[pMatches->count]  = match.length;
+
+    return ++pMatches->count == GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_;
+}
+
+// Scans pString with pSet, returning whether it matched exactly the given (pattern, offset, length) triples
+static GblBool GblPatternSetTestSuite_verify_(const GblPatternSet* pSet,
+                                              const char*          pString,
+                                              size_t               count,
+                                              const size_t*        pExpected)
+{
+    GblPatternSetTestMatches_ matches = { .pString = pString };
+
+    if(GblPatternSet_scan(pSet, GBL_STRV(pString), GblPatternSetTestSuite_collect_, &matches) != count ||
+       matches.count != count)
+        return GBL_FALSE;
+
+    for(size_t m = 0; m < count; ++m)
+        if(matches.patterns[m] != pExpected[m * 3]     ||
+           matches.offsets[m]  != pExpected[m * 3 + 1] ||
+           matches.lengths[m]  != pExpected[m * 3 + 2])
+            return GBL_FALSE;
+
+    return GBL_TRUE;
+}
+
+GBL_TEST_INIT()
+GBL_TEST_CASE_END
+
+GBL_TEST_FINAL()
+    GBL_TEST_COMPARE(GblPatternSet_unref(pFixture->pSet), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(createInvalid)
+    const char* pInvalid[] = { "[0-9]+", "x*", "a{", "^$", "b?c?" };
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblPatternSet_create(NULL, 1), NULL);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_POINTER);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblPatternSet_create(pInvalid, 0), NULL);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+    GBL_CTX_CLEAR_LAST_RECORD();
+
+    // every set containing a pattern which is malformed or matches an empty string
+    for(size_t p = 1; p < GBL_COUNT_OF(pInvalid); ++p) {
+        const char* pPatterns[] = { pInvalid[0], pInvalid[p] };
+
+        GBL_TEST_EXPECT_ERROR();
+        GBL_TEST_COMPARE(GblPatternSet_create(pPatterns, 2), NULL);
+        GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+        GBL_CTX_CLEAR_LAST_RECORD();
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(create)
+    const char* pPatterns[] = { "[0-9]+", "[a-z]+" };
+
+    pFixture->pSet = GblPatternSet_create(pPatterns, GBL_COUNT_OF(pPatterns));
+
+    GBL_TEST_VERIFY(pFixture->pSet);
+    GBL_TEST_COMPARE(GblPatternSet_refCount(pFixture->pSet), 1);
+    GBL_TEST_COMPARE(GblPatternSet_patternCount(pFixture->pSet), 2);
+    GBL_TEST_COMPARE(GblPattern_string(GblPatternSet_pattern(pFixture->pSet, 0)), "[0-9]+");
+    GBL_TEST_COMPARE(GblPattern_string(GblPatternSet_pattern(pFixture->pSet, 1)), "[a-z]+");
+    GBL_TEST_VERIFY(GblPatternSet_stateCount(pFixture->pSet));
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_COMPARE(GblPatternSet_pattern(pFixture->pSet, 2), NULL);
+    GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_OUT_OF_RANGE);
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(ref)
+    GBL_TEST_COMPARE(GblPatternSet_ref(pFixture->pSet), pFixture->pSet);
+    GBL_TEST_COMPARE(GblPatternSet_refCount(pFixture->pSet), 2);
+    GBL_TEST_COMPARE(GblPatternSet_unref(pFixture->pSet), 1);
+    GBL_TEST_COMPARE(GblPatternSet_refCount(pFixture->pSet), 1);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(findNone)
+    GblStringView match;
+    size_t        pattern;
+
+    GBL_TEST_VERIFY(!GblPatternSet_find(NULL, GBL_STRV("abc")));
+    GBL_TEST_VERIFY(!GblPatternSet_find(pFixture->pSet, GBL_STRV("")));
+    GBL_TEST_VERIFY(!GblPatternSet_find(pFixture->pSet, GBL_STRV("!@ #$"), &match, &pattern));
+    GBL_TEST_VERIFY(GblStringView_empty(match));
+    GBL_TEST_COMPARE(GblPatternSet_matchCount(pFixture->pSet, GBL_STRV("!@ #$")), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(find)
+    GblStringView match;
+    size_t        pattern;
+
+    GBL_TEST_VERIFY(GblPatternSet_find(pFixture->pSet, GBL_STRV("  42abc")));
+    GBL_TEST_VERIFY(GblPatternSet_find(pFixture->pSet, GBL_STRV("  42abc"), &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("42")));
+    GBL_TEST_VERIFY(GblPatternSet_find(pFixture->pSet, GBL_STRV("--xyz7"), &match, &pattern));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("xyz")));
+    GBL_TEST_COMPARE(pattern, 1);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(scan)
+    const size_t expected[] = {
+        1,  0, 3,   // abc
+        0,  4, 3,   // 123
+        1,  8, 1,   // x
+        0,  9, 1,   // 9
+        1, 11, 3    // end
+    };
+
+    GBL_TEST_VERIFY(GblPatternSetTestSuite_verify_(pFixture->pSet, "abc 123 x9 end", 5, expected));
+    GBL_TEST_COMPARE(GblPatternSet_matchCount(pFixture->pSet, GBL_STRV("abc 123 x9 end")), 5);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(scanStop)
+    GblPatternSetTestMatches_ matches = { .pString = "a1b2c3d4e5f6g7h8i9j0" };
+
+    GBL_TEST_COMPARE(GblPatternSet_scan(pFixture->pSet,
+                                        GBL_STRV(matches.pString),
+                                        GblPatternSetTestSuite_collect_,
+                                        &matches),
+                     GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_);
+    GBL_TEST_COMPARE(matches.count, GBL_PATTERN_SET_TEST_SUITE_MATCHES_MAX_);
+    GBL_TEST_COMPARE(GblPatternSet_matchCount(pFixture->pSet, GBL_STRV(matches.pString)), 20);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(scanAnchors)
+    const char*    pPatterns[]  = { "^ab", "cd$", "b" };
+    GblPatternSet* pSet         = GblPatternSet_create(pPatterns, GBL_COUNT_OF(pPatterns));
+    const size_t   anchored[]   = { 0, 0, 2,   2, 3, 1,   1, 4, 2 };
+    const size_t   unanchored[] = { 2, 2, 1,   2, 4, 1 };
+
+    GBL_TEST_VERIFY(pSet);
+    GBL_TEST_VERIFY(GblPatternSetTestSuite_verify_(pSet, "abcbcd", 3, anchored));
+    GBL_TEST_VERIFY(GblPatternSetTestSuite_verify_(pSet, "xabcbcdx", 2, unanchored));
+    GBL_TEST_COMPARE(GblPatternSet_unref(pSet), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(scanRepetition)
+    const char*    pPatterns[] = { "a{2,3}", "\\d\\d?", "a.*b" };
+    GblPatternSet* pSet        = GblPatternSet_create(pPatterns, GBL_COUNT_OF(pPatterns));
+    const size_t   counted[]   = { 0, 0, 3,   0, 3, 3,   1, 8, 2,   1, 10, 2 };
+    const size_t   greedy[]    = { 2, 2, 5,   2, 10, 2 };
+
+    GBL_TEST_VERIFY(pSet);
+    GBL_TEST_VERIFY(GblPatternSetTestSuite_verify_(pSet, "aaaaaaa 1234", 4, counted));
+    // '.' doesn't cross lines, and the longest match is taken on each
+    GBL_TEST_VERIFY(GblPatternSetTestSuite_verify_(pSet, "xxaxbxbxx\nab", 2, greedy));
+    GBL_TEST_COMPARE(GblPatternSet_unref(pSet), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(profileScan)
+    static const char* pWords[] = {
+        "INFO", "request", "served", "in", "12ms", "WARNING", "slow", "query",
+        "ERROR", "timeout", "user", "alice", "192.168.0.1", "GET", "/index.html", "200"
+    };
+    const char* pPatterns[] = {
+        "ERROR", "WARN[A-Z]*", "[0-9]+ms", "\\d+\\.\\d+\\.\\d+\\.\\d+", "/[a-z]+\\.html",
+        "timeout", "GET", "user", "alice", "query"
+    };
+
+    char*    pBuffer = GBL_CTX_MALLOC(GBL_PATTERN_SET_TEST_SUITE_PROFILE_SIZE_ + 32);
+    size_t   length  = 0;
+    size_t   words   = 0;
+    size_t   errors  = 0;   // words matched by the first pattern
+    size_t   hits    = 0;   // words matched by any pattern
+    GblTimer timer;
+
+    while(length < GBL_PATTERN_SET_TEST_SUITE_PROFILE_SIZE_) {
+        length += sprintf(&pBuffer[length], "%s%c", pWords[words % 16], words % 11? ' ' : '\n');
+        errors += words % 16 == 8;
+        hits   += words % 16 >= 4 && words % 16 <= 14 && words % 16 != 6;
+        ++words;
+    }
+
+    for(size_t count = 1; count <= GBL_COUNT_OF(pPatterns); count += GBL_COUNT_OF(pPatterns) - 1) {
+        GblPatternSet* pSet = GblPatternSet_create(pPatterns, count);
+        GBL_TEST_VERIFY(pSet);
+
+        GblTimer_start(&timer);
+        const size_t matches = GblPatternSet_matchCount(pSet, GblStringView_fromStringSized(pBuffer, length));
+        GblTimer_stop(&timer);
+
+        GBL_TEST_COMPARE(matches, count == 1? errors : hits);
+        GBL_CTX_INFO("scan: %zu patterns, %zu states, %zu bytes, %zu matches, %.2lf MB/s",
+                     count,
+                     GblPatternSet_stateCount(pSet),
+                     length,
+                     matches,
+                     length / (GblTimer_elapsedMs(&timer) * 1000.0));
+
+        GBL_TEST_COMPARE(GblPatternSet_unref(pSet), 0);
+    }
+
+    GBL_CTX_FREE(pBuffer);
+GBL_TEST_CASE_END
+
+GBL_TEST_REGISTER(createInvalid,
+                  create,
+                  ref,
+                  findNone,
+                  find,
+                  scan,
+                  scanStop,
+                  scanAnchors,
+                  scanRepetition,
+                  profileScan)
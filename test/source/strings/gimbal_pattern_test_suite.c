@@ -1,17 +1,23 @@
 #include "strings/gimbal_pattern_test_suite.h"
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/strings/gimbal_pattern.h>
+#include <gimbal/core/gimbal_thread.h>
 
 #define GBL_SELF_TYPE GblPatternTestSuite
 
+#define GBL_PATTERN_TEST_SUITE_THREADS_     4
+#define GBL_PATTERN_TEST_SUITE_ITERATIONS_  2000
+#define GBL_PATTERN_TEST_SUITE_LONG_LENGTH_ 70000
+
 GBL_TEST_FIXTURE {
-    const GblPattern* pPattern;
+    GblPattern* pPattern;
 };
 
 GBL_TEST_INIT()
 GBL_TEST_CASE_END
 
 GBL_TEST_FINAL()
+    GBL_TEST_COMPARE(GblPattern_unref(pFixture->pPattern), 0);
 GBL_TEST_CASE_END
 
 GBL_TEST_CASE(compileInvalid)
@@ -19,7 +25,43 @@ GBL_TEST_CASE(compileInvalid)
 GBL_TEST_CASE_END
 
 GBL_TEST_CASE(compile)
-    pFixture->pPattern = GblPattern_compile("[0-9]{8}");
+    const GblPattern* pPattern = GblPattern_compile("[a-z]+");
+
+    // borrowed rather than owned, so there's nothing to unref
+    GBL_TEST_VERIFY(pPattern);
+    GBL_TEST_COMPARE(GblPattern_string(pPattern), "[a-z]+");
+    GBL_TEST_VERIFY(GblPattern_matchExact(pPattern, "abc"));
+    GBL_TEST_COMPARE(GblPattern_compile("[a-z]+"), pPattern);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(createInvalid)
+    const char* pInvalid[] = {
+        "*abc", "a**", "a+?", "^+", "{2}", "a{", "a{x}",
+        "a{2", "a{3,2}", "a{,2}", "abc\\", "[abc", "[^", "[a\\",
+        "a{65535}", "a{1,65535}"
+    };
+
+    for(size_t p = 0; p < GBL_COUNT_OF(pInvalid); ++p) {
+        GBL_TEST_EXPECT_ERROR();
+        GBL_TEST_COMPARE(GblPattern_create(pInvalid[p]), NULL);
+        GBL_TEST_COMPARE(GBL_CTX_LAST_RESULT(), GBL_RESULT_ERROR_INVALID_ARG);
+        GBL_CTX_CLEAR_LAST_RECORD();
+    }
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(create)
+    pFixture->pPattern = GblPattern_create("[0-9]{8}");
+
+    GBL_TEST_VERIFY(pFixture->pPattern);
+    GBL_TEST_COMPARE(GblPattern_refCount(pFixture->pPattern), 1);
+    GBL_TEST_COMPARE(GblPattern_string(pFixture->pPattern), "[0-9]{8}");
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(ref)
+    GBL_TEST_COMPARE(GblPattern_ref(pFixture->pPattern), pFixture->pPattern);
+    GBL_TEST_COMPARE(GblPattern_refCount(pFixture->pPattern), 2);
+    GBL_TEST_COMPARE(GblPattern_unref(pFixture->pPattern), 1);
+    GBL_TEST_COMPARE(GblPattern_refCount(pFixture->pPattern), 1);
 GBL_TEST_CASE_END
 
 GBL_TEST_CASE(matchInvalid)
@@ -190,8 +232,140 @@ GBL_TEST_CASE(matchNotLast)
     GBL_TEST_COMPARE(count, 3);
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(matchSemantics)
+    GblStringView match;
+
+    // '?' prefers matching nothing
+    GBL_TEST_VERIFY(GblPattern_matchStr("ab?", "abb", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("a")));
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("ab?c", "abc"));
+
+    // '*', '+', and {n,m} are greedy, but backtrack
+    GBL_TEST_VERIFY(GblPattern_matchStr("a.*b", "xxaxbxbxx", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("axbxb")));
+    GBL_TEST_VERIFY(GblPattern_matchStr("[0-9]{2,3}5", "123456", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("2345")));
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("a{2,}", "aaaa"));
+    GBL_TEST_VERIFY(!GblPattern_matchExactStr("a{2,3}", "aaaa"));
+
+    // '.' doesn't match line endings
+    GBL_TEST_VERIFY(GblPattern_matchStr("a.+", "abc\ndef", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("abc")));
+
+    // anchors only apply at either end of the expression
+    GBL_TEST_VERIFY(!GblPattern_matchStr("^bc", "abc"));
+    GBL_TEST_VERIFY(GblPattern_matchStr("bc$", "abc"));
+    GBL_TEST_VERIFY(!GblPattern_matchStr("bc$", "abcd"));
+    GBL_TEST_VERIFY(!GblPattern_matchStr("a$b", "a$b"));
+
+    // escapes and classes
+    GBL_TEST_VERIFY(GblPattern_matchStr("\\d+\\.\\d+", "pi=3.14;", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("3.14")));
+    GBL_TEST_VERIFY(GblPattern_matchStr("[^\\s]+", "  word  ", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("word")));
+    GBL_TEST_VERIFY(GblPattern_matchStr("\\W\\w", "..a", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV(".a")));
+    GBL_TEST_VERIFY(GblPattern_matchStr("[-x]+", "ab-x-c", &match));
+    GBL_TEST_VERIFY(GblStringView_equals(match, GBL_STRV("-x-")));
+
+    // matching nothing at the very end of the string isn't a match
+    GBL_TEST_VERIFY(!GblPattern_matchStr("x*", ""));
+    GBL_TEST_COMPARE(GblPattern_matchCountStr("b+", "abbab"), 2);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(matchLongPattern)
+    // more tokens and character class text than the old engine's fixed-size buffers could hold
+    const char* pRegExp = "^[a-z][a-z][a-z][a-z][a-z]-[0-9][0-9][0-9][0-9][0-9]-"
+                          "[a-z][a-z][a-z][a-z][a-z]-[0-9][0-9][0-9][0-9][0-9]-"
+                          "[abcdefghijklmnopqrstuvwxyz0123456789]+$";
+    GblPattern* pPattern = GblPattern_create(pRegExp);
+
+    GBL_TEST_VERIFY(pPattern);
+    GBL_TEST_VERIFY(GblPattern_matchExact(pPattern, "abcde-12345-fghij-67890-xyz42"));
+    GBL_TEST_VERIFY(!GblPattern_matchExact(pPattern, "abcde-12345-fghij-6789-xyz42"));
+    GBL_TEST_COMPARE(GblPattern_unref(pPattern), 0);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(matchLongString)
+    // longer than the highest explicit repetition count, which '*' and '+' aren't limited to
+    char* pString = GBL_CTX_MALLOC(GBL_PATTERN_TEST_SUITE_LONG_LENGTH_ + 2);
+    memset(pString, 'a', GBL_PATTERN_TEST_SUITE_LONG_LENGTH_);
+    pString[GBL_PATTERN_TEST_SUITE_LONG_LENGTH_] = '\0';
+
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("a*", pString));
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("^a+$", pString));
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("a{2,}", pString));
+    GBL_TEST_COMPARE(GblPattern_matchCountStr("a+", pString), 1);
+
+    pString[GBL_PATTERN_TEST_SUITE_LONG_LENGTH_]     = 'b';
+    pString[GBL_PATTERN_TEST_SUITE_LONG_LENGTH_ + 1] = '\0';
+
+    GBL_TEST_VERIFY(GblPattern_matchExactStr("a*b", pString));
+    GBL_TEST_VERIFY(!GblPattern_matchExactStr("a+", pString));
+
+    GBL_CTX_FREE(pString);
+GBL_TEST_CASE_END
+
+GBL_TEST_CASE(matchStrCache)
+    char regExp[32];
+    char string[32];
+
+    // cycle through more expressions than the cache holds, more than once
+    for(unsigned r = 0; r < 3; ++r) {
+        for(unsigned p = 0; p < 40; ++p) {
+            snprintf(regExp, sizeof(regExp), "x%u[0-9]+", p);
+            snprintf(string, sizeof(string), "abcx%u%u", p, r);
+            GBL_TEST_VERIFY(GblPattern_matchStr(regExp, string));
+            snprintf(string, sizeof(string), "abcx%u", p + 1);
+            GBL_TEST_VERIFY(!GblPattern_matchExactStr(regExp, string));
+        }
+    }
+
+    GBL_TEST_EXPECT_ERROR();
+    GBL_TEST_VERIFY(!GblPattern_matchStr("a{", "a{"));
+    GBL_CTX_CLEAR_LAST_RECORD();
+GBL_TEST_CASE_END
+
+static GBL_RESULT matchStrThreadRun_(GblThread* pThread) {
+    size_t* pErrors = GblBox_userdata(GBL_BOX(pThread));
+    char    regExp[16];
+    char    expected[16];
+    char    string[32];
+
+    for(unsigned i = 0; i < GBL_PATTERN_TEST_SUITE_ITERATIONS_; ++i) {
+        GblStringView match;
+
+        snprintf(regExp,   sizeof(regExp),   "k%u=[0-9]+", i % 24);
+        snprintf(expected, sizeof(expected), "k%u=%u", i % 24, i);
+        snprintf(string,   sizeof(string),   "a %s b", expected);
+
+        if(!GblPattern_matchStr(regExp, string, &match) ||
+           !GblStringView_equals(match, GblStringView_fromString(expected)))
+            ++*pErrors;
+    }
+
+    return GBL_RESULT_SUCCESS;
+}
+
+GBL_TEST_CASE(matchStrThreaded)
+    size_t     errors[GBL_PATTERN_TEST_SUITE_THREADS_] = { 0 };
+    GblThread* pThreads[GBL_PATTERN_TEST_SUITE_THREADS_];
+
+    for(size_t t = 0; t < GBL_PATTERN_TEST_SUITE_THREADS_; ++t)
+        pThreads[t] = GblThread_create(matchStrThreadRun_, &errors[t]);
+
+    for(size_t t = 0; t < GBL_PATTERN_TEST_SUITE_THREADS_; ++t) {
+        GblThread_join(pThreads[t]);
+        GblThread_unref(pThreads[t]);
+        GBL_TEST_COMPARE(errors[t], 0);
+    }
+GBL_TEST_CASE_END
+
 GBL_TEST_REGISTER(compileInvalid,
                   compile,
+                  createInvalid,
+                  create,
+                  ref,
                   matchInvalid,
                   matchNone,
                   matchDefaultMatchDefaultCount,
@@ -203,7 +377,12 @@ GBL_TEST_REGISTER(compileInvalid,
                   matchNotDefaultMatchDefaultCount,
                   matchNotDefaultCount,
                   matchNot,
-                  matchNotLast)
+                  matchNotLast,
+                  matchSemantics,
+                  matchLongPattern,
+                  matchLongString,
+                  matchStrCache,
+                  matchStrThreaded)
 #if 0
 
 GBL_TEST_CASE(iso8601BasicDate)
@@ -2,8 +2,11 @@
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/core/gimbal_ctx.h>
 #include <gimbal/strings/gimbal_quark.h>
+#include <tinycthread.h>
 
 #define GBL_QUARK_TEST_SUITE_(inst)     (GBL_PRIVATE(GblQuarkTestSuite, inst))
+#define GBL_QUARK_TEST_SUITE_THREADS_   4
+#define GBL_QUARK_TEST_SUITE_STRINGS_   256
 
 typedef struct GblQuarkTestSuite_ {
     GblQuark    staticString;
@@ -157,6 +160,27 @@ static GBL_RESULT GblQuarkTestSuite_extraPage_(GblTestSuite* pSelf, GblContext*
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblQuarkTestSuite_sizedSubstring_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblQuarkTestSuite_* pSelf_  = GBL_QUARK_TEST_SUITE_(pSelf);
+    const char          buffer[] = "xxStringStaticStringSizedString";
+    const size_t        bytes    = GblQuark_bytesUsed();
+
+    // existing strings are found within a larger buffer without being interned again
+    GBL_TEST_COMPARE(GblQuark_fromStringSized(&buffer[2], 6),  pSelf_->string);
+    GBL_TEST_COMPARE(GblQuark_fromStringSized(&buffer[8], 12), pSelf_->staticString);
+    GBL_TEST_COMPARE(GblQuark_tryStringSized(&buffer[20], 11), pSelf_->sizedString);
+    GBL_TEST_COMPARE(GblQuark_tryStringSized(&buffer[20], 10), GBL_QUARK_INVALID);
+
+    // sized strings stop at an embedded terminator, like the C strings they become
+    GBL_TEST_COMPARE(GblQuark_fromStringSized("String\0Sized", 12), pSelf_->string);
+    GBL_TEST_COMPARE(GblQuark_tryStringSized("SizedString\0xx", 14), pSelf_->sizedString);
+
+    GBL_TEST_COMPARE(GblQuark_bytesUsed(), bytes);
+    GBL_TEST_COMPARE(GblQuark_count(), pSelf_->quarkStartCount + 5);
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblQuarkTestSuite_toString_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_CTX_BEGIN(pCtx);
     GblQuarkTestSuite_* pSelf_  = GBL_QUARK_TEST_SUITE_(pSelf);
@@ -202,6 +226,54 @@ static GBL_RESULT GblQuarkTestSuite_internStringStatic_(GblTestSuite* pSelf, Gbl
     GBL_CTX_END();
 }
 
+static GblQuark threadQuarks_[GBL_QUARK_TEST_SUITE_THREADS_][GBL_QUARK_TEST_SUITE_STRINGS_];
+
+static int GblQuarkTestSuite_threadRun_(void* pClosure) {
+    GblQuark*    pQuarks = pClosure;
+    const size_t thread  = (pQuarks - threadQuarks_[0]) / GBL_QUARK_TEST_SUITE_STRINGS_;
+    char         buffer[32];
+
+    // every thread interns the same strings, starting from a different one
+    for(size_t s = 0; s < GBL_QUARK_TEST_SUITE_STRINGS_; ++s) {
+        const size_t index = (s + thread * GBL_QUARK_TEST_SUITE_STRINGS_ / GBL_QUARK_TEST_SUITE_THREADS_)
+                             % GBL_QUARK_TEST_SUITE_STRINGS_;
+
+        snprintf(buffer, sizeof(buffer), "ThreadedString%zu", index);
+        pQuarks[index] = GblQuark_fromString(buffer);
+
+        if(GblQuark_tryString(buffer) != pQuarks[index])
+            pQuarks[index] = GBL_QUARK_INVALID;
+    }
+
+    return 0;
+}
+
+static GBL_RESULT GblQuarkTestSuite_fromStringThreaded_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_CTX_BEGIN(pCtx);
+    GblQuarkTestSuite_* pSelf_  = GBL_QUARK_TEST_SUITE_(pSelf);
+    thrd_t              threads[GBL_QUARK_TEST_SUITE_THREADS_];
+
+    // raw threads, so nothing but the strings under test can be interned while counting quarks below
+    for(size_t t = 0; t < GBL_QUARK_TEST_SUITE_THREADS_; ++t)
+        GBL_TEST_COMPARE(thrd_create(&threads[t], GblQuarkTestSuite_threadRun_, threadQuarks_[t]), thrd_success);
+
+    for(size_t t = 0; t < GBL_QUARK_TEST_SUITE_THREADS_; ++t)
+        thrd_join(threads[t], NULL);
+
+    for(size_t s = 0; s < GBL_QUARK_TEST_SUITE_STRINGS_; ++s) {
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "ThreadedString%zu", s);
+
+        GBL_TEST_COMPARE(GblQuark_toString(threadQuarks_[0][s]), buffer);
+
+        for(size_t t = 1; t < GBL_QUARK_TEST_SUITE_THREADS_; ++t)
+            GBL_TEST_COMPARE(threadQuarks_[t][s], threadQuarks_[0][s]);
+    }
+
+    GBL_TEST_COMPARE(GblQuark_count(), pSelf_->quarkStartCount + 8 + GBL_QUARK_TEST_SUITE_STRINGS_);
+    GBL_CTX_END();
+}
+
 GBL_EXPORT GblType GblQuarkTestSuite_type(void) {
     static GblType type = GBL_INVALID_TYPE;
 
@@ -212,10 +284,12 @@ GBL_EXPORT GblType GblQuarkTestSuite_type(void) {
         { "tryString",          GblQuarkTestSuite_tryString_            },
         { "tryStringSized",     GblQuarkTestSuite_tryStringSized_       },
         { "extraPage",          GblQuarkTestSuite_extraPage_            },
+        { "sizedSubstring",     GblQuarkTestSuite_sizedSubstring_       },
         { "toString",           GblQuarkTestSuite_toString_             },
         { "internString",       GblQuarkTestSuite_internString_         },
         { "internStringSized",  GblQuarkTestSuite_internStringSized_    },
         { "internStringStatic", GblQuarkTestSuite_internStringStatic_   },
+        { "fromStringThreaded", GblQuarkTestSuite_fromStringThreaded_   },
         { NULL,                 NULL                                    }
     };
 
@@ -1,8 +1,17 @@
 #include <gimbal/core/gimbal_ctx.h>
 #include <gimbal/strings/gimbal_string_view.h>
 #include <gimbal/test/gimbal_test_macros.h>
+#include <gimbal/utils/gimbal_timer.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <errno.h>
+#include <float.h>
+#include <math.h>
 #include "strings/gimbal_string_view_test_suite.h"
 
+#define GBL_STRING_VIEW_TEST_SUITE_FUZZ_ROUNDS_     2000
+#define GBL_STRING_VIEW_TEST_SUITE_PROFILE_SIZES_   3
+
 
 static GBL_RESULT GblStringViewTestSuite_fromEmpty_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_UNUSED(pSelf);
@@ -710,6 +719,153 @@ static GBL_RESULT GblStringViewTestSuite_findLastNotOf_(GblTestSuite* pSelf, Gbl
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblStringViewTestSuite_findSlice_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    // views over the front of a larger buffer, which must never match past their end
+    const GblStringView slice = GblStringView_fromStringSized("lolzlolz", 5);
+    GBL_TEST_VERIFY(!slice.nullTerminated);
+    GBL_TEST_COMPARE(GblStringView_find(slice, GBL_STRV("lz"), 0), 2);
+    GBL_TEST_COMPARE(GblStringView_find(slice, GBL_STRV("zlo"), 0), GBL_STRING_VIEW_NPOS);
+    GBL_TEST_COMPARE(GblStringView_find(slice, GBL_STRV("l"), 3), 4);
+    GBL_TEST_COMPARE(GblStringView_rfind(slice, GBL_STRV("lo"), GBL_STRING_VIEW_NPOS), 0);
+    GBL_TEST_COMPARE(GblStringView_count(slice, GBL_STRV("l")), 3);
+    GBL_TEST_VERIFY(!GblStringView_contains(slice, GBL_STRV("zlo")));
+    GBL_TEST_COMPARE(GblStringView_findFirstOf(slice, GBL_STRV("z"), 4), GBL_STRING_VIEW_NPOS);
+    GBL_TEST_COMPARE(GblStringView_findFirstNotOf(slice, GBL_STRV("l"), 4), GBL_STRING_VIEW_NPOS);
+    GBL_TEST_COMPARE(GblStringView_findFirstNotOf(slice, GBL_STRV("lo"), 1), 3);
+
+    // embedded NULL characters are just another byte
+    const GblStringView binary = GblStringView_fromStringSized("ab\0cd\0cd", 8);
+    GBL_TEST_COMPARE(GblStringView_find(binary, GblStringView_fromStringSized("\0cd", 3), 3), 5);
+    GBL_TEST_COMPARE(GblStringView_rfind(binary, GblStringView_fromStringSized("\0c", 2), GBL_STRING_VIEW_NPOS), 5);
+    GBL_TEST_COMPARE(GblStringView_findLastOf(binary, GblStringView_fromStringSized("\0x", 2), 4), 2);
+    GBL_CTX_END();
+}
+
+static size_t GblStringViewTestSuite_naiveFind_(GblStringView self, GblStringView substr, size_t offset) {
+    for(size_t i = offset; i + substr.length <= self.length; ++i)
+        if(memcmp(self.pData + i, substr.pData, substr.length) == 0)
+            return i;
+    return GBL_STRING_VIEW_NPOS;
+}
+
+static size_t GblStringViewTestSuite_naiveRfind_(GblStringView self, GblStringView substr, size_t end) {
+    for(size_t i = end + 1; i >= substr.length && i > 0; --i)
+        if(memcmp(self.pData + i - substr.length, substr.pData, substr.length) == 0)
+            return i - substr.length;
+    return GBL_STRING_VIEW_NPOS;
+}
+
+static size_t GblStringViewTestSuite_naiveScan_(GblStringView self, GblStringView chars, size_t i, int step, GblBool in) {
+    for(; i < self.length; i += step)
+        if((memchr(chars.pData, self.pData[i], chars.length) != NULL) == in)
+            return i;
+    return GBL_STRING_VIEW_NPOS;
+}
+
+static GBL_RESULT GblStringViewTestSuite_findFuzz_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    char     buffer[96];
+    uint32_t seed = 0x2545f491;
+
+    // small alphabets, so there are plenty of partial matches straddling each block boundary
+    for(size_t r = 0; r < GBL_STRING_VIEW_TEST_SUITE_FUZZ_ROUNDS_; ++r) {
+        const size_t length    = 1 + r % (sizeof(buffer) - 1);
+        const size_t subLength = 1 + r % 7;
+        const size_t offset    = r % length;
+
+        for(size_t c = 0; c < sizeof(buffer); ++c) {
+            seed = seed * 1664525u + 1013904223u;
+            buffer[c] = (char)('a' + (seed >> 24) % 3);
+        }
+
+        const GblStringView self   = GblStringView_fromStringSized(buffer, length);
+        const GblStringView substr = GblStringView_fromStringSized(buffer + length - subLength / 2,
+                                                                   subLength);
+
+        GBL_TEST_COMPARE(GblStringView_find(self, substr, offset),
+                         GblStringViewTestSuite_naiveFind_(self, substr, offset));
+        GBL_TEST_COMPARE(GblStringView_rfind(self, substr, offset),
+                         GblStringViewTestSuite_naiveRfind_(self, substr, offset));
+        GBL_TEST_COMPARE(GblStringView_findFirstOf(self, GblStringView_fromStringSized(substr.pData, 2), offset),
+                         GblStringViewTestSuite_naiveScan_(self, GblStringView_fromStringSized(substr.pData, 2), offset, 1, GBL_TRUE));
+        GBL_TEST_COMPARE(GblStringView_findFirstNotOf(self, GblStringView_fromStringSized(substr.pData, 2), offset),
+                         GblStringViewTestSuite_naiveScan_(self, GblStringView_fromStringSized(substr.pData, 2), offset, 1, GBL_FALSE));
+        GBL_TEST_COMPARE(GblStringView_findLastOf(self, GblStringView_fromStringSized(substr.pData, 2), offset),
+                         GblStringViewTestSuite_naiveScan_(self, GblStringView_fromStringSized(substr.pData, 2), offset, -1, GBL_TRUE));
+        GBL_TEST_COMPARE(GblStringView_findLastNotOf(self, GblStringView_fromStringSized(substr.pData, 2), offset),
+                         GblStringViewTestSuite_naiveScan_(self, GblStringView_fromStringSized(substr.pData, 2), offset, -1, GBL_FALSE));
+
+        // too many characters to compare directly, so these go through the lookup table
+        const GblStringView wide = GBL_STRV("bcdefghijklmnopqrstuvwxyz");
+        GBL_TEST_COMPARE(GblStringView_findFirstNotOf(self, wide, offset),
+                         GblStringViewTestSuite_naiveScan_(self, wide, offset, 1, GBL_FALSE));
+        GBL_TEST_COMPARE(GblStringView_findLastOf(self, wide, offset),
+                         GblStringViewTestSuite_naiveScan_(self, wide, offset, -1, GBL_TRUE));
+
+        size_t count = 0;
+        for(size_t pos = 0; (pos = GblStringViewTestSuite_naiveFind_(self, substr, pos)) != GBL_STRING_VIEW_NPOS; pos += substr.length)
+            ++count;
+        GBL_TEST_COMPARE(GblStringView_count(self, substr), count);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblStringViewTestSuite_profileFind_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    static const size_t sizes[GBL_STRING_VIEW_TEST_SUITE_PROFILE_SIZES_] = { 1024, 64 * 1024, 1024 * 1024 };
+    const size_t        maxSize = sizes[GBL_STRING_VIEW_TEST_SUITE_PROFILE_SIZES_ - 1];
+    char*               pBuffer = GBL_CTX_MALLOC(maxSize + 1);
+    GblTimer            timer;
+
+    // text with lots of near-misses, and the only full match at the very end
+    for(size_t c = 0; c < maxSize; ++c)
+        pBuffer[c] = "the quick brown fox jumps over the lazy dog "[c % 44];
+    pBuffer[maxSize] = '\0';
+
+    const GblStringView needle = GBL_STRV("the lazy cat");
+
+    for(size_t s = 0; s < GBL_STRING_VIEW_TEST_SUITE_PROFILE_SIZES_; ++s) {
+        // slice off the terminator, so the view isn't NULL-terminated
+        const GblStringView self = GblStringView_fromStringSized(pBuffer, sizes[s] - 1);
+        memcpy(pBuffer + sizes[s] - 1 - needle.length, needle.pData, needle.length);
+
+        GblTimer_start(&timer);
+        GBL_TEST_COMPARE(GblStringView_find(self, needle, 0), sizes[s] - 1 - needle.length);
+        GblTimer_stop(&timer);
+        const double find = GblTimer_elapsedUs(&timer);
+
+        GblTimer_start(&timer);
+        GBL_TEST_COMPARE(GblStringView_rfind(self, GBL_STRV("the quick fox"), GBL_STRING_VIEW_NPOS), GBL_STRING_VIEW_NPOS);
+        GblTimer_stop(&timer);
+        const double rfind = GblTimer_elapsedUs(&timer);
+
+        GblTimer_start(&timer);
+        GBL_TEST_VERIFY(GblStringView_count(self, GBL_STRV("lazy")) > 0);
+        GblTimer_stop(&timer);
+        const double count = GblTimer_elapsedUs(&timer);
+
+        GblTimer_start(&timer);
+        GBL_TEST_COMPARE(GblStringView_findFirstOf(self, GBL_STRV("0123456789"), 0), GBL_STRING_VIEW_NPOS);
+        GblTimer_stop(&timer);
+        const double firstOf = GblTimer_elapsedUs(&timer);
+
+        GBL_CTX_INFO("[%7zu bytes] find: %8.2lf us, rfind: %8.2lf us, count: %8.2lf us, findFirstOf: %8.2lf us",
+                     sizes[s], find, rfind, count, firstOf);
+
+        memcpy(pBuffer + sizes[s] - 1 - needle.length,
+               pBuffer + (sizes[s] - 1 - needle.length) % 44,
+               needle.length);
+    }
+
+    GBL_CTX_FREE(pBuffer);
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblStringViewTestSuite_quark_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_UNUSED(pSelf);
     GBL_CTX_BEGIN(pCtx);
@@ -863,6 +1019,258 @@ static GBL_RESULT GblStringViewTestSuite_toPointer_(GblTestSuite* pSelf, GblCont
     GBL_CTX_END();
 }
 
+static GBL_RESULT GblStringViewTestSuite_toPointerWide_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblBool success;
+
+    GBL_TEST_COMPARE(GblStringView_toPointer(GBL_STRV("0XABCDEF"), &success), (void*)0xabcdef);
+    GBL_TEST_VERIFY(success);
+#ifdef GBL_64BIT
+    // used to be truncated to 32 bits
+    GBL_TEST_COMPARE(GblStringView_toPointer(GBL_STRV("0x7fffdeadbeef"), &success), (void*)0x7fffdeadbeef);
+    GBL_TEST_VERIFY(success);
+#endif
+    GblStringView_toPointer(GBL_STRV("0x10000000000000000"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toPointer(GBL_STRV("0xdeadbeefzz"), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblStringViewTestSuite_toIntLimits_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblBool success;
+
+    GBL_TEST_COMPARE(GblStringView_toUint8(GBL_STRV("255"), &success), 255);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toUint8(GBL_STRV("256"), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_TEST_COMPARE(GblStringView_toInt16(GBL_STRV("-32768"), &success), INT16_MIN);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toInt16(GBL_STRV("-32769"), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_TEST_COMPARE(GblStringView_toInt64(GBL_STRV("-9223372036854775808"), &success), INT64_MIN);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toInt64(GBL_STRV("9223372036854775808"), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_TEST_COMPARE(GblStringView_toUint64(GBL_STRV("18446744073709551615"), &success), UINT64_MAX);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toUint64(GBL_STRV("18446744073709551616"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toUint64(GBL_STRV("99999999999999999999"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toUint32(GBL_STRV("-1"), &success);
+    GBL_TEST_VERIFY(!success);
+
+    // same prefixes as strtol() with a base of 0
+    GBL_TEST_COMPARE(GblStringView_toUint32(GBL_STRV("0xDeadBeef"), &success), 0xdeadbeef);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toInt32(GBL_STRV(" \t-0777"), &success), -0777);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toInt32(GBL_STRV("+0"), &success), 0);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toInt32(GBL_STRV("08"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toInt32(GBL_STRV("0x"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toInt32(GBL_STRV("12 "), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toInt32(GBL_STRV("-"), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblStringViewTestSuite_toNumberSlice_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblBool             success;
+    const GblStringView csv = GBL_STRV("12345678901,-2.5e-3,0x7f,1.5f");
+
+    // none of these slices are NULL-terminated, the rest of the line must be ignored
+    GBL_TEST_COMPARE(GblStringView_toInt64(GblStringView_substr(csv, 0, 11), &success), 12345678901);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toInt32(GblStringView_substr(csv, 0, 4), &success), 1234);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GblStringView_substr(csv, 12, 7), &success), -2.5e-3);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toFloat(GblStringView_substr(csv, 12, 4), &success), -2.5f);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toUint8(GblStringView_substr(csv, 20, 4), &success), 0x7f);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_COMPARE(GblStringView_toFloat(GblStringView_substr(csv, 25, 3), &success), 1.5f);
+    GBL_TEST_VERIFY(success);
+    GblStringView_toFloat(GblStringView_substr(csv, 25, 4), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblStringViewTestSuite_toDoubleRounding_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    GblBool success;
+
+    // halfway between two doubles, which rounds to even
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("9007199254740993")), 9007199254740992.0);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("9007199254740995")), 9007199254740996.0);
+    GBL_TEST_COMPARE(GblStringView_toFloat(GBL_STRV("16777217")), 16777216.0f);
+
+    // beyond the range of the fast paths
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("1.7976931348623157e308")), DBL_MAX);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("2.2250738585072014e-308")), DBL_MIN);
+    GBL_TEST_COMPARE(GblStringView_toFloat(GBL_STRV("3.4028234664e38")), FLT_MAX);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("0.1000000000000000000000000001")), 0.1);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("0.00000000000000000000000000001234")), 1.234e-29);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("0x1.8p1")), 3.0);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV("-0e999")), -0.0);
+
+    GblStringView_toDouble(GBL_STRV("1e309"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toFloat(GBL_STRV("1e39"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toDouble(GBL_STRV("1e"), &success);
+    GBL_TEST_VERIFY(!success);
+    GblStringView_toDouble(GBL_STRV("."), &success);
+    GBL_TEST_VERIFY(!success);
+    GBL_TEST_COMPARE(GblStringView_toDouble(GBL_STRV(" .5"), &success), 0.5);
+    GBL_TEST_VERIFY(success);
+    GBL_TEST_VERIFY(isinf(GblStringView_toDouble(GBL_STRV("-Infinity"), &success)));
+    GBL_TEST_VERIFY(success);
+    GBL_CTX_END();
+}
+
+static uint32_t GblStringViewTestSuite_random_(uint32_t* pSeed) {
+    *pSeed = *pSeed * 1664525u + 1013904223u;
+    return *pSeed >> 8;
+}
+
+static GBL_RESULT GblStringViewTestSuite_toNumberFuzz_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    char     buffer[64];
+    uint32_t seed = 0x5eed1234;
+
+    // must agree with the C library on every random number, both in value and validity
+    for(size_t r = 0; r < GBL_STRING_VIEW_TEST_SUITE_FUZZ_ROUNDS_ * 10; ++r) {
+        size_t length = 0;
+
+        if(GblStringViewTestSuite_random_(&seed) % 4 == 0)
+            buffer[length++] = "-+ "[GblStringViewTestSuite_random_(&seed) % 3];
+
+        for(size_t d = GblStringViewTestSuite_random_(&seed) % 22; d; --d)
+            buffer[length++] = (char)('0' + GblStringViewTestSuite_random_(&seed) % 10);
+
+        if(GblStringViewTestSuite_random_(&seed) % 2) {
+            buffer[length++] = '.';
+            for(size_t d = GblStringViewTestSuite_random_(&seed) % 22; d; --d)
+                buffer[length++] = (char)('0' + GblStringViewTestSuite_random_(&seed) % 10);
+        }
+
+        if(GblStringViewTestSuite_random_(&seed) % 3 == 0)
+            length += (size_t)snprintf(buffer + length, sizeof(buffer) - length, "e%d",
+                                       (int)(GblStringViewTestSuite_random_(&seed) % 800) - 400);
+
+        buffer[length] = '\0';
+        if(!length) continue;
+
+        char* pEnd;
+        errno = 0;
+        const double    expectedDouble      = strtod(buffer, &pEnd);
+        const GblBool   expectedDoubleValid = pEnd == buffer + length && !errno;
+        errno = 0;
+        const float     expectedFloat       = strtof(buffer, &pEnd);
+        const GblBool   expectedFloatValid  = pEnd == buffer + length && !errno;
+        errno = 0;
+        const long long expectedInt         = strtoll(buffer, &pEnd, 0);
+        const GblBool   expectedIntValid    = pEnd == buffer + length && !errno;
+
+        // parse it as a slice, without the terminator
+        buffer[length] = ',';
+        const GblStringView view = GblStringView_fromStringSized(buffer, length);
+        GblBool success;
+
+        const double actualDouble = GblStringView_toDouble(view, &success);
+        GBL_TEST_COMPARE(success, expectedDoubleValid);
+        if(success) GBL_TEST_VERIFY(memcmp(&actualDouble, &expectedDouble, sizeof(double)) == 0);
+
+        const float actualFloat = GblStringView_toFloat(view, &success);
+        GBL_TEST_COMPARE(success, expectedFloatValid);
+        if(success) GBL_TEST_VERIFY(memcmp(&actualFloat, &expectedFloat, sizeof(float)) == 0);
+
+        const int64_t actualInt = GblStringView_toInt64(view, &success);
+        GBL_TEST_COMPARE(success, expectedIntValid);
+        if(success) GBL_TEST_COMPARE(actualInt, (int64_t)expectedInt);
+    }
+
+    GBL_CTX_END();
+}
+
+static GBL_RESULT GblStringViewTestSuite_profileToNumber_(GblTestSuite* pSelf, GblContext* pCtx) {
+    GBL_UNUSED(pSelf);
+    GBL_CTX_BEGIN(pCtx);
+    enum { count = 10000 };
+    char*          pBuffer = GBL_CTX_MALLOC(count * 24);
+    GblStringView* pViews  = GBL_CTX_MALLOC(sizeof(GblStringView) * count);
+    uint32_t       seed    = 0xcafe;
+    GblTimer       timer;
+    char*          pIt;
+    double         sum;
+
+    // comma-separated, so that none of the numbers are NULL-terminated
+    pIt = pBuffer;
+    for(size_t n = 0; n < count; ++n) {
+        const int length = sprintf(pIt, "%d", (int)GblStringViewTestSuite_random_(&seed) - (1 << 23));
+        pViews[n] = GblStringView_fromStringSized(pIt, length);
+        pIt[length] = ',';
+        pIt += length + 1;
+    }
+
+    GblTimer_start(&timer);
+    sum = 0;
+    for(size_t n = 0; n < count; ++n)
+        sum += GblStringView_toInt32(pViews[n]);
+    GblTimer_stop(&timer);
+    const double toInt32 = GblTimer_elapsedUs(&timer);
+
+    GblTimer_start(&timer);
+    for(size_t n = 0; n < count; ++n)
+        sum -= strtol(GBL_STRING_VIEW_CSTR(pViews[n]), NULL, 0);
+    GblTimer_stop(&timer);
+    const double strtolUs = GblTimer_elapsedUs(&timer);
+    GBL_TEST_COMPARE(sum, 0.0);
+
+    pIt = pBuffer;
+    for(size_t n = 0; n < count; ++n) {
+        const int length = sprintf(pIt, "%.*g", 3 + (int)(n % 15),
+                                   (double)GblStringViewTestSuite_random_(&seed) / 977.0);
+        pViews[n] = GblStringView_fromStringSized(pIt, length);
+        pIt[length] = ',';
+        pIt += length + 1;
+    }
+
+    GblTimer_start(&timer);
+    sum = 0;
+    for(size_t n = 0; n < count; ++n)
+        sum += GblStringView_toDouble(pViews[n]);
+    GblTimer_stop(&timer);
+    const double toDouble = GblTimer_elapsedUs(&timer);
+
+    GblTimer_start(&timer);
+    for(size_t n = 0; n < count; ++n)
+        sum -= strtod(GBL_STRING_VIEW_CSTR(pViews[n]), NULL);
+    GblTimer_stop(&timer);
+    const double strtodUs = GblTimer_elapsedUs(&timer);
+    GBL_TEST_VERIFY(fabs(sum) < 1e-3);
+
+    GBL_CTX_INFO("[%d numbers] toInt32: %8.2lf us, strtol: %8.2lf us, toDouble: %8.2lf us, strtod: %8.2lf us",
+                 count, toInt32, strtolUs, toDouble, strtodUs);
+
+    GBL_CTX_FREE(pViews);
+    GBL_CTX_FREE(pBuffer);
+    GBL_CTX_END();
+}
+
 static GBL_RESULT GblStringViewTestSuite_scanf_(GblTestSuite* pSelf, GblContext* pCtx) {
     GBL_UNUSED(pSelf);
     GBL_CTX_BEGIN(pCtx);
@@ -925,6 +1333,9 @@ GBL_EXPORT GblType GblStringViewTestSuite_type(void) {
         { "findLastOf",             GblStringViewTestSuite_findLastOf_              },
         { "findLastNotOfInvalid",   GblStringViewTestSuite_findLastNotOf_invalid_   },
         { "findLastNotOf",          GblStringViewTestSuite_findLastNotOf_           },
+        { "findSlice",              GblStringViewTestSuite_findSlice_               },
+        { "findFuzz",               GblStringViewTestSuite_findFuzz_                },
+        { "profileFind",            GblStringViewTestSuite_profileFind_             },
         { "quark",                  GblStringViewTestSuite_quark_                   },
         { "quarkTry",               GblStringViewTestSuite_quarkTry_                },
         { "intern",                 GblStringViewTestSuite_intern_                  },
@@ -938,6 +1349,12 @@ GBL_EXPORT GblType GblStringViewTestSuite_type(void) {
         { "toDouble",               GblStringViewTestSuite_toDouble_                },
         { "toPointerInvalid",       GblStringViewTestSuite_toPointer_invalid_       },
         { "toPointer",              GblStringViewTestSuite_toPointer_               },
+        { "toPointerWide",          GblStringViewTestSuite_toPointerWide_           },
+        { "toIntLimits",            GblStringViewTestSuite_toIntLimits_             },
+        { "toNumberSlice",          GblStringViewTestSuite_toNumberSlice_           },
+        { "toDoubleRounding",       GblStringViewTestSuite_toDoubleRounding_        },
+        { "toNumberFuzz",           GblStringViewTestSuite_toNumberFuzz_            },
+        { "profileToNumber",        GblStringViewTestSuite_profileToNumber_         },
         { "scanf",                  GblStringViewTestSuite_scanf_                   },
         { NULL,                     NULL                                            }
     };
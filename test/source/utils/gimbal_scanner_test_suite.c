@@ -1,9 +1,12 @@
 #include "utils/gimbal_scanner_test_suite.h"
 #include <gimbal/test/gimbal_test_macros.h>
 #include <gimbal/utils/gimbal_scanner.h>
+#include <gimbal/utils/gimbal_timer.h>
 
 #define GBL_SELF_TYPE GblScannerTestSuite
 
+#define GBL_SCANNER_TEST_SUITE_PROFILE_SIZE_    (1024 * 1024)
+
 GBL_TEST_FIXTURE {
     size_t      refCount;
     GblScanner* pEmptyScanner;
@@ -379,6 +382,48 @@ GBL_TEST_CASE(scanBytes)
     GBL_TEST_COMPARE(pFixture->pScanner->status, GBL_SCANNER_EOF);
 GBL_TEST_CASE_END
 
+GBL_TEST_CASE(profileScan)
+    static const char* pWords[] = {
+        "alpha", "beta42", "gamma_ray", "3.14159",
+        "x", "delta", "epsilon", "0xdeadbeef"
+    };
+
+    char*    pBuffer = GBL_CTX_MALLOC(GBL_SCANNER_TEST_SUITE_PROFILE_SIZE_ + 16);
+    size_t   length  = 0;
+    size_t   words   = 0;
+    size_t   tokens  = 0;
+    GblTimer timer;
+
+    while(length < GBL_SCANNER_TEST_SUITE_PROFILE_SIZE_) {
+        length += sprintf(&pBuffer[length], "%s%c", pWords[words % 8], words % 7? ' ' : '\n');
+        ++words;
+    }
+
+    GblScanner* pScanner = GblScanner_create(pBuffer, length);
+
+    GblTimer_start(&timer);
+    while(GblScanner_scanToken(pScanner))
+        ++tokens;
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(tokens, words);
+    GBL_CTX_INFO("scanToken: %zu bytes, %zu tokens, %.2lf ms", length, tokens, GblTimer_elapsedMs(&timer));
+
+    GblScanner_setInput(pScanner, pBuffer, length);
+    tokens = 0;
+
+    GblTimer_start(&timer);
+    while(GblScanner_scanMatch(pScanner, "[^ \n]+"))
+        ++tokens;
+    GblTimer_stop(&timer);
+
+    GBL_TEST_COMPARE(tokens, words);
+    GBL_CTX_INFO("scanMatch: %zu bytes, %zu tokens, %.2lf ms", length, tokens, GblTimer_elapsedMs(&timer));
+
+    GblScanner_unref(pScanner);
+    GBL_CTX_FREE(pBuffer);
+GBL_TEST_CASE_END
+
 GBL_TEST_CASE(unref)
     GblScanner_unref(pFixture->pEmptyScanner);
     GBL_UNREF(pFixture->pScanner);
@@ -420,4 +465,5 @@ GBL_TEST_REGISTER(createEmpty,
                   scanLines,
                   peekBytesInvalid,
                   scanBytesInvalid,
+                  profileScan,
                   unref)